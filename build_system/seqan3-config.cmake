@@ -26,10 +26,12 @@
 #
 #   ZLIB      -- zlib compression library
 #   BZip2     -- libbz2 compression library
+#   ZSTD      -- libzstd compression library
+#   libdeflate -- fast (de)compression of BGZF blocks (requires ZLIB)
 #   Cereal    -- Serialisation library
 #
 # If you don't wish for these to be detected (and used), you may define SEQAN3_NO_ZLIB,
-# SEQAN3_NO_BZIP2, and SEQAN3_NO_CEREAL respectively.
+# SEQAN3_NO_BZIP2, SEQAN3_NO_ZSTD, SEQAN3_NO_LIBDEFLATE, and SEQAN3_NO_CEREAL respectively.
 #
 # If you wish to require the presence of ZLIB or BZip2, just check for the module before
 # finding SeqAn3, e.g. "find_package (ZLIB REQUIRED)" and "find_package (BZip2 REQUIRED)".
@@ -183,10 +185,12 @@ elseif (SEQAN3_NO_CEREAL)
     set (SEQAN3_DEFINITIONS ${SEQAN3_DEFINITIONS} "-DSEQAN3_WITH_CEREAL=0")
 endif ()
 
-# These two are "opt-in", because detected by CMake
+# These three are "opt-in", because detected by CMake
 # If you want to force-require these, just do find_package (zlib REQUIRED) before find_package (seqan3)
 option (SEQAN3_NO_ZLIB "Don't use ZLIB, even if present." OFF)
 option (SEQAN3_NO_BZIP2 "Don't use BZip2, even if present." OFF)
+option (SEQAN3_NO_ZSTD "Don't use ZSTD, even if present." OFF)
+option (SEQAN3_NO_LIBDEFLATE "Don't use libdeflate, even if present." OFF)
 
 # ----------------------------------------------------------------------------
 # Check supported compilers
@@ -343,6 +347,54 @@ else ()
     seqan3_config_print ("Optional dependency:        BZip2 not found.")
 endif ()
 
+# ----------------------------------------------------------------------------
+# ZSTD dependency
+# ----------------------------------------------------------------------------
+
+# CMake does not ship a find module for libzstd.
+if (NOT SEQAN3_NO_ZSTD)
+    find_path (ZSTD_INCLUDE_DIR NAMES zstd.h)
+    find_library (ZSTD_LIBRARY NAMES zstd)
+    mark_as_advanced (ZSTD_INCLUDE_DIR ZSTD_LIBRARY)
+
+    if (ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+        set (ZSTD_FOUND TRUE)
+    endif ()
+endif ()
+
+if (ZSTD_FOUND)
+    set (SEQAN3_LIBRARIES ${SEQAN3_LIBRARIES} ${ZSTD_LIBRARY})
+    set (SEQAN3_DEPENDENCY_INCLUDE_DIRS ${SEQAN3_DEPENDENCY_INCLUDE_DIRS} ${ZSTD_INCLUDE_DIR})
+    set (SEQAN3_DEFINITIONS ${SEQAN3_DEFINITIONS} "-DSEQAN3_HAS_ZSTD=1")
+    seqan3_config_print ("Optional dependency:        ZSTD found.")
+else ()
+    seqan3_config_print ("Optional dependency:        ZSTD not found.")
+endif ()
+
+# ----------------------------------------------------------------------------
+# libdeflate dependency
+# ----------------------------------------------------------------------------
+
+# libdeflate replaces zlib for BGZF blocks only; the other gzip streams still need zlib.
+if (ZLIB_FOUND AND NOT SEQAN3_NO_LIBDEFLATE)
+    find_path (LIBDEFLATE_INCLUDE_DIR NAMES libdeflate.h)
+    find_library (LIBDEFLATE_LIBRARY NAMES deflate)
+    mark_as_advanced (LIBDEFLATE_INCLUDE_DIR LIBDEFLATE_LIBRARY)
+
+    if (LIBDEFLATE_INCLUDE_DIR AND LIBDEFLATE_LIBRARY)
+        set (LIBDEFLATE_FOUND TRUE)
+    endif ()
+endif ()
+
+if (LIBDEFLATE_FOUND)
+    set (SEQAN3_LIBRARIES ${SEQAN3_LIBRARIES} ${LIBDEFLATE_LIBRARY})
+    set (SEQAN3_DEPENDENCY_INCLUDE_DIRS ${SEQAN3_DEPENDENCY_INCLUDE_DIRS} ${LIBDEFLATE_INCLUDE_DIR})
+    set (SEQAN3_DEFINITIONS ${SEQAN3_DEFINITIONS} "-DSEQAN3_HAS_LIBDEFLATE=1")
+    seqan3_config_print ("Optional dependency:        libdeflate found.")
+else ()
+    seqan3_config_print ("Optional dependency:        libdeflate not found.")
+endif ()
+
 # ----------------------------------------------------------------------------
 # System dependencies
 # ----------------------------------------------------------------------------
@@ -450,6 +502,8 @@ if (SEQAN3_FIND_DEBUG)
     message ("  ${CMAKE_FIND_PACKAGE_NAME}_FOUND                ${${CMAKE_FIND_PACKAGE_NAME}_FOUND}")
     message ("  SEQAN3_HAS_ZLIB             ${ZLIB_FOUND}")
     message ("  SEQAN3_HAS_BZIP2            ${BZIP2_FOUND}")
+    message ("  SEQAN3_HAS_ZSTD             ${ZSTD_FOUND}")
+    message ("  SEQAN3_HAS_LIBDEFLATE       ${LIBDEFLATE_FOUND}")
     message ("")
     message ("  SEQAN3_INCLUDE_DIRS         ${SEQAN3_INCLUDE_DIRS}")
     message ("  SEQAN3_LIBRARIES            ${SEQAN3_LIBRARIES}")
@@ -15,6 +15,9 @@ int main()
     // the latest modification will determine the value.
     seqan3::contrib::bgzf_thread_count = 1u;
 
+    // Plain gzip files are decompressed on a single thread unless `gz_thread_count` is greater than `1`.
+    seqan3::contrib::gz_thread_count = 4u;
+
     // Read/Write compressed files.
     // ...
     return 0;
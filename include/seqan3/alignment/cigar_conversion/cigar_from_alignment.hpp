@@ -46,6 +46,8 @@ struct cigar_clipped_bases
  *                       alignment or whether part of the query sequence does not take part (soft clipping) in the
  *                       alignment.
  * \param  extended_cigar  Whether to print the extended CIGAR alphabet or not. See `seqan3::cigar::operation`.
+ * \param  min_intron_length The minimal length of a deletion that is reported as a skipped region (`N`), e.g. an
+ *                           intron of a spliced alignment; `0` reports all deletions as `D`.
  * \returns A std::vector\<seqan3::cigar\> representing the alignment.
  *
  * \details
@@ -105,6 +107,14 @@ struct cigar_clipped_bases
  *
  * \include test/snippet/alignment/cigar_conversion/cigar_from_alignment_with_clipping.cpp
  *
+ * ### Introns
+ *
+ * The SAM specifications use the operation `N` for a region of the reference that is skipped by the query, e.g. an
+ * intron of an RNA read. Since an aligned sequence only contains gaps, such regions cannot be distinguished from
+ * deletions. If `min_intron_length` is set, every deletion of at least this length is reported as `N` instead of `D`.
+ * Spliced alignments computed with seqan3::align_cfg::gap_cost_splice report their introns exactly with
+ * seqan3::align_cfg::output_cigar.
+ *
  * \sa seqan3::cigar_clipped_bases
  * \sa seqan3::sam_file_output
  * \sa seqan3::cigar
@@ -113,7 +123,8 @@ struct cigar_clipped_bases
 template <typename alignment_type>
 inline auto cigar_from_alignment(alignment_type const & alignment,
                                  cigar_clipped_bases const & clipped_bases = {},
-                                 bool const extended_cigar = false)
+                                 bool const extended_cigar = false,
+                                 uint32_t const min_intron_length = 0)
 {
     static_assert((tuple_like<std::remove_cvref_t<alignment_type>>
                    && std::tuple_size_v<std::remove_cvref_t<alignment_type>> == 2),
@@ -163,7 +174,7 @@ inline auto cigar_from_alignment(alignment_type const & alignment,
         // note that N is not considered because it is equivalent to D but has a special meaning:
         // SAM spec: "For mRNA-to-genome alignment, an N operation represents an intron. For other types of alignments,
         //            the interpretation of N is not defined."
-        // as we cannot know the meaning, the user has to change D -> N themself
+        // as we cannot know the meaning, long deletions are only changed to N below if requested by min_intron_length
         constexpr std::array<char, 6> operators{'M', 'D', 'I', 'P', 'X', '='}; // contains the possible cigar operators.
 
         // no gaps               -> 00 -> 0
@@ -193,6 +204,15 @@ inline auto cigar_from_alignment(alignment_type const & alignment,
 
     std::vector<cigar> result{};
 
+    // Appends the operation, but reports long deletions as skipped regions.
+    auto append = [&result, min_intron_length](uint32_t const count, cigar::operation const operation)
+    {
+        if (min_intron_length > 0 && operation == 'D'_cigar_operation && count >= min_intron_length)
+            result.emplace_back(count, 'N'_cigar_operation);
+        else
+            result.emplace_back(count, operation);
+    };
+
     // Add (H)ard-clipping at the start of the query
     if (clipped_bases.hard_front)
         result.emplace_back(clipped_bases.hard_front, 'H'_cigar_operation);
@@ -218,14 +238,14 @@ inline auto cigar_from_alignment(alignment_type const & alignment,
         }
         else
         {
-            result.emplace_back(count, operation);
+            append(count, operation);
             operation = next_op;
             count = 1;
         }
     }
 
     // append last cigar element
-    result.emplace_back(count, operation);
+    append(count, operation);
 
     // Add (S)oft-clipping at the end of the query
     if (clipped_bases.soft_back)
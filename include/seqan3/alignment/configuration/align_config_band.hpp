@@ -6,7 +6,7 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides seqan3::detail::align_config_band.
+ * \brief Provides seqan3::align_cfg::band_fixed_size and seqan3::align_cfg::band_adaptive.
  * \author Jörg Winkler <j.winkler AT fu-berlin.de>
  * \author Rene Rahn <rene.rahn AT fu-berlin.de>
  */
@@ -101,4 +101,62 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::band};
 };
 
+/*!\brief Configuration element for setting an adaptive band that follows the path of the best score.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * In contrast to seqan3::align_cfg::band_fixed_size, the position of the adaptive band does not need to be known
+ * a priori. The band consists of a fixed number of cells on every anti-diagonal of the alignment matrix. After an
+ * anti-diagonal was computed, the band is moved either one cell to the right or one cell down, depending on which of
+ * its two end cells has the higher score. Thus, the band follows the path of the optimal alignment, even if the
+ * insertions and deletions of the alignment shift this path far away from the main diagonal, as it is common when
+ * aligning long and noisy reads. The run time and the memory are \f$ O((n+m)*w) \f$ for a band width `w`.
+ *
+ * Since only the cells within the band are computed, the returned alignment is not guaranteed to be optimal if the
+ * optimal path leaves the band, e.g. because of a gap that is longer than the band width. Its score, however, always
+ * matches the returned alignment.
+ *
+ * The adaptive band can only be used in combination with seqan3::align_cfg::method_global without any free
+ * end-gaps. The band width must be positive. An invalid configuration will throw a
+ * seqan3::invalid_alignment_configuration exception when calling seqan3::align_pairwise.
+ *
+ * \note For more information, please refer to the original article:
+ *       Suzuki H, Kasahara M. Acceleration of nucleotide semi-global alignment with adaptive banded dynamic
+ *       programming. bioRxiv, 2017, 130633.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_band_adaptive_example.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ */
+class band_adaptive : private pipeable_config_element
+{
+public:
+    //!\brief The number of cells of the band on every anti-diagonal. Defaults to 128.
+    uint32_t width{128};
+
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr band_adaptive() = default;                                  //!< Defaulted.
+    constexpr band_adaptive(band_adaptive const &) = default;             //!< Defaulted.
+    constexpr band_adaptive(band_adaptive &&) = default;                  //!< Defaulted.
+    constexpr band_adaptive & operator=(band_adaptive const &) = default; //!< Defaulted.
+    constexpr band_adaptive & operator=(band_adaptive &&) = default;      //!< Defaulted.
+    ~band_adaptive() = default;                                           //!< Defaulted.
+
+    /*!\brief Initialises the adaptive band with the given width.
+     * \param width \copybrief seqan3::align_cfg::band_adaptive::width
+     */
+    constexpr explicit band_adaptive(uint32_t const width) : width{width}
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::band_adaptive};
+};
+
 } // namespace seqan3::align_cfg
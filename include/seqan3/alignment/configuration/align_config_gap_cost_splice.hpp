@@ -0,0 +1,123 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+/*!\file
+ * \brief Provides seqan3::align_cfg::gap_cost_splice.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/core/detail/strong_type.hpp>
+
+namespace seqan3::align_cfg
+{
+// ------------------------------------------------------------------
+// seqan3::align_cfg::intron_open_score
+// ------------------------------------------------------------------
+
+/*!\brief A strong type of underlying type `int32_t` that represents the score (usually negative) of an intron,
+ *        independent of its length.
+ * \ingroup alignment_configuration
+ * \see seqan3::align_cfg::gap_cost_splice
+ */
+struct intron_open_score :
+    seqan3::detail::strong_type<int32_t, intron_open_score, seqan3::detail::strong_type_skill::convert>
+{
+    //!\brief The type of the strong type base class.
+    using base_t = seqan3::detail::strong_type<int32_t, intron_open_score, seqan3::detail::strong_type_skill::convert>;
+    using base_t::base_t; // Import the base class constructors
+};
+
+// ------------------------------------------------------------------
+// seqan3::align_cfg::non_canonical_score
+// ------------------------------------------------------------------
+
+/*!\brief A strong type of underlying type `int32_t` that represents the score (usually negative) of a splice site
+ *        that does not match the canonical GT-AG motif.
+ * \ingroup alignment_configuration
+ * \see seqan3::align_cfg::gap_cost_splice
+ */
+struct non_canonical_score :
+    seqan3::detail::strong_type<int32_t, non_canonical_score, seqan3::detail::strong_type_skill::convert>
+{
+    //!\brief The type of the strong type base class.
+    using base_t
+        = seqan3::detail::strong_type<int32_t, non_canonical_score, seqan3::detail::strong_type_skill::convert>;
+    using base_t::base_t; // Import the base class constructors
+};
+
+/*!\brief A configuration element for spliced alignments of RNA sequences against a genomic region.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * With the affine gap cost scheme, an intron of an RNA read, which can span thousands of bases of the genome, is
+ * penalised like any other deletion. This configuration adds a separate gap state to the alignment recursion that
+ * skips bases of the first sequence, i.e. the genomic region, at a constant score: an intron of any length costs the
+ * \ref seqan3::align_cfg::intron_open_score "intron open score". Short gaps are still scored with the
+ * seqan3::align_cfg::gap_cost_affine scheme, such that the cheaper of both models is chosen for every gap.
+ *
+ * Additionally, the splice sites can be scored: the
+ * \ref seqan3::align_cfg::non_canonical_score "non-canonical score" is added once if the intron does not begin with
+ * the donor motif `GT` (or `GU`) and once if it does not end with the acceptor motif `AG`. The motifs are read
+ * from the first sequence, so for genes on the reverse strand, the reverse complement of the genomic region must be
+ * aligned. A non-canonical score of `0` disables the motif awareness.
+ *
+ * Introns are reported as `N` operations by seqan3::align_cfg::output_cigar and as gaps in the second sequence by
+ * seqan3::align_cfg::output_alignment. Use the `min_intron_length` of seqan3::cigar_from_alignment to
+ * report long gaps of an aligned sequence pair as `N` operations.
+ *
+ * Spliced alignments are computed for global (including free end-gaps) and local alignments. They can neither be
+ * banded nor vectorised.
+ *
+ * \note The intron state corresponds to the long gap state of the splice mode of minimap2:
+ *       Li, Heng. Minimap2: pairwise alignment for nucleotide sequences. Bioinformatics, 2018, 34. Jg., Nr. 18,
+ *       S. 3094-3100.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_gap_cost_splice_example.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ */
+class gap_cost_splice : private pipeable_config_element
+{
+public:
+    //!\brief The score of an intron of any length. Defaults to -32.
+    int32_t intron_open_score{-32};
+    //!\brief The score of every splice site that does not match the canonical motif. Defaults to -9.
+    int32_t non_canonical_score{-9};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr gap_cost_splice() = default;                                    //!< Defaulted
+    constexpr gap_cost_splice(gap_cost_splice const &) = default;             //!< Defaulted
+    constexpr gap_cost_splice(gap_cost_splice &&) = default;                  //!< Defaulted
+    constexpr gap_cost_splice & operator=(gap_cost_splice const &) = default; //!< Defaulted
+    constexpr gap_cost_splice & operator=(gap_cost_splice &&) = default;      //!< Defaulted
+    ~gap_cost_splice() = default;                                             //!< Defaulted
+
+    /*!\brief Construction from strongly typed intron open score and non-canonical score.
+     * \param intron_open_score The score of an intron (of type seqan3::align_cfg::intron_open_score).
+     * \param non_canonical_score The score of a non-canonical splice site
+     *                            (of type seqan3::align_cfg::non_canonical_score).
+     */
+    constexpr gap_cost_splice(seqan3::align_cfg::intron_open_score intron_open_score,
+                              seqan3::align_cfg::non_canonical_score non_canonical_score) :
+        intron_open_score(std::move(intron_open_score)),
+        non_canonical_score(std::move(non_canonical_score))
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::gap_splice};
+};
+
+} // namespace seqan3::align_cfg
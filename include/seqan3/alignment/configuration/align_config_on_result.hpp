@@ -34,7 +34,9 @@ namespace seqan3::align_cfg
  * specified, the call to the alignment algorithm seqan3::align_pairwise will return nothing, i.e. it does not return
  * a seqan3::algorithm_result_generator_range anymore. Note that within a parallel configuration the order of the generated alignment
  * results and therefore the call to the user callback is non-deterministic. However, the continuation interface with the
- * user callback can be more efficient in a concurrent environment. If you pass an lvalue function object as callback
+ * user callback can be more efficient in a concurrent environment. If a seqan3::align_cfg::streaming_window is given to
+ * seqan3::align_cfg::parallel, the callback is only invoked on the calling thread and the results are reported in the
+ * configured seqan3::align_cfg::result_order. If you pass an lvalue function object as callback
  * function, you need to make sure that the referenced function object outlives the call to the alignment algorithm.
  *
  * \if DEV
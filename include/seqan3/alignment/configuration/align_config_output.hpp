@@ -187,6 +187,53 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::output_alignment};
 };
 
+/*!\brief Configures the alignment result to output the CIGAR representation of the alignment.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * This option forces the alignment to compute and output the alignment as a std::vector over seqan3::cigar elements.
+ * The CIGAR operations are read directly from the trace path of the alignment without building the aligned
+ * sequences first. Accordingly, this option is cheaper than seqan3::align_cfg::output_alignment followed by
+ * seqan3::cigar_from_alignment, e.g. if the alignments are written to a SAM or BAM file.
+ * As for seqan3::cigar_from_alignment, the first sequence is the reference and the second sequence is the query,
+ * i.e. a gap in the first sequence is an insertion ('I') and a gap in the second sequence is a deletion ('D').
+ * Aligned positions are reported as 'M' regardless of whether the symbols match.
+ *
+ * If this option is not set in the alignment configuration, accessing the CIGAR sequence via the
+ * seqan3::alignment_result object is forbidden and will lead to a compile time error.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_output_cigar.cpp
+ *
+ * \see seqan3::align_cfg::output_score
+ * \see seqan3::align_cfg::output_end_position
+ * \see seqan3::align_cfg::output_begin_position
+ * \see seqan3::align_cfg::output_alignment
+ * \see seqan3::align_cfg::output_sequence1_id
+ * \see seqan3::align_cfg::output_sequence2_id
+ */
+class output_cigar : private pipeable_config_element
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr output_cigar() = default;                                 //!< Defaulted.
+    constexpr output_cigar(output_cigar const &) = default;             //!< Defaulted.
+    constexpr output_cigar(output_cigar &&) = default;                  //!< Defaulted.
+    constexpr output_cigar & operator=(output_cigar const &) = default; //!< Defaulted.
+    constexpr output_cigar & operator=(output_cigar &&) = default;      //!< Defaulted.
+    ~output_cigar() = default;                                          //!< Defaulted.
+
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::output_cigar};
+};
+
 /*!\brief Configures the alignment result to output the id of the first sequence.
  * \ingroup alignment_configuration
  *
@@ -28,6 +28,16 @@ namespace seqan3::align_cfg
  *
  * The value represents the number of threads to be used and must be greater than `0`.
  *
+ * ### Streaming
+ *
+ * By default, the alignments are computed in batches whose results are buffered until the entire batch is finished.
+ * If a seqan3::align_cfg::streaming_window is given as second argument, at most that many chunks of sequence pairs
+ * are computed or buffered at the same time and every result is handed out as soon as it is available.
+ * This bounds the memory of the parallel execution and allows, for example, to write the alignments while the
+ * remaining ones are still computed. The optional third argument seqan3::align_cfg::result_order selects whether the
+ * results are reported in the order of the input (default) or in the order in which they are finished.
+ * If seqan3::align_cfg::on_result is used, the callback is then invoked on the calling thread only.
+ *
  * ### Example
  *
  * \include test/snippet/alignment/configuration/align_cfg_parallel_example.cpp
@@ -37,4 +47,16 @@ namespace seqan3::align_cfg
 using parallel = seqan3::detail::parallel_mode<
     std::integral_constant<seqan3::detail::align_config_id, seqan3::detail::align_config_id::parallel>>;
 
+/*!\brief The maximum number of chunks of sequence pairs in flight in the streaming parallel alignment.
+ * \ingroup alignment_configuration
+ * \see seqan3::align_cfg::parallel
+ */
+using streaming_window = seqan3::detail::parallel_streaming_window;
+
+/*!\brief The order in which the streaming parallel alignment reports its results.
+ * \ingroup alignment_configuration
+ * \see seqan3::align_cfg::parallel
+ */
+using result_order = seqan3::detail::parallel_result_order;
+
 } // namespace seqan3::align_cfg
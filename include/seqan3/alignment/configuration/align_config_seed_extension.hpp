@@ -0,0 +1,138 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::seed_extension.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/core/detail/strong_type.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief A strong type representing the X-drop value of the seqan3::align_cfg::seed_extension.
+ * \ingroup alignment_configuration
+ */
+struct x_drop : public seqan3::detail::strong_type<int32_t, x_drop>
+{
+    //!\brief The type of the strong type base class.
+    using base_t = seqan3::detail::strong_type<int32_t, x_drop>;
+    // Import the base class constructors
+    using base_t::base_t;
+};
+
+/*!\brief A strong type representing the Z-drop value of the seqan3::align_cfg::seed_extension.
+ * \ingroup alignment_configuration
+ */
+struct z_drop : public seqan3::detail::strong_type<int32_t, z_drop>
+{
+    //!\brief The type of the strong type base class.
+    using base_t = seqan3::detail::strong_type<int32_t, z_drop>;
+    // Import the base class constructors
+    using base_t::base_t;
+};
+
+/*!\brief The direction in which the seqan3::align_cfg::seed_extension extends the seed.
+ * \ingroup alignment_configuration
+ */
+enum struct extension_direction : uint8_t
+{
+    //!\brief Extends to the right, i.e. the alignment starts at the beginning of both sequences.
+    right,
+    //!\brief Extends to the left, i.e. the alignment ends at the end of both sequences.
+    left
+};
+
+/*!\brief Configuration element to compute an extension alignment with an X-drop or Z-drop termination criterion.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * In seed-and-extend approaches a seed, i.e. a short exact match between two sequences, is extended to both sides
+ * until the alignment score drops too far below the best score seen so far. In contrast to a global or banded
+ * alignment, only the cells that are close to the best score are computed, such that the runtime depends on the length
+ * of the actual alignment and not on the length of the sequences.
+ *
+ * The extension alignment is anchored at one end of the given sequences, depending on the
+ * seqan3::align_cfg::extension_direction. For a right extension, the alignment starts at the beginning of both
+ * sequences and ends at the cell with the best score. For a left extension, the alignment ends at the end of both
+ * sequences and starts at the cell with the best score. Hence, to extend a seed, one passes the sequence infixes
+ * left of the seed to a left extension and the sequence infixes right of the seed to a right extension.
+ *
+ * Two termination criteria are supported:
+ *
+ *  * seqan3::align_cfg::x_drop: A cell is discarded if its score falls more than `X` below the best score seen so far.
+ *    The extension stops as soon as all cells of a row were discarded.
+ *  * seqan3::align_cfg::z_drop: Works like the X-drop, but the allowed drop grows with the distance between the
+ *    diagonal of the cell and the diagonal of the best cell multiplied with the gap extension score, such that long
+ *    gaps do not terminate the extension prematurely (see Li H. Minimap2: pairwise alignment for nucleotide sequences.
+ *    Bioinformatics, 2018, 34(18), 3094-3100).
+ *
+ * The seed extension must be combined with seqan3::align_cfg::method_global without free end-gaps. It can be
+ * combined with seqan3::align_cfg::vectorised to extend many seeds at once.
+ * The drop value must be positive, otherwise a seqan3::invalid_alignment_configuration exception is thrown when
+ * calling seqan3::align_pairwise.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_seed_extension_example.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ */
+class seed_extension : private pipeable_config_element
+{
+public:
+    //!\brief The maximal drop of the score below the best score.
+    int32_t drop{};
+    //!\brief Whether the Z-drop criterion is used instead of the X-drop criterion.
+    bool use_z_drop{false};
+    //!\brief The direction of the extension.
+    extension_direction direction{extension_direction::right};
+
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr seed_extension() = default;                                   //!< Defaulted.
+    constexpr seed_extension(seed_extension const &) = default;             //!< Defaulted.
+    constexpr seed_extension(seed_extension &&) = default;                  //!< Defaulted.
+    constexpr seed_extension & operator=(seed_extension const &) = default; //!< Defaulted.
+    constexpr seed_extension & operator=(seed_extension &&) = default;      //!< Defaulted.
+    ~seed_extension() = default;                                            //!< Defaulted.
+
+    /*!\brief Initialises the seed extension with the X-drop criterion.
+     * \param x_drop The maximal drop of the score below the best score.
+     * \param direction The direction of the extension. Defaults to seqan3::align_cfg::extension_direction::right.
+     */
+    constexpr seed_extension(seqan3::align_cfg::x_drop const x_drop,
+                             extension_direction const direction = extension_direction::right) :
+        drop{x_drop.get()},
+        use_z_drop{false},
+        direction{direction}
+    {}
+
+    /*!\brief Initialises the seed extension with the Z-drop criterion.
+     * \param z_drop The maximal drop of the score below the best score on the same diagonal.
+     * \param direction The direction of the extension. Defaults to seqan3::align_cfg::extension_direction::right.
+     */
+    constexpr seed_extension(seqan3::align_cfg::z_drop const z_drop,
+                             extension_direction const direction = extension_direction::right) :
+        drop{z_drop.get()},
+        use_z_drop{true},
+        direction{direction}
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::seed_extension};
+};
+
+} // namespace seqan3::align_cfg
@@ -16,10 +16,31 @@
 #include <seqan3/alignment/configuration/detail.hpp>
 #include <seqan3/core/configuration/pipeable_config_element.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/detail/strong_type.hpp>
 
 namespace seqan3::align_cfg
 {
 
+/*!\brief A strong type representing the length sorting window of the seqan3::align_cfg::vectorised configuration.
+ * \ingroup alignment_configuration
+ */
+struct length_sorting_window : public seqan3::detail::strong_type<size_t, length_sorting_window>
+{
+    //!\brief The type of the strong type base class.
+    using base_t = seqan3::detail::strong_type<size_t, length_sorting_window>;
+    // Import the base class constructors
+    using base_t::base_t;
+};
+
+/*!\brief Selects how the scores are stored in the SIMD lanes of the seqan3::align_cfg::vectorised configuration.
+ * \ingroup alignment_configuration
+ */
+enum struct score_encoding : uint8_t
+{
+    absolute,  //!< Every cell stores its score in the configured seqan3::align_cfg::score_type.
+    difference //!< Every cell stores the 8 bit differences to its neighbouring cells.
+};
+
 /*!\brief Enables the vectorised alignment computation if possible for the current configuration.
  * \ingroup alignment_configuration
  *
@@ -32,6 +53,22 @@ namespace seqan3::align_cfg
  * multiple alignments and not a single alignment. This means that you should provide many sequences to compute as
  * one batch rather than computing them separately as there won't be performance gains.
  *
+ * All alignments packed into one SIMD vector are computed until the longest of them is finished. If the lengths of the
+ * sequences differ a lot, many lanes of the vector compute padding only. To avoid this, a
+ * seqan3::align_cfg::length_sorting_window can be given. Then the sequence pairs are processed in windows of the given
+ * size, in which they are sorted by their lengths before they are packed into the SIMD vectors. The results are
+ * still reported in the order of the input. The window size is rounded up to a multiple of the number of alignments
+ * per SIMD vector. A larger window sorts better but buffers more results before they are reported.
+ *
+ * By default, every lane stores the absolute scores of the cells, such that the width of a lane is given by the
+ * seqan3::align_cfg::score_type. With seqan3::align_cfg::score_encoding::difference the lanes only store the
+ * differences between adjacent cells, which are bounded by the scoring parameters and independent of the sequence
+ * lengths (difference recurrence of Suzuki and Kasahara). These fit into 8 bit lanes, such that four times as many
+ * alignments as with 32 bit scores are computed per instruction. The difference encoding is used for global
+ * alignments without free end-gaps and without a band that compute at most the score and the end positions, if the
+ * scoring scheme is not an amino acid scoring scheme and the gap and substitution scores are small enough to be
+ * represented in 8 bits. Otherwise the alignments are computed with the absolute scores.
+ *
  * \sa For further information on SIMD see https://en.wikipedia.org/wiki/SIMD.
  *
  * ### Example
@@ -51,8 +88,30 @@ public:
     constexpr vectorised & operator=(vectorised &&) = default;      //!< Defaulted.
     ~vectorised() = default;                                        //!< Defaulted.
 
+    /*!\brief Sorts the sequence pairs by length within windows of the given size.
+     * \param[in] window The number of sequence pairs that are sorted together; `0` disables the sorting.
+     */
+    constexpr vectorised(seqan3::align_cfg::length_sorting_window const window) noexcept :
+        length_sorting_window{window.get()}
+    {}
+
+    /*!\brief Selects the score encoding and optionally the length sorting window.
+     * \param[in] encoding The encoding of the scores in the SIMD lanes.
+     * \param[in] window The number of sequence pairs that are sorted together; `0` disables the sorting.
+     */
+    constexpr vectorised(seqan3::align_cfg::score_encoding const encoding,
+                         seqan3::align_cfg::length_sorting_window const window =
+                             seqan3::align_cfg::length_sorting_window{0}) noexcept :
+        length_sorting_window{window.get()},
+        score_encoding{encoding}
+    {}
     //!\}
 
+    //!\brief The number of sequence pairs that are sorted by length before they are packed into SIMD vectors.
+    size_t length_sorting_window{};
+    //!\brief The encoding of the scores in the SIMD lanes.
+    seqan3::align_cfg::score_encoding score_encoding{seqan3::align_cfg::score_encoding::absolute};
+
     //!\privatesection
     //!\brief Internal id to check for consistent configuration settings.
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::vectorised};
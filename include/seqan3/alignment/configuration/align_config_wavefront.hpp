@@ -0,0 +1,74 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::wavefront configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes the global alignment with the gap-affine wavefront alignment algorithm (WFA).
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The standard dynamic programming algorithm always computes the entire \f$ O(n*m) \f$ alignment matrix, regardless
+ * of how similar the two sequences are. The wavefront alignment algorithm instead only explores the furthest reaching
+ * cells on every diagonal for increasing alignment penalties. Its run time is \f$ O(n*s) \f$, where `s` is the
+ * penalty of the optimal alignment. For highly similar sequences, e.g. long reads aligned against their reference
+ * region, this is orders of magnitude faster than the standard algorithm.
+ *
+ * The wavefront algorithm can only be used in combination with seqan3::align_cfg::method_global without any free
+ * end-gaps. The scoring scheme must have a uniform match and a uniform mismatch score, where the match score must be
+ * greater than the mismatch score, for example seqan3::nucleotide_scoring_scheme initialised with seqan3::match_score
+ * and seqan3::mismatch_score. Scores with a positive match score are internally converted into equivalent penalties,
+ * such that the computed alignment score is always the same as the one computed by the standard algorithm.
+ * If the gap open score is 0, as for example in seqan3::align_cfg::edit_scheme, a linear gap model is used, which
+ * requires only one wavefront per penalty.
+ * An invalid configuration will throw a seqan3::invalid_alignment_configuration exception when calling
+ * seqan3::align_pairwise.
+ *
+ * \note In case of co-optimal alignments, the alignment computed by the wavefront algorithm might differ from the one
+ *       computed by the standard algorithm. The score, however, is always the same.
+ *
+ * \note For more information, please refer to the original article:
+ *       Marco-Sola S, Moure JC, Moreto M, Espinosa A. Fast gap-affine pairwise alignment using the wavefront
+ *       algorithm. Bioinformatics, 2021, 37. Jg., Nr. 4, S. 456-463.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_wavefront_example.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ */
+class wavefront : private pipeable_config_element
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr wavefront() = default;                              //!< Defaulted.
+    constexpr wavefront(wavefront const &) = default;             //!< Defaulted.
+    constexpr wavefront(wavefront &&) = default;                  //!< Defaulted.
+    constexpr wavefront & operator=(wavefront const &) = default; //!< Defaulted.
+    constexpr wavefront & operator=(wavefront &&) = default;      //!< Defaulted.
+    ~wavefront() = default;                                       //!< Defaulted.
+
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::wavefront};
+};
+
+} // namespace seqan3::align_cfg
@@ -114,6 +114,30 @@ public:
                                                        second_sequence_t && second,
                                                        align_cfg::band_fixed_size const & band,
                                                        score_t const initial_value = score_t{})
+    {
+        resize(first, second, band, initial_value);
+    }
+    //!\}
+
+    /*!\brief Resizes the matrix for two ranges and a band.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first          The first range.
+     * \param[in] second         The second range.
+     * \param[in] band           The seqan3::align_cfg::band_fixed_size in which to calculate the alignment.
+     * \param[in] initial_value  The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * Does only obtain the sizes of the passed ranges in order to resize the score matrix. The allocated memory is
+     * kept, such that the matrix only reallocates if the band grows beyond the capacity of the column.
+     */
+    template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
+    constexpr void resize(first_sequence_t && first,
+                          second_sequence_t && second,
+                          align_cfg::band_fixed_size const & band,
+                          score_t const initial_value = score_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
@@ -123,10 +147,11 @@ public:
             std::min<int32_t>(std::abs(std::min<int32_t>(band.lower_diagonal, 0)), matrix_base_t::num_rows - 1);
 
         band_size = band_col_index + band_row_index + 1;
+        matrix_base_t::cache = {};
+        matrix_base_t::pool.clear();
         // Reserve one more cell to deal with last cell in the banded column which needs only the diagonal and up cell.
         matrix_base_t::pool.resize(band_size + 1, element_type{initial_value, initial_value});
     }
-    //!\}
 
     //!\brief The column index where the upper bound of the band passes through.
     int32_t band_col_index{};
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iterator>
 #include <ranges>
 
@@ -120,19 +121,43 @@ public:
     constexpr alignment_trace_matrix_full(first_sequence_t && first,
                                           second_sequence_t && second,
                                           [[maybe_unused]] trace_t const initial_value = trace_t{})
+    {
+        resize(first, second, initial_value);
+    }
+    //!\}
+
+    /*!\brief Resizes the matrix for two ranges.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first         The first range.
+     * \param[in] second        The second range.
+     * \param[in] initial_value The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * Obtains only the sizes of the passed ranges in order to resize the trace matrix. The allocated memory is kept
+     * and reset to seqan3::detail::trace_directions::none, such that a matrix reused for many sequence pairs only
+     * reallocates if the matrix grows beyond its capacity.
+     */
+    template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
+    constexpr void resize(first_sequence_t && first,
+                          second_sequence_t && second,
+                          [[maybe_unused]] trace_t const initial_value = trace_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
 
         if constexpr (!coordinate_only)
         {
-            // Allocate the matrix here.
-            matrix_base_t::data = typename matrix_base_t::pool_type{number_rows{matrix_base_t::num_rows},
-                                                                    number_cols{matrix_base_t::num_cols}};
+            // Resize the matrix here and reuse the previously allocated memory.
+            matrix_base_t::data.resize(number_rows{matrix_base_t::num_rows}, number_cols{matrix_base_t::num_cols});
+            std::ranges::fill(matrix_base_t::data, trace_t{});
+            matrix_base_t::cache_left.clear();
             matrix_base_t::cache_left.resize(matrix_base_t::num_rows, initial_value);
+            matrix_base_t::cache_up = trace_t{};
         }
     }
-    //!\}
 
     /*!\brief Returns a trace path starting from the given coordinate and ending in the cell with
      *        seqan3::detail::trace_directions::none.
@@ -0,0 +1,107 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::cigar_builder.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <ranges>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Builds the CIGAR representation of an alignment from the respective trace path.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * In contrast to seqan3::detail::aligned_sequence_builder followed by seqan3::cigar_from_alignment, the CIGAR
+ * operations are read directly from the trace path, such that neither the aligned sequences nor the intermediate
+ * trace segments need to be stored.
+ * The first sequence is the reference and the second sequence is the query: a trace going up, i.e. a gap in the first
+ * sequence, is an insertion ('I'), a trace going left, i.e. a gap in the second sequence, is a deletion ('D') and a
+ * diagonal trace is an alignment match ('M').
+ */
+class cigar_builder
+{
+public:
+    //!\brief The result type when building the CIGAR sequence.
+    struct [[nodiscard]] result_type
+    {
+        //!\brief The slice positions of the first sequence.
+        std::pair<size_t, size_t> first_sequence_slice_positions{};
+        //!\brief The slice positions of the second sequence.
+        std::pair<size_t, size_t> second_sequence_slice_positions{};
+        //!\brief The CIGAR sequence, which corresponds to the given trace path.
+        std::vector<cigar> cigar_sequence{};
+    };
+
+    /*!\brief Builds the CIGAR sequence from the given trace path.
+     * \tparam trace_path_t The type of the trace path; must model std::ranges::input_range and
+     *                      std::same_as<std::ranges::range_value_t<trace_path_t>, seqan::detail::trace_directions> must
+     *                      evaluate to `true`.
+     * \param[in] trace_path The trace path.
+     * \returns seqan3::detail::cigar_builder::result_type with the built CIGAR sequence.
+     *
+     * \details
+     *
+     * The trace path is followed from the end of the alignment to its begin. Runs of the same trace direction are
+     * collected into one CIGAR element and the elements are reversed at the end, such that the CIGAR sequence starts
+     * at the begin of the alignment. An empty trace path results in an empty CIGAR sequence.
+     */
+    template <std::ranges::input_range trace_path_t>
+    result_type operator()(trace_path_t && trace_path) const
+    {
+        static_assert(std::same_as<std::ranges::range_value_t<trace_path_t>, trace_directions>,
+                      "The value type of the trace path must be seqan3::detail::trace_directions");
+
+        using namespace seqan3::literals;
+
+        result_type res{};
+        auto trace_it = std::ranges::begin(trace_path);
+        std::tie(res.first_sequence_slice_positions.second, res.second_sequence_slice_positions.second) =
+            std::pair<size_t, size_t>{trace_it.coordinate()};
+
+        while (trace_it != std::ranges::end(trace_path))
+        {
+            trace_directions const last_dir = *trace_it;
+            uint32_t span = 0;
+            for (; trace_it != std::ranges::end(trace_path) && *trace_it == last_dir; ++trace_it, ++span)
+            {}
+
+            assert(last_dir == trace_directions::up || last_dir == trace_directions::left
+                   || last_dir == trace_directions::diagonal);
+
+            if (last_dir == trace_directions::up)
+                res.cigar_sequence.emplace_back(span, 'I'_cigar_operation);
+            else if (last_dir == trace_directions::left)
+                res.cigar_sequence.emplace_back(span, 'D'_cigar_operation);
+            else
+                res.cigar_sequence.emplace_back(span, 'M'_cigar_operation);
+        }
+
+        std::tie(res.first_sequence_slice_positions.first, res.second_sequence_slice_positions.first) =
+            std::pair<size_t, size_t>{trace_it.coordinate()};
+
+        std::ranges::reverse(res.cigar_sequence);
+        return res;
+    }
+};
+
+} // namespace seqan3::detail
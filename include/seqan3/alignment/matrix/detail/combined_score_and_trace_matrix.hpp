@@ -81,7 +81,8 @@ public:
      *
      * \details
      *
-     * Resizes the underlying score and trace matrix to the given dimensions.
+     * Resizes the underlying score and trace matrix to the given dimensions. Both matrices are resized in place, such
+     * that the memory of a matrix that is reused for many sequence pairs is only reallocated if it grows.
      *
      * ### Complexity
      *
@@ -89,21 +90,15 @@ public:
      *
      * ### Exception
      *
-     * Strong exception guarantee. Might throw std::bad_alloc.
+     * Basic exception guarantee. Might throw std::bad_alloc.
      */
     template <std::integral column_index_t, std::integral row_index_t>
     void resize(column_index_type<column_index_t> const column_count,
                 row_index_type<row_index_t> const row_count,
                 score_type const initial_score = score_type{})
     {
-        score_matrix_t tmp_score_matrix{};
-        tmp_score_matrix.resize(column_count, row_count, initial_score);
-
-        trace_matrix_t tmp_trace_matrix{};
-        tmp_trace_matrix.resize(column_count, row_count);
-
-        score_matrix = std::move(tmp_score_matrix);
-        trace_matrix = std::move(tmp_trace_matrix);
+        score_matrix.resize(column_count, row_count, initial_score);
+        trace_matrix.resize(column_count, row_count);
     }
 
     /*!\name Iterators
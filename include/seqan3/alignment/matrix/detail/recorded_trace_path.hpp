@@ -0,0 +1,234 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::recorded_trace_path.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A trace path that was recorded explicitly instead of being read from a trace matrix.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * Some alignment algorithms, e.g. the wavefront alignment algorithm, do not store a full trace matrix but reconstruct
+ * the trace path directly. This class stores such a path run-length encoded, starting at the cell where the path
+ * begins (the end of the alignment) and following it backwards to the origin of the alignment.
+ * The path models std::ranges::forward_range and its iterator offers the same interface as
+ * seqan3::detail::trace_iterator, i.e. it can be passed to seqan3::detail::aligned_sequence_builder.
+ */
+class recorded_trace_path
+{
+private:
+    //!\brief A run of identical trace directions.
+    using segment_type = std::pair<trace_directions, size_t>;
+
+    //!\brief The iterator over the recorded trace path.
+    class iterator
+    {
+    public:
+        /*!\name Associated types
+         * \{
+         */
+        using value_type = trace_directions;                 //!< The value type.
+        using reference = trace_directions const &;          //!< The reference type.
+        using pointer = value_type const *;                  //!< The pointer type.
+        using difference_type = std::ptrdiff_t;              //!< The difference type.
+        using iterator_category = std::forward_iterator_tag; //!< Forward iterator tag.
+        //!\}
+
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        iterator() = default;                             //!< Defaulted.
+        iterator(iterator const &) = default;             //!< Defaulted.
+        iterator(iterator &&) = default;                  //!< Defaulted.
+        iterator & operator=(iterator const &) = default; //!< Defaulted.
+        iterator & operator=(iterator &&) = default;      //!< Defaulted.
+        ~iterator() = default;                            //!< Defaulted.
+
+        /*!\brief Constructs the iterator from the recorded segments and the start coordinate.
+         * \param[in] segment_it Iterator pointing to the first segment.
+         * \param[in] segment_end Iterator pointing behind the last segment.
+         * \param[in] start The coordinate of the cell where the path starts.
+         */
+        iterator(std::vector<segment_type>::const_iterator segment_it,
+                 std::vector<segment_type>::const_iterator segment_end,
+                 matrix_coordinate const start) noexcept :
+            segment_it{segment_it},
+            segment_end{segment_end},
+            current_coordinate{start}
+        {}
+        //!\}
+
+        /*!\name Element access
+         * \{
+         */
+        //!\brief Returns the current trace direction.
+        reference operator*() const noexcept
+        {
+            assert(segment_it != segment_end);
+            return segment_it->first;
+        }
+
+        //!\brief Returns a pointer to the current trace direction.
+        pointer operator->() const noexcept
+        {
+            return &(**this);
+        }
+
+        //!\brief Returns the current coordinate in two-dimensional space.
+        [[nodiscard]] matrix_coordinate coordinate() const noexcept
+        {
+            return current_coordinate;
+        }
+        //!\}
+
+        /*!\name Arithmetic operators
+         * \{
+         */
+        //!\brief Advances the iterator by one.
+        iterator & operator++() noexcept
+        {
+            assert(segment_it != segment_end);
+
+            trace_directions const dir = segment_it->first;
+            if (dir != trace_directions::left) // up or diagonal
+            {
+                assert(current_coordinate.row > 0u);
+                --current_coordinate.row;
+            }
+            if (dir != trace_directions::up) // left or diagonal
+            {
+                assert(current_coordinate.col > 0u);
+                --current_coordinate.col;
+            }
+
+            if (++position_in_segment == segment_it->second)
+            {
+                ++segment_it;
+                position_in_segment = 0;
+            }
+            return *this;
+        }
+
+        //!\brief Returns an iterator advanced by one.
+        iterator operator++(int) noexcept
+        {
+            iterator tmp{*this};
+            ++(*this);
+            return tmp;
+        }
+        //!\}
+
+        /*!\name Comparison operators
+         * \{
+         */
+        //!\brief Returns `true` if both iterators are equal, `false` otherwise.
+        friend bool operator==(iterator const & lhs, iterator const & rhs) noexcept
+        {
+            return lhs.segment_it == rhs.segment_it && lhs.position_in_segment == rhs.position_in_segment;
+        }
+
+        //!\brief Returns `true` if the iterator reached the end of the recorded path.
+        friend bool operator==(iterator const & lhs, std::default_sentinel_t const &) noexcept
+        {
+            return lhs.segment_it == lhs.segment_end;
+        }
+        //!\}
+
+    private:
+        //!\brief The current segment.
+        std::vector<segment_type>::const_iterator segment_it{};
+        //!\brief The end of the recorded segments.
+        std::vector<segment_type>::const_iterator segment_end{};
+        //!\brief The position within the current segment.
+        size_t position_in_segment{};
+        //!\brief The coordinate of the current cell.
+        matrix_coordinate current_coordinate{};
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    recorded_trace_path() = default;                                        //!< Defaulted.
+    recorded_trace_path(recorded_trace_path const &) = default;             //!< Defaulted.
+    recorded_trace_path(recorded_trace_path &&) = default;                  //!< Defaulted.
+    recorded_trace_path & operator=(recorded_trace_path const &) = default; //!< Defaulted.
+    recorded_trace_path & operator=(recorded_trace_path &&) = default;      //!< Defaulted.
+    ~recorded_trace_path() = default;                                       //!< Defaulted.
+    //!\}
+
+    /*!\brief Removes all recorded directions and sets a new start coordinate.
+     * \param[in] start The coordinate of the cell where the path starts.
+     *
+     * \details
+     *
+     * The allocated memory is kept, such that the path can be reused for many alignments.
+     */
+    void clear(matrix_coordinate const start) noexcept
+    {
+        segments.clear();
+        start_coordinate = start;
+    }
+
+    /*!\brief Appends a direction to the end of the path.
+     * \param[in] direction The direction to append; must be one of seqan3::detail::trace_directions::diagonal,
+     *                      seqan3::detail::trace_directions::up or seqan3::detail::trace_directions::left.
+     * \param[in] count How often the direction is appended.
+     */
+    void push_back(trace_directions const direction, size_t const count = 1)
+    {
+        assert(direction == trace_directions::diagonal || direction == trace_directions::up
+               || direction == trace_directions::left);
+
+        if (count == 0)
+            return;
+
+        if (!segments.empty() && segments.back().first == direction)
+            segments.back().second += count;
+        else
+            segments.emplace_back(direction, count);
+    }
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the start of the path.
+    iterator begin() const noexcept
+    {
+        return iterator{segments.cbegin(), segments.cend(), start_coordinate};
+    }
+
+    //!\brief Returns a sentinel marking the end of the path.
+    std::default_sentinel_t end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+    //!\}
+
+private:
+    //!\brief The run-length encoded directions.
+    std::vector<segment_type> segments{};
+    //!\brief The coordinate where the path starts.
+    matrix_coordinate start_coordinate{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,548 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::trace_matrix_full_packed.
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix_iterator_base.hpp>
+#include <seqan3/utility/views/repeat_n.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Trace matrix for the pairwise alignment storing the full trace matrix with four bits per cell.
+ * \ingroup alignment_matrix
+ * \implements std::ranges::input_range
+ *
+ * \tparam trace_t The type of the trace; must be the same as seqan3::detail::trace_directions.
+ *
+ * \details
+ *
+ * Offers the same interface as seqan3::detail::trace_matrix_full, but stores every cell of the complete matrix in
+ * four bits instead of one byte, which halves the memory and the memory bandwidth needed for the trace back of long
+ * sequences.
+ * Following the trace path only depends on the direction the trace comes from, where the diagonal is preferred over
+ * the vertical and the vertical over the horizontal direction, and on the two carry bits
+ * seqan3::detail::trace_directions::carry_up_open and seqan3::detail::trace_directions::carry_left_open. The direction
+ * is stored in the lower two bits of a cell and the carry bits in the upper two bits.
+ *
+ * The column that is currently computed is kept unpacked in a separate buffer, such that the alignment algorithm can
+ * write the traces as before. The buffered column is packed into the matrix as soon as the iterator moves to the next
+ * column or the trace path is requested.
+ *
+ * ### Range interface
+ *
+ * The matrix offers an input range interface over the columns of the matrix. Dereferencing the iterator will return
+ * another range which represents the current trace column. The returned range is a seqan3::views::zip view over the
+ * buffered column referencing the best trace, as well as the horizontal and vertical trace column.
+ */
+template <typename trace_t>
+    requires std::same_as<trace_t, trace_directions>
+class trace_matrix_full_packed
+{
+private:
+    //!\brief The type of the packed storage; every byte stores two cells.
+    using storage_t = std::vector<uint8_t>;
+    //!\brief The type of the score column which allocates memory for the entire column.
+    using physical_column_t = std::vector<trace_t>;
+    //!\brief The type of the virtual score column which only stores one value.
+    using virtual_column_t = decltype(views::repeat_n(trace_t{}, 1));
+
+    class iterator;
+    class cell_iterator;
+
+    //!\brief Marks that no column is buffered.
+    static constexpr size_t no_buffered_column = std::numeric_limits<size_t>::max();
+
+    //!\brief Maps the trace directions to the four bit representation.
+    static constexpr std::array<uint8_t, 32> encoding_table = []() constexpr
+    {
+        std::array<uint8_t, 32> table{};
+        for (uint8_t value = 0; value < table.size(); ++value)
+        {
+            trace_directions const direction = static_cast<trace_directions>(value);
+            uint8_t code = 0;
+
+            if (static_cast<bool>(direction & trace_directions::diagonal))
+                code = 1;
+            else if (static_cast<bool>(direction & trace_directions::up))
+                code = 2;
+            else if (static_cast<bool>(direction & trace_directions::left))
+                code = 3;
+
+            if (static_cast<bool>(direction & trace_directions::carry_up_open))
+                code |= 0b0100;
+            if (static_cast<bool>(direction & trace_directions::carry_left_open))
+                code |= 0b1000;
+
+            table[value] = code;
+        }
+        return table;
+    }();
+
+    //!\brief Maps the four bit representation back to the trace directions.
+    static constexpr std::array<trace_directions, 16> decoding_table = []() constexpr
+    {
+        constexpr std::array<trace_directions, 4> sources{trace_directions::none,
+                                                          trace_directions::diagonal,
+                                                          trace_directions::up,
+                                                          trace_directions::left};
+        std::array<trace_directions, 16> table{};
+        for (uint8_t code = 0; code < table.size(); ++code)
+        {
+            table[code] = sources[code & 0b0011];
+            if (code & 0b0100)
+                table[code] |= trace_directions::carry_up_open;
+            if (code & 0b1000)
+                table[code] |= trace_directions::carry_left_open;
+        }
+        return table;
+    }();
+
+    //!\brief The packed trace matrix in column major order.
+    mutable storage_t packed_matrix{};
+    //!\brief The unpacked best traces of the column that is currently computed.
+    physical_column_t best_column{};
+    //!\brief The column over the horizontal traces.
+    physical_column_t horizontal_column{};
+    //!\brief The virtual column over the vertical traces.
+    virtual_column_t vertical_column{};
+    //!\brief The index of the column stored in seqan3::detail::trace_matrix_full_packed::best_column.
+    mutable size_t buffered_column_id{no_buffered_column};
+    //!\brief The number of columns for this matrix.
+    size_t column_count{};
+    //!\brief The number of rows for this matrix.
+    size_t row_count{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    trace_matrix_full_packed() = default;                                             //!< Defaulted.
+    trace_matrix_full_packed(trace_matrix_full_packed const &) = default;             //!< Defaulted.
+    trace_matrix_full_packed(trace_matrix_full_packed &&) = default;                  //!< Defaulted.
+    trace_matrix_full_packed & operator=(trace_matrix_full_packed const &) = default; //!< Defaulted.
+    trace_matrix_full_packed & operator=(trace_matrix_full_packed &&) = default;      //!< Defaulted.
+    ~trace_matrix_full_packed() = default;                                            //!< Defaulted.
+
+    //!\}
+
+    /*!\brief Resizes the matrix.
+     * \tparam column_index_t The column index type; must model std::integral.
+     * \tparam row_index_t The row index type; must model std::integral.
+     *
+     * \param[in] column_count The number of columns for this matrix.
+     * \param[in] row_count The number of rows for this matrix.
+     *
+     * \details
+     *
+     * Resizes the packed trace matrix as well as the buffered and the horizontal trace column.
+     * Note the trace matrix requires the number of columns and rows to be one bigger than the size of sequence1,
+     * respectively sequence2 for the initialisation of the matrix.
+     *
+     * ### Complexity
+     *
+     * In worst case `column_count` times `row_count` half bytes are allocated.
+     *
+     * ### Exception
+     *
+     * Basic exception guarantee. Might throw std::bad_alloc on resizing the internal matrices.
+     */
+    template <std::integral column_index_t, std::integral row_index_t>
+    void resize(column_index_type<column_index_t> const column_count, row_index_type<row_index_t> const row_count)
+    {
+        this->column_count = column_count.get();
+        this->row_count = row_count.get();
+        packed_matrix.resize((this->column_count * this->row_count + 1) / 2);
+        best_column.resize(this->row_count);
+        horizontal_column.resize(this->row_count);
+        vertical_column = views::repeat_n(trace_t{}, this->row_count);
+        buffered_column_id = no_buffered_column;
+    }
+
+    /*!\brief Returns a trace path starting from the given coordinate and ending in the cell with
+     *        seqan3::detail::trace_directions::none.
+     * \param[in] trace_begin A seqan3::matrix_coordinate pointing to the begin of the trace to follow.
+     * \returns A std::ranges::subrange over the corresponding trace path.
+     * \throws std::invalid_argument if the specified coordinate is out of range.
+     *
+     * \details
+     *
+     * Packs the currently buffered column into the matrix before the trace path is created.
+     */
+    auto trace_path(matrix_coordinate const & trace_begin) const
+    {
+        using trace_iterator_t = trace_iterator<cell_iterator>;
+        using path_t = std::ranges::subrange<trace_iterator_t, std::default_sentinel_t>;
+
+        if (trace_begin.row >= row_count || trace_begin.col >= column_count)
+            throw std::invalid_argument{"The given coordinate exceeds the matrix in vertical or horizontal direction."};
+
+        pack_buffered_column();
+
+        std::ptrdiff_t const cell_index = trace_begin.col * row_count + trace_begin.row;
+        return path_t{trace_iterator_t{cell_iterator{*this, cell_index}}, std::default_sentinel};
+    }
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns the iterator pointing to the first column.
+    iterator begin()
+    {
+        return iterator{*this, 0u};
+    }
+
+    //!\brief This score matrix is not const-iterable.
+    iterator begin() const = delete;
+
+    //!\brief Returns the iterator pointing behind the last column.
+    iterator end()
+    {
+        return iterator{*this, column_count};
+    }
+
+    //!\brief This score matrix is not const-iterable.
+    iterator end() const = delete;
+    //!\}
+
+private:
+    //!\brief Returns the trace directions stored in the cell with the given linear index.
+    trace_directions cell_at(size_t const cell_index) const noexcept
+    {
+        assert(cell_index / 2 < packed_matrix.size());
+        uint8_t const code = packed_matrix[cell_index / 2] >> ((cell_index & 1u) * 4u);
+        return decoding_table[code & 0b1111];
+    }
+
+    //!\brief Packs the buffered column into the matrix.
+    void pack_buffered_column() const noexcept
+    {
+        if (buffered_column_id == no_buffered_column)
+            return;
+
+        size_t cell_index = buffered_column_id * row_count;
+        auto column_it = best_column.begin();
+        auto column_end = best_column.end();
+
+        // The column starts in the upper half of a byte that is shared with the previous column.
+        if ((cell_index & 1u) && column_it != column_end)
+        {
+            uint8_t & target = packed_matrix[cell_index / 2];
+            target = (target & 0b1111) | (encoding_table[static_cast<uint8_t>(*column_it++)] << 4);
+            ++cell_index;
+        }
+
+        // Pack two cells at once.
+        uint8_t * target = packed_matrix.data() + cell_index / 2;
+        for (; column_end - column_it >= 2; column_it += 2, ++target)
+        {
+            *target = encoding_table[static_cast<uint8_t>(column_it[0])]
+                    | (encoding_table[static_cast<uint8_t>(column_it[1])] << 4);
+        }
+
+        // The column ends in the lower half of a byte that is shared with the next column.
+        if (column_it != column_end)
+            *target = (*target & 0b11110000) | encoding_table[static_cast<uint8_t>(*column_it)];
+
+        buffered_column_id = no_buffered_column;
+    }
+};
+
+/*!\brief Trace matrix iterator for the pairwise alignment using the packed full trace matrix.
+ * \implements std::input_iterator
+ *
+ * \details
+ *
+ * Implements a counted iterator to keep track of the current column within the matrix. When dereferenced, the
+ * iterator returns a view over the buffered column. The returned view zips the three columns into a single range.
+ * Before the buffer is handed out for another column, the previously buffered column is packed into the matrix.
+ */
+template <typename trace_t>
+    requires std::same_as<trace_t, trace_directions>
+class trace_matrix_full_packed<trace_t>::iterator
+{
+private:
+    //!\brief A lightweight representation of the buffered column.
+    using single_trace_column_type = std::span<trace_t>;
+    //!\brief The type of the zipped score column.
+    using matrix_column_type = decltype(views::zip(std::declval<single_trace_column_type>(),
+                                                   std::declval<physical_column_t &>(),
+                                                   std::declval<virtual_column_t &>()));
+    //!\brief The column type as value type.
+    using matrix_column_value_t = std::vector<std::ranges::range_value_t<matrix_column_type>>;
+
+    // Defines a proxy that can be converted to the value type.
+    class column_proxy;
+
+    //!\brief The pointer to the underlying matrix.
+    trace_matrix_full_packed * host_ptr{nullptr};
+    //!\brief The current column index.
+    size_t current_column_id{};
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief The value type.
+    using value_type = matrix_column_value_t;
+    //!\brief The reference type.
+    using reference = column_proxy;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief The difference type.
+    using difference_type = std::ptrdiff_t;
+    //!\brief The iterator category.
+    using iterator_category = std::input_iterator_tag;
+    //!\}
+
+    /*!\name Constructor, assignment and destructor
+     * \{
+     */
+    iterator() noexcept = default;                             //!< Defaulted.
+    iterator(iterator const &) noexcept = default;             //!< Defaulted.
+    iterator(iterator &&) noexcept = default;                  //!< Defaulted.
+    iterator & operator=(iterator const &) noexcept = default; //!< Defaulted.
+    iterator & operator=(iterator &&) noexcept = default;      //!< Defaulted.
+    ~iterator() = default;                                     //!< Defaulted.
+
+    /*!\brief Initialises the iterator from the underlying matrix.
+     *
+     * \param[in] host_matrix The underlying matrix.
+     * \param[in] initial_column_id The initial column index.
+     */
+    explicit iterator(trace_matrix_full_packed & host_matrix, size_t const initial_column_id) noexcept :
+        host_ptr{std::addressof(host_matrix)},
+        current_column_id{initial_column_id}
+    {}
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\brief Returns the range over the current column.
+    reference operator*() const
+    {
+        if (host_ptr->buffered_column_id != current_column_id)
+        {
+            host_ptr->pack_buffered_column();
+            host_ptr->buffered_column_id = current_column_id;
+        }
+
+        return column_proxy{views::zip(single_trace_column_type{host_ptr->best_column},
+                                       host_ptr->horizontal_column,
+                                       host_ptr->vertical_column)};
+    }
+    //!\}
+
+    /*!\name Arithmetic operators
+     * \{
+     */
+    //!\brief Move `this` to the next column.
+    iterator & operator++()
+    {
+        ++current_column_id;
+        return *this;
+    }
+
+    //!\brief Move `this` to the next column.
+    void operator++(int)
+    {
+        ++(*this);
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Tests whether `lhs == rhs`.
+    friend bool operator==(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return lhs.current_column_id == rhs.current_column_id;
+    }
+
+    //!\brief Tests whether `lhs != rhs`.
+    friend bool operator!=(iterator const & lhs, iterator const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+};
+
+/*!\brief The proxy returned as reference type.
+ * \implements std::ranges::view
+ *
+ * \details
+ *
+ * The proxy stores the column view of the current iterator and offers a dedicated conversion operator to
+ * assign it to the value type of the iterator.
+ */
+template <typename trace_t>
+    requires std::same_as<trace_t, trace_directions>
+class trace_matrix_full_packed<trace_t>::iterator::column_proxy : public std::ranges::view_interface<column_proxy>
+{
+private:
+    //!\brief The represented column.
+    matrix_column_type column{};
+
+public:
+    /*!\name Constructor, assignment and destructor
+     * \{
+     */
+    column_proxy() = default;                                 //!< Defaulted.
+    column_proxy(column_proxy const &) = default;             //!< Defaulted.
+    column_proxy(column_proxy &&) = default;                  //!< Defaulted.
+    column_proxy & operator=(column_proxy const &) = default; //!< Defaulted.
+    column_proxy & operator=(column_proxy &&) = default;      //!< Defaulted.
+    ~column_proxy() = default;                                //!< Defaulted.
+
+    /*!\brief Initialises the proxy with the respective column.
+     *
+     * \param[in] column The column to set.
+     */
+    explicit column_proxy(matrix_column_type && column) noexcept : column{std::move(column)}
+    {}
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the begin of the column.
+    std::ranges::iterator_t<matrix_column_type> begin()
+    {
+        return column.begin();
+    }
+    //!\brief Const iterator is not accessible.
+    std::ranges::iterator_t<matrix_column_type> begin() const = delete;
+
+    //!\brief Returns a sentinel marking the end of the column.
+    std::ranges::sentinel_t<matrix_column_type> end()
+    {
+        return column.end();
+    }
+
+    //!\brief Const sentinel is not accessible.
+    std::ranges::sentinel_t<matrix_column_type> end() const = delete;
+    //!\}
+
+    //!\brief Implicitly converts the column proxy into the value type of the iterator.
+    constexpr operator matrix_column_value_t() const
+    {
+        matrix_column_value_t target{};
+        std::ranges::copy(column, std::back_inserter(target));
+        return target;
+    }
+};
+
+/*!\brief Random access iterator over the cells of the packed trace matrix.
+ * \implements seqan3::detail::two_dimensional_matrix_iterator
+ *
+ * \details
+ *
+ * Dereferencing the iterator decodes the four bit representation of the current cell and returns the
+ * seqan3::detail::trace_directions by value. The iterator is used to follow the trace path with the
+ * seqan3::detail::trace_iterator.
+ */
+template <typename trace_t>
+    requires std::same_as<trace_t, trace_directions>
+class trace_matrix_full_packed<trace_t>::cell_iterator :
+    public two_dimensional_matrix_iterator_base<cell_iterator, matrix_major_order::column>
+{
+private:
+    //!\brief The type of the base class.
+    using base_t = two_dimensional_matrix_iterator_base<cell_iterator, matrix_major_order::column>;
+
+    //!\brief Befriend the base class.
+    friend base_t;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief The value type.
+    using value_type = trace_directions;
+    //!\brief The reference type; the decoded value is returned by value.
+    using reference = trace_directions;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief The difference type.
+    using difference_type = std::ptrdiff_t;
+    //!\brief The iterator concept.
+    using iterator_concept = std::random_access_iterator_tag;
+    //!\brief The iterator category.
+    using iterator_category = std::input_iterator_tag;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr cell_iterator() = default;                                  //!< Defaulted.
+    constexpr cell_iterator(cell_iterator const &) = default;             //!< Defaulted.
+    constexpr cell_iterator(cell_iterator &&) = default;                  //!< Defaulted.
+    constexpr cell_iterator & operator=(cell_iterator const &) = default; //!< Defaulted.
+    constexpr cell_iterator & operator=(cell_iterator &&) = default;      //!< Defaulted.
+    ~cell_iterator() = default;                                           //!< Defaulted.
+
+    /*!\brief Constructs the iterator pointing to the cell with the given linear index.
+     * \param[in] matrix The underlying packed matrix.
+     * \param[in] cell_index The linear index of the cell in column major order.
+     */
+    constexpr cell_iterator(trace_matrix_full_packed const & matrix, difference_type const cell_index) noexcept :
+        matrix_ptr{std::addressof(matrix)},
+        host_iter{cell_index}
+    {}
+    //!\}
+
+    // Import advance operator from base class.
+    using base_t::operator+=;
+
+    //!\brief Returns the decoded trace directions of the current cell.
+    reference operator*() const noexcept
+    {
+        assert(matrix_ptr != nullptr);
+        return matrix_ptr->cell_at(host_iter);
+    }
+
+    //!\brief Advances the iterator by the given `offset`.
+    constexpr cell_iterator & operator+=(matrix_offset const & offset) noexcept
+    {
+        assert(matrix_ptr != nullptr);
+        host_iter += offset.col * static_cast<difference_type>(matrix_ptr->row_count) + offset.row;
+        return *this;
+    }
+
+    //!\copydoc seqan3::detail::two_dimensional_matrix_iterator::coordinate()
+    matrix_coordinate coordinate() const noexcept
+    {
+        assert(matrix_ptr != nullptr);
+        return {row_index_type{static_cast<size_t>(host_iter) % matrix_ptr->row_count},
+                column_index_type{static_cast<size_t>(host_iter) / matrix_ptr->row_count}};
+    }
+
+private:
+    //!\brief The underlying matrix.
+    trace_matrix_full_packed const * matrix_ptr{nullptr};
+    //!\brief The linear index of the current cell.
+    difference_type host_iter{};
+};
+
+} // namespace seqan3::detail
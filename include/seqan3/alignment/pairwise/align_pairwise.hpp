@@ -25,6 +25,7 @@
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/algorithm/algorithm_result_generator_range.hpp>
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
+#include <seqan3/core/algorithm/detail/algorithm_executor_streaming.hpp>
 #include <seqan3/core/detail/all_view.hpp>
 #include <seqan3/utility/simd/simd.hpp>
 #include <seqan3/utility/simd/simd_traits.hpp>
@@ -174,19 +175,27 @@ constexpr auto align_pairwise(sequence_t && sequences, alignment_config_t const
     using complete_config_t = std::remove_cvref_t<decltype(complete_config)>;
     using traits_t = detail::alignment_configuration_traits<complete_config_t>;
 
-    auto indexed_sequence_chunk_view =
-        views::zip(seq_view, std::views::iota(0)) | views::chunk(traits_t::alignments_per_vector);
+    // The configured algorithm determines how many sequence pairs are passed to it at once.
+    size_t const chunk_size = detail::alignment_configurator::chunk_size(complete_config);
+
+    auto indexed_sequence_chunk_view = views::zip(seq_view, std::views::iota(0)) | views::chunk(chunk_size);
 
     using indexed_sequences_t = decltype(indexed_sequence_chunk_view);
     using alignment_result_t = typename traits_t::alignment_result_type;
-    using execution_handler_t = std::conditional_t<complete_config_t::template exists<align_cfg::parallel>(),
-                                                   detail::execution_handler_parallel,
-                                                   detail::execution_handler_sequential>;
-    using executor_t = detail::
-        algorithm_executor_blocking<indexed_sequences_t, decltype(algorithm), alignment_result_t, execution_handler_t>;
+    constexpr bool is_parallel = complete_config_t::template exists<align_cfg::parallel>();
+    using execution_handler_t =
+        std::conditional_t<is_parallel, detail::execution_handler_parallel, detail::execution_handler_sequential>;
+    // In parallel mode, the results are streamed with a bounded number of chunks in flight.
+    using algorithm_t = decltype(algorithm);
+    using executor_t = std::conditional_t<
+        is_parallel,
+        detail::algorithm_executor_streaming<indexed_sequences_t, algorithm_t, alignment_result_t>,
+        detail::algorithm_executor_blocking<indexed_sequences_t, algorithm_t, alignment_result_t, execution_handler_t>>;
+
+    auto parallel = complete_config.get_or(align_cfg::parallel{});
 
     // Select the execution handler for the alignment configuration.
-    auto select_execution_handler = [parallel = complete_config.get_or(align_cfg::parallel{})]()
+    auto select_execution_handler = [&parallel]()
     {
         if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
         {
@@ -202,15 +211,51 @@ constexpr auto align_pairwise(sequence_t && sequences, alignment_config_t const
         }
     };
 
+    // Creates the executor over the chunked sequence pairs.
+    auto make_executor = [&]()
+    {
+        if constexpr (is_parallel)
+        {
+            // Without a streaming window, all chunks may be in flight at the same time.
+            return executor_t{std::move(indexed_sequence_chunk_view),
+                              std::move(algorithm),
+                              alignment_result_t{},
+                              select_execution_handler(),
+                              parallel.streaming_window,
+                              parallel.result_order == align_cfg::result_order::input};
+        }
+        else
+        {
+            return executor_t{std::move(indexed_sequence_chunk_view),
+                              std::move(algorithm),
+                              alignment_result_t{},
+                              select_execution_handler()};
+        }
+    };
+
     if constexpr (traits_t::is_one_way_execution) // Just compute alignment and wait until all alignments are computed.
-        select_execution_handler().bulk_execute(algorithm,
-                                                indexed_sequence_chunk_view,
-                                                get<align_cfg::on_result>(complete_config).callback);
+    {
+        auto & callback = get<align_cfg::on_result>(complete_config).callback;
+
+        if constexpr (is_parallel)
+        {
+            // In the streaming mode, the callback is invoked on the calling thread while the alignments are computed.
+            if (parallel.streaming_window > 0)
+            {
+                executor_t executor = make_executor();
+                for (auto result = executor.next_result(); result.has_value(); result = executor.next_result())
+                    callback(std::move(*result));
+
+                return;
+            }
+        }
+
+        select_execution_handler().bulk_execute(algorithm, indexed_sequence_chunk_view, callback);
+    }
     else // Require two way execution: return the range over the alignments.
-        return algorithm_result_generator_range{executor_t{std::move(indexed_sequence_chunk_view),
-                                                           std::move(algorithm),
-                                                           alignment_result_t{},
-                                                           select_execution_handler()}};
+    {
+        return algorithm_result_generator_range{make_executor()};
+    }
 }
 //!\endcond
 
@@ -15,6 +15,7 @@
 #include <optional>
 #include <ranges>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
 #include <seqan3/alignment/decorator/gap_decorator.hpp>
@@ -23,6 +24,7 @@
 #include <seqan3/alignment/matrix/detail/trace_directions.hpp>
 #include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/core/detail/template_inspection.hpp>
@@ -75,6 +77,10 @@ private:
                                     lazy<make_pairwise_alignment_type, first_range_t &, second_range_t &>,
                                     std::type_identity<disabled_type>>::type;
 
+    //!\brief The configured CIGAR sequence type if selected.
+    using configured_cigar_sequence_type =
+        std::conditional_t<traits_type::output_cigar, std::vector<cigar>, disabled_type>;
+
     //!\brief The configured sequence id type for the first sequence if selected.
     using configured_sequence1_id_type = std::conditional_t<traits_type::output_sequence1_id, uint32_t, disabled_type>;
     //!\brief The configured sequence id type for the second sequence if selected.
@@ -99,7 +105,8 @@ public:
                                              configured_begin_position_type,
                                              configured_alignment_type,
                                              configured_debug_score_matrix_type,
-                                             configured_debug_trace_matrix_type>;
+                                             configured_debug_trace_matrix_type,
+                                             configured_cigar_sequence_type>;
 };
 
 } // namespace seqan3::detail
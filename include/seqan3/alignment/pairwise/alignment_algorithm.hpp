@@ -22,6 +22,7 @@
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
 #include <seqan3/alignment/exception.hpp>
 #include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
 #include <seqan3/alignment/matrix/detail/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
@@ -419,7 +420,7 @@ private:
         // Allocate and initialise first column.
         this->allocate_matrix(sequence1, sequence2, band, this->alignment_state);
         using row_index_t = std::ranges::range_difference_t<sequence2_t>;
-        row_index_t last_row_index = this->score_matrix.band_row_index;
+        row_index_t last_row_index = this->score_matrix().band_row_index;
         initialise_first_alignment_column(std::views::take(sequence2, last_row_index));
 
         // ----------------------------------------------------------------------------
@@ -427,7 +428,7 @@ private:
         // ----------------------------------------------------------------------------
 
         row_index_t sequence2_size = std::ranges::distance(sequence2);
-        for (auto const & seq1_value : std::views::take(sequence1, this->score_matrix.band_col_index))
+        for (auto const & seq1_value : std::views::take(sequence1, this->score_matrix().band_col_index))
         {
             compute_alignment_column<true>(seq1_value, std::views::take(sequence2, ++last_row_index));
             // Only if band reached last row of matrix the last cell might be tracked.
@@ -439,7 +440,7 @@ private:
         // ----------------------------------------------------------------------------
 
         size_t first_row_index = 0;
-        for (auto const & seq1_value : std::views::drop(sequence1, this->score_matrix.band_col_index))
+        for (auto const & seq1_value : std::views::drop(sequence1, this->score_matrix().band_col_index))
         {
             // In the second phase the band moves in every column one base down on the second sequence.
             compute_alignment_column<false>(seq1_value, sequence2 | views::slice(first_row_index++, ++last_row_index));
@@ -484,7 +485,7 @@ private:
         // Finalise the last cell of the initial column.
         bool at_last_row = true;
         if constexpr (traits_t::is_banded) // If the band reaches until the last row of the matrix.
-            at_last_row = static_cast<size_t>(this->score_matrix.band_row_index) == this->score_matrix.num_rows - 1;
+            at_last_row = static_cast<size_t>(this->score_matrix().band_row_index) == this->score_matrix().num_rows - 1;
 
         finalise_last_cell_in_column(at_last_row);
     }
@@ -622,10 +623,27 @@ private:
                                                        row_index_type{this->alignment_state.optimum.row_index}};
             // At some point this needs to be refactored so that it is not necessary to adapt the coordinate.
             if constexpr (traits_t::is_banded)
-                res.end_positions.second += res.end_positions.first - this->trace_matrix.band_col_index;
+                res.end_positions.second += res.end_positions.first - this->trace_matrix().band_col_index;
         }
 
-        if constexpr (traits_t::compute_begin_positions)
+        if constexpr (traits_t::output_cigar)
+        {
+            detail::matrix_coordinate const optimum_coordinate{
+                detail::row_index_type{this->alignment_state.optimum.row_index},
+                detail::column_index_type{this->alignment_state.optimum.column_index}};
+            auto cigar_res = cigar_builder{}(this->trace_matrix().trace_path(optimum_coordinate));
+            res.cigar_sequence = std::move(cigar_res.cigar_sequence);
+
+            // The aligned sequences are only built if they were requested.
+            if constexpr (traits_t::compute_begin_positions && !traits_t::compute_sequence_alignment)
+            {
+                res.begin_positions.first = cigar_res.first_sequence_slice_positions.first;
+                res.begin_positions.second = cigar_res.second_sequence_slice_positions.first;
+            }
+        }
+
+        if constexpr (traits_t::compute_begin_positions
+                      && !(traits_t::output_cigar && !traits_t::compute_sequence_alignment))
         {
             // Get a aligned sequence builder for banded or un-banded case.
             aligned_sequence_builder builder{sequence1, sequence2};
@@ -633,7 +651,7 @@ private:
             detail::matrix_coordinate const optimum_coordinate{
                 detail::row_index_type{this->alignment_state.optimum.row_index},
                 detail::column_index_type{this->alignment_state.optimum.column_index}};
-            auto trace_res = builder(this->trace_matrix.trace_path(optimum_coordinate));
+            auto trace_res = builder(this->trace_matrix().trace_path(optimum_coordinate));
             res.begin_positions.first = trace_res.first_sequence_slice_positions.first;
             res.begin_positions.second = trace_res.second_sequence_slice_positions.first;
 
@@ -725,7 +743,7 @@ private:
 
         auto coord = get<1>(column.front()).coordinate;
         if constexpr (traits_t::is_banded)
-            coord.second += coord.first - this->score_matrix.band_col_index;
+            coord.second += coord.first - this->score_matrix().band_col_index;
 
         matrix_offset offset{row_index_type{static_cast<std::ptrdiff_t>(coord.second)},
                              column_index_type{static_cast<std::ptrdiff_t>(coord.first)}};
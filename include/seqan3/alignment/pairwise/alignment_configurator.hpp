@@ -25,11 +25,14 @@
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_full_banded.hpp>
 #include <seqan3/alignment/matrix/detail/combined_score_and_trace_matrix.hpp>
 #include <seqan3/alignment/matrix/detail/score_matrix_single_column.hpp>
-#include <seqan3/alignment/matrix/detail/trace_matrix_full.hpp>
+#include <seqan3/alignment/matrix/detail/trace_matrix_full_packed.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
 #include <seqan3/alignment/pairwise/alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/adaptive_banded_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/difference_recurrence_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/length_sorted_lane_scheduler.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_banded.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion.hpp>
@@ -41,7 +44,11 @@
 #include <seqan3/alignment/pairwise/detail/policy_optimum_tracker.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_optimum_tracker_simd.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/detail/seed_extension_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/spliced_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/pairwise/detail/wavefront_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/windowed_local_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_algorithm.hpp>
 #include <seqan3/alignment/pairwise/policy/affine_gap_init_policy.hpp>
 #include <seqan3/alignment/pairwise/policy/affine_gap_policy.hpp>
@@ -122,6 +129,16 @@ public:
 
         return (is_global || is_local);
     }
+
+    //!\brief Expects that the CIGAR sequence of a global alignment is not requested in the vectorised mode.
+    static constexpr bool expects_cigar_output_without_simd()
+    {
+        // Local alignments and seed extensions compute the traceback without vectorisation.
+        return !(alignment_config_type::template exists<align_cfg::output_cigar>()
+                 && alignment_config_type::template exists<align_cfg::vectorised>()
+                 && alignment_config_type::template exists<align_cfg::method_global>()
+                 && !alignment_config_type::template exists<align_cfg::seed_extension>());
+    }
 };
 
 /*!\brief Configures the alignment algorithm given the sequences and the configuration object.
@@ -140,7 +157,7 @@ private:
     private:
         //!\brief Indicates whether only the coordinate is required to compute the alignment.
         static constexpr bool only_coordinates =
-            !(traits_t::compute_begin_positions || traits_t::compute_sequence_alignment);
+            !(traits_t::compute_begin_positions || traits_t::compute_sequence_alignment || traits_t::output_cigar);
 
         //!\brief The selected score matrix for either banded or unbanded alignments.
         using score_matrix_t =
@@ -311,6 +328,11 @@ public:
                       "Either the scoring scheme was not configured or the given scoring scheme cannot be invoked with "
                       "the value types of the passed sequences.");
 
+        static_assert(alignment_contract_t::expects_cigar_output_without_simd(),
+                      "Alignment configuration error: "
+                      "The align_cfg::output_cigar configuration cannot be combined with align_cfg::vectorised for "
+                      "global alignments.");
+
         // ----------------------------------------------------------------------------
         // Configure the algorithm
         // ----------------------------------------------------------------------------
@@ -320,7 +342,11 @@ public:
         auto const & gap_cost = config_with_result_type.get_or(edit_gap_cost);
         auto const & scoring_scheme = get<align_cfg::scoring_scheme>(cfg).scheme;
 
-        if constexpr (config_t::template exists<seqan3::align_cfg::method_global>())
+        if constexpr (config_t::template exists<seqan3::align_cfg::method_global>()
+                      && !config_t::template exists<align_cfg::wavefront>()
+                      && !config_t::template exists<align_cfg::band_adaptive>()
+                      && !config_t::template exists<align_cfg::gap_cost_splice>()
+                      && !config_t::template exists<align_cfg::seed_extension>())
         {
             // Only use edit distance if ...
             auto method_global_cfg = get<seqan3::align_cfg::method_global>(config_with_result_type);
@@ -361,6 +387,36 @@ public:
                          config_with_result_type};
     }
 
+    /*!\brief Returns the number of sequence pairs passed to the configured algorithm at once.
+     * \tparam config_t The alignment configuration type.
+     * \param[in] cfg The configuration object returned by seqan3::detail::alignment_configurator::configure.
+     *
+     * \details
+     *
+     * Without vectorisation, one alignment is computed at a time. In the vectorised mode, the chunk holds as many
+     * sequence pairs as are computed in one SIMD vector; with seqan3::align_cfg::score_encoding::difference as many
+     * as fit into a SIMD vector of 8 bit lanes. If a seqan3::align_cfg::length_sorting_window is given, the chunk
+     * size is rounded up to a multiple of this number.
+     */
+    template <typename config_t>
+    static size_t chunk_size(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        size_t lane_count = traits_t::alignments_per_vector;
+        if constexpr (traits_t::is_vectorised)
+        {
+            auto const & vectorised_cfg = get<align_cfg::vectorised>(cfg);
+            if (vectorised_cfg.score_encoding == align_cfg::score_encoding::difference)
+                lane_count = std::max(lane_count, simd_traits<simd_type_t<int8_t>>::length);
+
+            size_t const window = vectorised_cfg.length_sorting_window;
+            lane_count = std::max(lane_count, (window + lane_count - 1) / lane_count * lane_count);
+        }
+
+        return lane_count;
+    }
+
 private:
     /*!\brief Adds maybe the default output arguments if the user did not provide any.
      *
@@ -461,6 +517,49 @@ private:
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_scoring_scheme(config_t const & cfg);
 
+    /*!\brief Wraps the vectorised alignment algorithm into a seqan3::detail::length_sorted_lane_scheduler if
+     *        requested.
+     *
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t The alignment configuration type.
+     * \tparam algorithm_t The type of the configured alignment algorithm.
+     *
+     * \param[in] cfg The passed configuration object.
+     * \param[in] algorithm The configured alignment algorithm.
+     * \param[in] lane_count The number of sequence pairs the algorithm computes at once.
+     *
+     * \returns the alignment algorithm wrapped in the passed std::function object.
+     *
+     * \details
+     *
+     * If the seqan3::align_cfg::vectorised configuration specifies a seqan3::align_cfg::length_sorting_window, the
+     * algorithm is invoked by the seqan3::detail::length_sorted_lane_scheduler, which packs the sequence pairs of a
+     * window sorted by their lengths into the SIMD lanes. The scheduler is also used without sorting if the chunks
+     * passed to the algorithm (see seqan3::detail::alignment_configurator::chunk_size) are larger than the number of
+     * sequence pairs the algorithm can compute at once. Otherwise the algorithm is wrapped directly.
+     */
+    template <typename function_wrapper_t, typename config_t, typename algorithm_t>
+    static function_wrapper_t schedule_lanes(config_t const & cfg,
+                                             algorithm_t && algorithm,
+                                             size_t const lane_count =
+                                                 alignment_configuration_traits<config_t>::alignments_per_vector)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+        using plain_algorithm_t = std::remove_cvref_t<algorithm_t>;
+
+        if constexpr (traits_t::is_vectorised)
+        {
+            bool const sort_by_length = get<align_cfg::vectorised>(cfg).length_sorting_window > 0;
+            if (sort_by_length || chunk_size(cfg) > lane_count)
+                return function_wrapper_t{length_sorted_lane_scheduler<traits_t, plain_algorithm_t>{
+                    std::forward<algorithm_t>(algorithm),
+                    lane_count,
+                    sort_by_length}};
+        }
+
+        return function_wrapper_t{std::forward<algorithm_t>(algorithm)};
+    }
+
     /*!\brief Constructs the actual alignment algorithm wrapped in the passed std::function object.
      *
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
@@ -484,25 +583,106 @@ private:
         // refactor step-by-step to the new implementation. The new implementation will be tested in
         // macrobenchmarks to show that it maintains a high performance.
 
+        //--------------------------------------------------------------------------------------------------------------
+        // Select the scoring scheme used inside of the algorithm.
+        //--------------------------------------------------------------------------------------------------------------
+
+        using alignment_method_t = std::
+            conditional_t<traits_t::is_global, seqan3::align_cfg::method_global, seqan3::align_cfg::method_local>;
+
+        using score_t = typename traits_t::score_type;
+        using scoring_scheme_t = typename traits_t::scoring_scheme_type;
+        constexpr bool is_aminoacid_scheme = is_type_specialisation_of_v<scoring_scheme_t, aminoacid_scoring_scheme>;
+
+        using simple_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
+                                                        lazy<simd_match_mismatch_scoring_scheme,
+                                                             score_t,
+                                                             typename traits_t::scoring_scheme_alphabet_type,
+                                                             alignment_method_t>,
+                                                        void>;
+        using matrix_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
+                                                        lazy<simd_matrix_scoring_scheme,
+                                                             score_t,
+                                                             typename traits_t::scoring_scheme_alphabet_type,
+                                                             alignment_method_t>,
+                                                        void>;
+
+        using alignment_scoring_scheme_t =
+            std::conditional_t<traits_t::is_vectorised,
+                               std::conditional_t<is_aminoacid_scheme, matrix_simd_scheme_t, simple_simd_scheme_t>,
+                               scoring_scheme_t>;
+
+        // Use the difference recurrence if it was selected by the user and can be applied to the configuration.
+        if constexpr (traits_t::is_vectorised && traits_t::is_global && !traits_t::is_wavefront
+                      && !traits_t::is_seed_extension && !traits_t::is_debug
+                      && !traits_t::requires_trace_information)
+        {
+            using difference_algorithm_t = difference_recurrence_alignment_algorithm<config_t>;
+
+            if (difference_algorithm_t::is_applicable(cfg))
+                return schedule_lanes<function_wrapper_t>(cfg,
+                                                          difference_algorithm_t{cfg},
+                                                          difference_algorithm_t::alignments_per_vector);
+        }
+
+        // Use the spliced alignment if it was selected by the user.
+        if constexpr (traits_t::is_spliced)
+        {
+            return spliced_alignment_algorithm<config_t>{cfg};
+        }
+        // Use the adaptive band if it was selected by the user.
+        else if constexpr (traits_t::is_adaptive_banded)
+        {
+            return adaptive_banded_alignment_algorithm<config_t>{cfg};
+        }
+        // Use the wavefront alignment algorithm if it was selected by the user.
+        else if constexpr (traits_t::is_wavefront)
+        {
+            return wavefront_alignment_algorithm<config_t>{cfg};
+        }
+        // Use the seed extension if it was selected by the user.
+        else if constexpr (traits_t::is_seed_extension)
+        {
+            using algorithm_t = seed_extension_algorithm<config_t, alignment_scoring_scheme_t>;
+            return schedule_lanes<function_wrapper_t>(cfg, algorithm_t{cfg});
+        }
+        // Compute the traceback of a local alignment only within the window of the optimal alignment.
+        else if constexpr (traits_t::is_local && (traits_t::compute_sequence_alignment || traits_t::output_cigar)
+                           && !traits_t::is_banded && !traits_t::is_debug)
+        {
+            using indexed_sequence_pair_chunk_t =
+                typename alignment_function_traits<function_wrapper_t>::sequence_input_type;
+            using windowed_algorithm_t = windowed_local_alignment_algorithm<config_t, indexed_sequence_pair_chunk_t>;
+            // The window is always aligned in scalar mode.
+            using scalar_scoring_scheme_policy_t = deferred_crtp_base<scoring_scheme_policy, scoring_scheme_t>;
+
+            return function_wrapper_t{windowed_algorithm_t{
+                cfg,
+                make_algorithm<typename windowed_algorithm_t::score_function_type, policies_t...>(
+                    windowed_algorithm_t::make_score_configuration(cfg)),
+                make_algorithm<typename windowed_algorithm_t::window_function_type, scalar_scoring_scheme_policy_t>(
+                    windowed_algorithm_t::make_window_configuration(cfg))}};
+        }
         // Use old alignment implementation if...
-        if constexpr (traits_t::is_local ||                   // it is a local alignment,
-                      traits_t::is_debug ||                   // it runs in debug mode,
-                      traits_t::compute_sequence_alignment || // it computes more than the begin position.
-                      (traits_t::is_banded && traits_t::compute_begin_positions)
-                      || // banded && more than end positions.
-                      (traits_t::is_vectorised && traits_t::compute_end_positions)) // simd and more than the score.
+        else if constexpr (traits_t::is_local ||                   // it is a local alignment,
+                           traits_t::is_debug ||                   // it runs in debug mode,
+                           traits_t::compute_sequence_alignment || // it computes more than the begin position.
+                           (traits_t::is_banded && (traits_t::compute_begin_positions || traits_t::output_cigar))
+                           || // banded && more than end positions.
+                           (traits_t::is_vectorised && traits_t::compute_end_positions)) // simd and more than the score.
         {
             using matrix_policy_t = typename select_matrix_policy<traits_t>::type;
             using gap_policy_t = typename select_gap_policy<traits_t>::type;
             using find_optimum_t = typename select_find_optimum_policy<traits_t>::type;
             using gap_init_policy_t = deferred_crtp_base<affine_gap_init_policy>;
 
-            return alignment_algorithm<config_t,
-                                       matrix_policy_t,
-                                       gap_policy_t,
-                                       find_optimum_t,
-                                       gap_init_policy_t,
-                                       policies_t...>{cfg};
+            using algorithm_t = alignment_algorithm<config_t,
+                                                    matrix_policy_t,
+                                                    gap_policy_t,
+                                                    find_optimum_t,
+                                                    gap_init_policy_t,
+                                                    policies_t...>;
+            return schedule_lanes<function_wrapper_t>(cfg, algorithm_t{cfg});
         }
         else // Use new alignment algorithm implementation.
         {
@@ -534,32 +714,6 @@ private:
             // Configure the scoring scheme policy.
             //----------------------------------------------------------------------------------------------------------
 
-            using alignment_method_t = std::
-                conditional_t<traits_t::is_global, seqan3::align_cfg::method_global, seqan3::align_cfg::method_local>;
-
-            using score_t = typename traits_t::score_type;
-            using scoring_scheme_t = typename traits_t::scoring_scheme_type;
-            constexpr bool is_aminoacid_scheme =
-                is_type_specialisation_of_v<scoring_scheme_t, aminoacid_scoring_scheme>;
-
-            using simple_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
-                                                            lazy<simd_match_mismatch_scoring_scheme,
-                                                                 score_t,
-                                                                 typename traits_t::scoring_scheme_alphabet_type,
-                                                                 alignment_method_t>,
-                                                            void>;
-            using matrix_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
-                                                            lazy<simd_matrix_scoring_scheme,
-                                                                 score_t,
-                                                                 typename traits_t::scoring_scheme_alphabet_type,
-                                                                 alignment_method_t>,
-                                                            void>;
-
-            using alignment_scoring_scheme_t =
-                std::conditional_t<traits_t::is_vectorised,
-                                   std::conditional_t<is_aminoacid_scheme, matrix_simd_scheme_t, simple_simd_scheme_t>,
-                                   scoring_scheme_t>;
-
             using scoring_scheme_policy_t = policy_scoring_scheme<config_t, alignment_scoring_scheme_t>;
 
             //----------------------------------------------------------------------------------------------------------
@@ -567,7 +721,7 @@ private:
             //----------------------------------------------------------------------------------------------------------
 
             using score_matrix_t = score_matrix_single_column<score_t>;
-            using trace_matrix_t = trace_matrix_full<trace_directions>;
+            using trace_matrix_t = trace_matrix_full_packed<trace_directions>;
 
             using alignment_matrix_t =
                 std::conditional_t<traits_t::requires_trace_information,
@@ -586,7 +740,7 @@ private:
                                                              result_builder_policy_t,
                                                              scoring_scheme_policy_t,
                                                              alignment_matrix_policy_t>;
-            return algorithm_t{cfg};
+            return schedule_lanes<function_wrapper_t>(cfg, algorithm_t{cfg});
         }
     }
 };
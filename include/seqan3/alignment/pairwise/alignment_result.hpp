@@ -14,6 +14,7 @@
 #pragma once
 
 #include <optional>
+#include <string>
 
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/core/debug_stream/debug_stream_type.hpp>
@@ -38,6 +39,7 @@ class policy_alignment_result_builder;
  * \tparam alignment_t           The type of the alignment, can be omitted.
  * \tparam score_debug_matrix_t  The type of the score matrix. Only present if seqan3::align_cfg::detail::debug is enabled.
  * \tparam trace_debug_matrix_t  The type of the trace matrix. Only present if seqan3::align_cfg::detail::debug is enabled.
+ * \tparam cigar_sequence_t      The type of the CIGAR representation of the alignment, can be omitted.
  */
 template <typename sequence1_id_t,
           typename sequence2_id_t,
@@ -46,7 +48,8 @@ template <typename sequence1_id_t,
           typename begin_positions_t = std::nullopt_t *,
           typename alignment_t = std::nullopt_t *,
           typename score_debug_matrix_t = std::nullopt_t *,
-          typename trace_debug_matrix_t = std::nullopt_t *>
+          typename trace_debug_matrix_t = std::nullopt_t *,
+          typename cigar_sequence_t = std::nullopt_t *>
 struct alignment_result_value_type
 {
     //! \brief The alignment identifier for the first sequence.
@@ -66,6 +69,9 @@ struct alignment_result_value_type
     score_debug_matrix_t score_debug_matrix{};
     //!\brief The trace matrix. Only accessible with seqan3::align_cfg::detail::debug.
     trace_debug_matrix_t trace_debug_matrix{};
+
+    //!\brief The CIGAR representation of the alignment.
+    cigar_sequence_t cigar_sequence{};
 };
 
 /*!\name Type deduction guides
@@ -166,6 +172,8 @@ private:
     using begin_positions_t = decltype(data.begin_positions);
     //! \brief The type for the alignment.
     using alignment_t = decltype(data.alignment);
+    //! \brief The type for the CIGAR representation of the alignment.
+    using cigar_sequence_t = decltype(data.cigar_sequence);
     //!\}
 
     //!\brief Befriend alignment result builder.
@@ -308,6 +316,20 @@ public:
                       "Trying to access the alignment, although it was not requested in the alignment configuration.");
         return data.alignment;
     }
+
+    /*!\brief Returns the CIGAR representation of the alignment.
+     * \return A std::vector over seqan3::cigar elements, which represent the alignment.
+     *
+     * \note This function is only available if the CIGAR representation was requested via the alignment configuration
+     * (see seqan3::align_cfg::output_cigar).
+     */
+    constexpr cigar_sequence_t const & cigar_sequence() const noexcept
+    {
+        static_assert(!std::is_same_v<cigar_sequence_t, std::nullopt_t *>,
+                      "Trying to access the CIGAR sequence, although it was not requested in the alignment "
+                      "configuration.");
+        return data.cigar_sequence;
+    }
     //!\}
 
     //!\cond DEV
@@ -400,6 +422,8 @@ inline debug_stream_type<char_t> & operator<<(debug_stream_type<char_t> & stream
     constexpr bool has_begin_positions =
         !std::is_same_v<decltype(std::declval<result_data_t>().begin_positions), disabled_t>;
     constexpr bool has_alignment = !std::is_same_v<decltype(std::declval<result_data_t>().alignment), disabled_t>;
+    constexpr bool has_cigar_sequence =
+        !std::is_same_v<decltype(std::declval<result_data_t>().cigar_sequence), disabled_t>;
 
     bool prepend_comma = false;
     auto append_to_stream = [&](auto &&... args)
@@ -421,6 +445,8 @@ inline debug_stream_type<char_t> & operator<<(debug_stream_type<char_t> & stream
         append_to_stream("end: (", result.sequence1_end_position(), ",", result.sequence2_end_position(), ")");
     if constexpr (has_alignment)
         append_to_stream("\nalignment:\n", result.alignment());
+    if constexpr (has_cigar_sequence)
+        append_to_stream("cigar: ", result.cigar_sequence());
     stream << '}';
 
     return stream;
@@ -236,6 +236,23 @@
  * \note If there was a configuration that is not suitable for the edit distance algorithm the standard alignment
  *       algorithm is executed as a fallback.
  *
+ * For global alignments of similar sequences, the gap-affine wavefront alignment algorithm can be selected explicitly
+ * with seqan3::align_cfg::wavefront. Its runtime depends on the score of the optimal alignment instead of the product
+ * of the sequence lengths, i.e. **O(ns)**, where `s` is the alignment penalty. It requires a scoring scheme that only
+ * distinguishes between matches and mismatches and cannot be combined with free end-gaps, banded, local, or vectorised
+ * alignments.
+ *
+ * To extend a seed, i.e. a short exact match between two sequences, seqan3::align_cfg::seed_extension can be added to
+ * a global alignment configuration. It computes the alignment anchored at the beginning (right extension) or at the
+ * end (left extension) of both sequences and stops as soon as the score drops more than the configured X-drop or
+ * Z-drop below the best score seen so far. Only the cells around the best scoring path are computed, and many seeds can
+ * be extended at once by adding seqan3::align_cfg::vectorised.
+ *
+ * To align RNA sequences against a genomic region, seqan3::align_cfg::gap_cost_splice adds a separate intron state to
+ * the affine gap recursion. Introns of any length are scored with a constant penalty and, optionally, a penalty for
+ * splice sites that do not match the canonical GT-AG motif. The introns are reported as `N` operations of the CIGAR
+ * string.
+ *
  * # Computing banded alignments
  *
  * \include{doc} doc/fragments/alignment_configuration_align_config_band.md
@@ -0,0 +1,387 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::adaptive_banded_alignment_algorithm.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/recorded_trace_path.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/alignment_algorithm_helper.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Implements the global alignment with an adaptive band.
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ * \tparam alignment_configuration_t The type of the alignment configuration; must be a type specialisation of
+ *                                   seqan3::configuration.
+ *
+ * \details
+ *
+ * The matrix is computed anti-diagonal by anti-diagonal, where only `w` consecutive cells of every anti-diagonal are
+ * computed (see seqan3::align_cfg::band_adaptive). The band of an anti-diagonal is described by the row of its
+ * upper-right cell. After computing an anti-diagonal, the band of the next anti-diagonal is shifted one cell to the
+ * right if the score of the upper-right cell is at least the score of the lower-left cell, otherwise it is shifted
+ * one cell down. Hence, every cell of the next band can be computed from the cells of the two preceding bands and the
+ * cells of the band always have a predecessor within the band.
+ * The band is always moved down once its upper-right cell reached the last column and always moved to the right once
+ * its lower-left cell reached the last row. This guarantees that the band of the last anti-diagonal contains the
+ * bottom-right cell of the matrix.
+ *
+ * Only the scores of the last three anti-diagonals are kept in memory. If the begin positions, the alignment or the
+ * CIGAR string are requested, the trace directions of all bands are stored, which requires \f$ O((n+m)*w) \f$ memory
+ * instead of \f$ O(n*m) \f$ for the full trace matrix. The buffers are kept thread local such that they can be reused
+ * for all sequence pairs that are aligned by the same thread.
+ */
+template <typename alignment_configuration_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class adaptive_banded_alignment_algorithm
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using score_type = typename traits_type::score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The type of the scoring scheme.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(traits_type::is_global, "The adaptive band only supports global alignments.");
+    static_assert(!traits_type::is_vectorised, "The adaptive banded alignment cannot be vectorised.");
+
+    //!\brief The score of cells that are outside of the band or the matrix.
+    static constexpr score_type minus_infinity = std::numeric_limits<score_type>::lowest() / 2;
+
+    //!\brief The buffers of the band that are reused for every sequence pair.
+    struct band_buffer
+    {
+        //!\brief The best scores of the last three anti-diagonals.
+        std::vector<score_type> best{};
+        //!\brief The scores of the horizontal gaps of the last two anti-diagonals.
+        std::vector<score_type> horizontal{};
+        //!\brief The scores of the vertical gaps of the last two anti-diagonals.
+        std::vector<score_type> vertical{};
+        //!\brief The trace directions of the cells of all bands.
+        std::vector<trace_directions> trace{};
+        //!\brief The row of the upper-right cell of the band for every anti-diagonal.
+        std::vector<int64_t> first_row{};
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    adaptive_banded_alignment_algorithm() = default;                                            //!< Defaulted.
+    adaptive_banded_alignment_algorithm(adaptive_banded_alignment_algorithm const &) = default; //!< Defaulted.
+    adaptive_banded_alignment_algorithm(adaptive_banded_alignment_algorithm &&) = default;      //!< Defaulted.
+    adaptive_banded_alignment_algorithm &
+    operator=(adaptive_banded_alignment_algorithm const &) = default;                                  //!< Defaulted.
+    adaptive_banded_alignment_algorithm & operator=(adaptive_banded_alignment_algorithm &&) = default; //!< Defaulted.
+    ~adaptive_banded_alignment_algorithm() = default;                                                  //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band width is 0 or if free end-gaps were configured.
+     */
+    adaptive_banded_alignment_algorithm(alignment_configuration_t const & config) :
+        scoring_scheme{get<align_cfg::scoring_scheme>(config).scheme},
+        band_width{get<align_cfg::band_adaptive>(config).width}
+    {
+        reject_free_end_gaps(config, "The adaptive band");
+
+        if (band_width == 0)
+            throw invalid_alignment_configuration{"The width of the adaptive band must be positive."};
+
+        auto gap_cost =
+            config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+        gap_open_score = gap_cost.open_score + gap_cost.extension_score;
+        gap_extension_score = gap_cost.extension_score;
+    }
+    //!\}
+
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with the configured alignment result type.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * Computes for each contained sequence pair the respective alignment and invokes the given callback for each
+     * alignment result.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        thread_local band_buffer buffer{};
+        thread_local recorded_trace_path trace_path{};
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            score_type const score = compute_band(get<0>(sequence_pair), get<1>(sequence_pair), buffer);
+            size_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+            size_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+
+            make_alignment_result_and_invoke<traits_type, alignment_result_type>(
+                std::forward<decltype(sequence_pair)>(sequence_pair),
+                std::move(idx),
+                score,
+                matrix_coordinate{row_index_type{0u}, column_index_type{0u}},
+                matrix_coordinate{row_index_type{sequence2_size}, column_index_type{sequence1_size}},
+                trace_path,
+                [&](recorded_trace_path & path)
+                {
+                    compute_trace_path(buffer, sequence1_size, sequence2_size, path);
+                },
+                callback);
+        }
+    }
+
+private:
+    /*!\brief Computes the bands of all anti-diagonals.
+     * \param[in] sequence1 The first sequence, i.e. the columns of the matrix.
+     * \param[in] sequence2 The second sequence, i.e. the rows of the matrix.
+     * \param[in,out] buffer The buffers to compute the band in.
+     * \returns The score of the bottom-right cell of the matrix.
+     */
+    template <std::ranges::random_access_range sequence1_t, std::ranges::random_access_range sequence2_t>
+    score_type compute_band(sequence1_t && sequence1, sequence2_t && sequence2, band_buffer & buffer) const
+    {
+        int64_t const sequence1_size = std::ranges::distance(sequence1);
+        int64_t const sequence2_size = std::ranges::distance(sequence2);
+        int64_t const last_anti_diagonal = sequence1_size + sequence2_size;
+        int64_t const width = band_width;
+
+        // Every anti-diagonal is padded with one cell on both sides, which always stores minus infinity. The cells of
+        // the preceding anti-diagonals are accessed relative to the current band with an offset of at most one cell.
+        size_t const stride = band_width + 2;
+        buffer.best.assign(3 * stride, minus_infinity);
+        buffer.horizontal.assign(2 * stride, minus_infinity);
+        buffer.vertical.assign(2 * stride, minus_infinity);
+
+        if constexpr (traits_type::requires_trace_information)
+        {
+            buffer.trace.resize((last_anti_diagonal + 1) * band_width);
+            buffer.first_row.resize(last_anti_diagonal + 1);
+        }
+
+        auto sequence1_it = std::ranges::begin(sequence1);
+        auto sequence2_it = std::ranges::begin(sequence2);
+
+        int64_t first_row = 0;
+        int64_t previous_first_row = 0;
+        int64_t second_previous_first_row = 0;
+
+        for (int64_t anti_diagonal = 0; anti_diagonal <= last_anti_diagonal; ++anti_diagonal)
+        {
+            score_type * best = buffer.best.data() + (anti_diagonal % 3) * stride + 1;
+            score_type const * previous_best = buffer.best.data() + ((anti_diagonal + 2) % 3) * stride + 1;
+            score_type const * second_previous_best = buffer.best.data() + ((anti_diagonal + 1) % 3) * stride + 1;
+            score_type * horizontal = buffer.horizontal.data() + (anti_diagonal % 2) * stride + 1;
+            score_type const * previous_horizontal = buffer.horizontal.data() + ((anti_diagonal + 1) % 2) * stride + 1;
+            score_type * vertical = buffer.vertical.data() + (anti_diagonal % 2) * stride + 1;
+            score_type const * previous_vertical = buffer.vertical.data() + ((anti_diagonal + 1) % 2) * stride + 1;
+
+            // The cell (row, column) is stored at index `row - first_row` of its anti-diagonal.
+            int64_t const shift = first_row - previous_first_row;
+            int64_t const second_shift = first_row - second_previous_first_row;
+
+            // Only the cells with 0 <= column <= |sequence1| and row <= |sequence2| are part of the matrix.
+            int64_t const cell_begin = std::clamp<int64_t>(anti_diagonal - sequence1_size - first_row, 0, width);
+            int64_t const cell_end =
+                std::clamp<int64_t>(std::min(sequence2_size, anti_diagonal) - first_row + 1, cell_begin, width);
+
+            std::fill(best, best + cell_begin, minus_infinity);
+            std::fill(horizontal, horizontal + cell_begin, minus_infinity);
+            std::fill(vertical, vertical + cell_begin, minus_infinity);
+
+            [[maybe_unused]] trace_directions * trace{};
+            if constexpr (traits_type::requires_trace_information)
+            {
+                buffer.first_row[anti_diagonal] = first_row;
+                trace = buffer.trace.data() + anti_diagonal * band_width;
+                std::fill(trace, trace + width, trace_directions::none);
+            }
+
+            for (int64_t cell = cell_begin; cell < cell_end; ++cell)
+            {
+                int64_t const row = first_row + cell;
+                int64_t const column = anti_diagonal - row;
+
+                if (row == 0 && column == 0)
+                {
+                    best[cell] = 0;
+                    horizontal[cell] = minus_infinity;
+                    vertical[cell] = minus_infinity;
+                    continue;
+                }
+
+                // The horizontal gap comes from the left cell, the vertical gap from the cell above.
+                score_type const horizontal_open = previous_best[cell + shift] + gap_open_score;
+                score_type const horizontal_extension = previous_horizontal[cell + shift] + gap_extension_score;
+                score_type const vertical_open = previous_best[cell + shift - 1] + gap_open_score;
+                score_type const vertical_extension = previous_vertical[cell + shift - 1] + gap_extension_score;
+
+                horizontal[cell] = std::max(horizontal_open, horizontal_extension);
+                vertical[cell] = std::max(vertical_open, vertical_extension);
+
+                score_type diagonal = minus_infinity;
+                if (row > 0 && column > 0)
+                    diagonal = second_previous_best[cell + second_shift - 1]
+                             + scoring_scheme.score(sequence1_it[column - 1], sequence2_it[row - 1]);
+
+                best[cell] = std::max({diagonal, horizontal[cell], vertical[cell]});
+
+                if constexpr (traits_type::requires_trace_information)
+                {
+                    // Like the trace iterator, prefer the diagonal over the vertical over the horizontal direction
+                    // and extending a gap over opening it.
+                    trace_directions direction = (diagonal >= std::max(horizontal[cell], vertical[cell]))
+                                                   ? trace_directions::diagonal
+                                                   : (vertical[cell] >= horizontal[cell]) ? trace_directions::up
+                                                                                          : trace_directions::left;
+                    if (horizontal_open > horizontal_extension)
+                        direction |= trace_directions::carry_left_open;
+                    if (vertical_open > vertical_extension)
+                        direction |= trace_directions::carry_up_open;
+
+                    trace[cell] = direction;
+                }
+            }
+
+            std::fill(best + cell_end, best + width, minus_infinity);
+            std::fill(horizontal + cell_end, horizontal + width, minus_infinity);
+            std::fill(vertical + cell_end, vertical + width, minus_infinity);
+
+            // ---------------------------------------------------------------------
+            // Move the band to the right or down.
+            // ---------------------------------------------------------------------
+
+            bool move_down{};
+            if (anti_diagonal - first_row >= sequence1_size) // The upper-right cell reached the last column.
+                move_down = true;
+            else if (first_row + width - 1 >= sequence2_size) // The lower-left cell reached the last row.
+                move_down = false;
+            else
+                move_down = best[width - 1] > best[0];
+
+            second_previous_first_row = previous_first_row;
+            previous_first_row = first_row;
+            first_row += move_down;
+        }
+
+        // The band of the last anti-diagonal starts in the bottom-right cell.
+        assert(previous_first_row == sequence2_size);
+        return buffer.best[(last_anti_diagonal % 3) * stride + 1];
+    }
+
+    /*!\brief Reconstructs the trace path of the alignment from the stored trace directions of the bands.
+     * \param[in] buffer The buffers filled by compute_band.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     * \param[out] trace_path The path to record the trace in.
+     */
+    void compute_trace_path(band_buffer const & buffer,
+                            int64_t const sequence1_size,
+                            int64_t const sequence2_size,
+                            recorded_trace_path & trace_path) const
+    {
+        enum struct state
+        {
+            best,
+            horizontal,
+            vertical
+        };
+
+        trace_path.clear(matrix_coordinate{row_index_type{static_cast<size_t>(sequence2_size)},
+                                           column_index_type{static_cast<size_t>(sequence1_size)}});
+
+        int64_t row = sequence2_size;
+        int64_t column = sequence1_size;
+        state current_state = state::best;
+
+        while (row > 0 || column > 0)
+        {
+            int64_t const anti_diagonal = row + column;
+            int64_t const cell = row - buffer.first_row[anti_diagonal];
+            assert(cell >= 0 && cell < static_cast<int64_t>(band_width));
+            trace_directions const direction = buffer.trace[anti_diagonal * band_width + cell];
+
+            if (current_state == state::best)
+            {
+                if ((direction & trace_directions::diagonal) == trace_directions::diagonal)
+                {
+                    trace_path.push_back(trace_directions::diagonal);
+                    --row;
+                    --column;
+                    continue;
+                }
+
+                current_state = ((direction & trace_directions::left) == trace_directions::left) ? state::horizontal
+                                                                                                 : state::vertical;
+            }
+
+            // Gaps are either opened from the best score of the preceding cell or extended from the same gap.
+            if (current_state == state::horizontal)
+            {
+                trace_path.push_back(trace_directions::left);
+                if ((direction & trace_directions::carry_left_open) == trace_directions::carry_left_open)
+                    current_state = state::best;
+                --column;
+            }
+            else
+            {
+                trace_path.push_back(trace_directions::up);
+                if ((direction & trace_directions::carry_up_open) == trace_directions::carry_up_open)
+                    current_state = state::best;
+                --row;
+            }
+        }
+    }
+
+    //!\brief The scoring scheme.
+    scoring_scheme_type scoring_scheme{};
+    //!\brief The number of cells of the band on every anti-diagonal.
+    size_t band_width{};
+    //!\brief The score of the first gap character, i.e. the sum of the gap open and the gap extension score.
+    score_type gap_open_score{};
+    //!\brief The score of every further gap character.
+    score_type gap_extension_score{};
+};
+
+} // namespace seqan3::detail
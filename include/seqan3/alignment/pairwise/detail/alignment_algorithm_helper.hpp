@@ -0,0 +1,161 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides helper functions shared by the alignment algorithms that record their trace path explicitly.
+ */
+
+#pragma once
+
+#include <concepts>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/recorded_trace_path.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Returns whether any end-gaps are free in the seqan3::align_cfg::method_global of the configuration.
+ * \ingroup alignment_pairwise
+ * \tparam alignment_configuration_t The type of the alignment configuration.
+ * \param[in] config The alignment configuration.
+ * \returns `false` if the configuration contains no seqan3::align_cfg::method_global.
+ */
+template <typename alignment_configuration_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+constexpr bool has_free_end_gaps(alignment_configuration_t const & config)
+{
+    auto const method_global_config = config.get_or(align_cfg::method_global{});
+
+    return method_global_config.free_end_gaps_sequence1_leading || method_global_config.free_end_gaps_sequence1_trailing
+        || method_global_config.free_end_gaps_sequence2_leading
+        || method_global_config.free_end_gaps_sequence2_trailing;
+}
+
+/*!\brief Throws if any end-gaps are free in the configuration.
+ * \ingroup alignment_pairwise
+ * \tparam alignment_configuration_t The type of the alignment configuration.
+ * \param[in] config The alignment configuration.
+ * \param[in] algorithm_name The name of the algorithm used in the error message, e.g. "The seed extension".
+ * \throws seqan3::invalid_alignment_configuration if seqan3::detail::has_free_end_gaps is `true`.
+ */
+template <typename alignment_configuration_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+void reject_free_end_gaps(alignment_configuration_t const & config, std::string const & algorithm_name)
+{
+    if (has_free_end_gaps(config))
+        throw invalid_alignment_configuration{algorithm_name + " does not support free end-gaps."};
+}
+
+/*!\brief Creates the configured alignment result and invokes the callback with it.
+ * \ingroup alignment_pairwise
+ * \tparam traits_t The seqan3::detail::alignment_configuration_traits of the configuration.
+ * \tparam alignment_result_t The type of the alignment result; a specialisation of seqan3::alignment_result.
+ * \param[in] sequence_pair The aligned sequence pair.
+ * \param[in] id The index of the sequence pair.
+ * \param[in] score The score of the alignment.
+ * \param[in] begin The begin positions of the alignment.
+ * \param[in] end The end positions of the alignment.
+ * \param[in,out] trace_path The buffer to record the trace path in.
+ * \param[in] compute_trace_path Records the trace path of the alignment in the given
+ *                               seqan3::detail::recorded_trace_path; only invoked if the alignment or the CIGAR string
+ *                               is configured. It may return a CIGAR sequence, which is used instead of the one built
+ *                               from the trace path.
+ * \param[in] callback The callback to invoke with the alignment result.
+ *
+ * \details
+ *
+ * This is the seqan3::detail::policy_alignment_result_builder::make_result_and_invoke of the alignment algorithms that
+ * do not store a trace matrix but record the trace path explicitly, e.g. seqan3::detail::wavefront_alignment_algorithm.
+ */
+template <typename traits_t,
+          typename alignment_result_t,
+          typename sequence_pair_t,
+          typename index_t,
+          typename score_t,
+          typename compute_trace_path_t,
+          typename callback_t>
+void make_alignment_result_and_invoke(sequence_pair_t && sequence_pair,
+                                      [[maybe_unused]] index_t && id,
+                                      [[maybe_unused]] score_t const score,
+                                      [[maybe_unused]] matrix_coordinate const & begin,
+                                      [[maybe_unused]] matrix_coordinate const & end,
+                                      [[maybe_unused]] recorded_trace_path & trace_path,
+                                      [[maybe_unused]] compute_trace_path_t && compute_trace_path,
+                                      callback_t & callback)
+{
+    using std::get;
+    using result_value_type = typename alignment_result_value_type_accessor<alignment_result_t>::type;
+
+    result_value_type result{};
+
+    if constexpr (traits_t::output_sequence1_id)
+        result.sequence1_id = id;
+
+    if constexpr (traits_t::output_sequence2_id)
+        result.sequence2_id = id;
+
+    if constexpr (traits_t::compute_score)
+        result.score = score;
+
+    if constexpr (traits_t::compute_end_positions)
+    {
+        result.end_positions.first = end.col;
+        result.end_positions.second = end.row;
+    }
+
+    if constexpr (traits_t::compute_begin_positions)
+    {
+        result.begin_positions.first = begin.col;
+        result.begin_positions.second = begin.row;
+    }
+
+    if constexpr (traits_t::compute_sequence_alignment || traits_t::output_cigar)
+    {
+        using cigar_sequence_t = std::invoke_result_t<compute_trace_path_t, recorded_trace_path &>;
+
+        auto make_alignment = [&]()
+        {
+            if constexpr (traits_t::compute_sequence_alignment)
+            {
+                aligned_sequence_builder builder{get<0>(sequence_pair), get<1>(sequence_pair)};
+                result.alignment = std::move(builder(trace_path).alignment);
+            }
+        };
+
+        if constexpr (std::same_as<cigar_sequence_t, void>)
+        {
+            compute_trace_path(trace_path);
+            make_alignment();
+
+            if constexpr (traits_t::output_cigar)
+                result.cigar_sequence = std::move(cigar_builder{}(trace_path).cigar_sequence);
+        }
+        else
+        {
+            [[maybe_unused]] cigar_sequence_t cigar_sequence = compute_trace_path(trace_path);
+            make_alignment();
+
+            if constexpr (traits_t::output_cigar)
+                result.cigar_sequence = std::move(cigar_sequence);
+        }
+    }
+
+    callback(alignment_result_t{std::move(result)});
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,459 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::anti_diagonal_alignment_kernel.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/scoring/scoring_scheme_concept.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/container/aligned_allocator.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the score of a single global alignment with affine gaps along the anti-diagonals of the matrix.
+ * \ingroup alignment_pairwise
+ * \tparam score_t The score type; must model std::signed_integral.
+ * \tparam scoring_scheme_t The type of the scoring scheme.
+ *
+ * \details
+ *
+ * The cells of an anti-diagonal of the alignment matrix only depend on the two previous anti-diagonals. Hence, all
+ * cells of an anti-diagonal can be computed at once and the kernel processes
+ * seqan3::detail::anti_diagonal_alignment_kernel::cells_per_vector consecutive cells of an anti-diagonal in one simd
+ * vector. In contrast to the inter-sequence vectorisation of seqan3::align_cfg::vectorised, this speeds up the
+ * computation of a single sequence pair, e.g. when comparing two contigs.
+ *
+ * The first sequence is stored in reverse order, such that the symbols of both sequences compared along an
+ * anti-diagonal are stored contiguously. If the scoring scheme assigns the same score to all matches and the same
+ * score to all mismatches of the sequence alphabet, the substitution scores are obtained with a vectorised comparison
+ * of the ranks. Otherwise they are looked up in a table of the scores of all rank pairs.
+ *
+ * The kernel computes the same recursion as seqan3::detail::policy_affine_gap_recursion for a global alignment
+ * without free end-gaps and returns the score of the last cell of the matrix. Cells outside of the band given by the
+ * lower and the upper diagonal are treated as minus infinity.
+ */
+template <std::signed_integral score_t, typename scoring_scheme_t>
+class anti_diagonal_alignment_kernel
+{
+private:
+    //!\brief The simd type storing consecutive cells of an anti-diagonal.
+    using simd_score_type = simd_type_t<score_t>;
+    //!\brief The type of the buffers storing an anti-diagonal or a sequence.
+    using buffer_type = std::vector<score_t, aligned_allocator<score_t, alignof(simd_score_type)>>;
+
+public:
+    //!\brief The number of cells of an anti-diagonal computed in one simd vector.
+    static constexpr size_t cells_per_vector = simd_traits<simd_score_type>::length;
+
+    /*!\brief The minimal number of cells per anti-diagonal for which the kernel is used.
+     *
+     * \details
+     *
+     * Every anti-diagonal has a constant overhead for its boundary cells, which only pays off if the anti-diagonals
+     * span several simd vectors.
+     */
+    static constexpr size_t minimal_anti_diagonal_size = 4 * cells_per_vector;
+
+    /*!\brief The number of rows that are computed together.
+     *
+     * \details
+     *
+     * The seven anti-diagonals of a strip that are kept in memory occupy about 28 KiB, i.e. they fit into the first
+     * level cache.
+     */
+    static constexpr size_t strip_size = 4096 / sizeof(score_t);
+
+    /*!\brief Whether sequences over `alphabet_t` can be aligned with this kernel.
+     * \tparam alphabet_t The alphabet type of the sequences.
+     *
+     * \details
+     *
+     * The alphabet must model seqan3::semialphabet, its ranks must be representable by the score type and the
+     * scoring scheme must be able to score two of its symbols.
+     */
+    template <typename alphabet_t>
+    static constexpr bool is_supported_alphabet = []() constexpr
+    {
+        if constexpr (semialphabet<alphabet_t>)
+            return alphabet_size<alphabet_t> <= std::numeric_limits<score_t>::max()
+                && scoring_scheme_for<scoring_scheme_t, alphabet_t>;
+        else
+            return false;
+    }();
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    anti_diagonal_alignment_kernel() = default;                                                   //!< Defaulted.
+    anti_diagonal_alignment_kernel(anti_diagonal_alignment_kernel const &) = default;             //!< Defaulted.
+    anti_diagonal_alignment_kernel(anti_diagonal_alignment_kernel &&) = default;                  //!< Defaulted.
+    anti_diagonal_alignment_kernel & operator=(anti_diagonal_alignment_kernel const &) = default; //!< Defaulted.
+    anti_diagonal_alignment_kernel & operator=(anti_diagonal_alignment_kernel &&) = default;      //!< Defaulted.
+    ~anti_diagonal_alignment_kernel() = default;                                                  //!< Defaulted.
+
+    /*!\brief Constructs the kernel from the scoring scheme and the gap scores.
+     * \param[in] scoring_scheme The scoring scheme.
+     * \param[in] gap_open_score The gap open score; must not be positive.
+     * \param[in] gap_extension_score The gap extension score; must not be positive.
+     *
+     * \details
+     *
+     * As in seqan3::align_cfg::gap_cost_affine, a gap of size \f$ k \f$ is scored with
+     * \f$ gap\_open\_score + k \cdot gap\_extension\_score \f$.
+     */
+    anti_diagonal_alignment_kernel(scoring_scheme_t scoring_scheme,
+                                   score_t const gap_open_score,
+                                   score_t const gap_extension_score) :
+        scoring_scheme{std::move(scoring_scheme)},
+        gap_open_score{static_cast<score_t>(gap_open_score + gap_extension_score)},
+        gap_extension_score{gap_extension_score}
+    {
+        assert(gap_open_score <= 0 && gap_extension_score <= 0);
+    }
+    //!\}
+
+    /*!\brief Whether the kernel is faster than the column-wise computation for the given matrix.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     * \param[in] lower_diagonal The lower diagonal of the band.
+     * \param[in] upper_diagonal The upper diagonal of the band.
+     */
+    bool is_profitable(size_t const sequence1_size,
+                       size_t const sequence2_size,
+                       int64_t const lower_diagonal,
+                       int64_t const upper_diagonal) const noexcept
+    {
+        size_t const band_size = (upper_diagonal - lower_diagonal) / 2;
+        return cells_per_vector > 1
+            && std::min({sequence1_size, sequence2_size, band_size}) >= minimal_anti_diagonal_size;
+    }
+
+    /*!\brief Computes the score of the global alignment of the given sequences.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range with the same
+     *                     value type as `sequence1_t`.
+     *
+     * \param[in] sequence1 The first sequence, whose symbols correspond to the columns of the matrix.
+     * \param[in] sequence2 The second sequence, whose symbols correspond to the rows of the matrix.
+     * \param[in] lower_diagonal The lower diagonal of the band; must not be positive.
+     * \param[in] upper_diagonal The upper diagonal of the band; must not be negative.
+     *
+     * \returns The score of the last cell of the alignment matrix.
+     *
+     * \details
+     *
+     * The band must contain the last cell of the matrix. For an unbanded alignment, pass the negative size of the
+     * second sequence as the lower diagonal and the size of the first sequence as the upper diagonal.
+     *
+     * The matrix is computed in strips of seqan3::detail::anti_diagonal_alignment_kernel::strip_size rows, such that
+     * the anti-diagonals of a strip fit into the first level cache. Only the last row of a strip is stored for the
+     * computation of the next strip.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+        requires std::same_as<std::ranges::range_value_t<sequence1_t>, std::ranges::range_value_t<sequence2_t>>
+              && is_supported_alphabet<std::ranges::range_value_t<sequence1_t>>
+    score_t operator()(sequence1_t && sequence1,
+                       sequence2_t && sequence2,
+                       int64_t const lower_diagonal,
+                       int64_t const upper_diagonal) const
+    {
+        assert(lower_diagonal <= 0 && upper_diagonal >= 0);
+
+        using alphabet_t = std::ranges::range_value_t<sequence1_t>;
+
+        matrix_state state{};
+        state.lower_diagonal = lower_diagonal;
+        state.upper_diagonal = upper_diagonal;
+        state.sequence1_size = std::ranges::distance(sequence1);
+        state.sequence2_size = std::ranges::distance(sequence2);
+
+        assert(state.sequence1_size - state.sequence2_size >= lower_diagonal
+               && state.sequence1_size - state.sequence2_size <= upper_diagonal);
+
+        // The scores of all pairs of ranks; the score of the ranks `r1` and `r2` is stored at `r1 * σ + r2`.
+        state.score_table.resize(alphabet_size<alphabet_t> * alphabet_size<alphabet_t>);
+        for (size_t lhs = 0; lhs < alphabet_size<alphabet_t>; ++lhs)
+            for (size_t rhs = 0; rhs < alphabet_size<alphabet_t>; ++rhs)
+                state.score_table[lhs * alphabet_size<alphabet_t> + rhs] =
+                    scoring_scheme.score(assign_rank_to(lhs, alphabet_t{}), assign_rank_to(rhs, alphabet_t{}));
+
+        state.alphabet_size = alphabet_size<alphabet_t>;
+        state.match_score = state.score_table[0];
+        state.mismatch_score = state.score_table[std::min<size_t>(1, alphabet_size<alphabet_t> - 1)];
+        for (size_t lhs = 0; lhs < alphabet_size<alphabet_t>; ++lhs)
+            for (size_t rhs = 0; rhs < alphabet_size<alphabet_t>; ++rhs)
+                state.has_uniform_scores &= state.score_table[lhs * alphabet_size<alphabet_t> + rhs]
+                                         == ((lhs == rhs) ? state.match_score : state.mismatch_score);
+
+        // A cell outside of the band is derived from at most three other cells before it is reset.
+        int64_t const lowest_step =
+            std::min<int64_t>({0, gap_open_score, gap_extension_score, std::ranges::min(state.score_table)});
+        state.minus_infinity = static_cast<score_t>(std::numeric_limits<score_t>::lowest() - 3 * lowest_step);
+
+        // Pad the sequences such that the last simd vector of an anti-diagonal can be read completely.
+        buffer_type & reversed_ranks1 = state.reversed_ranks1;
+        reversed_ranks1.assign(state.sequence1_size + cells_per_vector, 0);
+        std::ranges::transform(sequence1,
+                               reversed_ranks1.rend() - state.sequence1_size,
+                               [](auto const & symbol)
+                               {
+                                   return static_cast<score_t>(seqan3::to_rank(symbol));
+                               });
+        state.ranks2.assign(state.sequence2_size + cells_per_vector, 0);
+        std::ranges::transform(sequence2,
+                               state.ranks2.begin(),
+                               [](auto const & symbol)
+                               {
+                                   return static_cast<score_t>(seqan3::to_rank(symbol));
+                               });
+
+        // Initialise the first row of the matrix, i.e. H[0, j] = o + e * j inside of the band.
+        state.row_optimal.assign(state.sequence1_size + 1, state.minus_infinity);
+        state.row_vertical.assign(state.sequence1_size + 1, state.minus_infinity);
+        state.row_optimal[0] = 0;
+        for (int64_t column = 1; column <= std::min(state.sequence1_size, upper_diagonal); ++column)
+            state.row_optimal[column] = gap_score(column);
+
+        for (int64_t first_row = 0; first_row < state.sequence2_size; first_row += strip_size)
+            compute_strip(state, first_row, std::min<int64_t>(strip_size, state.sequence2_size - first_row));
+
+        return state.row_optimal[state.sequence1_size];
+    }
+
+private:
+    //!\brief The state of the matrix computation, which is shared by all strips.
+    struct matrix_state
+    {
+        //!\brief The size of the first sequence.
+        int64_t sequence1_size{};
+        //!\brief The size of the second sequence.
+        int64_t sequence2_size{};
+        //!\brief The lower diagonal of the band.
+        int64_t lower_diagonal{};
+        //!\brief The upper diagonal of the band.
+        int64_t upper_diagonal{};
+
+        //!\brief The size of the sequence alphabet.
+        size_t alphabet_size{};
+        //!\brief The scores of all pairs of ranks.
+        std::vector<score_t> score_table{};
+        //!\brief Whether all matches and all mismatches have the same score.
+        bool has_uniform_scores{true};
+        //!\brief The score of a match if all matches have the same score.
+        score_t match_score{};
+        //!\brief The score of a mismatch if all mismatches have the same score.
+        score_t mismatch_score{};
+        //!\brief The score of cells outside of the band, which stays representable when adding other scores to it.
+        score_t minus_infinity{};
+
+        //!\brief The ranks of the first sequence in reverse order.
+        buffer_type reversed_ranks1{};
+        //!\brief The ranks of the second sequence.
+        buffer_type ranks2{};
+        //!\brief The optimal scores of the last row of the previous strip.
+        buffer_type row_optimal{};
+        //!\brief The vertical gap scores of the last row of the previous strip.
+        buffer_type row_vertical{};
+    };
+
+    /*!\brief Computes a strip of rows of the alignment matrix along its anti-diagonals.
+     * \param[in,out] state The state of the matrix computation.
+     * \param[in] first_row The row preceding the strip, whose scores are stored in the state.
+     * \param[in] row_count The number of rows of the strip.
+     *
+     * \details
+     *
+     * Within the strip, the row `first_row` has the local index 0 and the anti-diagonal `d` contains the cells
+     * `(l, d - l)`. The local index 0 of every anti-diagonal is loaded from the stored row, and the cells of the last
+     * row of the strip replace it when they are computed.
+     */
+    void compute_strip(matrix_state & state, int64_t const first_row, int64_t const row_count) const
+    {
+        // The buffers are reused by all strips computed on the same thread.
+        static thread_local std::array<buffer_type, 3> optimal_scores{}; // Anti-diagonals d, d - 1 and d - 2.
+        static thread_local std::array<buffer_type, 2> horizontal_scores{}; // Anti-diagonals d and d - 1.
+        static thread_local std::array<buffer_type, 2> vertical_scores{}; // Anti-diagonals d and d - 1.
+
+        // Pad the anti-diagonals such that the last simd vector can be written completely.
+        size_t const anti_diagonal_buffer_size = row_count + 2 + cells_per_vector;
+        for (buffer_type & buffer : optimal_scores)
+            buffer.assign(anti_diagonal_buffer_size, state.minus_infinity);
+        for (buffer_type & buffer : horizontal_scores)
+            buffer.assign(anti_diagonal_buffer_size, state.minus_infinity);
+        for (buffer_type & buffer : vertical_scores)
+            buffer.assign(anti_diagonal_buffer_size, state.minus_infinity);
+
+        simd_score_type const gap_open_vector = simd::fill<simd_score_type>(gap_open_score);
+        simd_score_type const gap_extension_vector = simd::fill<simd_score_type>(gap_extension_score);
+        simd_score_type const match_vector = simd::fill<simd_score_type>(state.match_score);
+        simd_score_type const mismatch_vector = simd::fill<simd_score_type>(state.mismatch_score);
+
+        auto max = [](simd_score_type const & lhs, simd_score_type const & rhs)
+        {
+            return (lhs < rhs) ? rhs : lhs;
+        };
+
+        // The band in local coordinates, i.e. the cell (l, j) is inside of the band if lower <= j - l <= upper.
+        int64_t const lower_diagonal = state.lower_diagonal + first_row;
+        int64_t const upper_diagonal = state.upper_diagonal + first_row;
+        int64_t const sequence1_size = state.sequence1_size;
+
+        // The first anti-diagonal with a cell in the strip; its two predecessors provide the stored row.
+        int64_t const first_anti_diagonal = std::max<int64_t>(0, 1 + std::max<int64_t>(0, 1 + lower_diagonal) - 2);
+        int64_t const last_anti_diagonal = row_count + std::min(sequence1_size, row_count + upper_diagonal);
+
+        score_t const * ranks1 = state.reversed_ranks1.data() + sequence1_size;
+        score_t const * ranks2 = state.ranks2.data() + first_row - 1;
+
+        for (int64_t anti_diagonal = first_anti_diagonal; anti_diagonal <= last_anti_diagonal; ++anti_diagonal)
+        {
+            // Rotate the buffers, such that the index 0 refers to the current anti-diagonal.
+            std::ranges::rotate(optimal_scores, optimal_scores.end() - 1);
+            std::ranges::swap(horizontal_scores[0], horizontal_scores[1]);
+            std::ranges::swap(vertical_scores[0], vertical_scores[1]);
+
+            score_t * current_optimal = optimal_scores[0].data();
+            score_t const * previous_optimal = optimal_scores[1].data();
+            score_t const * second_previous_optimal = optimal_scores[2].data();
+            score_t * current_horizontal = horizontal_scores[0].data();
+            score_t const * previous_horizontal = horizontal_scores[1].data();
+            score_t * current_vertical = vertical_scores[0].data();
+            score_t const * previous_vertical = vertical_scores[1].data();
+
+            // The local index 0 refers to the stored row.
+            bool const is_inside_of_row = anti_diagonal <= sequence1_size;
+            current_optimal[0] = is_inside_of_row ? state.row_optimal[anti_diagonal] : state.minus_infinity;
+            current_horizontal[0] = state.minus_infinity;
+            current_vertical[0] = is_inside_of_row ? state.row_vertical[anti_diagonal] : state.minus_infinity;
+
+            // The local rows of the cells on the current anti-diagonal that are inside of the strip and the band.
+            int64_t const first_local_row =
+                std::max<int64_t>({1, anti_diagonal - sequence1_size, ceil_half(anti_diagonal - upper_diagonal)});
+            int64_t const last_local_row =
+                std::min<int64_t>({row_count, anti_diagonal, floor_half(anti_diagonal - lower_diagonal)});
+
+            // The inner cells exclude the cells of the first column.
+            int64_t const last_inner_row = std::min<int64_t>(last_local_row, anti_diagonal - 1);
+            int64_t row = first_local_row;
+
+            for (; row <= last_inner_row; row += cells_per_vector)
+            {
+                // The column of the cell in this row is anti_diagonal - row.
+                simd_score_type const rank1 = simd::load<simd_score_type>(ranks1 - anti_diagonal + row);
+                simd_score_type const rank2 = simd::load<simd_score_type>(ranks2 + row);
+
+                simd_score_type sequence_score{};
+                if (state.has_uniform_scores)
+                {
+                    sequence_score = (rank1 == rank2) ? match_vector : mismatch_vector;
+                }
+                else
+                {
+                    for (size_t lane = 0; lane < cells_per_vector; ++lane)
+                        sequence_score[lane] = state.score_table[rank1[lane] * state.alphabet_size + rank2[lane]];
+                }
+
+                simd_score_type const diagonal =
+                    simd::load<simd_score_type>(second_previous_optimal + row - 1) + sequence_score;
+                simd_score_type const horizontal =
+                    max(simd::load<simd_score_type>(previous_horizontal + row) + gap_extension_vector,
+                        simd::load<simd_score_type>(previous_optimal + row) + gap_open_vector);
+                simd_score_type const vertical =
+                    max(simd::load<simd_score_type>(previous_vertical + row - 1) + gap_extension_vector,
+                        simd::load<simd_score_type>(previous_optimal + row - 1) + gap_open_vector);
+
+                simd::store(current_optimal + row, max(diagonal, max(horizontal, vertical)));
+                simd::store(current_horizontal + row, horizontal);
+                simd::store(current_vertical + row, vertical);
+            }
+
+            // Reset the cells next to the current anti-diagonal and the cells written by the last simd vector beyond
+            // its end, since they are read when computing the next two anti-diagonals.
+            auto reset = [&](int64_t const local_row)
+            {
+                current_optimal[local_row] = state.minus_infinity;
+                current_horizontal[local_row] = state.minus_infinity;
+                current_vertical[local_row] = state.minus_infinity;
+            };
+
+            int64_t const last_written_row = (first_local_row <= last_inner_row) ? row - 1 : last_local_row + 1;
+
+            if (first_local_row > 1)
+                reset(first_local_row - 1);
+            int64_t const first_stale_row = std::max<int64_t>(1, last_local_row + 1);
+            for (int64_t local_row = first_stale_row; local_row <= last_written_row; ++local_row)
+                reset(local_row);
+
+            // Initialise the cell of the first column, i.e. V[i, 0] = o + e * i.
+            if (anti_diagonal > 0 && first_local_row <= anti_diagonal && last_local_row == anti_diagonal)
+            {
+                reset(anti_diagonal);
+                current_optimal[anti_diagonal] = gap_score(first_row + anti_diagonal);
+            }
+
+            // Store the cell of the last row of the strip for the next strip.
+            if (first_local_row <= row_count && row_count <= last_local_row)
+            {
+                state.row_optimal[anti_diagonal - row_count] = current_optimal[row_count];
+                state.row_vertical[anti_diagonal - row_count] = current_vertical[row_count];
+            }
+        }
+
+        // The cells of the stored row that are left of the band in the last row of the strip.
+        int64_t const first_column_before = std::max<int64_t>(0, state.lower_diagonal + first_row);
+        int64_t const first_column_after = std::max<int64_t>(0, state.lower_diagonal + first_row + row_count);
+        for (int64_t column = first_column_before; column < std::min(first_column_after, sequence1_size + 1); ++column)
+        {
+            state.row_optimal[column] = state.minus_infinity;
+            state.row_vertical[column] = state.minus_infinity;
+        }
+    }
+
+    //!\brief Returns the score of a gap of the given size.
+    score_t gap_score(int64_t const size) const noexcept
+    {
+        return static_cast<score_t>(gap_open_score + (size - 1) * gap_extension_score);
+    }
+
+    //!\brief Returns \f$ \lfloor value / 2 \rfloor \f$.
+    static constexpr int64_t floor_half(int64_t const value) noexcept
+    {
+        return (value >= 0) ? value / 2 : -((1 - value) / 2);
+    }
+
+    //!\brief Returns \f$ \lceil value / 2 \rceil \f$.
+    static constexpr int64_t ceil_half(int64_t const value) noexcept
+    {
+        return (value >= 0) ? (value + 1) / 2 : -((-value) / 2);
+    }
+
+    //!\brief The scoring scheme.
+    scoring_scheme_t scoring_scheme{};
+    //!\brief The score for opening a gap including the score for its first extension.
+    score_t gap_open_score{};
+    //!\brief The score for extending a gap.
+    score_t gap_extension_score{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,375 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::difference_recurrence_alignment_algorithm.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/policy_alignment_result_builder.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/detail/simd_match_mismatch_scoring_scheme.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/utility/container/aligned_allocator.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+#include <seqan3/utility/simd/views/to_simd.hpp>
+#include <seqan3/utility/views/elements.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes vectorised global alignment scores with the difference recurrence in 8 bit lanes.
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ * \tparam alignment_configuration_t The type of the alignment configuration; must be a type specialisation of
+ *                                   seqan3::configuration.
+ *
+ * \details
+ *
+ * Instead of the absolute scores of the cells, the algorithm stores for every cell the difference to the left and to
+ * the upper cell as well as the differences of the horizontal and vertical gap scores to the cell score
+ * (Suzuki and Kasahara, 2018). With \f$ \Delta V_{i,j} = H_{i,j} - H_{i-1,j} \f$,
+ * \f$ \Delta H_{i,j} = H_{i,j} - H_{i,j-1} \f$, \f$ X_{i,j} = E_{i,j+1} - H_{i,j} \f$ and
+ * \f$ Y_{i,j} = F_{i+1,j} - H_{i,j} \f$ the affine gap recursion becomes:
+ *
+ * \f[
+ * \begin{aligned}
+ * Z_{i,j} &= \max(s(i, j), X_{i,j-1} + \Delta V_{i,j-1}, Y_{i-1,j} + \Delta H_{i-1,j}) \\
+ * \Delta V_{i,j} &= Z_{i,j} - \Delta H_{i-1,j} \\
+ * \Delta H_{i,j} &= Z_{i,j} - \Delta V_{i,j-1} \\
+ * X_{i,j} &= \max(X_{i,j-1} - \Delta H_{i,j}, o) + e \\
+ * Y_{i,j} &= \max(Y_{i-1,j} - \Delta V_{i,j}, o) + e
+ * \end{aligned}
+ * \f]
+ *
+ * where \f$ o \f$ is the gap open and \f$ e \f$ the gap extension score. All these values are bounded by the gap and
+ * substitution scores and do not grow with the sequence lengths. Hence, they are stored in simd vectors over
+ * `int8_t`, which pack four times as many alignments as the default 32 bit scores. The score of a sequence pair is
+ * obtained by adding up the vertical differences of its last column to the score of the first row.
+ *
+ * Every lane of the simd vectors computes another sequence pair. The algorithm can be invoked with any number of
+ * sequence pairs and processes them in batches of seqan3::detail::difference_recurrence_alignment_algorithm::
+ * alignments_per_vector pairs. Use seqan3::detail::difference_recurrence_alignment_algorithm::is_applicable to check
+ * whether a configuration can be computed with this algorithm.
+ */
+template <typename alignment_configuration_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class difference_recurrence_alignment_algorithm :
+    protected policy_alignment_result_builder<alignment_configuration_t>
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type without the simd conversion.
+    using original_score_type = typename traits_type::original_score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The alphabet type of the configured scoring scheme.
+    using alphabet_type = typename traits_type::scoring_scheme_alphabet_type;
+    //!\brief The simd type storing the differences.
+    using simd_score_type = simd_type_t<int8_t>;
+    //!\brief The vectorised scoring scheme.
+    using simd_scoring_scheme_type =
+        simd_match_mismatch_scoring_scheme<simd_score_type, alphabet_type, align_cfg::method_global>;
+    //!\brief The type of the buffers storing one simd vector per sequence position.
+    using simd_buffer_type = std::vector<simd_score_type, aligned_allocator<simd_score_type, alignof(simd_score_type)>>;
+    //!\brief The type used to sum up the differences.
+    using sum_type = std::common_type_t<original_score_type, int32_t>;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+
+public:
+    //!\brief The number of alignments computed in one simd vector.
+    static constexpr size_t alignments_per_vector = simd_traits<simd_score_type>::length;
+
+    /*!\brief Whether the alignment configuration can be computed with this algorithm.
+     * \param[in] config The alignment configuration to check.
+     *
+     * \details
+     *
+     * The configuration must describe a vectorised global alignment without a band and without free end-gaps that
+     * computes no more than the score and the end positions and selects seqan3::align_cfg::score_encoding::difference.
+     * The scoring scheme must assign the same score to all matches and the same score to all mismatches and the
+     * differences must be representable in 8 bits, i.e. \f$ 2|o + e| + \max(|match|, |mismatch|) \leq 127 \f$.
+     */
+    static bool is_applicable(alignment_configuration_t const & config)
+    {
+        if constexpr (!traits_type::is_vectorised || !traits_type::is_global || traits_type::is_banded
+                      || traits_type::requires_trace_information
+                      || is_type_specialisation_of_v<typename traits_type::scoring_scheme_type,
+                                                     aminoacid_scoring_scheme>
+                      || (alphabet_size<alphabet_type> > 127))
+        {
+            return false;
+        }
+        else
+        {
+            if (get<align_cfg::vectorised>(config).score_encoding != align_cfg::score_encoding::difference)
+                return false;
+
+            auto method_global_config = get<align_cfg::method_global>(config);
+            if (method_global_config.free_end_gaps_sequence1_leading
+                || method_global_config.free_end_gaps_sequence1_trailing
+                || method_global_config.free_end_gaps_sequence2_leading
+                || method_global_config.free_end_gaps_sequence2_trailing)
+            {
+                return false;
+            }
+
+            auto const & scheme = get<align_cfg::scoring_scheme>(config).scheme;
+            auto score_of = [&](size_t const lhs, size_t const rhs)
+            {
+                return static_cast<int64_t>(
+                    scheme.score(assign_rank_to(lhs, alphabet_type{}), assign_rank_to(rhs, alphabet_type{})));
+            };
+
+            int64_t const match_score = score_of(0, 0);
+            int64_t const mismatch_score = score_of(0, 1);
+            for (size_t lhs = 0; lhs < alphabet_size<alphabet_type>; ++lhs)
+                for (size_t rhs = 0; rhs < alphabet_size<alphabet_type>; ++rhs)
+                    if (score_of(lhs, rhs) != ((lhs == rhs) ? match_score : mismatch_score))
+                        return false;
+
+            auto gap_cost =
+                config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+            int64_t const gap_score = std::abs(static_cast<int64_t>(gap_cost.open_score) + gap_cost.extension_score);
+
+            return gap_cost.open_score <= 0 && gap_cost.extension_score <= 0
+                && 2 * gap_score + std::max(std::abs(match_score), std::abs(mismatch_score)) <= 127;
+        }
+    }
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Defaulted.
+    difference_recurrence_alignment_algorithm() = default;
+    //!\brief Defaulted.
+    difference_recurrence_alignment_algorithm(difference_recurrence_alignment_algorithm const &) = default;
+    //!\brief Defaulted.
+    difference_recurrence_alignment_algorithm(difference_recurrence_alignment_algorithm &&) = default;
+    //!\brief Defaulted.
+    difference_recurrence_alignment_algorithm & operator=(difference_recurrence_alignment_algorithm const &) = default;
+    //!\brief Defaulted.
+    difference_recurrence_alignment_algorithm & operator=(difference_recurrence_alignment_algorithm &&) = default;
+    //!\brief Defaulted.
+    ~difference_recurrence_alignment_algorithm() = default;
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm; must be applicable (see
+     *               seqan3::detail::difference_recurrence_alignment_algorithm::is_applicable).
+     */
+    difference_recurrence_alignment_algorithm(alignment_configuration_t const & config) :
+        policy_alignment_result_builder<alignment_configuration_t>{config},
+        scoring_scheme{get<align_cfg::scoring_scheme>(config).scheme}
+    {
+        assert(is_applicable(config));
+
+        auto gap_cost =
+            config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+        gap_open_score = gap_cost.open_score;
+        gap_extension_score = gap_cost.extension_score;
+    }
+    //!\}
+
+    /*!\brief Computes the scores of the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with the configured alignment result type.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * Computes batches of at most seqan3::detail::difference_recurrence_alignment_algorithm::alignments_per_vector
+     * sequence pairs and invokes the callback for every sequence pair in the order of the given range.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        auto batch_end = std::ranges::begin(indexed_sequence_pairs);
+        while (batch_end != std::ranges::end(indexed_sequence_pairs))
+        {
+            auto batch_begin = batch_end;
+            std::ranges::advance(batch_end, alignments_per_vector, std::ranges::end(indexed_sequence_pairs));
+            compute_batch(std::ranges::subrange{batch_begin, batch_end}, callback);
+        }
+    }
+
+private:
+    //!\brief Returns the element-wise maximum of both simd vectors.
+    static simd_score_type max(simd_score_type const & lhs, simd_score_type const & rhs) noexcept
+    {
+        return (lhs < rhs) ? rhs : lhs;
+    }
+
+    //!\brief Returns the score of a gap with the given length.
+    sum_type gap_score(size_t const length) const noexcept
+    {
+        return (length == 0) ? 0 : gap_open_score + static_cast<sum_type>(length) * gap_extension_score;
+    }
+
+    /*!\brief Converts the sequences of a batch to one simd vector per sequence position.
+     * \param[out] simd_sequence The buffer to store the simd vectors in.
+     * \param[in] sequences The sequences of the batch.
+     * \param[out] sizes The sizes of the sequences per lane.
+     */
+    template <typename sequence_collection_t>
+    void convert_to_simd(simd_buffer_type & simd_sequence,
+                         sequence_collection_t && sequences,
+                         std::array<size_t, alignments_per_vector> & sizes)
+    {
+        size_t lane = 0;
+        for (auto && sequence : sequences)
+            sizes[lane++] = std::ranges::distance(sequence);
+
+        simd_sequence.clear();
+        for (auto && simd_vector_chunk : sequences | views::to_simd<simd_score_type>(scoring_scheme.padding_symbol))
+            std::ranges::move(simd_vector_chunk, std::back_inserter(simd_sequence));
+    }
+
+    /*!\brief Computes the scores of a batch of at most seqan3::detail::difference_recurrence_alignment_algorithm::
+     *        alignments_per_vector sequence pairs.
+     * \param[in] batch The batch of indexed sequence pairs.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     */
+    template <typename batch_t, typename callback_t>
+    void compute_batch(batch_t && batch, callback_t & callback)
+    {
+        thread_local simd_buffer_type simd_sequence1{};
+        thread_local simd_buffer_type simd_sequence2{};
+        thread_local simd_buffer_type vertical_differences{};
+        thread_local simd_buffer_type horizontal_gaps{};
+
+        std::array<size_t, alignments_per_vector> sequence1_sizes{};
+        std::array<size_t, alignments_per_vector> sequence2_sizes{};
+        convert_to_simd(simd_sequence1, batch | views::elements<0> | views::elements<0>, sequence1_sizes);
+        convert_to_simd(simd_sequence2, batch | views::elements<0> | views::elements<1>, sequence2_sizes);
+
+        size_t const column_count = simd_sequence1.size();
+        size_t const row_count = simd_sequence2.size();
+        size_t const lane_count = std::ranges::distance(batch);
+
+        simd_score_type const gap_open = simd::fill<simd_score_type>(gap_open_score + gap_extension_score);
+        simd_score_type const gap_extension = simd::fill<simd_score_type>(gap_extension_score);
+        simd_score_type const open = simd::fill<simd_score_type>(gap_open_score);
+
+        // ---------------------------------------------------------------------
+        // The first column: the cell scores are gap scores.
+        // ---------------------------------------------------------------------
+
+        vertical_differences.resize(row_count + 1);
+        horizontal_gaps.resize(row_count + 1);
+        for (size_t row = 1; row <= row_count; ++row)
+        {
+            vertical_differences[row] = (row == 1) ? gap_open : gap_extension;
+            horizontal_gaps[row] = gap_open;
+        }
+
+        std::array<sum_type, alignments_per_vector> scores{};
+        // The score of a sequence pair is the score of the first row plus the vertical differences of its last column.
+        auto sum_up_last_columns = [&](size_t const column)
+        {
+            for (size_t lane = 0; lane < lane_count; ++lane)
+            {
+                if (sequence1_sizes[lane] != column)
+                    continue;
+
+                sum_type score = gap_score(column);
+                for (size_t row = 1; row <= sequence2_sizes[lane]; ++row)
+                    score += vertical_differences[row][lane];
+
+                scores[lane] = score;
+            }
+        };
+
+        sum_up_last_columns(0);
+
+        // ---------------------------------------------------------------------
+        // The remaining columns.
+        // ---------------------------------------------------------------------
+
+        for (size_t column = 1; column <= column_count; ++column)
+        {
+            simd_score_type const & ranks1 = simd_sequence1[column - 1];
+            // The differences of the first row.
+            simd_score_type horizontal_difference = (column == 1) ? gap_open : gap_extension;
+            simd_score_type vertical_gap = gap_open;
+
+            for (size_t row = 1; row <= row_count; ++row)
+            {
+                simd_score_type & vertical_difference = vertical_differences[row];
+                simd_score_type & horizontal_gap = horizontal_gaps[row];
+
+                simd_score_type const best = max(scoring_scheme.score(ranks1, simd_sequence2[row - 1]),
+                                                 max(horizontal_gap + vertical_difference,
+                                                     vertical_gap + horizontal_difference));
+
+                simd_score_type const next_vertical_difference = best - horizontal_difference;
+                horizontal_difference = best - vertical_difference;
+                horizontal_gap = max(horizontal_gap - horizontal_difference, open) + gap_extension;
+                vertical_gap = max(vertical_gap - next_vertical_difference, open) + gap_extension;
+                vertical_difference = next_vertical_difference;
+            }
+
+            sum_up_last_columns(column);
+        }
+
+        // ---------------------------------------------------------------------
+        // Report the results.
+        // ---------------------------------------------------------------------
+
+        size_t lane = 0;
+        for (auto && [sequence_pair, idx] : batch)
+        {
+            matrix_coordinate coordinate{row_index_type{sequence2_sizes[lane]},
+                                         column_index_type{sequence1_sizes[lane]}};
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         static_cast<original_score_type>(scores[lane]),
+                                         std::move(coordinate),
+                                         empty_type{},
+                                         callback);
+            ++lane;
+        }
+    }
+
+    //!\brief The vectorised scoring scheme.
+    simd_scoring_scheme_type scoring_scheme{};
+    //!\brief The gap open score.
+    int32_t gap_open_score{};
+    //!\brief The gap extension score.
+    int32_t gap_extension_score{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,169 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::length_sorted_lane_scheduler.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/utility/views/type_reduce.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Packs the sequence pairs of a window into the SIMD lanes of a vectorised alignment algorithm, optionally
+ *        sorted by their lengths.
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ *
+ * \tparam traits_t The alignment configuration traits type; must be an instance of
+ *                  seqan3::detail::alignment_configuration_traits.
+ * \tparam algorithm_t The type of the wrapped vectorised alignment algorithm.
+ *
+ * \details
+ *
+ * The vectorised alignment algorithm computes all alignments of a batch until the longest of them is finished.
+ * This scheduler is invoked with a window of sequence pairs that can be much larger than the number of alignments per
+ * SIMD vector of the wrapped algorithm. If requested, it sorts the sequence pairs of the window by the length of the
+ * first and then of the second sequence, such that the sequences computed together have similar lengths. It then
+ * invokes the wrapped algorithm for consecutive batches of the (sorted) pairs. The results of the window are buffered
+ * and reported in the original order of the sequence pairs.
+ *
+ * The wrapped algorithm must report exactly one result per sequence pair, which holds for all vectorised pairwise
+ * alignment algorithms.
+ */
+template <typename traits_t, typename algorithm_t>
+    requires is_type_specialisation_of_v<traits_t, alignment_configuration_traits>
+class length_sorted_lane_scheduler
+{
+private:
+    //!\brief The alignment result type.
+    using alignment_result_type = typename traits_t::alignment_result_type;
+
+    //!\brief The wrapped alignment algorithm.
+    algorithm_t algorithm{};
+    //!\brief The number of sequence pairs the wrapped algorithm computes at once.
+    size_t lane_count{traits_t::alignments_per_vector};
+    //!\brief Whether the sequence pairs are sorted by their lengths.
+    bool sort_by_length{true};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    length_sorted_lane_scheduler() = default;                                                 //!< Defaulted.
+    length_sorted_lane_scheduler(length_sorted_lane_scheduler const &) = default;             //!< Defaulted.
+    length_sorted_lane_scheduler(length_sorted_lane_scheduler &&) = default;                  //!< Defaulted.
+    length_sorted_lane_scheduler & operator=(length_sorted_lane_scheduler const &) = default; //!< Defaulted.
+    length_sorted_lane_scheduler & operator=(length_sorted_lane_scheduler &&) = default;      //!< Defaulted.
+    ~length_sorted_lane_scheduler() = default;                                                //!< Defaulted.
+
+    /*!\brief Constructs the scheduler from the wrapped algorithm.
+     * \param[in] algorithm The vectorised alignment algorithm to invoke on the sorted batches.
+     * \param[in] lane_count The number of sequence pairs the algorithm computes at once.
+     * \param[in] sort_by_length Whether the sequence pairs are sorted by their lengths.
+     */
+    explicit length_sorted_lane_scheduler(algorithm_t algorithm,
+                                          size_t const lane_count = traits_t::alignments_per_vector,
+                                          bool const sort_by_length = true) :
+        algorithm{std::move(algorithm)},
+        lane_count{lane_count},
+        sort_by_length{sort_by_length}
+    {}
+    //!\}
+
+    /*!\brief Computes the alignments of a window of sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of the window; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs The window of indexed sequence pairs.
+     * \param[in] callback The callback function to be invoked with every alignment result.
+     *
+     * \details
+     *
+     * Sorts the sequence pairs of the window by their lengths if requested, computes them in batches of `lane_count`
+     * sequence pairs and invokes the callback with the results in the order of the window.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+        using pair_iterator_t = std::ranges::iterator_t<indexed_sequence_pairs_t>;
+
+        std::vector<pair_iterator_t> pair_iterators{};
+        std::vector<std::pair<size_t, size_t>> pair_lengths{};
+        for (auto it = std::ranges::begin(indexed_sequence_pairs); it != std::ranges::end(indexed_sequence_pairs); ++it)
+        {
+            auto && sequence_pair = get<0>(*it);
+            pair_iterators.push_back(it);
+            pair_lengths.emplace_back(std::ranges::distance(get<0>(sequence_pair)),
+                                      std::ranges::distance(get<1>(sequence_pair)));
+        }
+
+        // Sort the positions of the sequence pairs within the window by the lengths of the sequences.
+        std::vector<size_t> order(pair_iterators.size());
+        std::iota(order.begin(), order.end(), 0u);
+        if (sort_by_length)
+        {
+            std::ranges::stable_sort(order,
+                                     [&](size_t const lhs, size_t const rhs)
+                                     {
+                                         return pair_lengths[lhs] < pair_lengths[rhs];
+                                     });
+        }
+
+        std::vector<pair_iterator_t> sorted_pair_iterators{};
+        sorted_pair_iterators.reserve(order.size());
+        for (size_t const position : order)
+            sorted_pair_iterators.push_back(pair_iterators[position]);
+
+        // Only view the sequences, such that the sorted batch does not copy them.
+        auto as_indexed_sequence_pair = [](pair_iterator_t const & it)
+        {
+            auto && [sequence_pair, idx] = *it;
+            return std::tuple{std::tuple{get<0>(sequence_pair) | views::type_reduce,
+                                         get<1>(sequence_pair) | views::type_reduce},
+                              idx};
+        };
+
+        std::vector<alignment_result_type> results(order.size());
+        for (size_t batch_begin = 0; batch_begin < order.size(); batch_begin += lane_count)
+        {
+            size_t const batch_end = std::min(batch_begin + lane_count, order.size());
+            std::span<pair_iterator_t const> batch{sorted_pair_iterators.data() + batch_begin,
+                                                   sorted_pair_iterators.data() + batch_end};
+
+            size_t result_position = batch_begin;
+            algorithm(batch | std::views::transform(as_indexed_sequence_pair),
+                      [&](auto && result)
+                      {
+                          assert(result_position < batch_end);
+                          results[order[result_position++]] = std::move(result);
+                      });
+            assert(result_position == batch_end);
+        }
+
+        for (alignment_result_type & result : results)
+            callback(std::move(result));
+    }
+};
+
+} // namespace seqan3::detail
@@ -13,13 +13,21 @@
 #pragma once
 
 #include <concepts>
+#include <cstdint>
+#include <optional>
 #include <ranges>
 
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/pairwise/detail/anti_diagonal_alignment_kernel.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/utility/container/aligned_allocator.hpp>
 #include <seqan3/utility/detail/type_name_as_string.hpp>
 #include <seqan3/utility/simd/views/to_simd.hpp>
+#include <seqan3/utility/type_traits/lazy_conditional.hpp>
 #include <seqan3/utility/views/elements.hpp>
 
 namespace seqan3::detail
@@ -40,6 +48,12 @@ namespace seqan3::detail
  * configure the `alignment algorithm type` within the seqan3::detail::alignment_configurator.
  * The algorithm computes a column based dynamic programming matrix given two sequences.
  * After the computation a user defined callback function is invoked with the computed seqan3::alignment_result.
+ *
+ * ### Long sequence pairs
+ *
+ * If only the score and the end positions of a global alignment without free end-gaps are computed in scalar mode,
+ * sufficiently long sequence pairs are computed with the seqan3::detail::anti_diagonal_alignment_kernel instead, which
+ * vectorises the computation of a single alignment along the anti-diagonals of the matrix.
  */
 template <typename alignment_configuration_t, typename... policies_t>
     requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
@@ -55,6 +69,22 @@ protected:
 
     static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
 
+    //!\brief Whether the configuration can be computed with the seqan3::detail::anti_diagonal_alignment_kernel.
+    static constexpr bool is_anti_diagonal_kernel_supported =
+        !traits_type::is_vectorised && traits_type::is_global && !traits_type::is_debug
+        && !traits_type::requires_trace_information && std::signed_integral<score_type>;
+
+    //!\brief The kernel type to compute long sequence pairs or seqan3::detail::empty_type if it is not supported.
+    using anti_diagonal_kernel_type =
+        lazy_conditional_t<is_anti_diagonal_kernel_supported,
+                           lazy<anti_diagonal_alignment_kernel, score_type, typename traits_type::scoring_scheme_type>,
+                           empty_type>;
+
+    //!\brief Computes the scores of long sequence pairs along the anti-diagonals of the matrix.
+    anti_diagonal_kernel_type anti_diagonal_kernel{};
+    //!\brief Whether the configuration permits to use the anti-diagonal kernel, i.e. there are no free end-gaps.
+    bool use_anti_diagonal_kernel{false};
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -74,7 +104,25 @@ public:
      * Initialises the base policies of the alignment algorithm.
      */
     pairwise_alignment_algorithm(alignment_configuration_t const & config) : policies_t(config)...
-    {}
+    {
+        if constexpr (is_anti_diagonal_kernel_supported)
+        {
+            auto const & method_global_config = get<align_cfg::method_global>(config);
+            auto const & gap_cost =
+                config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+
+            use_anti_diagonal_kernel = !method_global_config.free_end_gaps_sequence1_leading
+                                    && !method_global_config.free_end_gaps_sequence1_trailing
+                                    && !method_global_config.free_end_gaps_sequence2_leading
+                                    && !method_global_config.free_end_gaps_sequence2_trailing
+                                    && gap_cost.open_score <= 0 && gap_cost.extension_score <= 0;
+
+            if (use_anti_diagonal_kernel)
+                anti_diagonal_kernel = anti_diagonal_kernel_type{get<align_cfg::scoring_scheme>(config).scheme,
+                                                                 static_cast<score_type>(gap_cost.open_score),
+                                                                 static_cast<score_type>(gap_cost.extension_score)};
+        }
+    }
     //!\}
 
     /*!\name Invocation
@@ -133,6 +181,25 @@ public:
             size_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
             size_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
 
+            if constexpr (is_anti_diagonal_kernel_supported)
+            {
+                std::optional<score_type> score = compute_anti_diagonal_score(get<0>(sequence_pair),
+                                                                              get<1>(sequence_pair),
+                                                                              -static_cast<int64_t>(sequence2_size),
+                                                                              sequence1_size);
+                if (score.has_value())
+                {
+                    this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                                 std::move(idx),
+                                                 *score,
+                                                 matrix_coordinate{row_index_type{sequence2_size},
+                                                                   column_index_type{sequence1_size}},
+                                                 empty_type{},
+                                                 callback);
+                    continue;
+                }
+            }
+
             auto && [alignment_matrix, index_matrix] = this->acquire_matrices(sequence1_size, sequence2_size);
 
             compute_matrix(get<0>(sequence_pair), get<1>(sequence_pair), alignment_matrix, index_matrix);
@@ -196,6 +263,49 @@ public:
     }
 
 protected:
+    /*!\brief Computes the score with the seqan3::detail::anti_diagonal_alignment_kernel if it is faster.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] sequence1 The first sequence to compute the alignment for.
+     * \param[in] sequence2 The second sequence to compute the alignment for.
+     * \param[in] lower_diagonal The lower diagonal of the band.
+     * \param[in] upper_diagonal The upper diagonal of the band.
+     *
+     * \returns The score of the global alignment or std::nullopt if the column-wise computation shall be used.
+     *
+     * \details
+     *
+     * The kernel is used if the configuration has no free end-gaps, both sequences are over the same alphabet and the
+     * anti-diagonals of the (banded) matrix span several simd vectors.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    std::optional<score_type> compute_anti_diagonal_score(sequence1_t && sequence1,
+                                                          sequence2_t && sequence2,
+                                                          int64_t const lower_diagonal,
+                                                          int64_t const upper_diagonal) const
+    {
+        using alphabet_t = std::ranges::range_value_t<sequence1_t>;
+
+        if constexpr (is_anti_diagonal_kernel_supported)
+        {
+            if constexpr (std::same_as<alphabet_t, std::ranges::range_value_t<sequence2_t>>
+                          && anti_diagonal_kernel_type::template is_supported_alphabet<alphabet_t>)
+            {
+                if (use_anti_diagonal_kernel
+                    && anti_diagonal_kernel.is_profitable(std::ranges::distance(sequence1),
+                                                          std::ranges::distance(sequence2),
+                                                          lower_diagonal,
+                                                          upper_diagonal))
+                {
+                    return anti_diagonal_kernel(sequence1, sequence2, lower_diagonal, upper_diagonal);
+                }
+            }
+        }
+
+        return std::nullopt;
+    }
+
     /*!\brief Converts a batch of sequences to a sequence of simd vectors.
      * \tparam simd_sequence_t The type of the simd sequence; must model std::ranges::output_range for the `score_type`.
      * \tparam sequence_collection_t The type of the collection containing the sequences; must model
@@ -267,11 +377,29 @@ protected:
         // Iteration phase: compute column-wise the alignment matrix.
         // ---------------------------------------------------------------------
 
-        for (auto alphabet1 : sequence1)
-            compute_column(*++alignment_matrix_it,
-                           *++indexed_matrix_it,
-                           this->scoring_scheme_profile_column(alphabet1),
-                           sequence2);
+        bool compute_with_query_profile{false};
+        if constexpr (traits_type::is_vectorised && pairwise_alignment_algorithm::has_query_profile)
+        {
+            // One query against a batch: every cell is scored with a single load from the profile of its column.
+            compute_with_query_profile = this->use_query_profile(sequence2);
+            if (compute_with_query_profile)
+            {
+                for (auto alphabet1 : sequence1)
+                    compute_column(*++alignment_matrix_it,
+                                   *++indexed_matrix_it,
+                                   this->scoring_scheme_query_profile_column(alphabet1),
+                                   sequence2);
+            }
+        }
+
+        if (!compute_with_query_profile)
+        {
+            for (auto alphabet1 : sequence1)
+                compute_column(*++alignment_matrix_it,
+                               *++indexed_matrix_it,
+                               this->scoring_scheme_profile_column(alphabet1),
+                               sequence2);
+        }
 
         // ---------------------------------------------------------------------
         // Final phase: track score of last column
@@ -345,7 +473,7 @@ protected:
     /*!\brief Initialise any column of the alignment matrix except the first one.
      * \tparam alignment_column_t The type of the alignment column; must model std::ranges::input_range.
      * \tparam cell_index_column_t The type of the indexed column; must model std::ranges::input_range.
-     * \tparam alphabet1_t The type of the current symbol of sequence1.
+     * \tparam alphabet1_t The type of the current symbol of sequence1 or of its query profile.
      * \tparam sequence2_t The type of the second sequence; must model std::ranges::input_range.
      *
      * \param[in] alignment_column The current alignment matrix column to compute.
@@ -364,7 +492,7 @@ protected:
               std::ranges::input_range cell_index_column_t,
               typename alphabet1_t,
               std::ranges::input_range sequence2_t>
-        requires semialphabet<alphabet1_t> || simd_concept<alphabet1_t>
+        requires semialphabet<alphabet1_t> || simd_concept<alphabet1_t> || std::ranges::random_access_range<alphabet1_t>
     void compute_column(alignment_column_t && alignment_column,
                         cell_index_column_t && cell_index_column,
                         alphabet1_t const & alphabet1,
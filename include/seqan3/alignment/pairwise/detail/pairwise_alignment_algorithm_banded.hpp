@@ -13,6 +13,7 @@
 #pragma once
 
 #include <concepts>
+#include <optional>
 #include <ranges>
 
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
@@ -83,6 +84,27 @@ public:
             size_t sequence1_size = std::ranges::distance(get<0>(sequence_pair));
             size_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
 
+            if constexpr (base_algorithm_t::is_anti_diagonal_kernel_supported)
+            {
+                this->check_valid_band_configuration(sequence1_size, sequence2_size);
+
+                std::optional<score_type> score = this->compute_anti_diagonal_score(get<0>(sequence_pair),
+                                                                                    get<1>(sequence_pair),
+                                                                                    this->lower_diagonal,
+                                                                                    this->upper_diagonal);
+                if (score.has_value())
+                {
+                    this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                                 std::move(idx),
+                                                 *score,
+                                                 matrix_coordinate{row_index_type{sequence2_size},
+                                                                   column_index_type{sequence1_size}},
+                                                 empty_type{},
+                                                 callback);
+                    continue;
+                }
+            }
+
             auto && [alignment_matrix, index_matrix] =
                 this->acquire_matrices(sequence1_size, sequence2_size, this->lowest_viable_score());
 
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
@@ -125,7 +126,20 @@ protected:
             result.data.end_positions.second = end_positions.row;
         }
 
-        if constexpr (traits_type::requires_trace_information)
+        if constexpr (traits_type::output_cigar)
+        {
+            // The CIGAR sequence also provides the begin positions without building the aligned sequences.
+            auto cigar_result = cigar_builder{}(alignment_matrix.trace_path(end_positions));
+
+            if constexpr (traits_type::compute_begin_positions)
+            {
+                result.data.begin_positions.first = cigar_result.first_sequence_slice_positions.first;
+                result.data.begin_positions.second = cigar_result.second_sequence_slice_positions.first;
+            }
+
+            result.data.cigar_sequence = std::move(cigar_result.cigar_sequence);
+        }
+        else if constexpr (traits_type::requires_trace_information)
         {
             aligned_sequence_builder builder{get<0>(sequence_pair), get<1>(sequence_pair)};
             auto aligned_sequence_result = builder(alignment_matrix.trace_path(end_positions));
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <ranges>
+
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/utility/simd/concept.hpp>
@@ -37,6 +39,9 @@ protected:
     //!\brief The scoring scheme used for this alignment algorithm.
     scoring_scheme_t scoring_scheme{};
 
+    //!\brief Whether the scoring scheme can score the columns with a query profile.
+    static constexpr bool has_query_profile = requires { typename scoring_scheme_t::simd_query_profile_type; };
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -83,6 +88,45 @@ protected:
     {
         return std::forward<alphabet_t>(alphabet);
     }
+
+    /*!\brief Whether the columns can be scored with a query profile against the given second sequence.
+     *
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] sequence2 The second sequence to compute the alignment for.
+     *
+     * \details
+     *
+     * Returns `true` if the scoring scheme supports query profiles and all lanes of the vectorised second sequence
+     * store the same sequence, e.g. when one query is aligned against a batch of sequences. The columns can then be
+     * converted with seqan3::detail::policy_scoring_scheme::scoring_scheme_query_profile_column.
+     */
+    template <std::ranges::forward_range sequence2_t>
+    bool use_query_profile(sequence2_t && sequence2) const noexcept
+    {
+        if constexpr (has_query_profile)
+            return scoring_scheme_t::is_shared_sequence(std::forward<sequence2_t>(sequence2));
+        else
+            return false;
+    }
+
+    /*!\brief Converts the given simd vector of the first sequence to a query profile.
+     *
+     * \tparam alphabet_t The type of the simd vector; must model seqan3::simd::simd_concept.
+     *
+     * \param[in] alphabet The simd vector to get the query profile for.
+     *
+     * \details
+     *
+     * Only available if the scoring scheme supports query profiles. The profile stores the score vectors of the
+     * column against every symbol, such that every cell is scored with a single load instead of a gather.
+     */
+    template <typename alphabet_t>
+        requires has_query_profile && simd_concept<std::remove_cvref_t<alphabet_t>>
+    auto scoring_scheme_query_profile_column(alphabet_t && alphabet) const noexcept
+    {
+        return scoring_scheme.make_query_profile(std::forward<alphabet_t>(alphabet));
+    }
 };
 
 } // namespace seqan3::detail
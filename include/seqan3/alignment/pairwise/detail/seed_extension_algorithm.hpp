@@ -0,0 +1,708 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::seed_extension_algorithm.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_seed_extension.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/recorded_trace_path.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/alignment_algorithm_helper.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/utility/container/aligned_allocator.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/concept.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+#include <seqan3/utility/simd/views/to_simd.hpp>
+#include <seqan3/utility/views/elements.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Implements the X-drop and Z-drop seed extension.
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ * \tparam alignment_configuration_t The type of the alignment configuration; must be a type specialisation of
+ *                                   seqan3::configuration.
+ * \tparam alignment_scoring_scheme_t The type of the scoring scheme used to score the sequence characters; in
+ *                                    vectorised mode this is the simd version of the configured scoring scheme.
+ *
+ * \details
+ *
+ * Computes the affine gap recursion row by row (one row per character of the second sequence), starting in the
+ * top-left cell of the matrix. Within every row only the cells between the first and the last cell that are not
+ * dropped are kept alive. A cell is dropped if its score falls more than the configured drop below the best score
+ * seen so far. For the Z-drop criterion the allowed drop is additionally increased by the absolute gap extension
+ * score times the distance between the diagonal of the cell and the diagonal of the best cell. The computation stops
+ * as soon as a row has no alive cells left, and the result is the best scoring cell, i.e. the alignment is anchored
+ * in the top-left cell and ends in the best cell.
+ * For a left extension the same computation is applied to the reversed sequences.
+ *
+ * In vectorised mode every lane of the simd vectors extends another sequence pair, and a row is continued as long as
+ * any lane is still alive. The trace is only recorded in the scalar mode. If the alignment is requested in
+ * combination with seqan3::align_cfg::vectorised, the sequence pairs are therefore extended one after the other.
+ *
+ * The score and trace buffers are kept in thread local storage, such that they are reused for all sequence pairs
+ * that are extended by the same thread.
+ */
+template <typename alignment_configuration_t, typename alignment_scoring_scheme_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class seed_extension_algorithm
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type; a simd type in vectorised mode.
+    using score_type = typename traits_type::score_type;
+    //!\brief The configured score type without the simd conversion.
+    using original_score_type = typename traits_type::original_score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The type of the configured scoring scheme.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+    //!\brief The type used to compute the scalar extension; at least 32 bit wide to hold the positions.
+    using scalar_value_type = std::common_type_t<original_score_type, int32_t>;
+
+    //!\brief Whether the trace of the extension must be recorded, i.e. the alignment or its CIGAR sequence is output.
+    static constexpr bool compute_trace = traits_type::compute_sequence_alignment || traits_type::output_cigar;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(traits_type::is_global, "The seed extension must be configured with align_cfg::method_global.");
+
+    //!\brief The source of a cell stored in the lowest two bits of a trace cell.
+    enum trace_bits : uint8_t
+    {
+        from_diagonal = 0b0000, //!< The score comes from the diagonal cell.
+        from_left = 0b0001,     //!< The score comes from a horizontal gap.
+        from_up = 0b0010,       //!< The score comes from a vertical gap.
+        source_mask = 0b0011,   //!< Extracts the source of the cell.
+        left_open = 0b0100,     //!< The horizontal gap was opened in the left cell.
+        up_open = 0b1000        //!< The vertical gap was opened in the upper cell.
+    };
+
+    //!\brief The recorded trace cells of one row.
+    struct trace_row
+    {
+        size_t first_column; //!< The column of the first recorded cell.
+        size_t offset;       //!< The position of the first recorded cell in the trace buffer.
+    };
+
+    //!\brief The recorded trace of the extension.
+    struct trace_storage
+    {
+        std::vector<uint8_t> cells{};  //!< The trace cells of all computed rows.
+        std::vector<trace_row> rows{}; //!< The recorded rows.
+    };
+
+    //!\brief The best cell found during the extension.
+    template <typename value_t>
+    struct extension_optimum
+    {
+        value_t score; //!< The best score.
+        value_t row;   //!< The row of the best cell.
+        value_t col;   //!< The column of the best cell.
+    };
+
+    //!\brief The buffer type used to store one row of the score matrix.
+    template <typename value_t>
+    using row_buffer_type = std::vector<value_t, aligned_allocator<value_t, alignof(value_t)>>;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    seed_extension_algorithm() = default;                                             //!< Defaulted.
+    seed_extension_algorithm(seed_extension_algorithm const &) = default;             //!< Defaulted.
+    seed_extension_algorithm(seed_extension_algorithm &&) = default;                  //!< Defaulted.
+    seed_extension_algorithm & operator=(seed_extension_algorithm const &) = default; //!< Defaulted.
+    seed_extension_algorithm & operator=(seed_extension_algorithm &&) = default;      //!< Defaulted.
+    ~seed_extension_algorithm() = default;                                            //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the drop is not positive or if free end-gaps were
+     *         configured.
+     */
+    seed_extension_algorithm(alignment_configuration_t const & config) :
+        scoring_scheme{get<align_cfg::scoring_scheme>(config).scheme},
+        alignment_scoring_scheme{get<align_cfg::scoring_scheme>(config).scheme},
+        extension{get<align_cfg::seed_extension>(config)}
+    {
+        reject_free_end_gaps(config, "The seed extension");
+
+        if (extension.drop <= 0)
+            throw invalid_alignment_configuration{"The drop of the seed extension must be positive."};
+
+        auto gap_cost =
+            config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+
+        gap_open_score = gap_cost.open_score;
+        gap_extension_score = gap_cost.extension_score;
+    }
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     * \param report_last_optimum Whether the last computed of several cells with the best score is reported instead
+     *                            of the first one.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the drop is not positive or if free end-gaps were
+     *         configured.
+     */
+    seed_extension_algorithm(alignment_configuration_t const & config, bool const report_last_optimum) :
+        seed_extension_algorithm{config}
+    {
+        this->report_last_optimum = report_last_optimum;
+    }
+    //!\}
+
+    /*!\brief Extends the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with the configured alignment result type.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * Computes for each contained sequence pair the respective extension and invokes the given callback for each
+     * alignment result. In vectorised mode, all sequence pairs of the range are extended at once.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        if constexpr (traits_type::is_vectorised && !compute_trace)
+            extend_vectorised(indexed_sequence_pairs, callback);
+        else
+            extend_scalar(indexed_sequence_pairs, callback);
+    }
+
+private:
+    //!\brief Whether the extension runs to the left, i.e. on the reversed sequences.
+    bool is_left_extension() const noexcept
+    {
+        return extension.direction == align_cfg::extension_direction::left;
+    }
+
+    //!\brief Broadcasts the given scalar to the value type of the extension.
+    template <typename value_t, typename scalar_t>
+    static value_t broadcast(scalar_t const scalar) noexcept
+    {
+        if constexpr (simd_concept<value_t>)
+            return simd::fill<value_t>(static_cast<typename simd_traits<value_t>::scalar_type>(scalar));
+        else
+            return static_cast<value_t>(scalar);
+    }
+
+    //!\brief Returns the score of a dropped cell, which is far below any score that can be reached.
+    template <typename value_t>
+    static value_t lowest_score() noexcept
+    {
+        if constexpr (simd_concept<value_t>)
+            return broadcast<value_t>(std::numeric_limits<typename simd_traits<value_t>::scalar_type>::lowest() / 2);
+        else
+            return std::numeric_limits<value_t>::lowest() / 2;
+    }
+
+    //!\brief Whether any lane of the mask computed for the given value type is set.
+    template <typename value_t, typename mask_t>
+    static bool any_of(mask_t const & mask) noexcept
+    {
+        if constexpr (simd_concept<value_t>)
+        {
+            for (size_t lane = 0; lane < simd_traits<value_t>::length; ++lane)
+                if (mask[lane])
+                    return true;
+
+            return false;
+        }
+        else
+        {
+            return static_cast<bool>(mask);
+        }
+    }
+
+    //!\brief Returns the thread local buffer of the recorded trace.
+    static trace_storage & trace_buffer() noexcept
+    {
+        thread_local trace_storage storage{};
+        return storage;
+    }
+
+    //!\brief Returns the element-wise maximum of both values.
+    template <typename value_t>
+    static value_t max(value_t const & lhs, value_t const & rhs) noexcept
+    {
+        return (lhs < rhs) ? rhs : lhs;
+    }
+
+    /*!\brief Computes the extension for the sequences of the given sizes.
+     * \tparam record_trace Whether the trace of the computed cells is recorded.
+     * \tparam value_t The type of the scores; either a scalar or a simd type.
+     * \tparam score_fn_t The type of the function returning the score of the cell in row `i` and column `j`.
+     * \param[in] max_columns The number of columns to compute at most.
+     * \param[in] max_rows The number of rows to compute at most.
+     * \param[in] columns The size of the first sequence, per lane.
+     * \param[in] rows The size of the second sequence, per lane.
+     * \param[in] score_at The score function.
+     * \returns The best cell of the extension.
+     */
+    template <bool record_trace, typename value_t, typename score_fn_t>
+    extension_optimum<value_t> compute_extension(size_t const max_columns,
+                                                 size_t const max_rows,
+                                                 value_t const & columns,
+                                                 value_t const & rows,
+                                                 score_fn_t && score_at)
+    {
+        thread_local row_buffer_type<value_t> score_row{};
+        thread_local row_buffer_type<value_t> vertical_row{};
+
+        if (score_row.size() < max_columns + 1)
+        {
+            score_row.resize(max_columns + 1);
+            vertical_row.resize(max_columns + 1);
+        }
+
+        value_t const minus_infinity = lowest_score<value_t>();
+        value_t const zero = broadcast<value_t>(0);
+        value_t const gap_open = broadcast<value_t>(gap_open_score + gap_extension_score);
+        value_t const gap_extension = broadcast<value_t>(gap_extension_score);
+        value_t const drop = broadcast<value_t>(extension.drop);
+        // With the X-drop criterion the allowed drop does not depend on the diagonal.
+        value_t const drop_slope = broadcast<value_t>(extension.use_z_drop ? -gap_extension_score : 0);
+
+        extension_optimum<value_t> optimum{zero, zero, zero};
+
+        auto threshold = [&](value_t const & row, value_t const & column)
+        {
+            value_t distance = (row - column) - (optimum.row - optimum.col);
+            distance = (distance < zero) ? zero - distance : distance;
+            return optimum.score - drop - drop_slope * distance;
+        };
+
+        auto update_optimum = [&](value_t const & score, value_t const & row, value_t const & column)
+        {
+            auto const is_better = report_last_optimum ? optimum.score <= score : optimum.score < score;
+            optimum.score = is_better ? score : optimum.score;
+            optimum.row = is_better ? row : optimum.row;
+            optimum.col = is_better ? column : optimum.col;
+        };
+
+        [[maybe_unused]] std::vector<uint8_t> & trace_cells = trace_buffer().cells;
+        [[maybe_unused]] std::vector<trace_row> & trace_rows = trace_buffer().rows;
+
+        if constexpr (record_trace)
+        {
+            trace_rows.clear();
+            trace_cells.clear();
+            trace_rows.push_back(trace_row{0, 0});
+            trace_cells.push_back(from_diagonal); // The origin has no source.
+        }
+
+        // ----------------------------------------------------------------------------
+        // The first row only consists of horizontal gaps.
+        // ----------------------------------------------------------------------------
+
+        size_t first_alive = 0;
+        size_t last_alive = 0;
+
+        score_row[0] = zero;
+        vertical_row[0] = minus_infinity;
+        value_t horizontal = minus_infinity;
+
+        for (size_t j = 1; j <= max_columns; ++j)
+        {
+            value_t const column = broadcast<value_t>(j);
+            value_t const horizontal_open = score_row[j - 1] + gap_open;
+            value_t const horizontal_extension = horizontal + gap_extension;
+            horizontal = max(horizontal_open, horizontal_extension);
+
+            auto const alive = (column <= columns) & (horizontal >= threshold(zero, column));
+            horizontal = alive ? horizontal : minus_infinity;
+            score_row[j] = horizontal;
+            vertical_row[j] = minus_infinity;
+
+            if constexpr (record_trace)
+                trace_cells.push_back(from_left | ((horizontal_open >= horizontal_extension) ? left_open : 0));
+
+            if (!any_of<value_t>(alive))
+                break;
+
+            update_optimum(horizontal, zero, column);
+            last_alive = j;
+        }
+
+        // ----------------------------------------------------------------------------
+        // Compute the remaining rows within the alive columns of the previous row.
+        // ----------------------------------------------------------------------------
+
+        for (size_t i = 1; i <= max_rows; ++i)
+        {
+            value_t const row = broadcast<value_t>(i);
+            auto const row_is_valid = row <= rows;
+
+            if constexpr (record_trace)
+                trace_rows.push_back(trace_row{first_alive, trace_cells.size()});
+
+            value_t diagonal = minus_infinity;
+            value_t left = minus_infinity;
+            horizontal = minus_infinity;
+            size_t next_first_alive = std::numeric_limits<size_t>::max();
+            size_t next_last_alive = 0;
+
+            for (size_t j = first_alive; j <= max_columns; ++j)
+            {
+                value_t const column = broadcast<value_t>(j);
+                bool const has_upper_cell = j <= last_alive;
+                value_t const up = has_upper_cell ? score_row[j] : minus_infinity;
+                value_t const vertical_open = up + gap_open;
+                value_t const vertical_extension = (has_upper_cell ? vertical_row[j] : minus_infinity) + gap_extension;
+                value_t vertical = max(vertical_open, vertical_extension);
+
+                value_t best = vertical;
+                [[maybe_unused]] uint8_t trace{};
+
+                if (j > 0)
+                {
+                    value_t const horizontal_open = left + gap_open;
+                    value_t const horizontal_extension = horizontal + gap_extension;
+                    horizontal = max(horizontal_open, horizontal_extension);
+
+                    value_t const match = diagonal + score_at(i, j);
+                    best = max(match, max(horizontal, vertical));
+
+                    if constexpr (record_trace)
+                    {
+                        trace = (match == best) ? from_diagonal : ((horizontal == best) ? from_left : from_up);
+                        trace |= (horizontal_open >= horizontal_extension) ? left_open : 0;
+                    }
+                }
+                else if constexpr (record_trace)
+                {
+                    trace = from_up;
+                }
+
+                if constexpr (record_trace)
+                {
+                    trace |= (vertical_open >= vertical_extension) ? up_open : 0;
+                    trace_cells.push_back(trace);
+                }
+
+                diagonal = up;
+
+                auto const alive = row_is_valid & (column <= columns) & (best >= threshold(row, column));
+                best = alive ? best : minus_infinity;
+                horizontal = alive ? horizontal : minus_infinity;
+                vertical = alive ? vertical : minus_infinity;
+
+                score_row[j] = best;
+                vertical_row[j] = vertical;
+                left = best;
+
+                if (any_of<value_t>(alive))
+                {
+                    update_optimum(best, row, column);
+                    next_first_alive = std::min(next_first_alive, j);
+                    next_last_alive = j;
+                }
+                else if (!has_upper_cell) // All cells to the right are dropped as well.
+                {
+                    break;
+                }
+            }
+
+            if (next_first_alive > next_last_alive)
+                break;
+
+            first_alive = next_first_alive;
+            last_alive = next_last_alive;
+        }
+
+        return optimum;
+    }
+
+    /*!\brief Follows the recorded trace from the given cell back to the origin.
+     * \param[in] row The row of the best cell.
+     * \param[in] column The column of the best cell.
+     * \param[out] directions The directions of the trace path, starting at the best cell.
+     */
+    void compute_trace_directions(size_t row, size_t column, std::vector<trace_directions> & directions) const
+    {
+        enum struct state
+        {
+            best,
+            horizontal,
+            vertical
+        };
+
+        std::vector<uint8_t> const & trace_cells = trace_buffer().cells;
+        std::vector<trace_row> const & trace_rows = trace_buffer().rows;
+
+        directions.clear();
+        state current_state = state::best;
+
+        while (row > 0 || column > 0)
+        {
+            assert(column >= trace_rows[row].first_column);
+            uint8_t const trace = trace_cells[trace_rows[row].offset + column - trace_rows[row].first_column];
+
+            switch (current_state)
+            {
+                case state::best:
+                {
+                    uint8_t const source = trace & source_mask;
+                    if (source == from_diagonal)
+                    {
+                        directions.push_back(trace_directions::diagonal);
+                        --row;
+                        --column;
+                    }
+                    else
+                    {
+                        current_state = (source == from_left) ? state::horizontal : state::vertical;
+                    }
+                    break;
+                }
+                case state::horizontal:
+                {
+                    directions.push_back(trace_directions::left);
+                    current_state = (trace & left_open) ? state::best : state::horizontal;
+                    --column;
+                    break;
+                }
+                case state::vertical:
+                {
+                    directions.push_back(trace_directions::up);
+                    current_state = (trace & up_open) ? state::best : state::vertical;
+                    --row;
+                    break;
+                }
+            }
+        }
+    }
+
+    //!\brief Extends the sequence pairs one after the other.
+    template <typename indexed_sequence_pairs_t, typename callback_t>
+    void extend_scalar(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t & callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            size_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+            size_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+            auto sequence1_it = std::ranges::begin(get<0>(sequence_pair));
+            auto sequence2_it = std::ranges::begin(get<1>(sequence_pair));
+
+            auto compute = [&](auto && score_at)
+            {
+                return compute_extension<compute_trace>(
+                    sequence1_size,
+                    sequence2_size,
+                    static_cast<scalar_value_type>(sequence1_size),
+                    static_cast<scalar_value_type>(sequence2_size),
+                    score_at);
+            };
+
+            extension_optimum<scalar_value_type> optimum =
+                is_left_extension() ? compute(
+                    [&](size_t const i, size_t const j) -> scalar_value_type
+                    {
+                        return scoring_scheme.score(sequence1_it[sequence1_size - j],
+                                                    sequence2_it[sequence2_size - i]);
+                    })
+                                    : compute(
+                                        [&](size_t const i, size_t const j) -> scalar_value_type
+                                        {
+                                            return scoring_scheme.score(sequence1_it[j - 1], sequence2_it[i - 1]);
+                                        });
+
+            make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                   std::move(idx),
+                                   static_cast<original_score_type>(optimum.score),
+                                   static_cast<size_t>(optimum.col),
+                                   static_cast<size_t>(optimum.row),
+                                   callback);
+        }
+    }
+
+    //!\brief Extends all sequence pairs at once, one sequence pair per simd lane.
+    template <typename indexed_sequence_pairs_t, typename callback_t>
+    void extend_vectorised(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t & callback)
+    {
+        using std::get;
+        using simd_collection_t = std::vector<score_type, aligned_allocator<score_type, alignof(score_type)>>;
+
+        assert(static_cast<size_t>(std::ranges::distance(indexed_sequence_pairs))
+               <= traits_type::alignments_per_vector);
+
+        auto seq1_collection = indexed_sequence_pairs | views::elements<0> | views::elements<0>;
+        auto seq2_collection = indexed_sequence_pairs | views::elements<0> | views::elements<1>;
+
+        // Convert batch of sequences to sequence of simd vectors.
+        thread_local simd_collection_t simd_seq1_collection{};
+        thread_local simd_collection_t simd_seq2_collection{};
+
+        auto convert = [&](simd_collection_t & simd_sequence, auto && sequences)
+        {
+            simd_sequence.clear();
+            auto simd_sequences = sequences | views::to_simd<score_type>(alignment_scoring_scheme.padding_symbol);
+            for (auto && simd_vector_chunk : simd_sequences)
+                std::ranges::move(simd_vector_chunk, std::back_inserter(simd_sequence));
+        };
+
+        auto reverse = std::views::transform(
+            [](auto && sequence)
+            {
+                return sequence | std::views::reverse;
+            });
+
+        if (is_left_extension())
+        {
+            convert(simd_seq1_collection, seq1_collection | reverse);
+            convert(simd_seq2_collection, seq2_collection | reverse);
+        }
+        else
+        {
+            convert(simd_seq1_collection, seq1_collection);
+            convert(simd_seq2_collection, seq2_collection);
+        }
+
+        for (score_type & ranks : simd_seq1_collection)
+            ranks = alignment_scoring_scheme.make_score_profile(ranks);
+
+        score_type sequence1_sizes{};
+        score_type sequence2_sizes{};
+        size_t lane = 0;
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            sequence1_sizes[lane] = std::ranges::distance(get<0>(sequence_pair));
+            sequence2_sizes[lane] = std::ranges::distance(get<1>(sequence_pair));
+            ++lane;
+        }
+
+        extension_optimum<score_type> optimum =
+            compute_extension<false>(simd_seq1_collection.size(),
+                                     simd_seq2_collection.size(),
+                                     sequence1_sizes,
+                                     sequence2_sizes,
+                                     [&](size_t const i, size_t const j)
+                                     {
+                                         return alignment_scoring_scheme.score(simd_seq1_collection[j - 1],
+                                                                               simd_seq2_collection[i - 1]);
+                                     });
+
+        lane = 0;
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                   std::move(idx),
+                                   static_cast<original_score_type>(optimum.score[lane]),
+                                   static_cast<size_t>(optimum.col[lane]),
+                                   static_cast<size_t>(optimum.row[lane]),
+                                   callback);
+            ++lane;
+        }
+    }
+
+    /*!\brief Creates a new alignment result from the best cell of the extension and invokes the callback.
+     * \param[in] sequence_pair The extended sequence pair.
+     * \param[in] id The index of the sequence pair.
+     * \param[in] score The score of the best cell.
+     * \param[in] column The column of the best cell, i.e. the number of extended characters of the first sequence.
+     * \param[in] row The row of the best cell, i.e. the number of extended characters of the second sequence.
+     * \param[in] callback The callback to invoke with the alignment result.
+     */
+    template <typename sequence_pair_t, typename index_t, typename callback_t>
+    void make_result_and_invoke(sequence_pair_t && sequence_pair,
+                                index_t && id,
+                                original_score_type const score,
+                                size_t const column,
+                                size_t const row,
+                                callback_t & callback) const
+    {
+        using std::get;
+
+        thread_local recorded_trace_path trace_path{};
+
+        size_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+        size_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+        bool const is_left = is_left_extension();
+
+        // A left extension ends at the end of the sequences and a right extension begins at their begin.
+        matrix_coordinate const begin{row_index_type{is_left ? sequence2_size - row : 0u},
+                                      column_index_type{is_left ? sequence1_size - column : 0u}};
+        matrix_coordinate const end{row_index_type{is_left ? sequence2_size : row},
+                                    column_index_type{is_left ? sequence1_size : column}};
+
+        make_alignment_result_and_invoke<traits_type, alignment_result_type>(
+            std::forward<sequence_pair_t>(sequence_pair),
+            std::forward<index_t>(id),
+            score,
+            begin,
+            end,
+            trace_path,
+            [&](recorded_trace_path & path)
+            {
+                thread_local std::vector<trace_directions> directions{};
+                compute_trace_directions(row, column, directions);
+                path.clear(end);
+
+                // The trace of the reversed sequences read from the origin is the trace of the original sequences
+                // read from their ends.
+                if (is_left)
+                {
+                    for (auto it = directions.rbegin(); it != directions.rend(); ++it)
+                        path.push_back(*it);
+                }
+                else
+                {
+                    for (trace_directions const direction : directions)
+                        path.push_back(direction);
+                }
+            },
+            callback);
+    }
+
+    //!\brief The configured scoring scheme.
+    scoring_scheme_type scoring_scheme{};
+    //!\brief The scoring scheme used in vectorised mode.
+    alignment_scoring_scheme_t alignment_scoring_scheme{};
+    //!\brief The configured seed extension.
+    align_cfg::seed_extension extension{};
+    //!\brief The gap open score.
+    int32_t gap_open_score{};
+    //!\brief The gap extension score.
+    int32_t gap_extension_score{};
+    //!\brief Whether the last of several cells with the best score is reported.
+    bool report_last_optimum{false};
+};
+
+} // namespace seqan3::detail
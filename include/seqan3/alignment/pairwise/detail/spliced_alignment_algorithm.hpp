@@ -0,0 +1,615 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+/*!\file
+ * \brief Provides seqan3::detail::spliced_alignment_algorithm.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_splice.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/recorded_trace_path.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/alignment_algorithm_helper.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Implements the spliced alignment with a separate intron state.
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ * \tparam alignment_configuration_t The type of the alignment configuration; must be a type specialisation of
+ *                                   seqan3::configuration.
+ *
+ * \details
+ *
+ * The first sequence is the genomic region and the second sequence is the RNA sequence. In addition to the affine gap
+ * recursion, the intron state \f$S\f$ skips bases of the first sequence at a constant score (see
+ * seqan3::align_cfg::gap_cost_splice):
+ *
+ * * \f$ S[i, j] = \max \{M[i, j - 1] + g_s + d(j), S[i, j - 1]\}\f$
+ * * \f$ M[i, j] = \max \{M[i - 1, j - 1] + \delta, H[i, j], V[i, j], S[i, j] + a(j)\}\f$
+ *
+ * where \f$g_s\f$ is the intron open score and \f$d(j)\f$ and \f$a(j)\f$ are the non-canonical scores of an
+ * intron beginning or ending with the \f$j\f$-th base of the first sequence, respectively. Introns are not opened in
+ * the first row, i.e. before the first base of the second sequence.
+ *
+ * The matrix is computed column by column in \f$O(n \cdot m)\f$ time. Only one column of scores is kept in memory.
+ * If the begin positions, the alignment or the CIGAR string are requested, the trace of all cells is stored, which
+ * requires one byte per cell. The buffers are kept thread local such that they can be reused for all sequence pairs
+ * that are aligned by the same thread.
+ */
+template <typename alignment_configuration_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class spliced_alignment_algorithm
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using score_type = typename traits_type::score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The type of the scoring scheme.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(!traits_type::is_vectorised, "The spliced alignment cannot be vectorised.");
+
+    //!\brief The score of cells that cannot be reached.
+    static constexpr score_type minus_infinity = std::numeric_limits<score_type>::lowest() / 2;
+
+    /*!\name Trace flags
+     * \brief The trace of a cell stores the origin of the best score and whether the gaps and the intron ending in
+     *        the cell were opened in it.
+     * \{
+     */
+    //!\brief The best score comes from the diagonal.
+    static constexpr uint8_t from_diagonal = 0b0000'0000;
+    //!\brief The best score comes from the vertical gap.
+    static constexpr uint8_t from_vertical = 0b0000'0001;
+    //!\brief The best score comes from the horizontal gap.
+    static constexpr uint8_t from_horizontal = 0b0000'0010;
+    //!\brief The best score comes from the intron.
+    static constexpr uint8_t from_intron = 0b0000'0011;
+    //!\brief The mask of the origin of the best score.
+    static constexpr uint8_t origin_mask = 0b0000'0011;
+    //!\brief The vertical gap is opened in this cell.
+    static constexpr uint8_t vertical_open = 0b0000'0100;
+    //!\brief The horizontal gap is opened in this cell.
+    static constexpr uint8_t horizontal_open = 0b0000'1000;
+    //!\brief The intron is opened in this cell.
+    static constexpr uint8_t intron_open = 0b0001'0000;
+    //!\brief The local alignment begins in this cell.
+    static constexpr uint8_t alignment_begin = 0b0010'0000;
+    //!\}
+
+    //!\brief The buffers of the matrix that are reused for every sequence pair.
+    struct matrix_buffer
+    {
+        //!\brief The best scores of the current column.
+        std::vector<score_type> best{};
+        //!\brief The scores of the horizontal gaps of the current column.
+        std::vector<score_type> horizontal{};
+        //!\brief The scores of the introns of the current column.
+        std::vector<score_type> intron{};
+        //!\brief The trace of all cells in column-major order.
+        std::vector<uint8_t> trace{};
+    };
+
+    //!\brief The cell of the optimum and its score.
+    struct optimum_type
+    {
+        //!\brief The best score.
+        score_type score{minus_infinity};
+        //!\brief The column of the best score.
+        size_t column{};
+        //!\brief The row of the best score.
+        size_t row{};
+
+        //!\brief Replaces the optimum if the given score is better.
+        void update(score_type const new_score, size_t const new_column, size_t const new_row) noexcept
+        {
+            if (new_score > score)
+            {
+                score = new_score;
+                column = new_column;
+                row = new_row;
+            }
+        }
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    spliced_alignment_algorithm() = default;                                                //!< Defaulted.
+    spliced_alignment_algorithm(spliced_alignment_algorithm const &) = default;             //!< Defaulted.
+    spliced_alignment_algorithm(spliced_alignment_algorithm &&) = default;                  //!< Defaulted.
+    spliced_alignment_algorithm & operator=(spliced_alignment_algorithm const &) = default; //!< Defaulted.
+    spliced_alignment_algorithm & operator=(spliced_alignment_algorithm &&) = default;      //!< Defaulted.
+    ~spliced_alignment_algorithm() = default;                                               //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     */
+    spliced_alignment_algorithm(alignment_configuration_t const & config) :
+        scoring_scheme{get<align_cfg::scoring_scheme>(config).scheme}
+    {
+        auto gap_cost =
+            config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+        gap_open_score = gap_cost.open_score + gap_cost.extension_score;
+        gap_extension_score = gap_cost.extension_score;
+
+        auto const & splice_cost = get<align_cfg::gap_cost_splice>(config);
+        intron_open_score = splice_cost.intron_open_score;
+        non_canonical_score = splice_cost.non_canonical_score;
+
+        if constexpr (traits_type::is_global)
+        {
+            auto method_global_config = get<align_cfg::method_global>(config);
+            first_row_is_free = method_global_config.free_end_gaps_sequence1_leading;
+            first_column_is_free = method_global_config.free_end_gaps_sequence2_leading;
+            last_row_is_free = method_global_config.free_end_gaps_sequence1_trailing;
+            last_column_is_free = method_global_config.free_end_gaps_sequence2_trailing;
+        }
+    }
+    //!\}
+
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with the configured alignment result type.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * Computes for each contained sequence pair the respective alignment and invokes the given callback for each
+     * alignment result.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        thread_local matrix_buffer buffer{};
+        thread_local recorded_trace_path trace_path{};
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            optimum_type const optimum = compute_matrix(get<0>(sequence_pair), get<1>(sequence_pair), buffer);
+            make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                   std::move(idx),
+                                   optimum,
+                                   buffer,
+                                   trace_path,
+                                   callback);
+        }
+    }
+
+private:
+    /*!\brief Returns whether the two bases match the given motif.
+     * \param[in] first The first base.
+     * \param[in] second The second base.
+     * \param[in] motif_first The first character of the motif.
+     * \param[in] motif_second The second character of the motif; `T` also matches `U`.
+     */
+    template <typename alphabet_t>
+    static bool matches_motif(alphabet_t const & first,
+                              alphabet_t const & second,
+                              char const motif_first,
+                              char const motif_second) noexcept
+    {
+        auto matches = [](char const base, char const motif)
+        {
+            char const upper_base = (base >= 'a' && base <= 'z') ? base - 'a' + 'A' : base;
+            return upper_base == motif || (motif == 'T' && upper_base == 'U');
+        };
+
+        return matches(to_char(first), motif_first) && matches(to_char(second), motif_second);
+    }
+
+    /*!\brief Computes the non-canonical scores of all splice sites of the first sequence.
+     * \param[in] sequence1 The first sequence.
+     * \param[out] donor The score of an intron beginning with the \f$j\f$-th base, stored at index \f$j\f$.
+     * \param[out] acceptor The score of an intron ending with the \f$j\f$-th base, stored at index \f$j\f$.
+     */
+    template <std::ranges::random_access_range sequence1_t>
+    void compute_splice_site_scores(sequence1_t && sequence1,
+                                    std::vector<score_type> & donor,
+                                    std::vector<score_type> & acceptor) const
+    {
+        size_t const sequence1_size = std::ranges::distance(sequence1);
+        auto sequence1_it = std::ranges::begin(sequence1);
+
+        donor.assign(sequence1_size + 1, non_canonical_score);
+        acceptor.assign(sequence1_size + 1, non_canonical_score);
+
+        if (non_canonical_score == 0)
+            return;
+
+        for (size_t j = 1; j < sequence1_size; ++j)
+        {
+            // The intron begins with the j-th base or ends with the (j + 1)-th base.
+            if (matches_motif(sequence1_it[j - 1], sequence1_it[j], 'G', 'T'))
+                donor[j] = 0;
+            if (matches_motif(sequence1_it[j - 1], sequence1_it[j], 'A', 'G'))
+                acceptor[j + 1] = 0;
+        }
+    }
+
+    /*!\brief Computes the alignment matrix column by column.
+     * \param[in] sequence1 The first sequence, i.e. the columns of the matrix.
+     * \param[in] sequence2 The second sequence, i.e. the rows of the matrix.
+     * \param[in,out] buffer The buffers to compute the matrix in.
+     * \returns The score and the cell of the optimum.
+     */
+    template <std::ranges::random_access_range sequence1_t, std::ranges::random_access_range sequence2_t>
+    optimum_type compute_matrix(sequence1_t && sequence1, sequence2_t && sequence2, matrix_buffer & buffer) const
+    {
+        size_t const sequence1_size = std::ranges::distance(sequence1);
+        size_t const sequence2_size = std::ranges::distance(sequence2);
+        size_t const column_size = sequence2_size + 1;
+        auto sequence1_it = std::ranges::begin(sequence1);
+        auto sequence2_it = std::ranges::begin(sequence2);
+
+        thread_local std::vector<score_type> donor{};
+        thread_local std::vector<score_type> acceptor{};
+        compute_splice_site_scores(sequence1, donor, acceptor);
+
+        if constexpr (traits_type::requires_trace_information)
+            buffer.trace.assign((sequence1_size + 1) * column_size, from_diagonal);
+
+        // ---------------------------------------------------------------------
+        // Initialise the first column.
+        // ---------------------------------------------------------------------
+
+        buffer.best.resize(column_size);
+        buffer.horizontal.assign(column_size, minus_infinity);
+        buffer.intron.assign(column_size, minus_infinity);
+
+        optimum_type optimum{};
+        buffer.best[0] = 0;
+        for (size_t i = 1; i < column_size; ++i)
+        {
+            if constexpr (traits_type::is_local)
+                buffer.best[i] = 0;
+            else
+                buffer.best[i] = first_column_is_free ? 0 : gap_open_score + (i - 1) * gap_extension_score;
+
+            if constexpr (traits_type::requires_trace_information)
+                buffer.trace[i]
+                    = traits_type::is_local ? alignment_begin : from_vertical | (i == 1 ? vertical_open : 0);
+        }
+
+        if constexpr (traits_type::is_local)
+            optimum.update(0, 0, 0);
+        else
+            track_last_column_or_row(optimum, 0, sequence1_size, sequence2_size, buffer.best);
+
+        // ---------------------------------------------------------------------
+        // Compute the remaining columns.
+        // ---------------------------------------------------------------------
+
+        for (size_t j = 1; j <= sequence1_size; ++j)
+        {
+            [[maybe_unused]] uint8_t * trace{};
+            if constexpr (traits_type::requires_trace_information)
+                trace = buffer.trace.data() + j * column_size;
+
+            score_type diagonal = buffer.best[0];
+
+            // The first row.
+            if constexpr (traits_type::is_local)
+            {
+                buffer.best[0] = 0;
+                if constexpr (traits_type::requires_trace_information)
+                    trace[0] = alignment_begin;
+            }
+            else
+            {
+                buffer.best[0] = first_row_is_free ? 0 : gap_open_score + (j - 1) * gap_extension_score;
+                if constexpr (traits_type::requires_trace_information)
+                    trace[0] = from_horizontal | (j == 1 ? horizontal_open : 0);
+            }
+
+            score_type vertical = minus_infinity;
+            score_type const donor_score = intron_open_score + donor[j];
+            score_type const acceptor_score = acceptor[j];
+            auto const sequence1_value = sequence1_it[j - 1];
+
+            for (size_t i = 1; i < column_size; ++i)
+            {
+                score_type const left_best = buffer.best[i];
+
+                score_type const opened_horizontal = left_best + gap_open_score;
+                score_type const extended_horizontal = buffer.horizontal[i] + gap_extension_score;
+                score_type const opened_vertical = buffer.best[i - 1] + gap_open_score;
+                score_type const extended_vertical = vertical + gap_extension_score;
+                score_type const opened_intron = left_best + donor_score;
+                score_type const extended_intron = buffer.intron[i];
+
+                score_type const horizontal = std::max(opened_horizontal, extended_horizontal);
+                vertical = std::max(opened_vertical, extended_vertical);
+                score_type const intron = std::max(opened_intron, extended_intron);
+
+                score_type const diagonal_score = diagonal + scoring_scheme.score(sequence1_value, sequence2_it[i - 1]);
+                score_type const intron_end_score = intron + acceptor_score;
+
+                // Prefer the diagonal over the vertical over the horizontal direction and the gaps over the intron.
+                score_type best = diagonal_score;
+                uint8_t origin = from_diagonal;
+                if (vertical > best)
+                {
+                    best = vertical;
+                    origin = from_vertical;
+                }
+                if (horizontal > best)
+                {
+                    best = horizontal;
+                    origin = from_horizontal;
+                }
+                if (intron_end_score > best)
+                {
+                    best = intron_end_score;
+                    origin = from_intron;
+                }
+
+                if constexpr (traits_type::is_local)
+                {
+                    if (best <= 0)
+                    {
+                        best = 0;
+                        origin = alignment_begin;
+                    }
+                    optimum.update(best, j, i);
+                }
+
+                // Like the trace iterator, prefer extending a gap or an intron over opening it.
+                if constexpr (traits_type::requires_trace_information)
+                {
+                    trace[i] = origin | ((opened_vertical > extended_vertical) ? vertical_open : 0)
+                             | ((opened_horizontal > extended_horizontal) ? horizontal_open : 0)
+                             | ((opened_intron > extended_intron) ? intron_open : 0);
+                }
+
+                diagonal = left_best;
+                buffer.best[i] = best;
+                buffer.horizontal[i] = horizontal;
+                buffer.intron[i] = intron;
+            }
+
+            if constexpr (!traits_type::is_local)
+                track_last_column_or_row(optimum, j, sequence1_size, sequence2_size, buffer.best);
+        }
+
+        return optimum;
+    }
+
+    /*!\brief Tracks the optimum of a global alignment in the last column and the last row of the matrix.
+     * \param[in,out] optimum The optimum to update.
+     * \param[in] column The current column.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     * \param[in] best The best scores of the current column.
+     */
+    void track_last_column_or_row(optimum_type & optimum,
+                                  size_t const column,
+                                  size_t const sequence1_size,
+                                  size_t const sequence2_size,
+                                  std::vector<score_type> const & best) const noexcept
+    {
+        if (column == sequence1_size)
+        {
+            if (last_column_is_free)
+            {
+                for (size_t i = 0; i <= sequence2_size; ++i)
+                    optimum.update(best[i], column, i);
+            }
+            else
+            {
+                optimum.update(best[sequence2_size], column, sequence2_size);
+            }
+        }
+        else if (last_row_is_free)
+        {
+            optimum.update(best[sequence2_size], column, sequence2_size);
+        }
+    }
+
+    /*!\brief Follows the trace from the optimum to the begin of the alignment.
+     * \param[in] buffer The buffers filled by compute_matrix.
+     * \param[in] optimum The optimum where the trace begins.
+     * \param[in] column_size The number of cells of a column.
+     * \param[out] trace_path The path to record the trace in; introns are recorded as horizontal gaps.
+     * \param[out] cigar_sequence The CIGAR sequence of the alignment, where introns are `N` operations.
+     * \returns The cell where the alignment begins.
+     */
+    matrix_coordinate compute_trace_path(matrix_buffer const & buffer,
+                                         optimum_type const & optimum,
+                                         size_t const column_size,
+                                         recorded_trace_path & trace_path,
+                                         std::vector<cigar> & cigar_sequence) const
+    {
+        using namespace seqan3::literals;
+
+        enum struct state
+        {
+            best,
+            horizontal,
+            vertical,
+            intron
+        };
+
+        trace_path.clear(matrix_coordinate{row_index_type{optimum.row}, column_index_type{optimum.column}});
+        cigar_sequence.clear();
+
+        cigar::operation last_operation{};
+        uint32_t count{};
+        auto push = [&](trace_directions const direction, cigar::operation const operation)
+        {
+            trace_path.push_back(direction);
+            if (count > 0 && operation != last_operation)
+            {
+                cigar_sequence.emplace_back(count, last_operation);
+                count = 0;
+            }
+            last_operation = operation;
+            ++count;
+        };
+
+        size_t row = optimum.row;
+        size_t column = optimum.column;
+        state current_state = state::best;
+
+        while (row > 0 || column > 0)
+        {
+            uint8_t const cell_trace = buffer.trace[column * column_size + row];
+
+            if (current_state == state::best)
+            {
+                // Free leading end-gaps and the begin of a local alignment are not part of the alignment.
+                if ((cell_trace & alignment_begin) || (row == 0 && first_row_is_free)
+                    || (column == 0 && first_column_is_free))
+                    break;
+
+                switch (cell_trace & origin_mask)
+                {
+                    case from_diagonal:
+                        push(trace_directions::diagonal, 'M'_cigar_operation);
+                        --row;
+                        --column;
+                        continue;
+                    case from_vertical:
+                        current_state = state::vertical;
+                        break;
+                    case from_horizontal:
+                        current_state = state::horizontal;
+                        break;
+                    default:
+                        current_state = state::intron;
+                }
+            }
+
+            // Gaps and introns are either opened from the best score of the preceding cell or extended.
+            switch (current_state)
+            {
+                case state::vertical:
+                    push(trace_directions::up, 'I'_cigar_operation);
+                    if (cell_trace & vertical_open)
+                        current_state = state::best;
+                    --row;
+                    break;
+                case state::horizontal:
+                    push(trace_directions::left, 'D'_cigar_operation);
+                    if (cell_trace & horizontal_open)
+                        current_state = state::best;
+                    --column;
+                    break;
+                default:
+                    assert(current_state == state::intron);
+                    push(trace_directions::left, 'N'_cigar_operation);
+                    if (cell_trace & intron_open)
+                        current_state = state::best;
+                    --column;
+            }
+        }
+
+        if (count > 0)
+            cigar_sequence.emplace_back(count, last_operation);
+
+        std::ranges::reverse(cigar_sequence);
+        return matrix_coordinate{row_index_type{row}, column_index_type{column}};
+    }
+
+    /*!\brief Creates a new alignment result from the computed matrix and invokes the callback.
+     * \param[in] sequence_pair The aligned sequence pair.
+     * \param[in] id The index of the sequence pair.
+     * \param[in] optimum The score and the cell of the optimum.
+     * \param[in] buffer The buffers filled by compute_matrix.
+     * \param[in,out] trace_path The buffer to record the trace path in.
+     * \param[in] callback The callback to invoke with the alignment result.
+     */
+    template <typename sequence_pair_t, typename index_t, typename callback_t>
+    void make_result_and_invoke(sequence_pair_t && sequence_pair,
+                                index_t && id,
+                                optimum_type const & optimum,
+                                [[maybe_unused]] matrix_buffer const & buffer,
+                                recorded_trace_path & trace_path,
+                                callback_t & callback) const
+    {
+        using std::get;
+
+        // The trace is followed before the result is built, as the begin positions are only known afterwards.
+        thread_local std::vector<cigar> cigar_sequence{};
+        matrix_coordinate begin{};
+        if constexpr (traits_type::requires_trace_information)
+            begin = compute_trace_path(buffer,
+                                       optimum,
+                                       std::ranges::distance(get<1>(sequence_pair)) + 1,
+                                       trace_path,
+                                       cigar_sequence);
+
+        // The CIGAR string is taken from the trace, as it marks the introns with `N` operations.
+        make_alignment_result_and_invoke<traits_type, alignment_result_type>(
+            std::forward<sequence_pair_t>(sequence_pair),
+            std::forward<index_t>(id),
+            optimum.score,
+            begin,
+            matrix_coordinate{row_index_type{optimum.row}, column_index_type{optimum.column}},
+            trace_path,
+            [&](recorded_trace_path &) -> std::vector<cigar> const &
+            {
+                return cigar_sequence;
+            },
+            callback);
+    }
+
+    //!\brief The scoring scheme.
+    scoring_scheme_type scoring_scheme{};
+    //!\brief The score of the first gap character, i.e. the sum of the gap open and the gap extension score.
+    score_type gap_open_score{};
+    //!\brief The score of every further gap character.
+    score_type gap_extension_score{};
+    //!\brief The score of an intron.
+    score_type intron_open_score{};
+    //!\brief The score of a non-canonical splice site.
+    score_type non_canonical_score{};
+    //!\brief Whether leading gaps in the first sequence are free.
+    bool first_row_is_free{};
+    //!\brief Whether leading gaps in the second sequence are free.
+    bool first_column_is_free{};
+    //!\brief Whether trailing gaps in the first sequence are free.
+    bool last_row_is_free{};
+    //!\brief Whether trailing gaps in the second sequence are free.
+    bool last_column_is_free{};
+};
+
+} // namespace seqan3::detail
@@ -17,6 +17,7 @@
 
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_splice.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/configuration/align_config_on_result.hpp>
 #include <seqan3/alignment/configuration/align_config_output.hpp>
@@ -24,7 +25,9 @@
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
 #include <seqan3/alignment/configuration/align_config_score_type.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_seed_extension.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
 #include <seqan3/alignment/matrix/detail/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
@@ -121,8 +124,16 @@ public:
     static constexpr bool is_local = configuration_t::template exists<seqan3::align_cfg::method_local>();
     //!\brief Flag indicating whether banded alignment mode is enabled.
     static constexpr bool is_banded = configuration_t::template exists<align_cfg::band_fixed_size>();
+    //!\brief Flag indicating whether the adaptive band is selected.
+    static constexpr bool is_adaptive_banded = configuration_t::template exists<align_cfg::band_adaptive>();
     //!\brief Flag indicating whether debug mode is enabled.
     static constexpr bool is_debug = configuration_t::template exists<detail::debug_mode>();
+    //!\brief Flag indicating whether the wavefront alignment algorithm is selected.
+    static constexpr bool is_wavefront = configuration_t::template exists<align_cfg::wavefront>();
+    //!\brief Flag indicating whether the spliced alignment with a separate intron state is selected.
+    static constexpr bool is_spliced = configuration_t::template exists<align_cfg::gap_cost_splice>();
+    //!\brief Flag indicating whether the seed extension with an X-drop or Z-drop is selected.
+    static constexpr bool is_seed_extension = configuration_t::template exists<align_cfg::seed_extension>();
     //!\brief Flag indicating whether a user provided callback was given.
     static constexpr bool is_one_way_execution = configuration_t::template exists<align_cfg::on_result>();
     //!\brief The selected scoring scheme.
@@ -163,16 +174,19 @@ public:
         configuration_t::template exists<align_cfg::output_begin_position>();
     //!\brief Flag indicating whether the sequence alignment shall be computed.
     static constexpr bool compute_sequence_alignment = configuration_t::template exists<align_cfg::output_alignment>();
+    //!\brief Flag indicating whether the CIGAR representation of the alignment shall be computed.
+    static constexpr bool output_cigar = configuration_t::template exists<align_cfg::output_cigar>();
     //!\brief Flag indicating whether the id of the first sequence shall be returned.
     static constexpr bool output_sequence1_id = configuration_t::template exists<align_cfg::output_sequence1_id>();
     //!\brief Flag indicating whether the id of the second sequence shall be returned.
     static constexpr bool output_sequence2_id = configuration_t::template exists<align_cfg::output_sequence2_id>();
     //!\brief Flag indicating if any output option was set.
     static constexpr bool has_output_configuration = compute_score || compute_end_positions || compute_begin_positions
-                                                  || compute_sequence_alignment || output_sequence1_id
+                                                  || compute_sequence_alignment || output_cigar || output_sequence1_id
                                                   || output_sequence2_id;
     //!\brief Flag indicating whether the trace matrix needs to be computed.
-    static constexpr bool requires_trace_information = compute_begin_positions || compute_sequence_alignment;
+    static constexpr bool requires_trace_information =
+        compute_begin_positions || compute_sequence_alignment || output_cigar;
 };
 
 //------------------------------------------------------------------------------
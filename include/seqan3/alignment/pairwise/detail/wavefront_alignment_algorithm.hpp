@@ -0,0 +1,590 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::wavefront_alignment_algorithm.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/recorded_trace_path.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/alignment_algorithm_helper.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Implements the gap-affine wavefront alignment algorithm (WFA).
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ * \tparam alignment_configuration_t The type of the alignment configuration; must be a type specialisation of
+ *                                   seqan3::configuration.
+ *
+ * \details
+ *
+ * Instead of computing the complete dynamic programming matrix, the wavefront algorithm computes, for increasing
+ * penalties `s`, the furthest reaching cell on every diagonal `k` that can be reached with exactly penalty `s`.
+ * After each step the furthest reaching cells of the match wavefront are extended along the diagonal as long as the
+ * characters of both sequences match. The algorithm terminates as soon as the furthest reaching cell on the final
+ * diagonal reaches the bottom-right corner of the matrix. Hence, the run time and memory depend on the penalty of the
+ * optimal alignment and not on the product of the sequence lengths.
+ *
+ * The algorithm works on penalties, where a match has a penalty of 0. The configured scores are converted into
+ * equivalent penalties within the constructor, such that the optimal alignment with respect to the penalties is also
+ * an optimal alignment with respect to the configured scores.
+ * Let `a` be the match score, `b` the mismatch score, `g_o` the gap open score and `g_e` the gap extension score.
+ * Every global alignment of two sequences with the lengths `n` and `m` satisfies `2M + 2X + G = n + m`, where `M` is
+ * the number of matches, `X` the number of mismatches and `G` the total number of gap characters.
+ * Thus, the score of an alignment is `a(n+m)/2 - P`, with the penalty `P = (a-b)X - g_o O + (a/2-g_e)G`, where `O`
+ * is the number of gaps. If `a` is odd, all penalties are doubled to keep them integral.
+ *
+ * If the gap open penalty is 0, the insertion and deletion wavefronts are identical to the match wavefronts they
+ * originate from and are therefore not stored (linear gap model).
+ *
+ * When only the score or the end positions are requested, only the wavefronts that can still be a source of a
+ * future wavefront are kept in memory. Otherwise, all wavefronts are kept to reconstruct the alignment.
+ * The wavefront storage is kept in thread local buffers such that it can be reused for all sequence pairs that are
+ * aligned by the same thread.
+ */
+template <typename alignment_configuration_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class wavefront_alignment_algorithm
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using score_type = typename traits_type::score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The type of the scoring scheme.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+    //!\brief The type of the offsets stored in the wavefronts.
+    using offset_type = int32_t;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(traits_type::is_global, "The wavefront alignment algorithm only supports global alignments.");
+    static_assert(!traits_type::is_vectorised, "The wavefront alignment algorithm cannot be vectorised.");
+
+    //!\brief Marks a cell that cannot be reached with the respective penalty.
+    static constexpr offset_type null_offset = std::numeric_limits<offset_type>::min() / 2;
+
+    //!\brief The furthest reaching offsets of one wavefront component for the diagonals `[lo, hi]`.
+    struct wavefront_component
+    {
+        //!\brief The lowest diagonal of this component.
+        offset_type lo{0};
+        //!\brief The highest diagonal of this component.
+        offset_type hi{-1};
+        //!\brief The furthest reaching offsets, i.e. the column indices, per diagonal.
+        std::vector<offset_type> offsets{};
+
+        //!\brief Returns the offset on diagonal `k` or seqan3::detail::wavefront_alignment_algorithm::null_offset.
+        offset_type operator[](offset_type const k) const noexcept
+        {
+            return (k < lo || k > hi) ? null_offset : offsets[k - lo];
+        }
+
+        //!\brief Whether this component contains any diagonal.
+        bool empty() const noexcept
+        {
+            return lo > hi;
+        }
+
+        //!\brief Resets the component to cover the diagonals `[new_lo, new_hi]`.
+        void reset(offset_type const new_lo, offset_type const new_hi)
+        {
+            lo = new_lo;
+            hi = new_hi;
+            offsets.resize(std::max<offset_type>(hi - lo + 1, 0));
+        }
+    };
+
+    //!\brief The match (M), insertion (I) and deletion (D) components of the wavefront with the same penalty.
+    struct wavefront_type
+    {
+        wavefront_component m{}; //!< The match component.
+        wavefront_component i{}; //!< The insertion component; gap in the second sequence.
+        wavefront_component d{}; //!< The deletion component; gap in the first sequence.
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    wavefront_alignment_algorithm() = default;                                                  //!< Defaulted.
+    wavefront_alignment_algorithm(wavefront_alignment_algorithm const &) = default;             //!< Defaulted.
+    wavefront_alignment_algorithm(wavefront_alignment_algorithm &&) = default;                  //!< Defaulted.
+    wavefront_alignment_algorithm & operator=(wavefront_alignment_algorithm const &) = default; //!< Defaulted.
+    wavefront_alignment_algorithm & operator=(wavefront_alignment_algorithm &&) = default;      //!< Defaulted.
+    ~wavefront_alignment_algorithm() = default;                                                 //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the scoring scheme does not have a uniform match and
+     *         mismatch score, if the resulting penalties are not positive or if free end-gaps were configured.
+     */
+    wavefront_alignment_algorithm(alignment_configuration_t const & config) :
+        scoring_scheme{get<align_cfg::scoring_scheme>(config).scheme}
+    {
+        reject_free_end_gaps(config, "The wavefront alignment algorithm");
+
+        // ----------------------------------------------------------------------------
+        // Check that the scoring scheme only distinguishes matches from mismatches.
+        // ----------------------------------------------------------------------------
+
+        using alphabet_t = typename traits_type::scoring_scheme_alphabet_type;
+        using rank_t = alphabet_rank_t<alphabet_t>;
+
+        auto to_letter = [](size_t const rank)
+        {
+            return assign_rank_to(static_cast<rank_t>(rank), alphabet_t{});
+        };
+
+        match_score = scoring_scheme.score(to_letter(0), to_letter(0));
+        mismatch_score = (alphabet_size<alphabet_t> > 1) ? scoring_scheme.score(to_letter(0), to_letter(1))
+                                                         : match_score - 1;
+
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+        {
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+            {
+                if (scoring_scheme.score(to_letter(rank1), to_letter(rank2))
+                    != ((rank1 == rank2) ? match_score : mismatch_score))
+                {
+                    throw invalid_alignment_configuration{"The wavefront alignment algorithm requires a scoring scheme "
+                                                          "with a uniform match and a uniform mismatch score."};
+                }
+            }
+        }
+
+        // ----------------------------------------------------------------------------
+        // Convert the scores into penalties.
+        // ----------------------------------------------------------------------------
+
+        auto gap_cost =
+            config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+
+        penalty_factor = (match_score % 2 == 0) ? 1 : 2;
+        mismatch_penalty = penalty_factor * (match_score - mismatch_score);
+        gap_open_penalty = -penalty_factor * gap_cost.open_score;
+        gap_extension_penalty = penalty_factor * match_score / 2 - penalty_factor * gap_cost.extension_score;
+
+        if (mismatch_penalty <= 0 || gap_open_penalty < 0 || gap_extension_penalty <= 0)
+        {
+            throw invalid_alignment_configuration{"The wavefront alignment algorithm requires a match score that is "
+                                                  "greater than the mismatch score, a gap open score that is not "
+                                                  "positive and a gap extension score that is smaller than half of the "
+                                                  "match score."};
+        }
+    }
+    //!\}
+
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with the configured alignment result type.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * Computes for each contained sequence pair the respective alignment and invokes the given callback for each
+     * alignment result.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        thread_local std::vector<wavefront_type> wavefronts{};
+        thread_local recorded_trace_path trace_path{};
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            offset_type const penalty = compute_wavefronts(get<0>(sequence_pair), get<1>(sequence_pair), wavefronts);
+            int64_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+            int64_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+
+            // Convert the penalty back into the score of the configured scoring scheme.
+            int64_t const scaled_score =
+                penalty_factor * match_score * (sequence1_size + sequence2_size) / 2 - static_cast<int64_t>(penalty);
+
+            make_alignment_result_and_invoke<traits_type, alignment_result_type>(
+                std::forward<decltype(sequence_pair)>(sequence_pair),
+                std::move(idx),
+                static_cast<score_type>(scaled_score / penalty_factor),
+                matrix_coordinate{row_index_type{0u}, column_index_type{0u}},
+                matrix_coordinate{row_index_type{static_cast<size_t>(sequence2_size)},
+                                  column_index_type{static_cast<size_t>(sequence1_size)}},
+                trace_path,
+                [&](recorded_trace_path & path)
+                {
+                    compute_trace_path(wavefronts, penalty, sequence1_size, sequence2_size, path);
+                },
+                callback);
+        }
+    }
+
+private:
+    //!\brief Whether the insertion and deletion wavefronts are not stored, because the gap open penalty is 0.
+    bool has_linear_gaps() const noexcept
+    {
+        return gap_open_penalty == 0;
+    }
+
+    //!\brief The number of wavefronts that must be kept in memory when computing only the score.
+    size_t ring_size() const noexcept
+    {
+        return std::max(mismatch_penalty, gap_open_penalty + gap_extension_penalty) + 1;
+    }
+
+    //!\brief Returns the wavefront for the given penalty or `nullptr` if the penalty is negative.
+    wavefront_type const * wavefront_at(std::vector<wavefront_type> const & wavefronts,
+                                        offset_type const penalty) const noexcept
+    {
+        if (penalty < 0)
+            return nullptr;
+
+        if constexpr (traits_type::requires_trace_information)
+            return &wavefronts[penalty];
+        else
+            return &wavefronts[penalty % ring_size()];
+    }
+
+    //!\brief Returns the offset on diagonal `k` of the given component if the source wavefront exists.
+    static offset_type offset_at(wavefront_type const * wavefront,
+                                 wavefront_component wavefront_type::*component,
+                                 offset_type const k) noexcept
+    {
+        return (wavefront == nullptr) ? null_offset : (wavefront->*component)[k];
+    }
+
+    /*!\brief Returns the offset if it describes a cell within the matrix, otherwise
+     *        seqan3::detail::wavefront_alignment_algorithm::null_offset.
+     */
+    static offset_type clip(offset_type const offset,
+                            offset_type const k,
+                            offset_type const sequence1_size,
+                            offset_type const sequence2_size) noexcept
+    {
+        offset_type const row = offset - k;
+        return (offset < 0 || row < 0 || offset > sequence1_size || row > sequence2_size) ? null_offset : offset;
+    }
+
+    //!\brief Updates the diagonal range `[lo, hi]` with the range of the given component shifted by `shift`.
+    static void update_range(offset_type & lo,
+                             offset_type & hi,
+                             wavefront_type const * wavefront,
+                             wavefront_component wavefront_type::*component,
+                             offset_type const shift) noexcept
+    {
+        if (wavefront == nullptr || (wavefront->*component).empty())
+            return;
+
+        lo = std::min(lo, (wavefront->*component).lo + shift);
+        hi = std::max(hi, (wavefront->*component).hi + shift);
+    }
+
+    /*!\brief Computes the wavefronts until the end of both sequences is reached.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in,out] wavefronts The storage for the wavefronts.
+     * \returns The penalty of the optimal alignment.
+     */
+    template <std::ranges::random_access_range sequence1_t, std::ranges::random_access_range sequence2_t>
+    offset_type compute_wavefronts(sequence1_t && sequence1,
+                                   sequence2_t && sequence2,
+                                   std::vector<wavefront_type> & wavefronts)
+    {
+        offset_type const sequence1_size = std::ranges::distance(sequence1);
+        offset_type const sequence2_size = std::ranges::distance(sequence2);
+        offset_type const final_diagonal = sequence1_size - sequence2_size;
+
+        auto sequence1_it = std::ranges::begin(sequence1);
+        auto sequence2_it = std::ranges::begin(sequence2);
+
+        // Extends the furthest reaching cells of the match component along the matching characters.
+        auto extend = [&](wavefront_component & match)
+        {
+            for (offset_type k = match.lo; k <= match.hi; ++k)
+            {
+                offset_type & offset = match.offsets[k - match.lo];
+                if (offset == null_offset)
+                    continue;
+
+                offset_type row = offset - k;
+                while (offset < sequence1_size && row < sequence2_size
+                       && is_match(sequence1_it[offset], sequence2_it[row]))
+                {
+                    ++offset;
+                    ++row;
+                }
+            }
+        };
+
+        if constexpr (!traits_type::requires_trace_information)
+            wavefronts.resize(std::max(wavefronts.size(), ring_size()));
+
+        for (offset_type penalty = 0;; ++penalty)
+        {
+            if constexpr (traits_type::requires_trace_information)
+            {
+                if (static_cast<size_t>(penalty) >= wavefronts.size())
+                    wavefronts.resize(penalty + 1);
+            }
+
+            wavefront_type & current = wavefronts[traits_type::requires_trace_information ? penalty
+                                                                                          : penalty % ring_size()];
+            current.m.reset(0, -1);
+            current.i.reset(0, -1);
+            current.d.reset(0, -1);
+
+            if (penalty == 0)
+            {
+                current.m.reset(0, 0);
+                current.m.offsets[0] = 0;
+            }
+            else
+            {
+                wavefront_type const * mismatch_source = wavefront_at(wavefronts, penalty - mismatch_penalty);
+                wavefront_type const * open_source =
+                    wavefront_at(wavefronts, penalty - gap_open_penalty - gap_extension_penalty);
+                wavefront_type const * extension_source = wavefront_at(wavefronts, penalty - gap_extension_penalty);
+
+                // Determine the diagonal range of the new wavefront.
+                offset_type lo = std::numeric_limits<offset_type>::max();
+                offset_type hi = std::numeric_limits<offset_type>::min();
+
+                update_range(lo, hi, mismatch_source, &wavefront_type::m, 0);
+                update_range(lo, hi, open_source, &wavefront_type::m, -1);
+                update_range(lo, hi, open_source, &wavefront_type::m, 1);
+                update_range(lo, hi, extension_source, &wavefront_type::i, 1);
+                update_range(lo, hi, extension_source, &wavefront_type::d, -1);
+
+                lo = std::max(lo, -sequence2_size);
+                hi = std::min(hi, sequence1_size);
+
+                if (lo > hi) // No cell can be reached with this penalty.
+                    continue;
+
+                current.m.reset(lo, hi);
+                if (!has_linear_gaps())
+                {
+                    current.i.reset(lo, hi);
+                    current.d.reset(lo, hi);
+                }
+
+                for (offset_type k = lo; k <= hi; ++k)
+                {
+                    offset_type insertion = offset_at(open_source, &wavefront_type::m, k - 1);
+                    offset_type deletion = offset_at(open_source, &wavefront_type::m, k + 1);
+
+                    if (!has_linear_gaps())
+                    {
+                        insertion = std::max(insertion, offset_at(extension_source, &wavefront_type::i, k - 1));
+                        deletion = std::max(deletion, offset_at(extension_source, &wavefront_type::d, k + 1));
+                    }
+
+                    insertion = clip(insertion + 1, k, sequence1_size, sequence2_size);
+                    deletion = clip(deletion, k, sequence1_size, sequence2_size);
+                    offset_type const mismatch = clip(offset_at(mismatch_source, &wavefront_type::m, k) + 1,
+                                                      k,
+                                                      sequence1_size,
+                                                      sequence2_size);
+
+                    if (!has_linear_gaps())
+                    {
+                        current.i.offsets[k - lo] = insertion;
+                        current.d.offsets[k - lo] = deletion;
+                    }
+                    current.m.offsets[k - lo] = std::max({mismatch, insertion, deletion});
+                }
+            }
+
+            extend(current.m);
+
+            if (current.m[final_diagonal] == sequence1_size)
+                return penalty;
+        }
+    }
+
+    /*!\brief Reconstructs the trace path of the optimal alignment from the stored wavefronts.
+     * \param[in] wavefronts The wavefronts computed by compute_wavefronts.
+     * \param[in] penalty The penalty of the optimal alignment.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     * \param[out] trace_path The path to record the trace in.
+     */
+    void compute_trace_path(std::vector<wavefront_type> const & wavefronts,
+                            offset_type penalty,
+                            offset_type const sequence1_size,
+                            offset_type const sequence2_size,
+                            recorded_trace_path & trace_path) const
+    {
+        enum struct state
+        {
+            match,
+            insertion,
+            deletion
+        };
+
+        trace_path.clear(matrix_coordinate{row_index_type{static_cast<size_t>(sequence2_size)},
+                                           column_index_type{static_cast<size_t>(sequence1_size)}});
+
+        offset_type k = sequence1_size - sequence2_size;
+        offset_type offset = sequence1_size;
+        state current_state = state::match;
+
+        while (true)
+        {
+            wavefront_type const & current = wavefronts[penalty];
+
+            if (current_state == state::match)
+            {
+                if (penalty == 0)
+                {
+                    assert(k == 0);
+                    trace_path.push_back(trace_directions::diagonal, offset);
+                    return;
+                }
+
+                wavefront_type const * open_source =
+                    wavefront_at(wavefronts, penalty - gap_open_penalty - gap_extension_penalty);
+
+                offset_type const mismatch =
+                    clip(offset_at(wavefront_at(wavefronts, penalty - mismatch_penalty), &wavefront_type::m, k) + 1,
+                         k,
+                         sequence1_size,
+                         sequence2_size);
+                offset_type insertion = current.i[k];
+                offset_type deletion = current.d[k];
+
+                if (has_linear_gaps())
+                {
+                    insertion = clip(offset_at(open_source, &wavefront_type::m, k - 1) + 1,
+                                     k,
+                                     sequence1_size,
+                                     sequence2_size);
+                    deletion = clip(offset_at(open_source, &wavefront_type::m, k + 1),
+                                    k,
+                                    sequence1_size,
+                                    sequence2_size);
+                }
+
+                offset_type const origin = std::max({mismatch, insertion, deletion});
+                assert(origin != null_offset);
+                trace_path.push_back(trace_directions::diagonal, offset - origin);
+                offset = origin;
+
+                if (origin == mismatch)
+                {
+                    trace_path.push_back(trace_directions::diagonal);
+                    --offset;
+                    penalty -= mismatch_penalty;
+                }
+                else if (has_linear_gaps())
+                {
+                    penalty -= gap_extension_penalty;
+                    if (origin == insertion)
+                    {
+                        trace_path.push_back(trace_directions::left);
+                        --offset;
+                        --k;
+                    }
+                    else
+                    {
+                        trace_path.push_back(trace_directions::up);
+                        ++k;
+                    }
+                }
+                else
+                {
+                    current_state = (origin == insertion) ? state::insertion : state::deletion;
+                }
+            }
+            else
+            {
+                // Gaps are either opened from the match component or extended from the same gap component.
+                bool const is_insertion = current_state == state::insertion;
+                offset_type const source_k = is_insertion ? k - 1 : k + 1;
+                offset_type const source_offset = is_insertion ? offset - 1 : offset;
+
+                trace_path.push_back(is_insertion ? trace_directions::left : trace_directions::up);
+
+                if (offset_at(wavefront_at(wavefronts, penalty - gap_open_penalty - gap_extension_penalty),
+                              &wavefront_type::m,
+                              source_k)
+                    == source_offset)
+                {
+                    penalty -= gap_open_penalty + gap_extension_penalty;
+                    current_state = state::match;
+                }
+                else
+                {
+                    assert(offset_at(wavefront_at(wavefronts, penalty - gap_extension_penalty),
+                                     is_insertion ? &wavefront_type::i : &wavefront_type::d,
+                                     source_k)
+                           == source_offset);
+                    penalty -= gap_extension_penalty;
+                }
+
+                k = source_k;
+                offset = source_offset;
+            }
+        }
+    }
+
+    //!\brief Checks whether the two letters are scored as a match.
+    template <typename letter1_t, typename letter2_t>
+    bool is_match(letter1_t const & letter1, letter2_t const & letter2) const noexcept
+    {
+        if constexpr (std::same_as<letter1_t, letter2_t> && std::equality_comparable<letter1_t>)
+            return letter1 == letter2;
+        else
+            return scoring_scheme.score(letter1, letter2) == match_score;
+    }
+
+    //!\brief The scoring scheme used to determine matching letters.
+    scoring_scheme_type scoring_scheme{};
+    //!\brief The score of a match.
+    int64_t match_score{};
+    //!\brief The score of a mismatch.
+    int64_t mismatch_score{};
+    //!\brief The factor with which all penalties are scaled to keep them integral.
+    int64_t penalty_factor{1};
+    //!\brief The penalty of a mismatch.
+    offset_type mismatch_penalty{};
+    //!\brief The penalty to open a gap.
+    offset_type gap_open_penalty{};
+    //!\brief The penalty to extend a gap.
+    offset_type gap_extension_penalty{};
+};
+
+} // namespace seqan3::detail
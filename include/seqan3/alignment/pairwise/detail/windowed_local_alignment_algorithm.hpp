@@ -0,0 +1,394 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::windowed_local_alignment_algorithm.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_result_type.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_seed_extension.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/matrix/detail/advanceable_alignment_coordinate.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/seed_extension_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/utility/views/slice.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes a local alignment with traceback in three passes, such that the trace is only recorded within the
+ *        window covered by the optimal alignment.
+ * \ingroup alignment_pairwise
+ * \implements std::invocable
+ * \tparam alignment_configuration_t The type of the alignment configuration; must be a type specialisation of
+ *                                   seqan3::configuration.
+ * \tparam indexed_sequence_pair_chunk_t The type of the chunk over indexed sequence pairs passed to the algorithm.
+ *
+ * \details
+ *
+ * The standard local alignment with traceback records the trace of all \f$ n \cdot m \f$ cells, although the optimal
+ * alignment usually covers only a small part of the matrix. This algorithm computes the same result in three passes:
+ *
+ *  1. The score and the end positions are computed for all sequence pairs of the chunk without any trace. This pass
+ *     uses the algorithm selected for the score-only configuration, i.e. it is vectorised if
+ *     seqan3::align_cfg::vectorised is given.
+ *  2. The begin positions are found by a seqan3::align_cfg::extension_direction::left seed extension of the prefixes
+ *     that end in the end positions. The optimal alignment is anchored in the end positions and every suffix of it
+ *     scores at least the gap open score, since otherwise the remaining prefix would score more than the optimum.
+ *     Hence, an X-drop of the optimal score plus the absolute gap open score never drops a cell of the optimal
+ *     alignment, while the cells far away from it are not computed.
+ *  3. The alignment and/or its CIGAR representation is computed with the global alignment algorithm with traceback,
+ *     restricted to the window between the begin and the end positions. Its score equals the local score, since
+ *     every alignment of the window is a local alignment of the sequences.
+ *
+ * The memory of the trace is thus proportional to the size of the window instead of the size of the matrix. If there
+ * are several optimal alignments ending in the end positions, the extension reports the last computed begin
+ * positions, which mostly agrees with the full local traceback that extends the alignment as long as possible.
+ * Otherwise, a different but equally scoring alignment is reported.
+ */
+template <typename alignment_configuration_t, typename indexed_sequence_pair_chunk_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class windowed_local_alignment_algorithm
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type without the simd conversion.
+    using original_score_type = typename traits_type::original_score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The value type of the configured alignment result.
+    using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+    //!\brief The type of the configured alignment.
+    using alignment_type = decltype(std::declval<result_value_type>().alignment);
+    //!\brief The type of the configured CIGAR sequence.
+    using cigar_sequence_type = decltype(std::declval<result_value_type>().cigar_sequence);
+    //!\brief The type of the begin and end positions stored in the alignment results.
+    using coordinate_type = advanceable_alignment_coordinate<>;
+    //!\brief The type indicating that an output option is not configured.
+    using disabled_type = std::nullopt_t *;
+
+    static_assert(traits_type::is_local, "The windowed traceback must be configured with align_cfg::method_local.");
+
+    //!\brief The type of an indexed sequence pair of the chunk.
+    using indexed_sequence_pair_type = std::ranges::range_value_t<indexed_sequence_pair_chunk_t>;
+    //!\brief The type of a sequence pair of the chunk.
+    using sequence_pair_type = std::remove_cvref_t<std::tuple_element_t<0, indexed_sequence_pair_type>>;
+    //!\brief The type of the index of a sequence pair.
+    using index_type = std::remove_cvref_t<std::tuple_element_t<1, indexed_sequence_pair_type>>;
+    //!\brief The type of a window over the first sequence.
+    using window1_type =
+        decltype(std::declval<std::tuple_element_t<0, sequence_pair_type> &>() | views::slice(0, 1));
+    //!\brief The type of a window over the second sequence.
+    using window2_type =
+        decltype(std::declval<std::tuple_element_t<1, sequence_pair_type> &>() | views::slice(0, 1));
+    //!\brief The range over a single indexed pair of windows that is passed to the second and the third pass.
+    using window_pair_range_type =
+        std::ranges::single_view<std::tuple<std::tuple<window1_type, window2_type>, index_type>>;
+
+public:
+    //!\brief The alignment result type of the first pass.
+    using score_result_type = alignment_result<
+        alignment_result_value_type<index_type, disabled_type, original_score_type, coordinate_type>>;
+    //!\brief The alignment result type of the second pass.
+    using extension_result_type = alignment_result<
+        alignment_result_value_type<disabled_type, disabled_type, original_score_type, disabled_type, coordinate_type>>;
+    //!\brief The alignment result type of the third pass.
+    using window_result_type = alignment_result<alignment_result_value_type<disabled_type,
+                                                                            disabled_type,
+                                                                            original_score_type,
+                                                                            disabled_type,
+                                                                            coordinate_type,
+                                                                            alignment_type,
+                                                                            disabled_type,
+                                                                            disabled_type,
+                                                                            cigar_sequence_type>>;
+
+    //!\brief The type of the type-erased algorithm computing the first pass.
+    using score_function_type =
+        std::function<void(indexed_sequence_pair_chunk_t, std::function<void(score_result_type)>)>;
+    //!\brief The type of the type-erased algorithm computing the third pass.
+    using window_function_type =
+        std::function<void(window_pair_range_type, std::function<void(window_result_type)>)>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    windowed_local_alignment_algorithm() = default;                                                      //!< Defaulted.
+    windowed_local_alignment_algorithm(windowed_local_alignment_algorithm const &) = default;            //!< Defaulted.
+    windowed_local_alignment_algorithm(windowed_local_alignment_algorithm &&) = default;                 //!< Defaulted.
+    windowed_local_alignment_algorithm & operator=(windowed_local_alignment_algorithm const &) = default;//!< Defaulted.
+    windowed_local_alignment_algorithm & operator=(windowed_local_alignment_algorithm &&) = default;     //!< Defaulted.
+    ~windowed_local_alignment_algorithm() = default;                                                     //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the configuration and the algorithms of the first and the third pass.
+     * \param[in] config The configuration passed into the algorithm.
+     * \param[in] score_algorithm The algorithm configured with
+     *            seqan3::detail::windowed_local_alignment_algorithm::make_score_configuration.
+     * \param[in] window_algorithm The algorithm configured with
+     *            seqan3::detail::windowed_local_alignment_algorithm::make_window_configuration.
+     */
+    windowed_local_alignment_algorithm(alignment_configuration_t const & config,
+                                       score_function_type score_algorithm,
+                                       window_function_type window_algorithm) :
+        config{config},
+        score_algorithm{std::move(score_algorithm)},
+        window_algorithm{std::move(window_algorithm)}
+    {
+        auto const & gap_cost =
+            config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+
+        gap_open_score = gap_cost.open_score;
+    }
+    //!\}
+
+    /*!\name Configurations of the passes
+     * \{
+     */
+    /*!\brief Returns the configuration of the first pass, which computes the score and the end positions.
+     * \param[in] config The configuration passed into the algorithm.
+     */
+    static auto make_score_configuration(alignment_configuration_t const & config)
+    {
+        auto score_config = align_cfg::method_local{} | get<align_cfg::scoring_scheme>(config) | gap_cost(config)
+                          | align_cfg::score_type<original_score_type>{} | align_cfg::output_score{}
+                          | align_cfg::output_end_position{} | align_cfg::output_sequence1_id{}
+                          | align_cfg::detail::result_type<score_result_type>{};
+
+        if constexpr (traits_type::is_vectorised)
+            return score_config | get<align_cfg::vectorised>(config);
+        else
+            return score_config;
+    }
+
+    /*!\brief Returns the configuration of the third pass, which computes the global alignment of the window.
+     * \param[in] config The configuration passed into the algorithm.
+     */
+    static auto make_window_configuration(alignment_configuration_t const & config)
+    {
+        auto window_config = align_cfg::method_global{} | get<align_cfg::scoring_scheme>(config) | gap_cost(config)
+                           | align_cfg::score_type<original_score_type>{} | align_cfg::output_score{}
+                           | align_cfg::output_begin_position{} | align_cfg::detail::result_type<window_result_type>{};
+
+        auto window_config_with_alignment = [&]()
+        {
+            if constexpr (traits_type::compute_sequence_alignment)
+                return window_config | align_cfg::output_alignment{};
+            else
+                return window_config;
+        }();
+
+        if constexpr (traits_type::output_cigar)
+            return window_config_with_alignment | align_cfg::output_cigar{};
+        else
+            return window_config_with_alignment;
+    }
+    //!\}
+
+    /*!\brief Computes the local alignments of the given chunk of indexed sequence pairs.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with the configured alignment result type.
+     *
+     * \param[in] indexed_sequence_pairs The chunk of indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     */
+    template <typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pair_chunk_t indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        std::vector<score_result_type> score_results{};
+        score_algorithm(indexed_sequence_pairs,
+                        [&](score_result_type score_result)
+                        {
+                            score_results.push_back(std::move(score_result));
+                        });
+
+        // The vectorised algorithm might reorder the sequence pairs of the chunk.
+        std::ranges::sort(score_results,
+                          [](score_result_type const & lhs, score_result_type const & rhs)
+                          {
+                              return lhs.sequence1_id() < rhs.sequence1_id();
+                          });
+
+        size_t position = 0;
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            assert(position < score_results.size());
+            score_result_type const & score_result = score_results[position++];
+            assert(score_result.sequence1_id() == idx);
+            size_t const sequence1_end = score_result.sequence1_end_position();
+            size_t const sequence2_end = score_result.sequence2_end_position();
+
+            // ----------------------------------------------------------------------------
+            // Find the begin positions with an extension to the left of the end positions.
+            // ----------------------------------------------------------------------------
+
+            // Like the full traceback, prefer the longer of several optimal alignments ending in the end positions.
+            extension_algorithm_type extension_algorithm{make_extension_configuration(score_result.score()), true};
+
+            size_t sequence1_begin = sequence1_end;
+            size_t sequence2_begin = sequence2_end;
+            extension_algorithm(make_window_pair(get<0>(sequence_pair),
+                                                 get<1>(sequence_pair),
+                                                 0,
+                                                 0,
+                                                 sequence1_end,
+                                                 sequence2_end,
+                                                 idx),
+                                [&](extension_result_type extension_result)
+                                {
+                                    assert(extension_result.score() == score_result.score());
+                                    sequence1_begin = extension_result.sequence1_begin_position();
+                                    sequence2_begin = extension_result.sequence2_begin_position();
+                                });
+
+            // ----------------------------------------------------------------------------
+            // Compute the alignment within the window.
+            // ----------------------------------------------------------------------------
+
+            result_value_type result{};
+
+            if constexpr (traits_type::output_sequence1_id)
+                result.sequence1_id = idx;
+
+            if constexpr (traits_type::output_sequence2_id)
+                result.sequence2_id = idx;
+
+            if constexpr (traits_type::compute_score)
+                result.score = score_result.score();
+
+            if constexpr (traits_type::compute_end_positions)
+                result.end_positions = coordinate_type{column_index_type{sequence1_end},
+                                                       row_index_type{sequence2_end}};
+
+            if constexpr (traits_type::compute_begin_positions)
+                result.begin_positions = coordinate_type{column_index_type{sequence1_begin},
+                                                         row_index_type{sequence2_begin}};
+
+            window_algorithm(make_window_pair(get<0>(sequence_pair),
+                                              get<1>(sequence_pair),
+                                              sequence1_begin,
+                                              sequence2_begin,
+                                              sequence1_end,
+                                              sequence2_end,
+                                              idx),
+                             [&](window_result_type window_result)
+                             {
+                                 assert(window_result.score() == score_result.score());
+                                 assert(window_result.sequence1_begin_position() == 0u);
+                                 assert(window_result.sequence2_begin_position() == 0u);
+
+                                 if constexpr (traits_type::compute_sequence_alignment)
+                                     result.alignment = window_result.alignment();
+
+                                 if constexpr (traits_type::output_cigar)
+                                     result.cigar_sequence = window_result.cigar_sequence();
+                             });
+
+            callback(alignment_result_type{std::move(result)});
+        }
+        assert(position == score_results.size());
+    }
+
+private:
+    //!\brief Returns the configured gap cost.
+    static align_cfg::gap_cost_affine gap_cost(alignment_configuration_t const & config)
+    {
+        return config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+    }
+
+    //!\brief The type of the configured scoring scheme element.
+    using scoring_scheme_config_type = std::remove_cvref_t<decltype(get<align_cfg::scoring_scheme>(
+        std::declval<alignment_configuration_t const &>()))>;
+    //!\brief The type of the configuration of the second pass.
+    using extension_configuration_type =
+        decltype(align_cfg::method_global{} | std::declval<scoring_scheme_config_type>() | align_cfg::gap_cost_affine{}
+                 | align_cfg::score_type<original_score_type>{} | align_cfg::output_score{}
+                 | align_cfg::output_begin_position{} | align_cfg::detail::result_type<extension_result_type>{}
+                 | align_cfg::seed_extension{});
+    //!\brief The type of the algorithm computing the second pass.
+    using extension_algorithm_type =
+        seed_extension_algorithm<extension_configuration_type, typename traits_type::scoring_scheme_type>;
+
+    /*!\brief Returns the configuration of the second pass, which computes the begin positions.
+     * \param[in] score The score of the local alignment.
+     *
+     * \details
+     *
+     * The X-drop is the score plus the absolute gap open score, which never drops a cell of an optimal alignment (see
+     * the detailed description of seqan3::detail::windowed_local_alignment_algorithm).
+     */
+    extension_configuration_type make_extension_configuration(original_score_type const score) const
+    {
+        double const drop = std::ceil(static_cast<double>(score)) + std::abs(static_cast<double>(gap_open_score)) + 1;
+        int32_t const x_drop = static_cast<int32_t>(std::min<double>(drop, std::numeric_limits<int32_t>::max() / 2));
+
+        return align_cfg::method_global{} | get<align_cfg::scoring_scheme>(config) | gap_cost(config)
+             | align_cfg::score_type<original_score_type>{} | align_cfg::output_score{}
+             | align_cfg::output_begin_position{} | align_cfg::detail::result_type<extension_result_type>{}
+             | align_cfg::seed_extension{align_cfg::x_drop{x_drop}, align_cfg::extension_direction::left};
+    }
+
+    /*!\brief Creates the range over the indexed pair of windows of the given sequences.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] sequence1_begin The begin position of the window in the first sequence.
+     * \param[in] sequence2_begin The begin position of the window in the second sequence.
+     * \param[in] sequence1_end The end position of the window in the first sequence.
+     * \param[in] sequence2_end The end position of the window in the second sequence.
+     * \param[in] idx The index of the sequence pair.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    static window_pair_range_type make_window_pair(sequence1_t & sequence1,
+                                                   sequence2_t & sequence2,
+                                                   size_t const sequence1_begin,
+                                                   size_t const sequence2_begin,
+                                                   size_t const sequence1_end,
+                                                   size_t const sequence2_end,
+                                                   index_type const idx)
+    {
+        return window_pair_range_type{std::tuple{std::tuple{sequence1 | views::slice(sequence1_begin, sequence1_end),
+                                                            sequence2 | views::slice(sequence2_begin, sequence2_end)},
+                                                 idx}};
+    }
+
+    //!\brief The configuration passed into the algorithm.
+    alignment_configuration_t config{};
+    //!\brief The algorithm computing the score and the end positions.
+    score_function_type score_algorithm{};
+    //!\brief The algorithm computing the alignment of the window.
+    window_function_type window_algorithm{};
+    //!\brief The gap open score.
+    int32_t gap_open_score{};
+};
+
+} // namespace seqan3::detail
@@ -18,6 +18,7 @@
 #include <utility>
 
 #include <seqan3/alignment/matrix/detail/advanceable_alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
 #include <seqan3/alignment/matrix/detail/edit_distance_score_matrix_full.hpp>
 #include <seqan3/alignment/matrix/detail/edit_distance_trace_matrix_full.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_concept.hpp>
@@ -746,6 +747,7 @@ private:
     using edit_traits::compute_trace_matrix;
     using edit_traits::is_global;
     using edit_traits::is_semi_global;
+    using edit_traits::output_cigar;
     using edit_traits::use_max_errors;
     using typename edit_traits::alignment_result_type;
     using typename edit_traits::database_iterator;
@@ -1059,7 +1061,7 @@ public:
         if constexpr (compute_end_positions)
             cached_end_positions = this->end_positions();
 
-        if constexpr (compute_begin_positions && !compute_sequence_alignment)
+        if constexpr (compute_begin_positions && !compute_sequence_alignment && !output_cigar)
         {
             static_assert(compute_end_positions, "End positions required to compute the begin positions.");
             cached_begin_positions = this->begin_positions();
@@ -1095,6 +1097,21 @@ public:
             }
         }
 
+        if constexpr (traits_type::output_cigar)
+        {
+            if (this->is_valid())
+            {
+                auto [first, second] = cached_end_positions;
+                detail::matrix_coordinate const end_positions{detail::row_index_type{second},
+                                                              detail::column_index_type{first}};
+
+                auto trace_res = cigar_builder{}(this->trace_matrix().trace_path(end_positions));
+                res_vt.cigar_sequence = std::move(trace_res.cigar_sequence);
+                cached_begin_positions.first = trace_res.first_sequence_slice_positions.first;
+                cached_begin_positions.second = trace_res.second_sequence_slice_positions.first;
+            }
+        }
+
         if constexpr (traits_type::compute_end_positions)
             res_vt.end_positions = std::move(cached_end_positions);
 
@@ -35,9 +35,10 @@ namespace seqan3::detail
  * \details
  *
  * This policy is used to manage the score and trace matrix of the alignment algorithm. On invocation of an alignment
- * instance the necessary memory is allocated and the corresponding matrix iterators are initialised. These
+ * instance the matrices are resized and the corresponding matrix iterators are initialised. These
  * iterators are used as a global state within this particular alignment instance and are accessed from the alignment
- * algorithm.
+ * algorithm. The matrices are thread local, such that their memory is reused for all sequence pairs and all
+ * alignment instances computed on the same thread and is only reallocated if a matrix grows beyond its capacity.
  *
  * \remarks The template parameters of this CRTP-policy are selected in the
  *          seqan3::detail::alignment_configurator::select_matrix_policy when selecting the alignment for the given
@@ -75,14 +76,14 @@ private:
      *
      * \details
      *
-     * Initialises the underlying score and trace matrices and sets the respective matrix iterators to the begin of the
+     * Resizes the underlying score and trace matrices and sets the respective matrix iterators to the begin of the
      * corresponding matrix.
      */
     template <typename sequence1_t, typename sequence2_t>
     constexpr void allocate_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
     {
-        score_matrix = score_matrix_t{sequence1, sequence2};
-        trace_matrix = trace_matrix_t{sequence1, sequence2};
+        score_matrix().resize(sequence1, sequence2);
+        trace_matrix().resize(sequence1, sequence2);
 
         initialise_matrix_iterator();
     }
@@ -99,7 +100,7 @@ private:
      *
      * \details
      *
-     * Initialises the underlying banded score and trace matrices and sets the respective matrix iterators to the begin
+     * Resizes the underlying banded score and trace matrices and sets the respective matrix iterators to the begin
      * of the corresponding matrix. Using the additional band parameter the actual dimensions are reduced according
      * to the matrix implementation. For the banded case, one additional cell per column is stored such that we can read
      * from it without introducing a case distinction inside of the algorithm implementation. However, this cell needs
@@ -117,8 +118,8 @@ private:
         assert(state.gap_extension_score <= 0); // We expect it to never be positive.
 
         score_t inf = std::numeric_limits<score_t>::lowest() - state.gap_extension_score;
-        score_matrix = score_matrix_t{sequence1, sequence2, band, inf};
-        trace_matrix = trace_matrix_t{sequence1, sequence2, band};
+        score_matrix().resize(sequence1, sequence2, band, inf);
+        trace_matrix().resize(sequence1, sequence2, band);
 
         initialise_matrix_iterator();
     }
@@ -126,8 +127,8 @@ private:
     //!\brief Initialises the score and trace matrix iterator after allocating the matrices.
     constexpr void initialise_matrix_iterator() noexcept
     {
-        score_matrix_iter = score_matrix.begin();
-        trace_matrix_iter = trace_matrix.begin();
+        score_matrix_iter = score_matrix().begin();
+        trace_matrix_iter = trace_matrix().begin();
     }
 
     /*!\brief Slices the sequences according to the band parameters.
@@ -195,8 +196,19 @@ private:
         ++trace_matrix_iter;
     }
 
-    score_matrix_t score_matrix{}; //!< The scoring matrix.
-    trace_matrix_t trace_matrix{}; //!< The trace matrix if needed.
+    //!\brief Returns the thread local scoring matrix.
+    static score_matrix_t & score_matrix() noexcept
+    {
+        static thread_local score_matrix_t matrix{};
+        return matrix;
+    }
+
+    //!\brief Returns the thread local trace matrix if needed.
+    static trace_matrix_t & trace_matrix() noexcept
+    {
+        static thread_local trace_matrix_t matrix{};
+        return matrix;
+    }
 
     typename score_matrix_t::iterator score_matrix_iter{}; //!< The matrix iterator over the score matrix.
     typename trace_matrix_t::iterator trace_matrix_iter{}; //!< The matrix iterator over the trace matrix.
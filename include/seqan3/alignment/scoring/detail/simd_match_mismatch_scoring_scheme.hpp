@@ -56,11 +56,11 @@ namespace seqan3::detail
  * The respective score can then be inferred from the projected position of the last row or column of the
  * vectorised matrix depending on the the corresponding alignment configuration.
  *
- * In case of the local alignment the second sequence pack are padded with a symbol that is distinct to any symbol
- * of the corresponding alphabet and to the padding symbol of the first sequence pack.
- * Comparing any symbol with the padding symbols will yield a mismatch, such that the score can only get smaller after
- * the end of a sequence has reached. This way the specific optimum of one sequence pair in the pack is not affected
- * during the computation of the vectorised alignment.
+ * In case of the local alignment both sequence packs are padded with the same symbol as well, but the score function
+ * is adapted in a way that a comparison with a padding symbol always yields a mismatch, even if the other symbol is
+ * a padding symbol, too. Thus, the score can only get smaller after the end of a sequence has been reached. This way
+ * the specific optimum of one sequence pair in the pack is not affected during the computation of the vectorised
+ * alignment.
  */
 template <simd_concept simd_score_t, semialphabet alphabet_t, typename alignment_t>
     requires (seqan3::alphabet_size<alphabet_t> > 1)
@@ -125,8 +125,8 @@ public:
      * This function compares packed elements in both simd vectors and returns a new simd vector filled with match and
      * mismatch scores depending on the result of the comparison. For global alignments the comparison yields a match
      * if any of the elements is a padding symbol. The padding symbol must have the signed bit set.
-     * For local alignments two different padding symbols are assumed, which will always yield a mismatch when compared
-     * with any other symbol.
+     * For local alignments the comparison with a padding symbol always yields a mismatch, even if both elements are
+     * padding symbols.
      *
      * ### Exception
      *
@@ -148,7 +148,8 @@ public:
         if constexpr (std::same_as<alignment_t, align_cfg::method_global>)
             mask = (ranks1 ^ ranks2) <= simd::fill<simd_score_t>(0);
         else // and in local alignment type padded characters always mismatch.
-            mask = (ranks1 ^ ranks2) == simd::fill<simd_score_t>(0);
+            mask = ((ranks1 ^ ranks2) | (ranks1 & simd::fill<simd_score_t>(padding_symbol)))
+                == simd::fill<simd_score_t>(0);
 
         return mask ? match_score : mismatch_score;
     }
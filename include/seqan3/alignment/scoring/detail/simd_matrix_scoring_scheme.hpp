@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <array>
+#include <cassert>
 #include <concepts>
+#include <ranges>
 
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/scoring/scoring_scheme_concept.hpp>
@@ -50,6 +53,11 @@ namespace seqan3::detail
  * In the local alignment the score with a padding symbol will always decrease, and the optimum can only be found inside
  * of the valid score matrix area.
  *
+ * If all lanes share the second sequence, e.g. when one query is aligned against many sequences, the gather can be
+ * avoided: seqan3::detail::simd_matrix_scoring_scheme::make_query_profile computes for every column the score vectors
+ * of the column against every symbol of the alphabet, such that every cell of the column is scored with a single load
+ * of the score vector selected by the shared symbol of the second sequence.
+ *
  * \note Note that the alphabet type information is lost during the conversion to the simd vectors and
  * only the ranks of the alphabet are used.
  */
@@ -87,6 +95,9 @@ public:
     //!\brief The padding symbol used to fill up smaller sequences in a simd batch.
     static constexpr scalar_type padding_symbol = static_cast<scalar_type>(seqan3::alphabet_size<alphabet_t>);
 
+    //!\brief The query profile type storing the score vectors of one column against every symbol including padding.
+    using simd_query_profile_type = std::array<simd_score_t, index_offset>;
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -148,6 +159,35 @@ public:
 
         return result;
     }
+
+    /*!\brief Given the query profile of a column and a simd vector of the shared second sequence, return the score
+     *        vector.
+     * \param[in] query_profile The precomputed query profile of the column.
+     * \param[in] ranks A simd vector over alphabet ranks, which stores the same rank in every lane.
+     * \returns The score vector of the column against the shared symbol.
+     *
+     * ### Exception
+     *
+     * No-throw guarantee.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Thread safety
+     *
+     * Thread-safe.
+     *
+     * \attention The query profile must be computed with seqan3::detail::simd_matrix_scoring_scheme::make_query_profile
+     *            and all lanes of `ranks` must store the same rank (see
+     *            seqan3::detail::simd_matrix_scoring_scheme::is_shared_sequence).
+     */
+    constexpr simd_score_t score(simd_query_profile_type const & query_profile,
+                                 simd_alphabet_ranks_type const & ranks) const noexcept
+    {
+        assert(ranks[0] >= 0 && static_cast<size_t>(ranks[0]) < index_offset);
+        return query_profile[ranks[0]];
+    }
     //!\}
 
     //!\brief Returns the score used when aligning a padding symbol.
@@ -171,6 +211,50 @@ public:
         return ranks * simd::fill<simd_score_t>(index_offset);
     }
 
+    /*!\brief Converts the simd alphabet ranks of one column into a query profile used for scoring it against a second
+     *        sequence batch whose lanes store the same sequence.
+     *
+     * \details
+     *
+     * The i-th score vector of the profile stores in every lane the score of the respective symbol of the column
+     * against the symbol with rank i. It is built once per column by copying the row of the linearised scoring scheme
+     * of every lane, and in contrast to the gather index it does not overflow for small scalar types.
+     */
+    constexpr simd_query_profile_type make_query_profile(simd_alphabet_ranks_type const & ranks) const noexcept
+    {
+        simd_query_profile_type query_profile{};
+
+        for (size_t idx = 0; idx < simd_traits<simd_score_t>::length; ++idx)
+        {
+            scalar_type const * scheme_row = scoring_scheme_data.data() + ranks[idx] * index_offset;
+            for (size_t rank = 0; rank < index_offset; ++rank)
+                query_profile[rank][idx] = scheme_row[rank];
+        }
+
+        return query_profile;
+    }
+
+    /*!\brief Checks whether all lanes of the given simd sequence store the same sequence.
+     * \tparam simd_sequence_t The type of the simd sequence; must model std::ranges::forward_range over the simd type.
+     * \param[in] simd_sequence The second sequence batch converted to simd vectors.
+     * \returns `true` if every simd vector stores the same rank in all lanes, `false` otherwise.
+     *
+     * \details
+     *
+     * Only if this function returns `true`, the columns can be scored with a query profile.
+     */
+    template <std::ranges::forward_range simd_sequence_t>
+        requires std::same_as<std::ranges::range_value_t<simd_sequence_t>, simd_alphabet_ranks_type>
+    static constexpr bool is_shared_sequence(simd_sequence_t && simd_sequence) noexcept
+    {
+        for (simd_alphabet_ranks_type const & ranks : simd_sequence)
+            for (size_t idx = 1; idx < simd_traits<simd_score_t>::length; ++idx)
+                if (ranks[idx] != ranks[0])
+                    return false;
+
+        return true;
+    }
+
 private:
     /*!\brief Store the given scoring scheme matrix into a private member variable.
      * \tparam scoring_scheme_t The type of the scoring scheme; must model seqan3::scoring_scheme_for the given
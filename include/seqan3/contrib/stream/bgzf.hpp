@@ -18,6 +18,7 @@ namespace seqan3::contrib
 {
 
 /*!\brief A static variable indicating the number of threads to use for the bgzf-streams. Defaults to 4.
+ * \sa seqan3::contrib::gz_thread_count for plain gzip files, which are decompressed on a single thread by default.
  */
 [[maybe_unused]] inline uint64_t bgzf_thread_count = 4;
 
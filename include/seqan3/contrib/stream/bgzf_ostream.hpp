@@ -20,8 +20,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
+#include <vector>
 
 #include <seqan3/contrib/parallel/serialised_resource_pool.hpp>
 #include <seqan3/contrib/parallel/suspendable_queue.hpp>
@@ -90,13 +92,19 @@ public:
     struct BufferWriter
     {
         ostream_reference ostream;
+        // compressed offset of every written block (in order)
+        std::vector<uint64_t> blockOffsets;
+        uint64_t compressedSize;
 
         BufferWriter(ostream_reference ostream) :
-            ostream(ostream)
+            ostream(ostream),
+            compressedSize(0)
         {}
 
         bool operator() (OutputBuffer const & outputBuffer)
         {
+            blockOffsets.push_back(compressedSize);
+            compressedSize += outputBuffer.size;
             ostream.write(outputBuffer.buffer, outputBuffer.size);
             return ostream.good();
         }
@@ -126,6 +134,9 @@ public:
     Serializer<OutputBuffer, BufferWriter> serializer;
     size_t                                 currentJobId;
     bool                                   currentJobAvail;
+    // uncompressed offset of every submitted block (in order)
+    std::vector<uint64_t>                  blockBegins;
+    uint64_t                               uncompressedSize = 0;
 
     struct CompressionThread
     {
@@ -223,6 +234,8 @@ public:
         if (currentJobAvail)
         {
             jobs[currentJobId].size = size;
+            blockBegins.push_back(uncompressedSize);
+            uncompressedSize += size;
             appendValue(jobQueue, currentJobId);
         }
 
@@ -286,6 +299,40 @@ public:
         return 0;
     }
 
+    // only supports tellp(), i.e. returns the uncompressed offset of the put position
+    pos_type seekoff(off_type ofs, std::ios_base::seekdir dir, std::ios_base::openmode which)
+    {
+        if (ofs == 0 && dir == std::ios_base::cur && (which & std::ios_base::out))
+            return pos_type(off_type(uncompressedSize + (this->pptr() - this->pbase())));
+
+        return pos_type(off_type(-1));
+    }
+
+    // translates an uncompressed offset into a virtual offset (compressed block offset << 16 | offset in block),
+    // all blocks up to the offset must have been written, i.e. flush() must have been called
+    uint64_t virtualOffset(uint64_t ofs) const
+    {
+        std::vector<uint64_t> const & blockOffsets = serializer.worker.blockOffsets;
+        assert(blockOffsets.size() == blockBegins.size());
+
+        auto it = std::upper_bound(blockBegins.begin(), blockBegins.end(), ofs);
+        if (it == blockBegins.begin())
+            return 0;
+
+        size_t block = it - blockBegins.begin() - 1;
+        uint64_t blockEnd = (block + 1 < blockBegins.size()) ? blockBegins[block + 1] : uncompressedSize;
+
+        // an offset at the end of a block points to the beginning of the next block
+        if (ofs >= blockEnd)
+        {
+            uint64_t nextBlock = (block + 1 < blockOffsets.size()) ? blockOffsets[block + 1]
+                                                                   : serializer.worker.compressedSize;
+            return nextBlock << 16;
+        }
+
+        return (blockOffsets[block] << 16) | (ofs - blockBegins[block]);
+    }
+
     void addFooter()
     {
         // we flush the filled buffer here, so that an empty (EOF) buffer is flushed in the d'tor
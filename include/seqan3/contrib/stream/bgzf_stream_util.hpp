@@ -34,6 +34,10 @@
 // Zlib headers
 #include <zlib.h>
 
+#if defined(SEQAN3_HAS_LIBDEFLATE)
+#include <libdeflate.h>
+#endif // defined(SEQAN3_HAS_LIBDEFLATE)
+
 namespace seqan3::contrib
 {
 
@@ -41,6 +45,12 @@ namespace seqan3::contrib
 // Forwards
 // ============================================================================
 
+template <typename TAlgTag>
+struct CompressionContext;
+
+inline void compressInit(CompressionContext<detail::gz_compression> & ctx);
+inline void decompressInit(CompressionContext<detail::gz_compression> & ctx);
+
 // ============================================================================
 // Classes
 // ============================================================================
@@ -72,12 +82,136 @@ struct CompressionContext<detail::gz_compression>
     }
 };
 
+// ----------------------------------------------------------------------------
+// BGZF block codecs
+// ----------------------------------------------------------------------------
+
+// A BGZF block codec (de)compresses the raw deflate data of a single BGZF block, which is self-contained and at most
+// 64 KiB large. Hence, whole-buffer codecs can be used instead of the streaming interface of zlib.
+// Every codec provides:
+//   size_t deflate(char * dst, size_t dst_capacity, char const * src, size_t src_length);
+//   size_t inflate(char * dst, size_t dst_capacity, char const * src, size_t src_length);
+//   static uint32_t crc32(char const * src, size_t src_length);
+// deflate() and inflate() return the number of bytes written to dst and throw seqan3::io_error on failure.
+
+// The BGZF block codec using zlib; always available.
+struct bgzf_zlib_codec
+{
+    CompressionContext<detail::gz_compression> ctx;
+
+    size_t deflate(char * dst, size_t dst_capacity, char const * src, size_t src_length)
+    {
+        z_stream & strm = ctx.strm;
+        compressInit(ctx);
+
+        strm.next_in = (Bytef *)(src);
+        strm.next_out = (Bytef *)(dst);
+        strm.avail_in = src_length;
+        strm.avail_out = dst_capacity;
+
+        int status = ::deflate(&strm, Z_FINISH);
+        if (status != Z_STREAM_END)
+        {
+            deflateEnd(&strm);
+            throw io_error("Deflation failed. Compressed BGZF data is too big.");
+        }
+
+        status = deflateEnd(&strm);
+        if (status != Z_OK)
+            throw io_error("BGZF deflateEnd() failed.");
+
+        return dst_capacity - strm.avail_out;
+    }
+
+    size_t inflate(char * dst, size_t dst_capacity, char const * src, size_t src_length)
+    {
+        z_stream & strm = ctx.strm;
+        decompressInit(ctx);
+
+        strm.next_in = (Bytef *)(src);
+        strm.next_out = (Bytef *)(dst);
+        strm.avail_in = src_length;
+        strm.avail_out = dst_capacity;
+
+        int status = ::inflate(&strm, Z_FINISH);
+        if (status != Z_STREAM_END)
+        {
+            inflateEnd(&strm);
+            throw io_error("Inflation failed. Decompressed BGZF data is too big.");
+        }
+
+        status = inflateEnd(&strm);
+        if (status != Z_OK)
+            throw io_error("BGZF inflateEnd() failed.");
+
+        return dst_capacity - strm.avail_out;
+    }
+
+    static uint32_t crc32(char const * src, size_t src_length)
+    {
+        return ::crc32(::crc32(0u, NULL, 0u), (Bytef const *)(src), src_length);
+    }
+};
+
+#if defined(SEQAN3_HAS_LIBDEFLATE)
+// The BGZF block codec using libdeflate, which is 2-3x faster than zlib on whole buffers.
+// The (de)compressors are allocated on first use and produce the same deflate level as bgzf_zlib_codec.
+struct bgzf_libdeflate_codec
+{
+    std::unique_ptr<libdeflate_compressor, decltype(&libdeflate_free_compressor)> compressor{
+        nullptr, &libdeflate_free_compressor};
+    std::unique_ptr<libdeflate_decompressor, decltype(&libdeflate_free_decompressor)> decompressor{
+        nullptr, &libdeflate_free_decompressor};
+
+    size_t deflate(char * dst, size_t dst_capacity, char const * src, size_t src_length)
+    {
+        if (!compressor)
+            compressor.reset(libdeflate_alloc_compressor(1));
+        if (!compressor)
+            throw io_error("Calling libdeflate_alloc_compressor() failed.");
+
+        size_t const size = libdeflate_deflate_compress(compressor.get(), src, src_length, dst, dst_capacity);
+        if (size == 0)
+            throw io_error("Deflation failed. Compressed BGZF data is too big.");
+
+        return size;
+    }
+
+    size_t inflate(char * dst, size_t dst_capacity, char const * src, size_t src_length)
+    {
+        if (!decompressor)
+            decompressor.reset(libdeflate_alloc_decompressor());
+        if (!decompressor)
+            throw io_error("Calling libdeflate_alloc_decompressor() failed.");
+
+        size_t size = 0;
+        if (libdeflate_deflate_decompress(decompressor.get(), src, src_length, dst, dst_capacity, &size)
+            != LIBDEFLATE_SUCCESS)
+            throw io_error("Inflation failed. Decompressed BGZF data is too big.");
+
+        return size;
+    }
+
+    static uint32_t crc32(char const * src, size_t src_length)
+    {
+        return libdeflate_crc32(0u, src, src_length);
+    }
+};
+
+// The codec used by the BGZF streams; selected at compile time.
+using bgzf_codec = bgzf_libdeflate_codec;
+#else
+// The codec used by the BGZF streams; selected at compile time.
+using bgzf_codec = bgzf_zlib_codec;
+#endif // defined(SEQAN3_HAS_LIBDEFLATE)
+
 template <>
 struct CompressionContext<detail::bgzf_compression>:
     CompressionContext<detail::gz_compression>
 {
     static constexpr size_t BLOCK_HEADER_LENGTH = detail::bgzf_compression::magic_header.size();
     unsigned char headerPos;
+    bgzf_codec codec;
 };
 
 template <>
@@ -178,10 +312,10 @@ _bgzfPack32(char * buffer, uint32_t value)
 // Function _compressBlock()
 // ----------------------------------------------------------------------------
 
-template <typename TDestValue, typename TDestCapacity, typename TSourceValue, typename TSourceLength>
+template <typename TDestValue, typename TDestCapacity, typename TSourceValue, typename TSourceLength, typename TCodec>
 inline TDestCapacity
 _compressBlock(TDestValue *dstBegin,   TDestCapacity dstCapacity,
-               TSourceValue *srcBegin, TSourceLength srcLength, CompressionContext<detail::bgzf_compression> & ctx)
+               TSourceValue *srcBegin, TSourceLength srcLength, TCodec & codec)
 {
     const size_t BLOCK_HEADER_LENGTH = DefaultPageSize<detail::bgzf_compression>::BLOCK_HEADER_LENGTH;
     const size_t BLOCK_FOOTER_LENGTH = DefaultPageSize<detail::bgzf_compression>::BLOCK_FOOTER_LENGTH;
@@ -194,36 +328,31 @@ _compressBlock(TDestValue *dstBegin,   TDestCapacity dstCapacity,
     std::ranges::copy(detail::bgzf_compression::magic_header, dstBegin);
 
     // 2. COMPRESS
-    compressInit(ctx);
-    ctx.strm.next_in = (Bytef *)(srcBegin);
-    ctx.strm.next_out = (Bytef *)(dstBegin + BLOCK_HEADER_LENGTH);
-    ctx.strm.avail_in = srcLength * sizeof(TSourceValue);
-    ctx.strm.avail_out = dstCapacity - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH;
-
-    int status = deflate(&ctx.strm, Z_FINISH);
-    if (status != Z_STREAM_END)
-    {
-        deflateEnd(&ctx.strm);
-        throw io_error("Deflation failed. Compressed BGZF data is too big.");
-    }
-
-    status = deflateEnd(&ctx.strm);
-    if (status != Z_OK)
-        throw io_error("BGZF deflateEnd() failed.");
-
+    size_t const compressedLen = codec.deflate(reinterpret_cast<char *>(dstBegin + BLOCK_HEADER_LENGTH),
+                                               dstCapacity - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH,
+                                               reinterpret_cast<char const *>(srcBegin),
+                                               srcLength * sizeof(TSourceValue));
 
     // 3. APPEND FOOTER
 
     // Set compressed length into buffer, compute CRC and write CRC into buffer.
 
-    size_t len = dstCapacity - ctx.strm.avail_out;
+    size_t len = BLOCK_HEADER_LENGTH + compressedLen + BLOCK_FOOTER_LENGTH;
     _bgzfPack16(dstBegin + 16, len - 1);
 
     dstBegin += len - BLOCK_FOOTER_LENGTH;
-    _bgzfPack32(dstBegin, crc32(crc32(0u, NULL, 0u), (Bytef *)(srcBegin), srcLength * sizeof(TSourceValue)));
+    _bgzfPack32(dstBegin, TCodec::crc32(reinterpret_cast<char const *>(srcBegin), srcLength * sizeof(TSourceValue)));
     _bgzfPack32(dstBegin + 4, srcLength * sizeof(TSourceValue));
 
-    return dstCapacity - ctx.strm.avail_out;
+    return len;
+}
+
+template <typename TDestValue, typename TDestCapacity, typename TSourceValue, typename TSourceLength>
+inline TDestCapacity
+_compressBlock(TDestValue *dstBegin,   TDestCapacity dstCapacity,
+               TSourceValue *srcBegin, TSourceLength srcLength, CompressionContext<detail::bgzf_compression> & ctx)
+{
+    return _compressBlock(dstBegin, dstCapacity, srcBegin, srcLength, ctx.codec);
 }
 
 // ----------------------------------------------------------------------------
@@ -257,10 +386,10 @@ decompressInit(CompressionContext<detail::bgzf_compression> & ctx)
 // Function _decompressBlock()
 // ----------------------------------------------------------------------------
 
-template <typename TDestValue, typename TDestCapacity, typename TSourceValue, typename TSourceLength>
+template <typename TDestValue, typename TDestCapacity, typename TSourceValue, typename TSourceLength, typename TCodec>
 inline TDestCapacity
 _decompressBlock(TDestValue *dstBegin,   TDestCapacity dstCapacity,
-                 TSourceValue *srcBegin, TSourceLength srcLength, CompressionContext<detail::bgzf_compression> & ctx)
+                 TSourceValue *srcBegin, TSourceLength srcLength, TCodec & codec)
 {
     const size_t BLOCK_HEADER_LENGTH = DefaultPageSize<detail::bgzf_compression>::BLOCK_HEADER_LENGTH;
     const size_t BLOCK_FOOTER_LENGTH = DefaultPageSize<detail::bgzf_compression>::BLOCK_FOOTER_LENGTH;
@@ -283,38 +412,34 @@ _decompressBlock(TDestValue *dstBegin,   TDestCapacity dstCapacity,
 
     // 2. DECOMPRESS
 
-    decompressInit(ctx);
-    ctx.strm.next_in = (Bytef *)(srcBegin + BLOCK_HEADER_LENGTH);
-    ctx.strm.next_out = (Bytef *)(dstBegin);
-    ctx.strm.avail_in = srcLength - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH;
-    ctx.strm.avail_out = dstCapacity * sizeof(TDestValue);
-
-    int status = inflate(&ctx.strm, Z_FINISH);
-    if (status != Z_STREAM_END)
-    {
-        inflateEnd(&ctx.strm);
-        throw io_error("Inflation failed. Decompressed BGZF data is too big.");
-    }
-
-    status = inflateEnd(&ctx.strm);
-    if (status != Z_OK)
-        throw io_error("BGZF inflateEnd() failed.");
+    size_t const decompressedLen = codec.inflate(reinterpret_cast<char *>(dstBegin),
+                                                 dstCapacity * sizeof(TDestValue),
+                                                 reinterpret_cast<char const *>(srcBegin + BLOCK_HEADER_LENGTH),
+                                                 srcLength - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH);
 
 
     // 3. CHECK FOOTER
 
     // Check compressed length in buffer, compute CRC and compare with CRC in buffer.
 
-    unsigned crc = crc32(crc32(0u, NULL, 0u), (Bytef *)(dstBegin), dstCapacity - ctx.strm.avail_out);
+    unsigned crc = TCodec::crc32(reinterpret_cast<char const *>(dstBegin), decompressedLen);
 
     srcBegin += compressedLen - BLOCK_FOOTER_LENGTH;
     if (_bgzfUnpack32(srcBegin) != crc)
         throw io_error("BGZF wrong checksum.");
 
-    if (_bgzfUnpack32(srcBegin + 4) != dstCapacity - ctx.strm.avail_out)
+    if (_bgzfUnpack32(srcBegin + 4) != decompressedLen)
         throw io_error("BGZF size mismatch.");
 
-    return (dstCapacity - ctx.strm.avail_out) / sizeof(TDestValue);
+    return decompressedLen / sizeof(TDestValue);
+}
+
+template <typename TDestValue, typename TDestCapacity, typename TSourceValue, typename TSourceLength>
+inline TDestCapacity
+_decompressBlock(TDestValue *dstBegin,   TDestCapacity dstCapacity,
+                 TSourceValue *srcBegin, TSourceLength srcLength, CompressionContext<detail::bgzf_compression> & ctx)
+{
+    return _decompressBlock(dstBegin, dstCapacity, srcBegin, srcLength, ctx.codec);
 }
 
 }  // namespace seqan3::contrib
@@ -0,0 +1,846 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::deflate_decoder.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <seqan3/io/exception.hpp>
+#include <seqan3/utility/detail/to_little_endian.hpp>
+
+namespace seqan3::contrib
+{
+
+// --------------------------------------------------------------------------
+// Class deflate_chunk
+// --------------------------------------------------------------------------
+
+/*!\brief The decompressed data of a part of a gzip file, see seqan3::contrib::deflate_decoder.
+ * \details
+ *
+ * The decompressed data consists of the #marked symbols followed by the #plain characters. A marked symbol is either
+ * a character (`< 256`) or a marker (`>= 256`) standing for the character at position `marker - 256` of the
+ * 32 KiB window, i.e. the last 32 KiB decompressed before this chunk.
+ */
+struct deflate_chunk
+{
+    //!\brief The smallest marker.
+    static constexpr uint16_t marker_begin = 256;
+    //!\brief The number of unused characters in front of the #plain characters, e.g. for putting characters back.
+    static constexpr size_t plain_offset = 4;
+
+    //!\brief The end of a gzip member.
+    struct member_end
+    {
+        //!\brief The position of the end in the decompressed data of the chunk.
+        size_t position{};
+        //!\brief The CRC32 of the member's decompressed data, as stored in the gzip footer.
+        uint32_t crc{};
+        //!\brief The size of the member's decompressed data modulo 2^32, as stored in the gzip footer.
+        uint32_t size{};
+    };
+
+    //!\brief The first decompressed symbols, which may contain markers.
+    std::vector<uint16_t> marked{};
+    //!\brief The decompressed characters following the #marked symbols, starting at #plain_offset.
+    std::vector<char> plain{};
+    //!\brief The ends of the gzip members in this chunk.
+    std::vector<member_end> member_ends{};
+
+    //!\brief The bit position in the compressed data at which the decompression stopped.
+    size_t end_bit{};
+    //!\brief Whether the decompression reached the end of the gzip file.
+    bool stream_end{false};
+    //!\brief Whether the decompression stopped because the compressed data ended too early.
+    bool overrun{false};
+
+    //!\brief The number of decompressed symbols.
+    size_t size() const
+    {
+        return marked.size() + (plain.empty() ? 0 : plain.size() - plain_offset);
+    }
+};
+
+// --------------------------------------------------------------------------
+// Class deflate_decoder
+// --------------------------------------------------------------------------
+
+/*!\brief Decompresses gzip data starting at any deflate block, e.g. for decompressing a gzip file in parallel.
+ * \details
+ *
+ * Plain gzip files cannot be split into independent parts like BGZF files. This decoder implements the approach of
+ * [pugz](https://github.com/Piezoelectric/pugz) and [rapidgzip](https://github.com/mxmlnkn/rapidgzip):
+ *
+ *  1. find_block() finds the start of a deflate block in a part of the compressed data by trying all bit positions.
+ *     A candidate must start a non-final block with dynamic Huffman codes, the codes must be valid and the block as
+ *     well as the header of the following block must be decodable.
+ *  2. decode() decompresses from there without knowing the preceding 32 KiB (the window). Back references into the
+ *     window are stored as markers, until the last 32 KiB decompressed do not contain markers anymore. The markers
+ *     are replaced as soon as the window is known, i.e. when the preceding part was decompressed.
+ *
+ * A block start found by find_block() may be wrong. It is only confirmed if the decompression of the preceding part
+ * stops exactly there: decode() stops at the first block start at or after the given stop position.
+ *
+ * Concatenated gzip members are supported. Data following the last member that is not a gzip header is ignored.
+ */
+class deflate_decoder
+{
+public:
+    //!\brief The size of the deflate window.
+    static constexpr size_t window_size = 1u << 15;
+    //!\brief Returned by find_block() if there is no block start.
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    /*!\brief Constructs the decoder.
+     * \param[in] data    The compressed data; must outlive the decoder.
+     * \param[in] is_last Whether the compressed data ends with the gzip file.
+     */
+    deflate_decoder(std::span<char const> const data, bool const is_last) :
+        m_data{reinterpret_cast<uint8_t const *>(data.data()), data.size()},
+        m_is_last{is_last},
+        m_reader{m_data}
+    {}
+
+    /*!\brief Decompresses the data from the given position.
+     * \param[in] start_bit The bit position to start at.
+     * \param[in] stop_bit  Decompression stops at the first block start at or after this bit position.
+     * \param[in] at_header Whether `start_bit` points to a gzip header instead of a deflate block.
+     * \param[in] max_size  Decompression also stops at the first block start after this many decompressed characters.
+     * \throws seqan3::io_error If the compressed data is invalid.
+     * \returns The decompressed data. Markers can only occur if `at_header` is `false`.
+     */
+    deflate_chunk decode(size_t const start_bit,
+                         size_t const stop_bit,
+                         bool const at_header,
+                         size_t const max_size = std::numeric_limits<size_t>::max())
+    {
+        deflate_chunk chunk{};
+        size_t size = 0;       // The number of symbols in the current output, i.e. chunk.marked or chunk.plain.
+        size_t marker_end = 0; // The position after the last marker.
+        bool is_marked = true;
+
+        // The number of decompressed characters so far.
+        auto output_size = [&]()
+        {
+            return is_marked ? size : chunk.marked.size() + size - chunk.plain_offset;
+        };
+
+        chunk.marked.resize(1u << 16);
+        m_reader.seek(start_bit);
+
+        try
+        {
+            if (at_header)
+                read_member_header(true);
+
+            while (true)
+            {
+                // The start of a block.
+                if (m_reader.position() >= m_data.size() * 8)
+                    throw overrun{};
+                if (m_reader.position() >= stop_bit || output_size() >= max_size)
+                    break;
+
+                bool const is_final = m_reader.read(1);
+                unsigned const type = m_reader.read(2);
+
+                if (type == 0)
+                {
+                    is_marked ? copy_stored_block(chunk.marked, size) : copy_stored_block(chunk.plain, size);
+                }
+                else if (type == 3)
+                {
+                    throw io_error{"Invalid deflate block type."};
+                }
+                else
+                {
+                    if (type == 2 && !read_dynamic_codes())
+                        throw io_error{"Invalid Huffman codes in deflate block."};
+
+                    huffman_code const & literal_code = (type == 1) ? fixed_codes().first : m_literal_code;
+                    huffman_code const & distance_code = (type == 1) ? fixed_codes().second : m_distance_code;
+
+                    if (is_marked)
+                        inflate_block(literal_code, distance_code, chunk.marked, size, 0, marker_end);
+                    else
+                        inflate_block(literal_code, distance_code, chunk.plain, size, chunk.plain_offset, marker_end);
+                }
+
+                // No marker can be referenced anymore: continue with characters.
+                if (is_marked && size - marker_end >= window_size)
+                {
+                    chunk.plain.resize(chunk.plain_offset + size - marker_end
+                                       + std::max<size_t>((stop_bit - std::min(start_bit, stop_bit)) / 2, 1u << 16));
+                    std::ranges::copy(chunk.marked.begin() + marker_end,
+                                      chunk.marked.begin() + size,
+                                      chunk.plain.begin() + chunk.plain_offset);
+                    chunk.marked.resize(marker_end);
+                    size = chunk.plain_offset + size - marker_end;
+                    is_marked = false;
+                }
+
+                if (is_final)
+                {
+                    m_reader.align();
+                    uint32_t const crc = m_reader.read(16) | (m_reader.read(16) << 16);
+                    uint32_t const member_size = m_reader.read(16) | (m_reader.read(16) << 16);
+
+                    if (m_reader.position() > m_data.size() * 8)
+                        throw overrun{};
+
+                    chunk.member_ends.push_back({output_size(), crc, member_size});
+
+                    if (!read_member_header(false))
+                    {
+                        chunk.stream_end = true;
+                        break;
+                    }
+                }
+            }
+        }
+        catch (overrun const &)
+        {
+            chunk.overrun = true;
+        }
+
+        chunk.end_bit = m_reader.position();
+        if (is_marked)
+            chunk.marked.resize(size);
+        else
+            chunk.plain.resize(size);
+
+        return chunk;
+    }
+
+    //!\brief Whether the first 13 bits are a valid header of a non-final block with dynamic Huffman codes.
+    static constexpr std::array<bool, 1u << 13> valid_headers = []()
+    {
+        // BFINAL = 0, BTYPE = 2 and at most 286 literal/length and 30 distance codes.
+        std::array<bool, 1u << 13> valid{};
+        for (unsigned header = 0; header < valid.size(); ++header)
+            valid[header] = (header & 0b111) == 0b100 && ((header >> 3) & 0b11111) <= 29 && (header >> 8) <= 29;
+        return valid;
+    }();
+
+    //!\brief The sums of `2^(7 - length)` over the non-zero code lengths packed into 9 bits (3 bits per length).
+    static constexpr std::array<uint8_t, 512> kraft_sums = []()
+    {
+        std::array<uint8_t, 512> sums{};
+        for (unsigned lengths = 0; lengths < sums.size(); ++lengths)
+            for (unsigned shift = 0; shift < 9; shift += 3)
+                if (unsigned const length = (lengths >> shift) & 0b111; length > 0)
+                    sums[lengths] += 128u >> length;
+        return sums;
+    }();
+
+    /*!\brief Finds the first start of a non-final deflate block with dynamic Huffman codes in the given range.
+     * \param[in] begin_bit The first bit position to try.
+     * \param[in] end_bit   The bit position after the last one to try.
+     * \returns The bit position of the block start or seqan3::contrib::deflate_decoder::npos.
+     */
+    size_t find_block(size_t const begin_bit, size_t const end_bit)
+    {
+        std::vector<uint16_t> output(1u << 16);
+
+        // Returns the 64 bits starting at the given byte; zeros beyond the end of the data.
+        auto load = [this](size_t const byte)
+        {
+            uint64_t word{};
+            if (byte < m_data.size())
+                std::memcpy(&word, m_data.data() + byte, std::min<size_t>(sizeof(word), m_data.size() - byte));
+            return seqan3::detail::to_little_endian(word);
+        };
+
+        size_t const last_bit = std::min(end_bit, m_data.size() * 8);
+
+        for (size_t byte = begin_bit / 8; byte * 8 < last_bit; ++byte)
+        {
+            uint64_t const low = load(byte);
+            uint64_t const high = load(byte + 8);
+
+            for (unsigned offset = 0; offset < 8; ++offset)
+            {
+                size_t const bit = byte * 8 + offset;
+                uint64_t const header = low >> offset;
+
+                if (!valid_headers[header & (valid_headers.size() - 1)] || bit < begin_bit || bit >= last_bit)
+                    continue;
+
+                // The code of the code lengths must be complete. A valid code of a single symbol is possible, but
+                // encoders do not produce it and missing such a block only means searching on.
+                unsigned const code_length_count = ((header >> 13) & 0b1111) + 4;
+                uint64_t const code_lengths = ((low >> (offset + 17)) | (high << (47 - offset)))
+                                            & ((uint64_t{1} << (3 * code_length_count)) - 1);
+                unsigned kraft_sum = 0;
+                for (unsigned shift = 0; shift < 63; shift += 9)
+                    kraft_sum += kraft_sums[(code_lengths >> shift) & 0b111'111'111];
+
+                if (kraft_sum != 128)
+                    continue;
+
+                if (is_block_start(bit, output))
+                    return bit;
+            }
+        }
+
+        return npos;
+    }
+
+private:
+    //!\brief Thrown if the decompression needs data beyond the end of the compressed data.
+    struct overrun
+    {};
+
+    // ----------------------------------------------------------------------
+    // Reading bits
+    // ----------------------------------------------------------------------
+
+    //!\brief Reads the compressed data bitwise, starting with the least significant bit of each byte.
+    class bit_reader
+    {
+    public:
+        //!\brief Constructs the reader over the given data.
+        explicit bit_reader(std::span<uint8_t const> const data) : m_data{data}
+        {}
+
+        //!\brief Moves to the given bit position.
+        void seek(size_t const bit)
+        {
+            m_next = bit / 8;
+            m_bits = 0;
+            m_count = 0;
+            refill();
+            consume(bit % 8);
+        }
+
+        //!\brief Returns the current bit position.
+        size_t position() const
+        {
+            return m_next * 8 - m_count;
+        }
+
+        /*!\brief Ensures that at least 56 bits are available.
+         * \details
+         * Zeros are read beyond the end of the data. Far beyond the end, overrun is thrown.
+         */
+        void refill()
+        {
+            if (m_next + sizeof(uint64_t) <= m_data.size())
+            {
+                uint64_t word{};
+                std::memcpy(&word, m_data.data() + m_next, sizeof(word));
+                m_bits |= seqan3::detail::to_little_endian(word) << m_count;
+                m_next += (63 - m_count) / 8;
+                m_count |= 56;
+                return;
+            }
+
+            for (; m_count <= 56; m_count += 8, ++m_next)
+            {
+                if (m_next >= m_data.size() + 16)
+                    throw overrun{};
+
+                m_bits |= static_cast<uint64_t>(m_next < m_data.size() ? m_data[m_next] : 0) << m_count;
+            }
+        }
+
+        //!\brief Returns the available bits.
+        uint64_t bits() const
+        {
+            return m_bits;
+        }
+
+        //!\brief Removes the given number of available bits.
+        void consume(unsigned const count)
+        {
+            m_bits >>= count;
+            m_count -= count;
+        }
+
+        //!\brief Returns and removes the given number (<= 32) of available bits.
+        uint32_t take(unsigned const count)
+        {
+            uint32_t const value = m_bits & ((uint64_t{1} << count) - 1);
+            consume(count);
+            return value;
+        }
+
+        //!\brief Returns and removes the given number (<= 32) of bits.
+        uint32_t read(unsigned const count)
+        {
+            if (m_count < count)
+                refill();
+
+            return take(count);
+        }
+
+        //!\brief Moves to the next byte boundary.
+        void align()
+        {
+            consume(m_count % 8);
+        }
+
+    private:
+        //!\brief The data.
+        std::span<uint8_t const> m_data{};
+        //!\brief The position of the next byte to be loaded into m_bits.
+        size_t m_next{};
+        //!\brief The loaded bits; the bits above m_count are zero or the following bits.
+        uint64_t m_bits{};
+        //!\brief The number of available bits.
+        unsigned m_count{};
+    };
+
+    // ----------------------------------------------------------------------
+    // Huffman codes
+    // ----------------------------------------------------------------------
+
+    //!\brief A canonical Huffman code with a lookup table for short codes.
+    struct huffman_code
+    {
+        //!\brief The maximal length of the codes in the lookup table.
+        static constexpr unsigned lookup_bits = 10;
+
+        //!\brief Maps the next bits to `symbol << 4 | length`, or 0 for longer codes.
+        std::array<uint16_t, 1u << lookup_bits> lookup{};
+        //!\brief The number of codes of each length.
+        std::array<uint16_t, 16> counts{};
+        //!\brief The symbols ordered by their codes.
+        std::array<uint16_t, 288> symbols{};
+
+        /*!\brief Builds the code from the code lengths of the symbols.
+         * \returns Whether the code is valid, i.e. neither over-subscribed nor incomplete (except for a single code).
+         */
+        bool build(uint8_t const * const lengths, size_t const symbol_count)
+        {
+            counts.fill(0);
+            for (size_t symbol = 0; symbol < symbol_count; ++symbol)
+                ++counts[lengths[symbol]];
+            counts[0] = 0;
+
+            int left = 1;
+            unsigned max_length = 0;
+            for (unsigned length = 1; length < counts.size(); ++length)
+            {
+                left = 2 * left - counts[length];
+                if (left < 0)
+                    return false;
+                if (counts[length] > 0)
+                    max_length = length;
+            }
+
+            if (left > 0 && max_length > 1)
+                return false;
+
+            std::array<uint16_t, 16> offsets{};
+            for (unsigned length = 1; length + 1 < offsets.size(); ++length)
+                offsets[length + 1] = offsets[length] + counts[length];
+
+            for (size_t symbol = 0; symbol < symbol_count; ++symbol)
+                if (lengths[symbol] > 0)
+                    symbols[offsets[lengths[symbol]]++] = symbol;
+
+            lookup.fill(0);
+            unsigned code = 0;
+            size_t index = 0;
+            for (unsigned length = 1; length <= lookup_bits; ++length, code <<= 1)
+            {
+                for (unsigned i = 0; i < counts[length]; ++i, ++code, ++index)
+                {
+                    unsigned reversed = 0;
+                    for (unsigned bit = 0; bit < length; ++bit)
+                        reversed |= ((code >> bit) & 1u) << (length - 1 - bit);
+
+                    uint16_t const entry = symbols[index] << 4 | length;
+                    for (; reversed < lookup.size(); reversed += 1u << length)
+                        lookup[reversed] = entry;
+                }
+            }
+
+            return true;
+        }
+
+        //!\brief Decodes the next symbol; at least 15 bits must be available.
+        unsigned decode(bit_reader & reader) const
+        {
+            uint16_t const entry = lookup[reader.bits() & (lookup.size() - 1)];
+            if (entry != 0)
+            {
+                reader.consume(entry & 0b1111);
+                return entry >> 4;
+            }
+
+            // Decode a long code bit by bit.
+            uint64_t bits = reader.bits();
+            int code = 0;
+            int first = 0;
+            int index = 0;
+            for (unsigned length = 1; length < counts.size(); ++length, bits >>= 1)
+            {
+                code |= bits & 1;
+                int const count = counts[length];
+                if (code - count < first)
+                {
+                    reader.consume(length);
+                    return symbols[index + (code - first)];
+                }
+                index += count;
+                first = (first + count) << 1;
+                code <<= 1;
+            }
+
+            throw io_error{"Invalid Huffman code in deflate block."};
+        }
+    };
+
+    //!\brief Returns the literal/length and distance codes of blocks with fixed Huffman codes.
+    static std::pair<huffman_code, huffman_code> const & fixed_codes()
+    {
+        static std::pair<huffman_code, huffman_code> const codes = []()
+        {
+            std::array<uint8_t, 288> lengths{};
+            std::fill(lengths.begin(), lengths.begin() + 144, 8);
+            std::fill(lengths.begin() + 144, lengths.begin() + 256, 9);
+            std::fill(lengths.begin() + 256, lengths.begin() + 280, 7);
+            std::fill(lengths.begin() + 280, lengths.end(), 8);
+
+            std::pair<huffman_code, huffman_code> result{};
+            result.first.build(lengths.data(), 288);
+            // Distance codes 30 and 31 do not occur, but take part in the construction of the code.
+            lengths.fill(5);
+            result.second.build(lengths.data(), 32);
+            return result;
+        }();
+
+        return codes;
+    }
+
+    /*!\brief Reads the Huffman codes of a block with dynamic Huffman codes.
+     * \returns Whether the codes are valid.
+     */
+    bool read_dynamic_codes()
+    {
+        static constexpr std::array<uint8_t, 19> order{16, 17, 18, 0, 8, 7, 9, 6, 10,
+                                                       5,  11, 4,  12, 3, 13, 2, 14, 1, 15};
+
+        unsigned const literal_count = m_reader.read(5) + 257;
+        unsigned const distance_count = m_reader.read(5) + 1;
+        unsigned const code_length_count = m_reader.read(4) + 4;
+
+        if (literal_count > 286 || distance_count > 30)
+            return false;
+
+        std::array<uint8_t, 19> code_lengths{};
+        for (unsigned i = 0; i < code_length_count; ++i)
+            code_lengths[order[i]] = m_reader.read(3);
+
+        if (!m_code_length_code.build(code_lengths.data(), code_lengths.size()))
+            return false;
+
+        std::array<uint8_t, 286 + 30> lengths{};
+        unsigned const count = literal_count + distance_count;
+        for (unsigned i = 0; i < count;)
+        {
+            m_reader.refill();
+            unsigned const symbol = m_code_length_code.decode(m_reader);
+
+            if (symbol < 16)
+            {
+                lengths[i++] = symbol;
+                continue;
+            }
+
+            uint8_t length = 0;
+            unsigned repeat = 0;
+            if (symbol == 16)
+            {
+                if (i == 0)
+                    return false;
+                length = lengths[i - 1];
+                repeat = 3 + m_reader.take(2);
+            }
+            else
+            {
+                repeat = (symbol == 17) ? 3 + m_reader.take(3) : 11 + m_reader.take(7);
+            }
+
+            if (i + repeat > count)
+                return false;
+
+            std::fill_n(lengths.begin() + i, repeat, length);
+            i += repeat;
+        }
+
+        // The end-of-block code is required.
+        return lengths[256] > 0 && m_literal_code.build(lengths.data(), literal_count)
+            && m_distance_code.build(lengths.data() + literal_count, distance_count);
+    }
+
+    // ----------------------------------------------------------------------
+    // Decoding
+    // ----------------------------------------------------------------------
+
+    //!\brief Ensures that the output can hold the given number of additional symbols and 8 more.
+    template <typename symbol_t>
+    static void reserve(std::vector<symbol_t> & output, size_t const size, size_t const count)
+    {
+        if (output.size() < size + count + 8)
+            output.resize(std::max(2 * output.size(), size + count + 8));
+    }
+
+    /*!\brief Decodes the compressed data of a block with Huffman codes.
+     * \param[in] literal_code  The literal/length code.
+     * \param[in] distance_code The distance code.
+     * \param[in,out] output    The output; characters of `output` are appended at `size`.
+     * \param[in,out] size      The size of the output.
+     * \param[in] history_begin The position of the first character that can be referenced.
+     * \param[in,out] marker_end The position after the last marker.
+     * \details
+     * If `symbol_t` is `uint16_t`, references before the beginning of the output produce markers.
+     */
+    template <typename symbol_t>
+    void inflate_block(huffman_code const & literal_code,
+                       huffman_code const & distance_code,
+                       std::vector<symbol_t> & output,
+                       size_t & size,
+                       size_t const history_begin,
+                       size_t & marker_end)
+    {
+        static constexpr std::array<uint16_t, 29> length_base{3,  4,  5,  6,  7,  8,  9,  10,  11,  13,
+                                                              15, 17, 19, 23, 27, 31, 35, 43,  51,  59,
+                                                              67, 83, 99, 115, 131, 163, 195, 227, 258};
+        static constexpr std::array<uint8_t, 29> length_extra{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                                              2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+        static constexpr std::array<uint16_t, 30> distance_base{1,    2,    3,    4,    5,    7,     9,     13,
+                                                                17,   25,   33,   49,   65,   97,    129,   193,
+                                                                257,  385,  513,  769,  1025, 1537,  2049,  3073,
+                                                                4097, 6145, 8193, 12289, 16385, 24577};
+        static constexpr std::array<uint8_t, 30> distance_extra{0, 0, 0, 0, 1, 1, 2,  2,  3,  3,  4,  4,  5,  5,  6,
+                                                                6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+        static constexpr bool is_marked = std::same_as<symbol_t, uint16_t>;
+
+        while (true)
+        {
+            reserve(output, size, 258);
+
+            // At most 15 + 5 bits for the length and 15 + 13 bits for the distance.
+            m_reader.refill();
+            unsigned symbol = literal_code.decode(m_reader);
+
+            if (symbol < 256)
+            {
+                output[size++] = static_cast<symbol_t>(symbol);
+                continue;
+            }
+
+            if (symbol == 256)
+                return;
+
+            symbol -= 257;
+            if (symbol >= length_base.size())
+                throw io_error{"Invalid length code in deflate block."};
+
+            size_t const length = length_base[symbol] + m_reader.take(length_extra[symbol]);
+
+            unsigned const distance_symbol = distance_code.decode(m_reader);
+            if (distance_symbol >= distance_base.size())
+                throw io_error{"Invalid distance code in deflate block."};
+
+            size_t const distance = distance_base[distance_symbol] + m_reader.take(distance_extra[distance_symbol]);
+
+            if constexpr (is_marked)
+            {
+                if (distance > size + window_size)
+                    throw io_error{"Invalid distance in deflate block: too far back."};
+
+                for (size_t const end = size + length; size < end; ++size)
+                {
+                    if (distance > size)
+                        output[size] = deflate_chunk::marker_begin + window_size - (distance - size);
+                    else
+                        output[size] = output[size - distance];
+
+                    if (output[size] >= deflate_chunk::marker_begin)
+                        marker_end = size + 1;
+                }
+            }
+            else
+            {
+                if (distance > size - history_begin)
+                    throw io_error{"Invalid distance in deflate block: too far back."};
+
+                symbol_t * const target = output.data() + size;
+                symbol_t const * const source = target - distance;
+
+                if (distance >= 8) // Copying 8 characters at once may write up to 7 characters too many.
+                    for (size_t i = 0; i < length; i += 8)
+                        std::memcpy(target + i, source + i, 8);
+                else
+                    for (size_t i = 0; i < length; ++i)
+                        target[i] = source[i];
+
+                size += length;
+            }
+        }
+    }
+
+    //!\brief Copies the data of a block without compression to the output.
+    template <typename symbol_t>
+    void copy_stored_block(std::vector<symbol_t> & output, size_t & size)
+    {
+        m_reader.align();
+        uint32_t const length = m_reader.read(16);
+        uint32_t const inverted_length = m_reader.read(16);
+
+        if (length != (~inverted_length & 0xFFFF))
+            throw io_error{"Invalid length of stored deflate block."};
+
+        size_t const begin = m_reader.position() / 8;
+        if (begin + length > m_data.size())
+            throw overrun{};
+
+        reserve(output, size, length);
+        std::ranges::copy(m_data.subspan(begin, length), output.begin() + size);
+        size += length;
+        m_reader.seek((begin + length) * 8);
+    }
+
+    /*!\brief Reads a gzip header.
+     * \param[in] is_first Whether it is the header of the first member.
+     * \returns `false` if the first member was already read and there is no further gzip header.
+     * \throws seqan3::io_error If the header of the first member is invalid.
+     */
+    bool read_member_header(bool const is_first)
+    {
+        size_t const begin = m_reader.position() / 8;
+
+        if (!is_first)
+        {
+            if (m_data.size() < begin + 2)
+            {
+                if (m_is_last)
+                    return false;
+                throw overrun{};
+            }
+
+            // Data following the last member is ignored.
+            if (m_data[begin] != 0x1F || m_data[begin + 1] != 0x8B)
+                return false;
+        }
+
+        uint32_t const magic = m_reader.read(16);
+        uint32_t const method = m_reader.read(8);
+        uint32_t const flags = m_reader.read(8);
+        m_reader.read(32); // modification time
+        m_reader.read(16); // extra flags and operating system
+
+        if (magic != 0x8B1F || method != 8 || flags > 0b11111)
+        {
+            if (m_reader.position() > m_data.size() * 8)
+                throw overrun{};
+            throw io_error{"Invalid gzip header."};
+        }
+
+        if (flags & 0b100) // FEXTRA
+        {
+            size_t const end = m_reader.position() / 8 + 2 + m_reader.read(16);
+            if (end > m_data.size())
+                throw overrun{};
+            m_reader.seek(end * 8);
+        }
+
+        if (flags & 0b1000) // FNAME
+            while (m_reader.read(8) != 0)
+            {}
+
+        if (flags & 0b10000) // FCOMMENT
+            while (m_reader.read(8) != 0)
+            {}
+
+        if (flags & 0b10) // FHCRC
+            m_reader.read(16);
+
+        if (m_reader.position() > m_data.size() * 8)
+            throw overrun{};
+
+        return true;
+    }
+
+    /*!\brief Whether a non-final block with dynamic Huffman codes starts at the given bit position.
+     * \param[in] bit The bit position.
+     * \param[in,out] output Space for decoding the block.
+     * \details
+     * The Huffman codes must be valid, the block must be decodable and be followed by a valid block header.
+     */
+    bool is_block_start(size_t const bit, std::vector<uint16_t> & output)
+    {
+        try
+        {
+            m_reader.seek(bit + 3);
+            if (!read_dynamic_codes())
+                return false;
+
+            size_t size = 0;
+            size_t marker_end = 0;
+            inflate_block(m_literal_code, m_distance_code, output, size, 0, marker_end);
+
+            if (m_reader.position() + 3 > m_data.size() * 8)
+                return false;
+
+            m_reader.read(1);
+            switch (m_reader.read(2))
+            {
+                case 0:
+                {
+                    m_reader.align();
+                    uint32_t const length = m_reader.read(16);
+                    return length == (~m_reader.read(16) & 0xFFFF);
+                }
+                case 1:
+                    return true;
+                case 2:
+                    return read_dynamic_codes();
+                default:
+                    return false;
+            }
+        }
+        catch (io_error const &)
+        {
+            return false;
+        }
+        catch (overrun const &)
+        {
+            return false;
+        }
+    }
+
+    //!\brief The compressed data.
+    std::span<uint8_t const> m_data{};
+    //!\brief Whether the compressed data ends with the gzip file.
+    bool m_is_last{};
+    //!\brief Reads m_data.
+    bit_reader m_reader;
+    //!\brief The literal/length code of the current block.
+    huffman_code m_literal_code{};
+    //!\brief The distance code of the current block.
+    huffman_code m_distance_code{};
+    //!\brief The code of the code lengths of the current block.
+    huffman_code m_code_length_code{};
+};
+
+} // namespace seqan3::contrib
@@ -0,0 +1,577 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::parallel_gz_istream and seqan3::contrib::gz_thread_count.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+#if !defined(SEQAN3_HAS_ZLIB) && !defined(SEQAN3_HEADER_TEST)
+#    error "This file cannot be used when building without ZLIB-support."
+#endif // !defined(SEQAN3_HAS_ZLIB) && !defined(SEQAN3_HEADER_TEST)
+
+#if defined(SEQAN3_HAS_ZLIB)
+
+#    include <zlib.h>
+
+#    include <seqan3/contrib/stream/deflate_decoder.hpp>
+#    include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
+#    include <seqan3/io/exception.hpp>
+
+namespace seqan3::contrib
+{
+
+/*!\brief A static variable indicating the number of threads to use for decompressing plain gzip files. Defaults to 1.
+ * \details
+ * With `0` or `1`, plain gzip files are decompressed by seqan3::contrib::gz_istream. With more threads, they are
+ * decompressed by seqan3::contrib::parallel_gz_istream, which only pays off for large files on multiple cores.
+ */
+[[maybe_unused]] inline uint64_t gz_thread_count = 1;
+
+// --------------------------------------------------------------------------
+// Class basic_parallel_gz_istreambuf
+// --------------------------------------------------------------------------
+
+/*!\brief A stream buffer decompressing a gzip file on multiple threads.
+ * \tparam char_t   The character type of the stream; only byte-sized character types are supported.
+ * \tparam traits_t The character traits of the stream.
+ *
+ * \details
+ *
+ * The compressed data is read in chunks of `chunk_size` bytes. Every chunk is decompressed by a seqan3::contrib::
+ * deflate_decoder on a thread pool, starting at the first deflate block found in the chunk and stopping at the first
+ * block starting in the following chunk. The chunks are then put together in order: the unknown window of a chunk is
+ * filled with the end of the preceding chunk and the CRC32 of every gzip member is checked. If a block start was
+ * not found or was wrong, the chunk is decompressed again on the reading thread, starting where the preceding chunk
+ * ended.
+ *
+ * Chunks of highly compressible data are decompressed in parts of at most `16 * chunk_size` characters; only the first
+ * part is decompressed speculatively.
+ *
+ * Files consisting only of blocks without dynamic Huffman codes (e.g. written without compression or with fixed
+ * Huffman codes) are therefore decompressed on the reading thread. After a few such chunks in a row, only every few
+ * chunks are decompressed speculatively.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_parallel_gz_istreambuf : public std::basic_streambuf<char_t, traits_t>
+{
+    static_assert(sizeof(char_t) == 1, "The parallel gzip stream only supports byte-sized character types.");
+
+public:
+    //!\brief The type of the underlying stream.
+    using istream_reference = std::basic_istream<char_t, traits_t> &;
+    //!\brief The integer type of the stream.
+    using int_type = typename traits_t::int_type;
+
+    //!\brief The default number of compressed bytes that are decompressed by one thread at once (1 MiB).
+    static constexpr size_t default_chunk_size = 1u << 20;
+
+    /*!\brief Constructs the buffer.
+     * \param[in] istream_     The stream to read the compressed data from.
+     * \param[in] thread_count The number of threads decompressing the chunks; `0` and `1` decompress on the reading
+     *                         thread.
+     * \param[in] chunk_size   The number of compressed bytes that are decompressed by one thread at once.
+     */
+    basic_parallel_gz_istreambuf(istream_reference istream_,
+                                 size_t const thread_count,
+                                 size_t const chunk_size = default_chunk_size) :
+        m_istream(istream_),
+        m_chunk_size(std::max<size_t>(chunk_size, 1u)),
+        m_max_jobs(2 * std::max<size_t>(thread_count, 1u))
+    {
+        if (thread_count > 1)
+            m_thread_pool.emplace(thread_count);
+
+        m_next_input = read_chunk();
+
+        m_marked_buffer.resize(putback_size);
+        this->setg(m_marked_buffer.data() + putback_size,
+                   m_marked_buffer.data() + putback_size,
+                   m_marked_buffer.data() + putback_size);
+    }
+
+    basic_parallel_gz_istreambuf(basic_parallel_gz_istreambuf const &) = delete;
+    basic_parallel_gz_istreambuf & operator=(basic_parallel_gz_istreambuf const &) = delete;
+
+    //!\brief Provides the next decompressed characters.
+    int_type underflow()
+    {
+        while (this->gptr() == this->egptr())
+        {
+            // Keep the last characters such that they can be put back.
+            size_t const putback = std::min<size_t>(this->gptr() - this->eback(), putback_size);
+            std::array<char_t, putback_size> putback_buffer{};
+            std::copy(this->gptr() - putback, this->gptr(), putback_buffer.data());
+            this->setg(nullptr, nullptr, nullptr);
+
+            // Continue with the plain output of the current chunk or with the next chunk.
+            if (!m_in_plain_buffer && m_plain_buffer.size() > putback_size)
+                m_in_plain_buffer = true;
+            else if (next_chunk())
+                m_in_plain_buffer = false;
+            else
+                return traits_t::eof();
+
+            std::vector<char> & buffer = m_in_plain_buffer ? m_plain_buffer : m_marked_buffer;
+
+            char_t * const begin = reinterpret_cast<char_t *>(buffer.data());
+            std::copy(putback_buffer.data(), putback_buffer.data() + putback, begin + putback_size - putback);
+            this->setg(begin + putback_size - putback, begin + putback_size, begin + buffer.size());
+        }
+
+        return traits_t::to_int_type(*this->gptr());
+    }
+
+private:
+    //!\brief The number of characters kept in front of the buffer such that they can be put back.
+    static constexpr size_t putback_size = deflate_chunk::plain_offset;
+    //!\brief The size of the deflate window.
+    static constexpr size_t window_size = deflate_decoder::window_size;
+    //!\brief Chunks are decompressed in parts of at most this many times their size (plus one deflate block).
+    static constexpr size_t max_expansion = 16;
+    //!\brief The number of failed speculative decompressions after which only every few chunks are speculated on.
+    static constexpr size_t max_misses = 4;
+
+    //!\brief A chunk of compressed data to be decompressed.
+    struct job
+    {
+        //!\brief The chunk, followed by the next chunk (if any).
+        std::vector<char> input{};
+        //!\brief The position of the chunk in the compressed data.
+        size_t offset{};
+        //!\brief The size of the chunk.
+        size_t size{};
+        //!\brief Whether the chunk is the first one, i.e. starts with a gzip header.
+        bool is_first{};
+        //!\brief Whether the chunk is the last one.
+        bool is_last{};
+        //!\brief Whether a part of the chunk was already put together, see max_expansion.
+        bool is_partial{};
+
+        //!\brief The bit position in the chunk at which the decompression started, if it was decompressed.
+        size_t start_bit{deflate_decoder::npos};
+        //!\brief The decompressed data.
+        deflate_chunk output{};
+        //!\brief The CRC32 of the parts of the plain output, see plain_crcs().
+        std::vector<uint32_t> plain_crcs{};
+        //!\brief Set as soon as the chunk was processed.
+        std::promise<void> done{};
+        //!\brief The future of #done.
+        std::future<void> processed{done.get_future()};
+    };
+
+    //!\brief Decompresses the chunk starting at its first block start (or at the gzip header of the first chunk).
+    static void decompress(job & current)
+    {
+        try
+        {
+            deflate_decoder decoder{current.input, current.is_last};
+            size_t const start_bit = current.is_first ? 0 : decoder.find_block(0, current.size * 8);
+
+            if (start_bit != deflate_decoder::npos)
+            {
+                current.output =
+                    decoder.decode(start_bit, current.size * 8, current.is_first, max_output_size(current));
+                if (!current.output.overrun)
+                    current.plain_crcs = plain_crcs(current.output);
+                current.start_bit = start_bit;
+            }
+        }
+        catch (...)
+        {
+            // Errors are reported when decompressing the chunk again in order.
+            current.start_bit = deflate_decoder::npos;
+        }
+    }
+
+    //!\brief The number of characters after which the decompression of the given chunk is continued later.
+    static size_t max_output_size(job const & current)
+    {
+        return std::max(current.size, window_size) * max_expansion;
+    }
+
+    /*!\brief Computes the CRC32 of the plain output of a chunk, split at the ends of the gzip members.
+     * \details
+     * There is one CRC32 for every member end behind the marked output and one for the rest of the plain output.
+     */
+    static std::vector<uint32_t> plain_crcs(deflate_chunk const & output)
+    {
+        std::vector<uint32_t> crcs{};
+        size_t const marked_size = output.marked.size();
+        size_t begin = marked_size;
+
+        auto add = [&](size_t const end)
+        {
+            Bytef const * const data = reinterpret_cast<Bytef const *>(output.plain.data());
+            crcs.push_back(crc32(0u, data + putback_size + (begin - marked_size), end - begin));
+            begin = end;
+        };
+
+        for (deflate_chunk::member_end const & member_end : output.member_ends)
+            if (member_end.position > marked_size)
+                add(member_end.position);
+
+        add(output.size());
+        return crcs;
+    }
+
+    //!\brief Reads the next chunk of compressed data; empty at the end of the stream.
+    std::vector<char> read_chunk()
+    {
+        std::vector<char> chunk(m_chunk_size);
+        m_istream.read(reinterpret_cast<char_t *>(chunk.data()), chunk.size());
+        chunk.resize(m_istream.gcount());
+        return chunk;
+    }
+
+    //!\brief Reads and schedules chunks until the given number of chunks is in flight.
+    void fill_jobs(size_t const count)
+    {
+        while (m_jobs.size() < count && !m_next_input.empty())
+        {
+            auto current = std::make_shared<job>();
+            current->offset = m_input_offset;
+            current->size = m_next_input.size();
+            current->is_first = m_input_offset == 0;
+
+            std::vector<char> next = read_chunk();
+            current->is_last = next.empty();
+            current->input = std::move(m_next_input);
+            current->input.insert(current->input.end(), next.begin(), next.end());
+
+            m_input_offset += current->size;
+            m_next_input = std::move(next);
+            m_jobs.push_back(current);
+
+            // Only every few chunks are decompressed speculatively while block starts are not found or are wrong.
+            if (m_thread_pool && (m_misses < max_misses || current->offset / m_chunk_size % max_misses == 0))
+            {
+                m_thread_pool->execute(
+                    [](std::shared_ptr<job> current, auto && callback)
+                    {
+                        decompress(*current);
+                        callback(*current);
+                    },
+                    std::move(current),
+                    [](job & current)
+                    {
+                        current.done.set_value();
+                    });
+            }
+            else
+            {
+                current->done.set_value();
+            }
+        }
+    }
+
+    /*!\brief Decompresses the first chunk in flight on the reading thread.
+     * \param[in] start_bit The bit position in the chunk at which the preceding chunk ended.
+     * \details
+     * If a block reaches beyond the following chunk, the decompression is repeated with more chunks.
+     */
+    deflate_chunk decompress_in_order(size_t const start_bit)
+    {
+        job const & current = *m_jobs.front();
+        std::vector<char> input{};
+
+        for (size_t count = 1;; ++count)
+        {
+            fill_jobs(std::max(count, m_max_jobs));
+
+            // The chunks of the first `count` jobs, followed by the next chunk.
+            job const & last = *m_jobs[std::min(count, m_jobs.size()) - 1];
+            if (count > 1)
+            {
+                input.clear();
+                for (size_t i = 0; i + 1 < count; ++i)
+                    input.insert(input.end(), m_jobs[i]->input.begin(), m_jobs[i]->input.begin() + m_jobs[i]->size);
+                input.insert(input.end(), last.input.begin(), last.input.end());
+            }
+
+            deflate_decoder decoder{count > 1 ? std::span<char const>{input} : current.input, last.is_last};
+            bool const at_header = current.is_first && start_bit == 0;
+            deflate_chunk output = decoder.decode(start_bit, current.size * 8, at_header, max_output_size(current));
+
+            if (!output.overrun)
+                return output;
+            if (last.is_last)
+                throw io_error{"Unexpected end of the gzip compressed stream."};
+        }
+    }
+
+    //!\brief Decompresses the next chunk and moves it into m_marked_buffer and m_plain_buffer.
+    bool next_chunk()
+    {
+        deflate_chunk output{};
+        std::vector<uint32_t> crcs{};
+
+        while (true)
+        {
+            if (m_stream_end)
+                return false;
+
+            fill_jobs(m_max_jobs);
+            if (m_jobs.empty())
+                return false;
+
+            job & current = *m_jobs.front();
+            size_t const begin_bit = current.offset * 8;
+
+            // The chunk was already decompressed as part of the preceding chunk.
+            if (m_next_bit >= begin_bit + current.size * 8)
+            {
+                m_jobs.pop_front();
+                continue;
+            }
+
+            current.processed.wait();
+
+            size_t const start_bit = m_next_bit - begin_bit;
+            if (current.start_bit == start_bit && !current.output.overrun)
+            {
+                output = std::move(current.output);
+                crcs = std::move(current.plain_crcs);
+                current.start_bit = deflate_decoder::npos;
+                m_misses = 0;
+            }
+            else
+            {
+                m_misses += m_thread_pool && !current.is_first && !current.is_partial;
+                output = decompress_in_order(start_bit);
+                crcs = plain_crcs(output);
+            }
+
+            m_next_bit = begin_bit + output.end_bit;
+            m_stream_end = output.stream_end;
+
+            // Otherwise, the rest of the chunk is decompressed in order by the next call.
+            if (m_next_bit >= begin_bit + current.size * 8)
+                m_jobs.pop_front();
+            else
+                current.is_partial = true;
+            break;
+        }
+
+        fill_jobs(m_max_jobs);
+
+        // Replace the markers by the characters of the window.
+        m_marked_buffer.resize(putback_size + output.marked.size());
+        for (size_t i = 0; i < output.marked.size(); ++i)
+        {
+            uint16_t const symbol = output.marked[i];
+            if (symbol < deflate_chunk::marker_begin)
+            {
+                m_marked_buffer[putback_size + i] = static_cast<char>(symbol);
+                continue;
+            }
+
+            size_t const position = symbol - deflate_chunk::marker_begin;
+            if (position < window_size - m_window_size)
+                throw io_error{"Invalid distance in deflate block: too far back."};
+            m_marked_buffer[putback_size + i] = m_window[position];
+        }
+
+        check_crcs(output, crcs);
+
+        std::span<char const> const plain = output.plain.empty()
+                                              ? std::span<char const>{}
+                                              : std::span<char const>{output.plain}.subspan(putback_size);
+        update_window(std::span<char const>{m_marked_buffer}.subspan(putback_size));
+        update_window(plain);
+
+        m_plain_buffer = std::move(output.plain);
+        return true;
+    }
+
+    //!\brief Checks the CRC32 and size of all gzip members ending in the given chunk.
+    void check_crcs(deflate_chunk const & output, std::span<uint32_t const> crcs)
+    {
+        size_t const marked_size = output.marked.size();
+        size_t begin = 0;
+        size_t crc_index = 0;
+
+        // Adds the output in [begin, end) to the current member.
+        auto add = [&](size_t const end)
+        {
+            if (begin < marked_size)
+            {
+                size_t const marked_end = std::min(end, marked_size);
+                m_member_crc = crc32(m_member_crc,
+                                     reinterpret_cast<Bytef const *>(m_marked_buffer.data() + putback_size + begin),
+                                     marked_end - begin);
+            }
+
+            if (end > marked_size)
+                m_member_crc = crc32_combine(m_member_crc, crcs[crc_index++], end - std::max(begin, marked_size));
+
+            m_member_size += end - begin;
+            begin = end;
+        };
+
+        for (deflate_chunk::member_end const & member_end : output.member_ends)
+        {
+            add(member_end.position);
+
+            if (m_member_crc != member_end.crc || static_cast<uint32_t>(m_member_size) != member_end.size)
+                throw io_error{"The checksum of the gzip compressed stream does not match."};
+
+            m_member_crc = 0;
+            m_member_size = 0;
+        }
+
+        add(output.size());
+    }
+
+    //!\brief Appends the given decompressed characters to the window.
+    void update_window(std::span<char const> const data)
+    {
+        if (data.size() >= window_size)
+        {
+            std::ranges::copy(data.last(window_size), m_window.begin());
+        }
+        else
+        {
+            std::copy(m_window.begin() + data.size(), m_window.end(), m_window.begin());
+            std::ranges::copy(data, m_window.end() - data.size());
+        }
+
+        m_window_size = std::min(m_window_size + data.size(), window_size);
+    }
+
+    //!\brief The underlying stream.
+    istream_reference m_istream;
+    //!\brief The number of compressed bytes that are decompressed by one thread at once.
+    size_t m_chunk_size{};
+    //!\brief The maximal number of chunks that are read ahead.
+    size_t m_max_jobs{};
+
+    //!\brief The next chunk of compressed data that is not yet in flight.
+    std::vector<char> m_next_input{};
+    //!\brief The position of m_next_input in the compressed data.
+    size_t m_input_offset{};
+    //!\brief The chunks in flight, in order.
+    std::deque<std::shared_ptr<job>> m_jobs{};
+    //!\brief The number of consecutive chunks whose speculative decompression could not be used.
+    size_t m_misses{};
+
+    //!\brief The bit position in the compressed data at which the decompression continues.
+    size_t m_next_bit{};
+    //!\brief Whether the end of the gzip file was reached.
+    bool m_stream_end{false};
+    //!\brief The last decompressed characters, right-aligned.
+    std::array<char, window_size> m_window{};
+    //!\brief The number of valid characters in m_window.
+    size_t m_window_size{};
+    //!\brief The CRC32 of the decompressed data of the current gzip member.
+    uint32_t m_member_crc{};
+    //!\brief The size of the decompressed data of the current gzip member.
+    uint64_t m_member_size{};
+
+    //!\brief The marked output of the current chunk with the markers replaced, preceded by the putback area.
+    std::vector<char> m_marked_buffer{};
+    //!\brief The plain output of the current chunk, preceded by the putback area.
+    std::vector<char> m_plain_buffer{};
+    //!\brief Whether m_plain_buffer is the get area.
+    bool m_in_plain_buffer{false};
+
+    //!\brief The threads decompressing the chunks; destroyed first to join them before the chunks are gone.
+    std::optional<seqan3::detail::execution_handler_parallel> m_thread_pool{};
+};
+
+// --------------------------------------------------------------------------
+// Class basic_parallel_gz_istreambase
+// --------------------------------------------------------------------------
+
+//!\brief Holds the stream buffer of seqan3::contrib::basic_parallel_gz_istream.
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_parallel_gz_istreambase : virtual public std::basic_ios<char_t, traits_t>
+{
+public:
+    //!\brief The type of the underlying stream.
+    using istream_reference = std::basic_istream<char_t, traits_t> &;
+    //!\brief The type of the stream buffer.
+    using parallel_gz_streambuf_type = basic_parallel_gz_istreambuf<char_t, traits_t>;
+
+    //!\brief Constructs the stream buffer, see seqan3::contrib::basic_parallel_gz_istreambuf.
+    basic_parallel_gz_istreambase(istream_reference istream_, size_t const thread_count, size_t const chunk_size) :
+        m_buf(istream_, thread_count, chunk_size)
+    {
+        this->init(&m_buf);
+    }
+
+    //!\brief Returns the stream buffer.
+    parallel_gz_streambuf_type * rdbuf()
+    {
+        return &m_buf;
+    }
+
+private:
+    //!\brief The stream buffer.
+    parallel_gz_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_parallel_gz_istream
+// --------------------------------------------------------------------------
+
+/*!\brief An input stream decompressing a gzip file on multiple threads.
+ * \tparam char_t   The character type of the stream.
+ * \tparam traits_t The character traits of the stream.
+ * \details
+ * See seqan3::contrib::basic_parallel_gz_istreambuf.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_parallel_gz_istream :
+    public basic_parallel_gz_istreambase<char_t, traits_t>,
+    public std::basic_istream<char_t, traits_t>
+{
+public:
+    //!\brief The base holding the stream buffer.
+    using parallel_gz_istreambase_type = basic_parallel_gz_istreambase<char_t, traits_t>;
+    //!\brief The type of the underlying stream.
+    using istream_type = std::basic_istream<char_t, traits_t>;
+    //!\brief A reference to the underlying stream.
+    using istream_reference = istream_type &;
+
+    /*!\brief Constructs the stream.
+     * \param[in] istream_     The stream to read the compressed data from.
+     * \param[in] thread_count The number of threads decompressing the data.
+     * \param[in] chunk_size   The number of compressed bytes that are decompressed by one thread at once.
+     */
+    basic_parallel_gz_istream(
+        istream_reference istream_,
+        size_t const thread_count = gz_thread_count,
+        size_t const chunk_size = basic_parallel_gz_istreambuf<char_t, traits_t>::default_chunk_size) :
+        parallel_gz_istreambase_type(istream_, thread_count, chunk_size),
+        istream_type(parallel_gz_istreambase_type::rdbuf())
+    {}
+};
+
+// --------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------
+
+//!\brief A parallel gzip input stream over `char`.
+using parallel_gz_istream = basic_parallel_gz_istream<char>;
+
+} // namespace seqan3::contrib
+
+#endif // defined(SEQAN3_HAS_ZLIB)
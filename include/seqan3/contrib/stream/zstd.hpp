@@ -0,0 +1,54 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::zstd_thread_count and the constants of the seekable zstd format.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace seqan3::contrib
+{
+
+/*!\brief A static variable indicating the number of threads to use for the zstd-streams. Defaults to 4.
+ */
+[[maybe_unused]] inline uint64_t zstd_thread_count = 4;
+
+/*!\brief The number of uncompressed bytes in every frame written by seqan3::contrib::zstd_ostream (1 MiB).
+ * \details
+ * Every frame can be decompressed independently, i.e. frames are the unit of parallel (de-)compression and random
+ * access.
+ */
+inline constexpr size_t zstd_frame_size = 1u << 20;
+
+/*!\brief Constants of the [seekable zstd format](https://github.com/facebook/zstd/blob/dev/contrib/seekable_format).
+ * \details
+ * A seekable zstd file consists of independent zstd frames, followed by a skippable frame holding the seek table.
+ * The seek table stores the compressed and decompressed size of every frame (and an optional checksum) and ends
+ * with a footer of 9 bytes: the number of frames, a descriptor byte and the seekable magic number.
+ * All integers are stored in little endian.
+ */
+struct zstd_seekable_format
+{
+    //!\brief The magic number of the skippable frame holding the seek table.
+    static constexpr uint32_t skippable_magic_number = 0x184D2A5E;
+    //!\brief The magic number at the very end of a seekable zstd file.
+    static constexpr uint32_t seekable_magic_number = 0x8F92EAB1;
+    //!\brief The size of the header of a skippable frame: the magic number and the size of the frame.
+    static constexpr size_t skippable_header_size = 8;
+    //!\brief The size of the footer of the seek table.
+    static constexpr size_t footer_size = 9;
+    //!\brief The bit of the descriptor byte signalling that the entries contain a checksum.
+    static constexpr uint8_t checksum_flag = 0x80;
+    //!\brief The bits of the descriptor byte that must be 0.
+    static constexpr uint8_t reserved_bits = 0x7C;
+};
+
+} // namespace seqan3::contrib
@@ -0,0 +1,520 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::zstd_istream.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+#if !defined(SEQAN3_HAS_ZSTD) && !defined(SEQAN3_HEADER_TEST)
+#    error "This file cannot be used when building without ZSTD-support."
+#endif // !defined(SEQAN3_HAS_ZSTD) && !defined(SEQAN3_HEADER_TEST)
+
+#if defined(SEQAN3_HAS_ZSTD)
+
+#    include <zstd.h>
+
+#    include <seqan3/contrib/stream/zstd.hpp>
+#    include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
+#    include <seqan3/io/exception.hpp>
+
+namespace seqan3::contrib
+{
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istreambuf
+// --------------------------------------------------------------------------
+
+/*!\brief A stream buffer decompressing a zstd file.
+ * \tparam char_t   The character type of the stream; only byte-sized character types are supported.
+ * \tparam traits_t The character traits of the stream.
+ *
+ * \details
+ *
+ * If the underlying stream is seekable and ends with a seek table (see seqan3::contrib::zstd_seekable_format), e.g.
+ * a file written by seqan3::contrib::zstd_ostream, the frames are read in order and decompressed independently on a
+ * thread pool. In this case, the stream also supports random access: seekg() takes the position in the decompressed
+ * data and only decompresses the frame containing it.
+ *
+ * Any other zstd file, e.g. one that is read from a pipe, is decompressed sequentially on the reading thread.
+ * Concatenated and skippable frames are supported in both cases. tellg() returns the position in the decompressed
+ * data.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_istreambuf : public std::basic_streambuf<char_t, traits_t>
+{
+public:
+    //!\brief The type of the underlying stream.
+    using istream_reference = std::basic_istream<char_t, traits_t> &;
+    //!\brief The integer type of the stream.
+    using int_type = typename traits_t::int_type;
+    //!\brief The position type of the stream.
+    using pos_type = typename traits_t::pos_type;
+    //!\brief The offset type of the stream.
+    using off_type = typename traits_t::off_type;
+
+    /*!\brief Constructs the buffer.
+     * \param[in] istream_     The stream to read the compressed data from.
+     * \param[in] thread_count The number of threads decompressing the frames of a seekable file; `0` and `1`
+     *                         decompress on the reading thread.
+     */
+    basic_zstd_istreambuf(istream_reference istream_, size_t const thread_count) :
+        m_istream(istream_),
+        m_max_frames_in_flight(2 * std::max<size_t>(thread_count, 1u))
+    {
+        if (read_seek_table())
+        {
+            if (thread_count > 1)
+                m_thread_pool.emplace(thread_count);
+        }
+        else
+        {
+            m_context.reset(ZSTD_createDCtx());
+            m_input.resize(ZSTD_DStreamInSize());
+        }
+
+        m_buffer.resize(putback_size);
+        this->setg(m_buffer.data() + putback_size, m_buffer.data() + putback_size, m_buffer.data() + putback_size);
+    }
+
+    basic_zstd_istreambuf(basic_zstd_istreambuf const &) = delete;
+    basic_zstd_istreambuf & operator=(basic_zstd_istreambuf const &) = delete;
+
+    //!\brief Provides the next decompressed characters.
+    int_type underflow()
+    {
+        if (this->gptr() < this->egptr())
+            return traits_t::to_int_type(*this->gptr());
+
+        // Keep the last characters such that they can be put back.
+        size_t const putback = std::min<size_t>(this->gptr() - this->eback(), putback_size);
+        std::array<char_t, putback_size> putback_buffer{};
+        std::copy(this->gptr() - putback, this->gptr(), putback_buffer.data());
+
+        m_buffer_offset += this->egptr() - (m_buffer.data() + putback_size);
+
+        size_t const size = is_seekable() ? next_frame() : decompress_stream();
+
+        std::copy(putback_buffer.data(), putback_buffer.data() + putback, m_buffer.data() + putback_size - putback);
+        this->setg(m_buffer.data() + putback_size - putback,
+                   m_buffer.data() + putback_size,
+                   m_buffer.data() + putback_size + size);
+
+        if (size == 0)
+            return traits_t::eof();
+
+        return traits_t::to_int_type(*this->gptr());
+    }
+
+    //!\brief Returns the current position for a relative offset of `0`, otherwise seeks like seekpos().
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode)
+    {
+        pos_type const current = m_buffer_offset + (this->gptr() - (m_buffer.data() + putback_size));
+
+        if (direction == std::ios_base::cur && offset == 0)
+            return current;
+        else if (direction == std::ios_base::cur)
+            return seekpos(current + offset, mode);
+        else if (direction == std::ios_base::beg)
+            return seekpos(offset, mode);
+
+        return pos_type(off_type(-1));
+    }
+
+    //!\brief Moves to the given position in the decompressed data; only available for seekable files.
+    pos_type seekpos(pos_type position, std::ios_base::openmode mode)
+    {
+        if (!(mode & std::ios_base::in) || !is_seekable() || off_type(position) < 0
+            || static_cast<uint64_t>(off_type(position)) > m_frames.back().decompressed_offset)
+            return pos_type(off_type(-1));
+
+        uint64_t const target = off_type(position);
+
+        // The position lies in the current buffer.
+        size_t const buffer_size = this->egptr() - (m_buffer.data() + putback_size);
+        if (target >= m_buffer_offset && target < m_buffer_offset + buffer_size)
+        {
+            this->setg(this->eback(), m_buffer.data() + putback_size + (target - m_buffer_offset), this->egptr());
+            return position;
+        }
+
+        // Find the frame containing the position and restart reading from there.
+        auto it = std::ranges::upper_bound(m_frames, target, {}, &frame_entry::decompressed_offset);
+        size_t const frame_index = std::max<size_t>(std::ranges::distance(m_frames.begin(), it), 1u) - 1u;
+
+        m_pending.clear();
+        m_istream.clear();
+        m_istream.seekg(m_start + static_cast<off_type>(m_frames[frame_index].compressed_offset));
+
+        if (!m_istream.good())
+            return pos_type(off_type(-1));
+
+        m_next_frame = frame_index;
+        m_buffer_offset = m_frames[frame_index].decompressed_offset;
+
+        size_t const size = next_frame();
+        this->setg(m_buffer.data() + putback_size,
+                   m_buffer.data() + putback_size + (target - m_buffer_offset),
+                   m_buffer.data() + putback_size + size);
+
+        return position;
+    }
+
+private:
+    //!\brief The number of characters kept in front of the buffer such that they can be put back.
+    static constexpr size_t putback_size = 4;
+
+    //!\brief The position of a frame in the seek table.
+    struct frame_entry
+    {
+        //!\brief The offset of the frame relative to the start of the stream.
+        uint64_t compressed_offset{};
+        //!\brief The offset of the decompressed frame in the decompressed data.
+        uint64_t decompressed_offset{};
+    };
+
+    //!\brief A frame to be decompressed.
+    struct frame
+    {
+        //!\brief The compressed frame.
+        std::vector<char> input{};
+        //!\brief The decompressed frame, preceded by space for the putback characters.
+        std::vector<char_t> output{};
+        //!\brief Holds an error that occurred while decompressing the frame.
+        std::exception_ptr error{};
+        //!\brief Set as soon as the frame was decompressed.
+        std::promise<void> done{};
+    };
+
+    //!\brief Decompresses the given frame with a decompression context of the calling thread.
+    static void decompress(frame & current)
+    {
+        static thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context{ZSTD_createDCtx(),
+                                                                                        &ZSTD_freeDCtx};
+
+        try
+        {
+            size_t const output_size = (current.output.size() - putback_size) * sizeof(char_t);
+            size_t const result = ZSTD_decompressDCtx(context.get(),
+                                                      current.output.data() + putback_size,
+                                                      output_size,
+                                                      current.input.data(),
+                                                      current.input.size());
+
+            if (ZSTD_isError(result))
+                throw io_error{std::string{"Zstd decompression failed: "} + ZSTD_getErrorName(result)};
+            if (result != output_size)
+                throw io_error{"Zstd frame does not match the size given in the seek table."};
+        }
+        catch (...)
+        {
+            current.error = std::current_exception();
+        }
+    }
+
+    //!\brief Reads a little endian integer from the given bytes.
+    static uint32_t read_uint32(char const * bytes)
+    {
+        uint32_t value{};
+        for (size_t i = 0; i < sizeof(value); ++i)
+            value |= static_cast<uint32_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+        return value;
+    }
+
+    //!\brief Whether the stream ends with a valid seek table.
+    bool is_seekable() const
+    {
+        return !m_frames.empty();
+    }
+
+    /*!\brief Reads the seek table at the end of the stream, if there is one.
+     * \returns Whether a valid seek table was found.
+     * \details
+     * The underlying stream is reset to its current position afterwards.
+     */
+    bool read_seek_table()
+    {
+        if constexpr (sizeof(char_t) != 1)
+            return false;
+
+        m_start = m_istream.tellg();
+        if (m_start == pos_type(off_type(-1)))
+        {
+            m_istream.clear();
+            return false;
+        }
+
+        std::vector<frame_entry> frames{};
+        uint64_t total_size{};
+
+        auto read_at = [&](off_type const offset, std::vector<char> & bytes)
+        {
+            m_istream.seekg(m_start + offset);
+            m_istream.read(reinterpret_cast<char_t *>(bytes.data()), bytes.size());
+            return m_istream.good();
+        };
+
+        m_istream.seekg(0, std::ios_base::end);
+        pos_type const end = m_istream.tellg();
+
+        if (end != pos_type(off_type(-1)))
+            total_size = end - m_start;
+
+        std::vector<char> footer(zstd_seekable_format::footer_size);
+        if (total_size >= zstd_seekable_format::skippable_header_size + zstd_seekable_format::footer_size
+            && read_at(total_size - footer.size(), footer)
+            && read_uint32(footer.data() + 5) == zstd_seekable_format::seekable_magic_number
+            && (static_cast<uint8_t>(footer[4]) & zstd_seekable_format::reserved_bits) == 0)
+        {
+            uint64_t const frame_count = read_uint32(footer.data());
+            bool const has_checksums = (static_cast<uint8_t>(footer[4]) & zstd_seekable_format::checksum_flag) != 0;
+            uint64_t const entry_size = has_checksums ? 12 : 8;
+            uint64_t const table_size = frame_count * entry_size + zstd_seekable_format::footer_size;
+            uint64_t const skippable_size = zstd_seekable_format::skippable_header_size + table_size;
+
+            std::vector<char> table(skippable_size);
+            if (frame_count > 0 && skippable_size <= total_size && read_at(total_size - skippable_size, table)
+                && read_uint32(table.data()) == zstd_seekable_format::skippable_magic_number
+                && read_uint32(table.data() + 4) == table_size)
+            {
+                frame_entry entry{};
+                for (size_t i = 0; i < frame_count; ++i)
+                {
+                    frames.push_back(entry);
+                    char const * bytes = table.data() + zstd_seekable_format::skippable_header_size + i * entry_size;
+                    entry.compressed_offset += read_uint32(bytes);
+                    entry.decompressed_offset += read_uint32(bytes + 4);
+                }
+                // The last entry marks the end of the frames, it must be followed by the seek table.
+                frames.push_back(entry);
+
+                if (entry.compressed_offset != total_size - skippable_size)
+                    frames.clear();
+            }
+        }
+
+        m_istream.clear();
+        m_istream.seekg(m_start);
+        m_frames = std::move(frames);
+        return is_seekable();
+    }
+
+    //!\brief Reads and schedules the following frames until enough frames are in flight.
+    void fill_pipeline()
+    {
+        while (m_pending.size() < m_max_frames_in_flight && m_next_frame + 1 < m_frames.size())
+        {
+            frame_entry const & begin = m_frames[m_next_frame];
+            frame_entry const & end = m_frames[m_next_frame + 1];
+            ++m_next_frame;
+
+            auto current = std::make_shared<frame>();
+            current->input.resize(end.compressed_offset - begin.compressed_offset);
+            current->output.resize(putback_size + (end.decompressed_offset - begin.decompressed_offset));
+            m_pending.push_back(current);
+
+            m_istream.read(reinterpret_cast<char_t *>(current->input.data()), current->input.size());
+            if (!m_istream.good())
+            {
+                current->error = std::make_exception_ptr(io_error{"Unexpected end of the zstd compressed stream."});
+                current->done.set_value();
+                m_next_frame = m_frames.size();
+            }
+            else if (m_thread_pool)
+            {
+                m_thread_pool->execute(
+                    [](std::shared_ptr<frame> current, auto && callback)
+                    {
+                        decompress(*current);
+                        callback(*current);
+                    },
+                    std::move(current),
+                    [](frame & current)
+                    {
+                        current.done.set_value();
+                    });
+            }
+            else
+            {
+                decompress(*current);
+                current->done.set_value();
+            }
+        }
+    }
+
+    //!\brief Moves the next decompressed frame into the buffer and returns its size.
+    size_t next_frame()
+    {
+        fill_pipeline();
+
+        if (m_pending.empty())
+            return 0;
+
+        std::shared_ptr<frame> current = std::move(m_pending.front());
+        m_pending.pop_front();
+        current->done.get_future().wait();
+
+        if (current->error)
+            std::rethrow_exception(current->error);
+
+        m_buffer = std::move(current->output);
+        fill_pipeline();
+
+        return m_buffer.size() - putback_size;
+    }
+
+    //!\brief Decompresses the next characters of a non-seekable stream into the buffer and returns their number.
+    size_t decompress_stream()
+    {
+        m_buffer.resize(putback_size + ZSTD_DStreamOutSize() / sizeof(char_t));
+
+        ZSTD_outBuffer output{m_buffer.data() + putback_size, (m_buffer.size() - putback_size) * sizeof(char_t), 0};
+
+        while (output.pos < sizeof(char_t))
+        {
+            if (m_input_buffer.pos == m_input_buffer.size)
+            {
+                m_istream.read(reinterpret_cast<char_t *>(m_input.data()), m_input.size() / sizeof(char_t));
+                m_input_buffer = ZSTD_inBuffer{m_input.data(), m_istream.gcount() * sizeof(char_t), 0};
+
+                if (m_input_buffer.size == 0 && !m_frame_incomplete)
+                    break;
+            }
+
+            // At the end of the input, the decompressor may still flush buffered data.
+            size_t const previous_position = output.pos;
+            size_t const result = ZSTD_decompressStream(m_context.get(), &output, &m_input_buffer);
+
+            if (ZSTD_isError(result))
+                throw io_error{std::string{"Zstd decompression failed: "} + ZSTD_getErrorName(result)};
+
+            m_frame_incomplete = result != 0;
+
+            if (m_input_buffer.size == 0 && output.pos == previous_position)
+                throw io_error{"Unexpected end of the zstd compressed stream."};
+        }
+
+        return output.pos / sizeof(char_t);
+    }
+
+    //!\brief The underlying stream.
+    istream_reference m_istream;
+    //!\brief The position of the underlying stream at construction.
+    pos_type m_start{};
+    //!\brief The buffer holding the decompressed characters, preceded by the putback area.
+    std::vector<char_t> m_buffer{};
+    //!\brief The position of the first character of the buffer in the decompressed data.
+    uint64_t m_buffer_offset{};
+
+    //!\brief The frames of a seekable stream and an entry marking their end; empty for non-seekable streams.
+    std::vector<frame_entry> m_frames{};
+    //!\brief The index of the next frame to be read.
+    size_t m_next_frame{};
+    //!\brief The maximal number of frames that are read ahead.
+    size_t m_max_frames_in_flight{};
+    //!\brief The frames that were read ahead, in order.
+    std::deque<std::shared_ptr<frame>> m_pending{};
+
+    //!\brief The decompression context for non-seekable streams.
+    std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> m_context{nullptr, &ZSTD_freeDCtx};
+    //!\brief The compressed data of a non-seekable stream.
+    std::vector<char> m_input{};
+    //!\brief The unprocessed part of m_input.
+    ZSTD_inBuffer m_input_buffer{nullptr, 0, 0};
+    //!\brief Whether the last call to ZSTD_decompressStream ended inside of a frame.
+    bool m_frame_incomplete{false};
+
+    //!\brief The threads decompressing the frames; destroyed first to join them before the frames are gone.
+    std::optional<seqan3::detail::execution_handler_parallel> m_thread_pool{};
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istreambase
+// --------------------------------------------------------------------------
+
+//!\brief Holds the stream buffer of seqan3::contrib::basic_zstd_istream.
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_istreambase : virtual public std::basic_ios<char_t, traits_t>
+{
+public:
+    //!\brief The type of the underlying stream.
+    using istream_reference = std::basic_istream<char_t, traits_t> &;
+    //!\brief The type of the stream buffer.
+    using zstd_streambuf_type = basic_zstd_istreambuf<char_t, traits_t>;
+
+    //!\brief Constructs the stream buffer, see seqan3::contrib::basic_zstd_istreambuf.
+    basic_zstd_istreambase(istream_reference istream_, size_t const thread_count) : m_buf(istream_, thread_count)
+    {
+        this->init(&m_buf);
+    }
+
+    //!\brief Returns the stream buffer.
+    zstd_streambuf_type * rdbuf()
+    {
+        return &m_buf;
+    }
+
+private:
+    //!\brief The stream buffer.
+    zstd_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istream
+// --------------------------------------------------------------------------
+
+/*!\brief An input stream decompressing a zstd file.
+ * \tparam char_t   The character type of the stream.
+ * \tparam traits_t The character traits of the stream.
+ * \details
+ * See seqan3::contrib::basic_zstd_istreambuf.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_istream : public basic_zstd_istreambase<char_t, traits_t>, public std::basic_istream<char_t, traits_t>
+{
+public:
+    //!\brief The base holding the stream buffer.
+    using zstd_istreambase_type = basic_zstd_istreambase<char_t, traits_t>;
+    //!\brief The type of the underlying stream.
+    using istream_type = std::basic_istream<char_t, traits_t>;
+    //!\brief A reference to the underlying stream.
+    using istream_reference = istream_type &;
+
+    /*!\brief Constructs the stream.
+     * \param[in] istream_     The stream to read the compressed data from.
+     * \param[in] thread_count The number of threads decompressing the frames of a seekable file.
+     */
+    basic_zstd_istream(istream_reference istream_, size_t const thread_count = zstd_thread_count) :
+        zstd_istreambase_type(istream_, thread_count),
+        istream_type(zstd_istreambase_type::rdbuf())
+    {}
+};
+
+// --------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------
+
+//!\brief A zstd input stream over `char`.
+using zstd_istream = basic_zstd_istream<char>;
+
+} // namespace seqan3::contrib
+
+#endif // defined(SEQAN3_HAS_ZSTD)
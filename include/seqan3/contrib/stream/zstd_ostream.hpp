@@ -0,0 +1,404 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::zstd_ostream.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#if !defined(SEQAN3_HAS_ZSTD) && !defined(SEQAN3_HEADER_TEST)
+#    error "This file cannot be used when building without ZSTD-support."
+#endif // !defined(SEQAN3_HAS_ZSTD) && !defined(SEQAN3_HEADER_TEST)
+
+#if defined(SEQAN3_HAS_ZSTD)
+
+#    include <zstd.h>
+
+#    include <seqan3/contrib/stream/zstd.hpp>
+#    include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
+#    include <seqan3/io/exception.hpp>
+
+namespace seqan3::contrib
+{
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostreambuf
+// --------------------------------------------------------------------------
+
+/*!\brief A stream buffer writing a seekable zstd file.
+ * \tparam char_t   The character type of the stream; only byte-sized character types are supported.
+ * \tparam traits_t The character traits of the stream.
+ *
+ * \details
+ *
+ * The written data is split into frames of seqan3::contrib::zstd_frame_size uncompressed bytes, which are compressed
+ * independently on a thread pool and written in order. When the buffer is destroyed, a seek table is appended (see
+ * seqan3::contrib::zstd_seekable_format), which allows parallel decompression and random access when reading the
+ * file. Every zstd decompressor can read the file, the seek table is a skippable frame.
+ *
+ * Calling sync() (e.g. via std::flush) finishes the current frame.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_ostreambuf : public std::basic_streambuf<char_t, traits_t>
+{
+public:
+    //!\brief The type of the underlying stream.
+    using ostream_reference = std::basic_ostream<char_t, traits_t> &;
+    //!\brief The integer type of the stream.
+    using int_type = typename traits_t::int_type;
+
+    /*!\brief Constructs the buffer.
+     * \param[in] ostream_          The stream to write the compressed data to.
+     * \param[in] compression_level The zstd compression level.
+     * \param[in] frame_size        The number of uncompressed bytes per frame.
+     * \param[in] thread_count      The number of threads compressing the frames; `0` and `1` compress on the
+     *                              writing thread.
+     */
+    basic_zstd_ostreambuf(ostream_reference ostream_,
+                          int const compression_level,
+                          size_t const frame_size,
+                          size_t const thread_count) :
+        m_ostream(ostream_),
+        m_compression_level(compression_level),
+        m_frame_size(std::max<size_t>(frame_size / sizeof(char_t), 1u)),
+        m_max_frames_in_flight(2 * thread_count)
+    {
+        if (thread_count > 1)
+            m_thread_pool.emplace(thread_count);
+
+        reset_buffer();
+    }
+
+    basic_zstd_ostreambuf(basic_zstd_ostreambuf const &) = delete;
+    basic_zstd_ostreambuf & operator=(basic_zstd_ostreambuf const &) = delete;
+
+    //!\brief Writes the remaining frames and the seek table.
+    ~basic_zstd_ostreambuf()
+    {
+        try
+        {
+            submit_frame();
+            while (!m_pending.empty())
+                write_front();
+
+            // An empty file consists of an empty frame, such that it is still recognised by the magic number.
+            if (m_seek_table.empty())
+            {
+                frame empty{};
+                compress(empty, m_compression_level);
+                write_frame(empty);
+            }
+
+            write_seek_table();
+            m_ostream.flush();
+        }
+        catch (...)
+        {
+            m_ostream.setstate(std::ios_base::badbit);
+        }
+    }
+
+    //!\brief Finishes the current frame and writes all frames to the underlying stream.
+    int sync()
+    {
+        try
+        {
+            submit_frame();
+            while (!m_pending.empty())
+                write_front();
+        }
+        catch (...)
+        {
+            return -1;
+        }
+
+        m_ostream.flush();
+        return m_ostream.good() ? 0 : -1;
+    }
+
+    //!\brief Submits the full buffer as a frame and stores `c` in the next one.
+    int_type overflow(int_type c)
+    {
+        try
+        {
+            submit_frame();
+        }
+        catch (...)
+        {
+            return traits_t::eof();
+        }
+
+        if (!traits_t::eq_int_type(c, traits_t::eof()))
+        {
+            *this->pptr() = traits_t::to_char_type(c);
+            this->pbump(1);
+            return c;
+        }
+
+        return traits_t::not_eof(c);
+    }
+
+private:
+    //!\brief A frame to be compressed.
+    struct frame
+    {
+        //!\brief The uncompressed data.
+        std::vector<char_t> input{};
+        //!\brief The compressed frame.
+        std::vector<char> output{};
+        //!\brief Holds an error that occurred while compressing the frame.
+        std::exception_ptr error{};
+        //!\brief Set as soon as the frame was compressed.
+        std::promise<void> done{};
+    };
+
+    //!\brief Compresses the given frame with a compression context of the calling thread.
+    static void compress(frame & current, int const compression_level)
+    {
+        static thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context{ZSTD_createCCtx(),
+                                                                                        &ZSTD_freeCCtx};
+
+        try
+        {
+            size_t const input_size = current.input.size() * sizeof(char_t);
+            current.output.resize(ZSTD_compressBound(input_size));
+
+            ZSTD_CCtx_reset(context.get(), ZSTD_reset_session_and_parameters);
+            ZSTD_CCtx_setParameter(context.get(), ZSTD_c_compressionLevel, compression_level);
+            ZSTD_CCtx_setParameter(context.get(), ZSTD_c_checksumFlag, 1);
+
+            size_t const result = ZSTD_compress2(context.get(),
+                                                 current.output.data(),
+                                                 current.output.size(),
+                                                 current.input.data(),
+                                                 input_size);
+
+            if (ZSTD_isError(result))
+                throw io_error{std::string{"Zstd compression failed: "} + ZSTD_getErrorName(result)};
+
+            current.output.resize(result);
+        }
+        catch (...)
+        {
+            current.error = std::current_exception();
+        }
+    }
+
+    //!\brief Provides an empty buffer for the next frame.
+    void reset_buffer()
+    {
+        m_buffer.resize(m_frame_size);
+        this->setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+    }
+
+    //!\brief Compresses the buffered data as a new frame; writes the oldest frames if too many are in flight.
+    void submit_frame()
+    {
+        size_t const size = this->pptr() - this->pbase();
+        if (size == 0)
+            return;
+
+        auto current = std::make_shared<frame>();
+        m_buffer.resize(size);
+        current->input = std::move(m_buffer);
+        reset_buffer();
+
+        m_pending.push_back(current);
+
+        if (m_thread_pool)
+        {
+            m_thread_pool->execute(
+                [level = m_compression_level](std::shared_ptr<frame> current, auto && callback)
+                {
+                    compress(*current, level);
+                    callback(*current);
+                },
+                std::move(current),
+                [](frame & current)
+                {
+                    current.done.set_value();
+                });
+        }
+        else
+        {
+            compress(*current, m_compression_level);
+            current->done.set_value();
+        }
+
+        while (m_pending.size() > m_max_frames_in_flight)
+            write_front();
+    }
+
+    //!\brief Waits for the oldest frame and writes it to the underlying stream.
+    void write_front()
+    {
+        std::shared_ptr<frame> current = std::move(m_pending.front());
+        m_pending.pop_front();
+        current->done.get_future().wait();
+        write_frame(*current);
+    }
+
+    //!\brief Writes a compressed frame to the underlying stream and adds it to the seek table.
+    void write_frame(frame const & current)
+    {
+        if (current.error)
+            std::rethrow_exception(current.error);
+
+        if (current.output.size() > UINT32_MAX || current.input.size() * sizeof(char_t) > UINT32_MAX)
+            throw io_error{"Zstd frame is too large for the seek table."};
+
+        m_seek_table.push_back(static_cast<uint32_t>(current.output.size()));
+        m_seek_table.push_back(static_cast<uint32_t>(current.input.size() * sizeof(char_t)));
+
+        write_bytes(current.output.data(), current.output.size());
+    }
+
+    //!\brief Appends the seek table as a skippable frame.
+    void write_seek_table()
+    {
+        uint32_t const frame_count = m_seek_table.size() / 2;
+        uint32_t const table_size = m_seek_table.size() * sizeof(uint32_t) + zstd_seekable_format::footer_size;
+
+        std::vector<char> table{};
+        table.reserve(zstd_seekable_format::skippable_header_size + table_size);
+
+        auto append = [&table](uint32_t value)
+        {
+            for (size_t i = 0; i < sizeof(value); ++i, value >>= 8)
+                table.push_back(static_cast<char>(value & 0xFF));
+        };
+
+        append(zstd_seekable_format::skippable_magic_number);
+        append(table_size);
+        for (uint32_t const value : m_seek_table)
+            append(value);
+        append(frame_count);
+        table.push_back('\0'); // The descriptor: no checksums in the seek table.
+        append(zstd_seekable_format::seekable_magic_number);
+
+        write_bytes(table.data(), table.size());
+    }
+
+    //!\brief Writes bytes to the underlying stream.
+    void write_bytes(char const * data, size_t const size)
+    {
+        m_ostream.write(reinterpret_cast<char_t const *>(data), size / sizeof(char_t));
+
+        if (!m_ostream.good())
+            throw io_error{"Could not write to the zstd compressed stream."};
+    }
+
+    //!\brief The underlying stream.
+    ostream_reference m_ostream;
+    //!\brief The zstd compression level.
+    int m_compression_level{};
+    //!\brief The number of characters per frame.
+    size_t m_frame_size{};
+    //!\brief The maximal number of frames that are compressed before the oldest one is written.
+    size_t m_max_frames_in_flight{};
+    //!\brief The buffer of the current frame.
+    std::vector<char_t> m_buffer{};
+    //!\brief The compressed and decompressed size of every written frame.
+    std::vector<uint32_t> m_seek_table{};
+    //!\brief The frames that were not yet written, in order.
+    std::deque<std::shared_ptr<frame>> m_pending{};
+    //!\brief The threads compressing the frames; destroyed first to join them before the frames are gone.
+    std::optional<seqan3::detail::execution_handler_parallel> m_thread_pool{};
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostreambase
+// --------------------------------------------------------------------------
+
+//!\brief Holds the stream buffer of seqan3::contrib::basic_zstd_ostream.
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_ostreambase : virtual public std::basic_ios<char_t, traits_t>
+{
+public:
+    //!\brief The type of the underlying stream.
+    using ostream_reference = std::basic_ostream<char_t, traits_t> &;
+    //!\brief The type of the stream buffer.
+    using zstd_streambuf_type = basic_zstd_ostreambuf<char_t, traits_t>;
+
+    //!\brief Constructs the stream buffer, see seqan3::contrib::basic_zstd_ostreambuf.
+    basic_zstd_ostreambase(ostream_reference ostream_,
+                           int const compression_level,
+                           size_t const frame_size,
+                           size_t const thread_count) :
+        m_buf(ostream_, compression_level, frame_size, thread_count)
+    {
+        this->init(&m_buf);
+    }
+
+    //!\brief Returns the stream buffer.
+    zstd_streambuf_type * rdbuf()
+    {
+        return &m_buf;
+    }
+
+private:
+    //!\brief The stream buffer.
+    zstd_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostream
+// --------------------------------------------------------------------------
+
+/*!\brief An output stream writing a seekable zstd file.
+ * \tparam char_t   The character type of the stream.
+ * \tparam traits_t The character traits of the stream.
+ * \details
+ * See seqan3::contrib::basic_zstd_ostreambuf.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_ostream : public basic_zstd_ostreambase<char_t, traits_t>, public std::basic_ostream<char_t, traits_t>
+{
+public:
+    //!\brief The base holding the stream buffer.
+    using zstd_ostreambase_type = basic_zstd_ostreambase<char_t, traits_t>;
+    //!\brief The type of the underlying stream.
+    using ostream_type = std::basic_ostream<char_t, traits_t>;
+    //!\brief A reference to the underlying stream.
+    using ostream_reference = ostream_type &;
+
+    /*!\brief Constructs the stream.
+     * \param[in] ostream_          The stream to write the compressed data to.
+     * \param[in] compression_level The zstd compression level; defaults to `ZSTD_CLEVEL_DEFAULT` (3).
+     * \param[in] frame_size        The number of uncompressed bytes per frame.
+     * \param[in] thread_count      The number of threads compressing the frames.
+     */
+    basic_zstd_ostream(ostream_reference ostream_,
+                       int const compression_level = ZSTD_CLEVEL_DEFAULT,
+                       size_t const frame_size = zstd_frame_size,
+                       size_t const thread_count = zstd_thread_count) :
+        zstd_ostreambase_type(ostream_, compression_level, frame_size, thread_count),
+        ostream_type(zstd_ostreambase_type::rdbuf())
+    {}
+};
+
+// --------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------
+
+//!\brief A zstd output stream over `char`.
+using zstd_ostream = basic_zstd_ostream<char>;
+
+} // namespace seqan3::contrib
+
+#endif // defined(SEQAN3_HAS_ZSTD)
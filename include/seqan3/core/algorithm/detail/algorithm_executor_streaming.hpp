@@ -0,0 +1,307 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::algorithm_executor_streaming.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A parallel algorithm executor that streams the results with a bounded number of invocations in flight.
+ * \ingroup core_algorithm
+ * \tparam resource_t The underlying range of algorithm inputs; must model std::ranges::viewable_range and
+ *                    std::ranges::forward_range.
+ * \tparam algorithm_t The algorithm to be invoked on the elements of the given resource; must model std::semiregular.
+ * \tparam algorithm_result_t The result type generated by the algorithm; must model std::semiregular.
+ *
+ * \details
+ *
+ * In contrast to the seqan3::detail::algorithm_executor_blocking, which waits until the algorithm was invoked on an
+ * entire buffer of inputs, this executor keeps at most `window_size` invocations of the algorithm in flight and
+ * hands out each result as soon as it is available. Whenever the results of an invocation have been consumed, the
+ * algorithm is invoked on the next element of the resource. Hence, the memory needed for buffering the results is
+ * bounded by the window size and not by the size of the resource.
+ *
+ * The results can be reported in the order of the input, i.e. the results of an invocation are only handed out after
+ * all results of the previous invocations, or in the order in which the invocations finish.
+ * The results of a single invocation are always reported in the order they were generated by the algorithm.
+ *
+ * ### Invocation
+ *
+ * The algorithm is invoked asynchronously by a seqan3::detail::execution_handler_parallel. Like for the
+ * seqan3::detail::algorithm_executor_blocking, the algorithm must model std::invocable with the first argument type
+ * being std::ranges::range_reference_t of the `resource_t` and the second argument type being convertible to
+ * std::function<void(algorithm_result_t)>.
+ *
+ * ### Thread safety
+ *
+ * The results must be consumed by a single thread.
+ */
+template <std::ranges::viewable_range resource_t, std::semiregular algorithm_t, std::semiregular algorithm_result_t>
+    requires std::ranges::forward_range<resource_t>
+          && std::invocable<algorithm_t,
+                            std::ranges::range_reference_t<resource_t>,
+                            std::function<void(algorithm_result_t)>>
+class algorithm_executor_streaming
+{
+private:
+    //!\brief The underlying resource type.
+    using resource_type = std::views::all_t<resource_t>;
+    //!\brief The iterator over the underlying resource.
+    using resource_iterator_type = std::ranges::iterator_t<resource_type>;
+    //!\brief The type of a bucket storing the results produced by a single algorithm invocation.
+    using bucket_type = std::vector<algorithm_result_t>;
+
+    /*!\brief The state shared between the executor and the asynchronously executed tasks.
+     *
+     * \details
+     *
+     * The state is allocated on the heap such that the executor can be moved while tasks are running.
+     * The execution handler is the last member and is therefore destroyed first, i.e. all running tasks are finished
+     * before the buckets they write to are destroyed.
+     */
+    struct internal_state
+    {
+        //!\brief The underlying resource.
+        resource_type resource;
+        //!\brief The iterator pointing to the next element of the resource to be processed.
+        resource_iterator_type resource_it{};
+        //!\brief The algorithm to invoke.
+        algorithm_t algorithm{};
+        //!\brief Whether the results are reported in the order of the input.
+        bool preserve_order{true};
+
+        //!\brief The buckets storing the results of the algorithm invocations in flight.
+        std::vector<bucket_type> buckets{};
+        //!\brief Whether the invocation writing to the respective bucket has finished.
+        std::vector<bool> finished{};
+        //!\brief The buckets that are not used by any invocation.
+        std::vector<size_t> free_buckets{};
+        //!\brief The buckets to be reported next; in submission order or in completion order.
+        std::deque<size_t> report_queue{};
+
+        //!\brief Guards the bucket states and the report queue.
+        std::mutex mutex{};
+        //!\brief Signals that an invocation has finished.
+        std::condition_variable invocation_finished{};
+
+        //!\brief The execution handler invoking the algorithm asynchronously.
+        execution_handler_parallel exec_handler;
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief The class is move-only, i.e. it is not copy-constructible or copy-assignable.
+     * \{
+     */
+    //!\brief Deleted default constructor because this class manages an external resource.
+    algorithm_executor_streaming() = delete;
+    //!\brief This class provides unique ownership over the managed resource and is therefor not copyable.
+    algorithm_executor_streaming(algorithm_executor_streaming const &) = delete;
+    algorithm_executor_streaming(algorithm_executor_streaming &&) noexcept = default; //!< Defaulted.
+    //!\brief This class provides unique ownership over the managed resource and is therefor not copyable.
+    algorithm_executor_streaming & operator=(algorithm_executor_streaming const &) = delete;
+    algorithm_executor_streaming & operator=(algorithm_executor_streaming &&) noexcept = default; //!< Defaulted.
+    ~algorithm_executor_streaming() = default;                                                    //!< Defaulted.
+
+    /*!\brief Constructs this executor with the given resource range.
+     *
+     * \param[in] resource The underlying resource.
+     * \param[in] algorithm The algorithm to invoke on the elements of the underlying resource.
+     * \param[in] result A dummy result object to deduce the type of the underlying buffer value.
+     * \param[in] exec_handler The parallel execution handler to use.
+     * \param[in] window_size The maximum number of invocations in flight; `0` uses the size of the resource.
+     * \param[in] preserve_order Whether the results are reported in the order of the input.
+     */
+    algorithm_executor_streaming(resource_t resource,
+                                 algorithm_t algorithm,
+                                 algorithm_result_t const SEQAN3_DOXYGEN_ONLY(result),
+                                 execution_handler_parallel && exec_handler,
+                                 size_t window_size,
+                                 bool preserve_order = true) :
+        state{new internal_state{.resource = std::forward<resource_t>(resource),
+                                 .algorithm = std::move(algorithm),
+                                 .preserve_order = preserve_order,
+                                 .exec_handler = std::move(exec_handler)}}
+    {
+        state->resource_it = std::ranges::begin(state->resource);
+
+        if (window_size == 0)
+            window_size = static_cast<size_t>(std::ranges::distance(state->resource));
+        window_size = std::max<size_t>(window_size, 1u);
+
+        state->buckets.resize(window_size);
+        state->finished.resize(window_size, false);
+        state->free_buckets.resize(window_size);
+        std::ranges::generate(state->free_buckets,
+                              [bucket_id = window_size]() mutable
+                              {
+                                  return --bucket_id;
+                              });
+    }
+    //!\}
+
+    /*!\brief Returns the next available algorithm result.
+     * \returns A std::optional that either contains the next algorithm result or is empty, i.e. the
+     *          underlying resource has been completely consumed.
+     *
+     * \details
+     *
+     * Invokes the algorithm on the next elements of the resource until the window is full and blocks until the next
+     * result is available.
+     */
+    std::optional<algorithm_result_t> next_result()
+    {
+        assert(state != nullptr);
+
+        while (true)
+        {
+            if (current_bucket.has_value())
+            {
+                bucket_type & bucket = state->buckets[*current_bucket];
+                if (bucket_position < bucket.size())
+                    return std::optional<algorithm_result_t>{std::move(bucket[bucket_position++])};
+
+                release_current_bucket();
+            }
+
+            submit();
+
+            std::unique_lock lock{state->mutex};
+            state->invocation_finished.wait(lock,
+                                            [this]()
+                                            {
+                                                return is_report_ready() || is_idle();
+                                            });
+
+            if (!is_report_ready()) // Nothing in flight and nothing left to submit.
+                return std::nullopt;
+
+            current_bucket = state->report_queue.front();
+            state->report_queue.pop_front();
+        }
+    }
+
+    //!\brief Checks whether the end of the input resource was reached.
+    bool is_eof() noexcept
+    {
+        return state->resource_it == std::ranges::end(state->resource);
+    }
+
+private:
+    //!\brief Whether the first bucket of the report queue can be reported. Requires the mutex to be locked.
+    bool is_report_ready() const
+    {
+        return !state->report_queue.empty() && state->finished[state->report_queue.front()];
+    }
+
+    //!\brief Whether no invocation is in flight. Requires the mutex to be locked.
+    bool is_idle() const
+    {
+        return state->free_buckets.size() == state->buckets.size();
+    }
+
+    //!\brief Returns the consumed bucket to the free buckets.
+    void release_current_bucket()
+    {
+        std::scoped_lock lock{state->mutex};
+        state->buckets[*current_bucket].clear(); // Keeps the memory for the next invocation.
+        state->finished[*current_bucket] = false;
+        state->free_buckets.push_back(*current_bucket);
+        current_bucket.reset();
+        bucket_position = 0;
+    }
+
+    /*!\brief Invokes the algorithm on the next elements of the resource until all buckets are in use.
+     *
+     * \details
+     *
+     * The tasks are pushed to the execution handler without holding the mutex, since pushing blocks if the task
+     * queue of the handler is full and the running tasks need the mutex to finish.
+     */
+    void submit()
+    {
+        std::vector<std::pair<size_t, resource_iterator_type>> claimed_buckets{};
+        {
+            std::scoped_lock lock{state->mutex};
+            for (; !state->free_buckets.empty() && !is_eof(); ++state->resource_it)
+            {
+                claimed_buckets.emplace_back(state->free_buckets.back(), state->resource_it);
+                state->free_buckets.pop_back();
+
+                if (state->preserve_order)
+                    state->report_queue.push_back(claimed_buckets.back().first);
+            }
+        }
+
+        for (auto & [bucket_id, input_it] : claimed_buckets)
+        {
+            internal_state * shared_state = state.get();
+            state->exec_handler.execute(
+                [shared_state, bucket_id = bucket_id, algorithm = state->algorithm](auto && input,
+                                                                                    auto && callback) mutable
+                {
+                    algorithm(std::forward<decltype(input)>(input), std::forward<decltype(callback)>(callback));
+
+                    {
+                        std::scoped_lock lock{shared_state->mutex};
+                        shared_state->finished[bucket_id] = true;
+                        if (!shared_state->preserve_order)
+                            shared_state->report_queue.push_back(bucket_id);
+                    }
+                    shared_state->invocation_finished.notify_one();
+                },
+                *input_it,
+                [bucket = &shared_state->buckets[bucket_id]](auto && algorithm_result)
+                {
+                    bucket->push_back(std::move(algorithm_result));
+                });
+        }
+    }
+
+    //!\brief The state shared with the running tasks.
+    std::unique_ptr<internal_state> state{};
+    //!\brief The bucket whose results are currently reported.
+    std::optional<size_t> current_bucket{};
+    //!\brief The position of the next result within the current bucket.
+    size_t bucket_position{};
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::detail::algorithm_executor_streaming
+ * \{
+ */
+
+//!\brief Deduce the type from the provided arguments.
+template <typename resource_rng_t, std::semiregular algorithm_t, std::semiregular algorithm_result_t>
+algorithm_executor_streaming(resource_rng_t &&,
+                             algorithm_t,
+                             algorithm_result_t const &,
+                             execution_handler_parallel &&,
+                             size_t,
+                             bool = true)
+    -> algorithm_executor_streaming<resource_rng_t, algorithm_t, algorithm_result_t>;
+//!\}
+} // namespace seqan3::detail
@@ -16,9 +16,33 @@
 #include <optional>
 
 #include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/core/detail/strong_type.hpp>
 
 namespace seqan3::detail
 {
+/*!\brief A strong type for the number of algorithm invocations that may be in flight in the streaming parallel mode.
+ * \ingroup core_configuration
+ * \see seqan3::detail::parallel_mode
+ */
+struct parallel_streaming_window : public detail::strong_type<size_t, parallel_streaming_window>
+{
+    //!\brief The type of the strong type base class.
+    using base_t = detail::strong_type<size_t, parallel_streaming_window>;
+
+    // Import the base class constructors.
+    using base_t::base_t;
+};
+
+/*!\brief The order in which the results of the streaming parallel mode are reported.
+ * \ingroup core_configuration
+ * \see seqan3::detail::parallel_mode
+ */
+enum struct parallel_result_order : bool
+{
+    input,     //!< The results are reported in the order of the input.
+    completion //!< The results are reported as soon as they are computed.
+};
+
 /*!\brief A global configuration type used to enable parallel execution of algorithms.
  * \ingroup core_configuration
  * \tparam wrapped_config_id_t The algorithm specific configuration id wrapped in a std::integral_constant.
@@ -26,6 +50,11 @@ namespace seqan3::detail
  * \details
  *
  * This type is used to enable the parallel mode of the algorithms.
+ *
+ * Optionally, a seqan3::detail::parallel_streaming_window can be given to bound the number of algorithm invocations
+ * whose results are computed or buffered at the same time. The results are then handed out as soon as they are
+ * available, either in the order of the input or in the order of their completion (see
+ * seqan3::detail::parallel_result_order). Algorithms that do not support streaming ignore these settings.
  */
 template <typename wrapped_config_id_t>
 class parallel_mode : private pipeable_config_element
@@ -46,10 +75,27 @@ public:
      */
     explicit parallel_mode(uint32_t thread_count_) noexcept : thread_count{thread_count_}
     {}
+
+    /*!\brief Sets the number of threads and enables the streaming parallel mode.
+     * \param[in] thread_count_ The maximum number of threads to be used by the algorithm.
+     * \param[in] window The maximum number of algorithm invocations that are in flight at the same time.
+     * \param[in] order The order in which the results are reported; defaults to the order of the input.
+     */
+    parallel_mode(uint32_t thread_count_,
+                  parallel_streaming_window window,
+                  parallel_result_order order = parallel_result_order::input) noexcept :
+        thread_count{thread_count_},
+        streaming_window{window.get()},
+        result_order{order}
+    {}
     //!\}
 
     //!\brief The maximum number of threads the algorithm can use.
     std::optional<uint32_t> thread_count{std::nullopt};
+    //!\brief The maximum number of algorithm invocations in flight; `0` disables the streaming mode.
+    size_t streaming_window{};
+    //!\brief The order in which the results are reported in the streaming mode.
+    parallel_result_order result_order{parallel_result_order::input};
 
     /*!\privatesection
      * \brief Internal id to check for consistent configuration settings.
@@ -75,6 +75,7 @@
  * | GZip       | `.gz`¹          | [zlib](https://zlib.net/)                  | GNU-Zip, most common format on UNIX                                                                                   |
  * | BGZF       | `.gz`, `.bgzf`² | [zlib](https://zlib.net/)                  | [Blocked GZip](https://samtools.github.io/hts-specs/SAMv1.pdf), compatible extension to GZip, features parallelisation|
  * | BZip2      | `.bz2`          | [libbz2](https://www.sourceware.org/bzip2) | Stronger compression than GZip, slower to compress                                                                    |
+ * | Zstandard  | `.zst`          | [libzstd](https://facebook.github.io/zstd) | Fast (de-)compression at ratios similar to GZip; written as [seekable zstd](https://github.com/facebook/zstd/blob/dev/contrib/seekable_format), features parallelisation |
  *
  * <small>¹ SeqAn always assumes GZip and does not handle pure `.Z`.<br>
  * ² Some file formats like `.bam` or `.bcf` are implicitly BGZF-compressed without showing this in the
@@ -89,7 +90,9 @@
  * The (de)compression stream wrappers are currently only used internally and not part of the API.
  *
  * The number of threads used for (de-)compression of BGZF-streams can be adjusted via
- * \ref setting_compression_threads "setting seqan3::contrib::bgzf_thread_count".
+ * \ref setting_compression_threads "setting seqan3::contrib::bgzf_thread_count", the one for zstd-streams via
+ * seqan3::contrib::zstd_thread_count. Plain GZip-streams are decompressed on a single thread unless
+ * seqan3::contrib::gz_thread_count is set to a greater value.
  *
  * # Serialisation {#serialisation}
  *
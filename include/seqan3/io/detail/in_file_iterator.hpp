@@ -166,6 +166,11 @@ public:
     in_file_iterator & seek_to(std::streampos const & pos)
     {
         assert(host != nullptr);
+
+        // Records that were read ahead of the current record must not be returned after seeking.
+        if constexpr (requires { host->discard_read_ahead_records(); })
+            host->discard_read_ahead_records();
+
         host->secondary_stream->seekg(pos);
         if (host->secondary_stream->fail())
         {
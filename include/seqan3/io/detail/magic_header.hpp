@@ -124,10 +124,10 @@ using compression_formats = pack_traits::drop_front<void
                                                     ,
                                                     bz2_compression
 #endif // defined(SEQAN3_HAS_BZIP2)
-#if SEQAN3_HAS_ZSTD
+#if defined(SEQAN3_HAS_ZSTD)
                                                     ,
                                                     zstd_compression
-#endif // SEQAN3_HAS_ZSTD
+#endif // defined(SEQAN3_HAS_ZSTD)
                                                     >;
 
 } // namespace seqan3::detail
@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::memory_mapped_file.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <string_view>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Maps a file read-only into memory.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The content of the file is available as a std::string_view via data(). The operating system loads the pages of
+ * the file when they are accessed for the first time, so accessing a small part of a large file only reads that part.
+ * The mapping is removed on destruction; the class is move-only.
+ */
+class memory_mapped_file
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_mapped_file() = default;                                      //!< Defaulted.
+    memory_mapped_file(memory_mapped_file const &) = delete;             //!< Deleted.
+    memory_mapped_file & operator=(memory_mapped_file const &) = delete; //!< Deleted.
+
+    //!\brief Move constructor.
+    memory_mapped_file(memory_mapped_file && other) noexcept : content{std::exchange(other.content, {})}
+    {}
+
+    //!\brief Move assignment.
+    memory_mapped_file & operator=(memory_mapped_file && other) noexcept
+    {
+        std::swap(content, other.content);
+        return *this;
+    }
+
+    //!\brief Removes the mapping.
+    ~memory_mapped_file()
+    {
+        if (!content.empty())
+            munmap(const_cast<char *>(content.data()), content.size());
+    }
+
+    /*!\brief Maps the file `file_name`.
+     * \param[in] file_name The path of the file.
+     * \throws seqan3::file_open_error if the file cannot be opened or mapped.
+     */
+    explicit memory_mapped_file(std::filesystem::path const & file_name)
+    {
+        int const file_descriptor = open(file_name.c_str(), O_RDONLY);
+        if (file_descriptor == -1)
+            throw file_open_error{"Could not open file " + file_name.string() + " for reading."};
+
+        struct stat file_status;
+        if (fstat(file_descriptor, &file_status) == -1)
+        {
+            close(file_descriptor);
+            throw file_open_error{"Could not determine the size of file " + file_name.string() + "."};
+        }
+
+        size_t const size = file_status.st_size;
+
+        // An empty file cannot be mapped.
+        if (size > 0u)
+        {
+            void * const address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+            if (address == MAP_FAILED)
+            {
+                close(file_descriptor);
+                throw file_open_error{"Could not map file " + file_name.string() + " into memory."};
+            }
+
+            content = std::string_view{static_cast<char const *>(address), size};
+        }
+
+        close(file_descriptor); // The mapping stays valid after closing the file.
+    }
+    //!\}
+
+    //!\brief Returns the content of the file.
+    std::string_view data() const noexcept
+    {
+        return content;
+    }
+
+private:
+    //!\brief The mapped memory.
+    std::string_view content{};
+};
+
+} // namespace seqan3::detail
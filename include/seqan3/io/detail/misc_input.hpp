@@ -28,6 +28,10 @@
 #    include <seqan3/contrib/stream/bgzf_istream.hpp>
 #    include <seqan3/contrib/stream/bgzf_stream_util.hpp>
 #    include <seqan3/contrib/stream/gz_istream.hpp>
+#    include <seqan3/contrib/stream/parallel_gz_istream.hpp>
+#endif
+#if defined(SEQAN3_HAS_ZSTD)
+#    include <seqan3/contrib/stream/zstd_istream.hpp>
 #endif
 #include <seqan3/contrib/stream/bgzf.hpp>
 #include <seqan3/io/detail/magic_header.hpp>
@@ -138,6 +142,12 @@ inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream,
         if (contains_extension(gz_compression{}, extension) || contains_extension(bgzf_compression{}, extension))
             filename.replace_extension();
 
+        if constexpr (sizeof(char_t) == 1)
+        {
+            if (contrib::gz_thread_count > 1)
+                return {new contrib::basic_parallel_gz_istream<char_t>{primary_stream}, stream_deleter_default};
+        }
+
         return {new contrib::basic_gz_istream<char_t>{primary_stream}, stream_deleter_default};
 #else
         throw file_open_error{"Trying to read from a gzipped file, but no ZLIB available."};
@@ -156,7 +166,14 @@ inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream,
     }
     else if (starts_with(magic_number, zstd_compression::magic_header)) // ZStd
     {
-        throw file_open_error{"Trying to read from a zst'ed file, but SeqAn does not yet support this."};
+#if defined(SEQAN3_HAS_ZSTD)
+        if (contains_extension(zstd_compression{}, extension))
+            filename.replace_extension();
+
+        return {new contrib::basic_zstd_istream<char_t>{primary_stream}, stream_deleter_default};
+#else
+        throw file_open_error{"Trying to read from a zst'ed file, but no libzstd available."};
+#endif
     }
 
     return {&primary_stream, stream_deleter_noop};
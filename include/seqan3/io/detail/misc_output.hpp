@@ -25,6 +25,9 @@
 #    include <seqan3/contrib/stream/bgzf_ostream.hpp>
 #    include <seqan3/contrib/stream/gz_ostream.hpp>
 #endif
+#if defined(SEQAN3_HAS_ZSTD)
+#    include <seqan3/contrib/stream/zstd_ostream.hpp>
+#endif
 #include <seqan3/contrib/stream/bgzf.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/utility/concept.hpp>
@@ -84,7 +87,12 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
     }
     else if (extension == ".zst")
     {
-        throw file_open_error{"Trying to write a zst'ed file, but SeqAn does not yet support this."};
+#if defined(SEQAN3_HAS_ZSTD)
+        filename.replace_extension("");
+        return {new contrib::basic_zstd_ostream<char_t>{primary_stream}, stream_deleter_default};
+#else
+        throw file_open_error{"Trying to write a zst'ed file, but no libzstd available."};
+#endif
     }
 
     return {&primary_stream, stream_deleter_noop};
@@ -31,6 +31,8 @@
 
 #pragma once
 
+#include <seqan3/io/sam_file/bam_index.hpp>
+#include <seqan3/io/sam_file/bam_record_view.hpp>
 #include <seqan3/io/sam_file/format_bam.hpp>
 #include <seqan3/io/sam_file/format_sam.hpp>
 #include <seqan3/io/sam_file/header.hpp>
@@ -0,0 +1,605 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(SEQAN3_HAS_ZLIB)
+#    include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#endif
+#include <seqan3/core/debug_stream/debug_stream_type.hpp>
+#include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A contiguous range of a BAM file, given by two BGZF virtual file offsets.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * A virtual file offset stores the offset of a compressed BGZF block in the upper 48 bits and the offset within the
+ * uncompressed block in the lower 16 bits. Chunks can be passed to seqan3::detail::in_file_iterator::seek_to.
+ */
+struct bam_index_chunk
+{
+    uint64_t begin{}; //!< The virtual file offset of the first record of the chunk.
+    uint64_t end{};   //!< The virtual file offset behind the last record of the chunk.
+
+    //!\brief Defaulted comparison.
+    friend bool operator==(bam_index_chunk const &, bam_index_chunk const &) = default;
+};
+
+/*!\brief Prints a chunk to the seqan3::debug_stream.
+ * \tparam char_t The underlying character type for the seqan3::debug_stream_type.
+ * \param[in,out] stream The output stream.
+ * \param[in] value The chunk to print.
+ * \relates seqan3::debug_stream_type
+ */
+template <typename char_t>
+inline debug_stream_type<char_t> & operator<<(debug_stream_type<char_t> & stream, bam_index_chunk const & value)
+{
+    return stream << "<begin:" << value.begin << ", end:" << value.end << ">";
+}
+
+/*!\brief A coordinate index of a BAM file in the BAI or CSI format.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * The index partitions every reference into a hierarchy of bins. The bins on the deepest level span
+ * \f$2^{\mathit{min\_shift}}\f$ positions and every level above spans eight times as many positions. Every record of a
+ * coordinate sorted BAM file is assigned to the smallest bin that contains it, and for every bin the index stores the
+ * chunks of the file that contain its records. Additionally, the index stores the offset of the first record that
+ * overlaps each window of \f$2^{\mathit{min\_shift}}\f$ positions (the linear index), which allows skipping all
+ * chunks that end before a queried region.
+ *
+ * The BAI format always uses a minimal shift of 14 and a depth of 5, i.e. it supports references of up to
+ * \f$2^{29}\f$ positions. The CSI format stores both parameters and therefore supports longer references.
+ *
+ * An index is written by seqan3::sam_file_output::write_index() if seqan3::sam_file_output_options::write_bam_index
+ * is set, and it is used by seqan3::sam_file_input::region to read only the records of a region.
+ *
+ * \sa https://samtools.github.io/hts-specs/SAMv1.pdf (section 5) and https://samtools.github.io/hts-specs/CSIv1.pdf
+ */
+class bam_index
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_index() = default;                              //!< Defaulted.
+    bam_index(bam_index const &) = default;             //!< Defaulted.
+    bam_index(bam_index &&) = default;                  //!< Defaulted.
+    bam_index & operator=(bam_index const &) = default; //!< Defaulted.
+    bam_index & operator=(bam_index &&) = default;      //!< Defaulted.
+    ~bam_index() = default;                             //!< Defaulted.
+
+    /*!\brief Constructs an empty index for the given number of references.
+     * \param[in] reference_count The number of references in the header of the BAM file.
+     * \param[in] min_shift       The binary logarithm of the span of the smallest bins (BAI: 14).
+     * \param[in] depth           The number of levels below the root bin (BAI: 5).
+     */
+    explicit bam_index(size_t const reference_count, uint8_t const min_shift = 14, uint8_t const depth = 5) :
+        min_shift_{min_shift},
+        depth_{depth},
+        references(reference_count)
+    {
+        if (min_shift + 3 * depth > 62)
+            throw std::invalid_argument{"The minimal shift and depth of a BAM index must not exceed 62 bits."};
+    }
+
+    /*!\brief Reads an index from a BAI or CSI file.
+     * \param[in] file_name The path to the index; the format is detected from the file content.
+     * \throws seqan3::file_open_error if the file cannot be opened.
+     * \throws seqan3::format_error if the file is neither a valid BAI nor a valid CSI index.
+     */
+    explicit bam_index(std::filesystem::path const & file_name)
+    {
+        std::ifstream file{file_name, std::ios_base::in | std::ios::binary};
+        if (!file.good())
+            throw file_open_error{"Could not open file " + file_name.string() + " for reading."};
+
+        std::filesystem::path stripped_file_name{file_name};
+        auto stream = detail::make_secondary_istream(file, stripped_file_name);
+
+        std::string magic(4, '\0');
+        stream->read(magic.data(), magic.size());
+
+        if (magic == std::string_view{"BAI\1", 4})
+            read_bai(*stream);
+        else if (magic == std::string_view{"CSI\1", 4})
+            read_csi(*stream);
+        else
+            throw format_error{"The file " + file_name.string() + " is neither a BAI nor a CSI index."};
+    }
+    //!\}
+
+    /*!\brief Writes the index to a file.
+     * \param[in] file_name The path of the index; a CSI index is written if its extension is `.csi`, and a BAI index
+     *                      otherwise.
+     * \throws seqan3::file_open_error if the file cannot be opened or a CSI index is written without ZLIB support.
+     * \throws seqan3::format_error if a BAI index is written for a minimal shift other than 14 or a depth other than 5.
+     */
+    void write(std::filesystem::path const & file_name) const
+    {
+        bool const csi = file_name.extension() == ".csi";
+
+        if (!csi && (min_shift_ != 14 || depth_ != 5))
+            throw format_error{"A BAI index requires a minimal shift of 14 and a depth of 5. "
+                               "Write a CSI index instead."};
+
+        std::ofstream file{file_name, std::ios_base::out | std::ios::binary};
+        if (!file.good())
+            throw file_open_error{"Could not open file " + file_name.string() + " for writing."};
+
+        if (csi)
+        {
+#if defined(SEQAN3_HAS_ZLIB)
+            contrib::bgzf_ostream stream{file};
+            write_csi(stream);
+#else
+            throw file_open_error{"Trying to write a CSI index, but no ZLIB available."};
+#endif
+        }
+        else
+        {
+            write_bai(file);
+        }
+    }
+
+    /*!\brief Adds a record of a coordinate sorted BAM file to the index.
+     * \param[in] reference_id The reference id of the record or -1 if the record is unplaced.
+     * \param[in] begin        The first reference position covered by the record or -1 if the record is unplaced.
+     * \param[in] end          The reference position behind the record; at least `begin + 1` is used.
+     * \param[in] mapped       Whether the record is mapped (seqan3::sam_flag::unmapped is not set).
+     * \param[in] record       The offsets of the record in the file.
+     * \throws seqan3::format_error if the records are not sorted by coordinate or if a record ends behind the largest
+     *                              position supported by the index.
+     *
+     * \details
+     *
+     * Consecutive records of the same bin are merged into one chunk. Unplaced records must be added last.
+     */
+    void insert(int32_t const reference_id,
+                int32_t const begin,
+                int32_t const end,
+                bool const mapped,
+                bam_index_chunk const record)
+    {
+        if (reference_id < 0 || begin < 0)
+        {
+            ++unplaced_unmapped_count_;
+            last_reference_id = std::numeric_limits<int32_t>::max();
+            return;
+        }
+
+        if (reference_id < last_reference_id || (reference_id == last_reference_id && begin < last_position))
+            throw format_error{"The records of a BAM file must be sorted by coordinate to be indexed."};
+
+        int64_t const record_end = std::max<int64_t>(end, begin + 1);
+        if (record_end > max_position())
+            throw format_error{"A record ends behind the largest position " + std::to_string(max_position())
+                               + " supported by the index. Use a CSI index with a larger depth instead."};
+
+        last_reference_id = reference_id;
+        last_position = begin;
+
+        if (references.size() <= static_cast<size_t>(reference_id))
+            references.resize(reference_id + 1);
+
+        reference_type & reference = references[reference_id];
+
+        std::vector<bam_index_chunk> & chunks = reference.bins[reg2bin(begin, record_end)].chunks;
+        if (!chunks.empty() && chunks.back().end == record.begin)
+            chunks.back().end = record.end;
+        else
+            chunks.push_back(record);
+
+        // Windows that no record overlaps take the offset of the next record.
+        size_t const last_window = (record_end - 1) >> min_shift_;
+        if (reference.linear_offsets.size() <= last_window)
+            reference.linear_offsets.resize(last_window + 1, record.begin);
+
+        if (reference.mapped_count + reference.unmapped_count == 0)
+            reference.records = record;
+        reference.records.end = record.end;
+        ++(mapped ? reference.mapped_count : reference.unmapped_count);
+    }
+
+    /*!\brief Returns the chunks of the file that contain all records overlapping a region.
+     * \param[in] reference_id The reference id of the region.
+     * \param[in] begin        The first position of the region (0-based).
+     * \param[in] end          The position behind the region.
+     * \returns The sorted and non-overlapping chunks; they may also contain records that do not overlap the region.
+     */
+    std::vector<bam_index_chunk> query(int32_t const reference_id, int64_t begin, int64_t end) const
+    {
+        if (reference_id < 0 || static_cast<size_t>(reference_id) >= references.size())
+            return {};
+
+        reference_type const & reference = references[reference_id];
+        begin = std::max<int64_t>(begin, 0);
+        end = std::min<int64_t>(end, max_position());
+        if (begin >= end || reference.bins.empty())
+            return {};
+
+        // Chunks ending before the first record that overlaps the region can be skipped.
+        uint64_t min_offset{};
+        if (!reference.linear_offsets.empty())
+        {
+            size_t const window = std::min<size_t>(begin >> min_shift_, reference.linear_offsets.size() - 1);
+            min_offset = reference.linear_offsets[window];
+        }
+        else // CSI indices store the offset for every bin instead.
+        {
+            for (uint32_t bin = first_bin(depth_) + (begin >> min_shift_);; bin = (bin - 1) >> 3)
+            {
+                if (auto it = reference.bins.find(bin); it != reference.bins.end())
+                {
+                    min_offset = it->second.loffset;
+                    break;
+                }
+
+                if (bin == 0)
+                    break;
+            }
+        }
+
+        std::vector<bam_index_chunk> result{};
+        for (uint8_t level = 0; level <= depth_; ++level)
+        {
+            int const shift = min_shift_ + 3 * (depth_ - level);
+            auto it = reference.bins.lower_bound(first_bin(level) + (begin >> shift));
+            auto const last = reference.bins.upper_bound(first_bin(level) + ((end - 1) >> shift));
+
+            for (; it != last; ++it)
+                for (bam_index_chunk const & chunk : it->second.chunks)
+                    if (chunk.end > min_offset)
+                        result.push_back(chunk);
+        }
+
+        std::ranges::sort(result, std::ranges::less{}, &bam_index_chunk::begin);
+
+        // Merge overlapping and adjacent chunks.
+        size_t merged = 0;
+        for (size_t i = 1; i < result.size(); ++i)
+        {
+            if (result[i].begin <= result[merged].end)
+                result[merged].end = std::max(result[merged].end, result[i].end);
+            else
+                result[++merged] = result[i];
+        }
+        result.resize(std::min(result.size(), merged + 1));
+
+        return result;
+    }
+
+    /*!\name Parameters and statistics
+     * \{
+     */
+    //!\brief The binary logarithm of the span of the smallest bins.
+    uint8_t min_shift() const noexcept
+    {
+        return min_shift_;
+    }
+
+    //!\brief The number of levels below the root bin.
+    uint8_t depth() const noexcept
+    {
+        return depth_;
+    }
+
+    //!\brief The number of references of the index.
+    size_t reference_count() const noexcept
+    {
+        return references.size();
+    }
+
+    //!\brief The number of mapped records of a reference.
+    uint64_t mapped_count(int32_t const reference_id) const
+    {
+        return references.at(reference_id).mapped_count;
+    }
+
+    //!\brief The number of unmapped records that are placed on a reference, e.g. the unmapped mate of a pair.
+    uint64_t unmapped_count(int32_t const reference_id) const
+    {
+        return references.at(reference_id).unmapped_count;
+    }
+
+    //!\brief The number of unmapped records without a coordinate at the end of the file.
+    uint64_t unplaced_unmapped_count() const noexcept
+    {
+        return unplaced_unmapped_count_;
+    }
+    //!\}
+
+private:
+    //!\brief The chunks of one bin.
+    struct bin_type
+    {
+        //!\brief The offset of the first record overlapping the first window of the bin (only used by CSI).
+        uint64_t loffset{};
+        //!\brief The chunks containing the records of the bin.
+        std::vector<bam_index_chunk> chunks{};
+    };
+
+    //!\brief The index of one reference.
+    struct reference_type
+    {
+        //!\brief The non-empty bins by their number.
+        std::map<uint32_t, bin_type> bins{};
+        //!\brief The offset of the first record overlapping each window (only stored by BAI).
+        std::vector<uint64_t> linear_offsets{};
+        //!\brief The offsets of the first and behind the last record of the reference.
+        bam_index_chunk records{};
+        //!\brief The number of mapped records.
+        uint64_t mapped_count{};
+        //!\brief The number of unmapped but placed records.
+        uint64_t unmapped_count{};
+    };
+
+    //!\brief The binary logarithm of the span of the smallest bins.
+    uint8_t min_shift_{14};
+    //!\brief The number of levels below the root bin.
+    uint8_t depth_{5};
+    //!\brief The index of every reference.
+    std::vector<reference_type> references{};
+    //!\brief The number of unplaced unmapped records.
+    uint64_t unplaced_unmapped_count_{};
+
+    //!\brief The reference id of the previously inserted record, used to validate the sorting.
+    int32_t last_reference_id{-1};
+    //!\brief The position of the previously inserted record, used to validate the sorting.
+    int32_t last_position{-1};
+
+    //!\brief Befriend seqan3::format_bam, which translates the offsets when the BAM file is complete.
+    friend class format_bam;
+
+    //!\brief The number of the first bin of a level.
+    static constexpr uint32_t first_bin(uint8_t const level) noexcept
+    {
+        return ((uint32_t{1} << (3 * level)) - 1) / 7;
+    }
+
+    //!\brief The number of the pseudo-bin that stores the statistics of a reference.
+    uint32_t pseudo_bin() const noexcept
+    {
+        return first_bin(depth_ + 1) + 1;
+    }
+
+    //!\brief The position behind the last position that can be indexed.
+    int64_t max_position() const noexcept
+    {
+        return int64_t{1} << (min_shift_ + 3 * depth_);
+    }
+
+    //!\brief Computes the bin number of the region [begin, end), following the CSI specification.
+    uint32_t reg2bin(int64_t const begin, int64_t end) const noexcept
+    {
+        --end;
+        for (int level = depth_, shift = min_shift_; level > 0; --level, shift += 3)
+            if (begin >> shift == end >> shift)
+                return first_bin(level) + (begin >> shift);
+
+        return 0;
+    }
+
+    //!\brief Applies `fn` to every stored file offset.
+    template <typename fn_t>
+    void transform_offsets(fn_t && fn)
+    {
+        for (reference_type & reference : references)
+        {
+            for (auto & [bin, content] : reference.bins)
+                for (bam_index_chunk & chunk : content.chunks)
+                    chunk = {fn(chunk.begin), fn(chunk.end)};
+
+            std::ranges::transform(reference.linear_offsets, reference.linear_offsets.begin(), fn);
+            reference.records = {fn(reference.records.begin), fn(reference.records.end)};
+        }
+    }
+
+    /*!\name Reading
+     * \{
+     */
+    //!\brief Reads an integral value in little endian byte order.
+    template <typename number_type>
+    static number_type read_integral(std::istream & stream)
+    {
+        number_type number{};
+        stream.read(reinterpret_cast<char *>(&number), sizeof(number));
+
+        if (!stream.good())
+            throw format_error{"Unexpected end of the BAM index."};
+
+        return number;
+    }
+
+    //!\brief Reads the bins of one reference.
+    void read_bins(std::istream & stream, reference_type & reference, bool const csi)
+    {
+        int32_t const bin_count = read_integral<int32_t>(stream);
+        for (int32_t i = 0; i < bin_count; ++i)
+        {
+            uint32_t const bin = read_integral<uint32_t>(stream);
+            uint64_t const loffset = csi ? read_integral<uint64_t>(stream) : 0u;
+            int32_t const chunk_count = read_integral<int32_t>(stream);
+
+            std::vector<bam_index_chunk> chunks(chunk_count);
+            for (bam_index_chunk & chunk : chunks)
+            {
+                chunk.begin = read_integral<uint64_t>(stream);
+                chunk.end = read_integral<uint64_t>(stream);
+            }
+
+            if (bin == pseudo_bin())
+            {
+                if (chunk_count != 2)
+                    throw format_error{"The pseudo-bin of a BAM index must contain two chunks."};
+
+                reference.records = chunks[0];
+                reference.mapped_count = chunks[1].begin;
+                reference.unmapped_count = chunks[1].end;
+            }
+            else
+            {
+                reference.bins[bin] = bin_type{loffset, std::move(chunks)};
+            }
+        }
+    }
+
+    //!\brief Reads the optional number of unplaced unmapped records at the end of an index.
+    void read_unplaced_unmapped_count(std::istream & stream)
+    {
+        uint64_t count{};
+        if (stream.read(reinterpret_cast<char *>(&count), sizeof(count)); stream.gcount() == sizeof(count))
+            unplaced_unmapped_count_ = count;
+    }
+
+    //!\brief Reads a BAI index after the magic string.
+    void read_bai(std::istream & stream)
+    {
+        references.resize(read_integral<int32_t>(stream));
+        for (reference_type & reference : references)
+        {
+            read_bins(stream, reference, false);
+
+            reference.linear_offsets.resize(read_integral<int32_t>(stream));
+            for (uint64_t & offset : reference.linear_offsets)
+                offset = read_integral<uint64_t>(stream);
+        }
+
+        read_unplaced_unmapped_count(stream);
+    }
+
+    //!\brief Reads a CSI index after the magic string.
+    void read_csi(std::istream & stream)
+    {
+        min_shift_ = read_integral<int32_t>(stream);
+        depth_ = read_integral<int32_t>(stream);
+        stream.ignore(read_integral<int32_t>(stream)); // auxiliary data
+
+        references.resize(read_integral<int32_t>(stream));
+        for (reference_type & reference : references)
+            read_bins(stream, reference, true);
+
+        read_unplaced_unmapped_count(stream);
+    }
+    //!\}
+
+    /*!\name Writing
+     * \{
+     */
+    //!\brief Writes an integral value in little endian byte order.
+    template <typename number_type>
+    static void write_integral(std::ostream & stream, number_type const number)
+    {
+        stream.write(reinterpret_cast<char const *>(&number), sizeof(number));
+    }
+
+    //!\brief Writes the bins of one reference including the pseudo-bin.
+    void write_bins(std::ostream & stream, reference_type const & reference, bool const csi) const
+    {
+        bool const has_records = reference.mapped_count + reference.unmapped_count > 0;
+        write_integral<int32_t>(stream, reference.bins.size() + has_records);
+
+        for (auto const & [bin, content] : reference.bins)
+        {
+            write_integral<uint32_t>(stream, bin);
+
+            if (csi && reference.linear_offsets.empty())
+            {
+                write_integral<uint64_t>(stream, content.loffset);
+            }
+            else if (csi) // The offset of the first record overlapping the bin, computed from the linear index.
+            {
+                uint8_t const level = bin_level(bin);
+                uint64_t const window = static_cast<uint64_t>(bin - first_bin(level)) << (3 * (depth_ - level));
+                write_integral<uint64_t>(
+                    stream,
+                    reference.linear_offsets[std::min<uint64_t>(window, reference.linear_offsets.size() - 1)]);
+            }
+
+            write_integral<int32_t>(stream, content.chunks.size());
+            for (bam_index_chunk const & chunk : content.chunks)
+            {
+                write_integral<uint64_t>(stream, chunk.begin);
+                write_integral<uint64_t>(stream, chunk.end);
+            }
+        }
+
+        if (has_records)
+        {
+            write_integral<uint32_t>(stream, pseudo_bin());
+            if (csi)
+                write_integral<uint64_t>(stream, 0u);
+            write_integral<int32_t>(stream, 2);
+            write_integral<uint64_t>(stream, reference.records.begin);
+            write_integral<uint64_t>(stream, reference.records.end);
+            write_integral<uint64_t>(stream, reference.mapped_count);
+            write_integral<uint64_t>(stream, reference.unmapped_count);
+        }
+    }
+
+    //!\brief The level of a bin.
+    uint8_t bin_level(uint32_t const bin) const noexcept
+    {
+        uint8_t level = depth_;
+        while (first_bin(level) > bin)
+            --level;
+        return level;
+    }
+
+    //!\brief Writes a BAI index.
+    void write_bai(std::ostream & stream) const
+    {
+        stream.write("BAI\1", 4);
+        write_integral<int32_t>(stream, references.size());
+        for (reference_type const & reference : references)
+        {
+            write_bins(stream, reference, false);
+
+            write_integral<int32_t>(stream, reference.linear_offsets.size());
+            for (uint64_t const offset : reference.linear_offsets)
+                write_integral<uint64_t>(stream, offset);
+        }
+        write_integral<uint64_t>(stream, unplaced_unmapped_count_);
+    }
+
+    //!\brief Writes a CSI index.
+    void write_csi(std::ostream & stream) const
+    {
+        stream.write("CSI\1", 4);
+        write_integral<int32_t>(stream, min_shift_);
+        write_integral<int32_t>(stream, depth_);
+        write_integral<int32_t>(stream, 0); // no auxiliary data
+        write_integral<int32_t>(stream, references.size());
+        for (reference_type const & reference : references)
+            write_bins(stream, reference, true);
+        write_integral<uint64_t>(stream, unplaced_unmapped_count_);
+    }
+    //!\}
+};
+
+} // namespace seqan3
@@ -0,0 +1,365 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_record_view.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/dna16sam.hpp>
+#include <seqan3/alphabet/quality/phred94.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/sam_file/format_bam.hpp>
+#include <seqan3/io/sam_file/sam_flag.hpp>
+#include <seqan3/io/sam_file/sam_tag_dictionary.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A non-owning view of a single BAM record that decodes its fields only when they are accessed.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * The view points to the bytes of a BAM record as stored in the (decompressed) file, starting behind the
+ * `block_size` field. The fixed length fields, e.g. flag(), reference_position() and mapping_quality(), are read
+ * directly from these bytes. The sequence, the qualities and the CIGAR are returned as lazy views that decode a
+ * letter when it is accessed, and the id as a std::string_view. Tags can be decoded one at a time with tag(), which
+ * skips the other tags without decoding them.
+ *
+ * Record views are returned by seqan3::sam_file_input::bam_records() and are only valid until the next record is
+ * read. Decode or copy the fields that you want to keep.
+ *
+ * Unlike seqan3::sam_file_input, the view does not replace a CIGAR with more than 65535 operations by the content of
+ * the `CG` tag.
+ *
+ * ### Example
+ *
+ * \include test/snippet/io/sam_file/sam_file_input_bam_records.cpp
+ */
+class bam_record_view
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_record_view() = default;                                    //!< Defaulted.
+    bam_record_view(bam_record_view const &) = default;             //!< Defaulted.
+    bam_record_view(bam_record_view &&) = default;                  //!< Defaulted.
+    bam_record_view & operator=(bam_record_view const &) = default; //!< Defaulted.
+    bam_record_view & operator=(bam_record_view &&) = default;      //!< Defaulted.
+    ~bam_record_view() = default;                                   //!< Defaulted.
+
+    /*!\brief Constructs the view over the given bytes of a record.
+     * \param[in] record The bytes of the record behind its `block_size` field.
+     * \throws seqan3::format_error if the lengths of the variable length fields exceed the record.
+     */
+    explicit bam_record_view(std::string_view const record) : record{record}
+    {
+        if (record.size() < fixed_size
+            || record.size() < fixed_size + read_name_size() + 4 * cigar_size() + (sequence_size() + 1) / 2
+                                   + sequence_size())
+        {
+            throw format_error{"The BAM record is shorter than its fields."};
+        }
+    }
+    //!\}
+
+    /*!\name Fixed length fields
+     * \{
+     */
+    //!\brief The id of the reference or std::nullopt if the record is not placed.
+    std::optional<int32_t> reference_id() const noexcept
+    {
+        return optional_field(0);
+    }
+
+    //!\brief The 0-based position of the alignment in the reference or std::nullopt if the record is not placed.
+    std::optional<int32_t> reference_position() const noexcept
+    {
+        return optional_field(4);
+    }
+
+    //!\brief The mapping quality.
+    uint8_t mapping_quality() const noexcept
+    {
+        return field<uint8_t>(9);
+    }
+
+    //!\brief The flag.
+    sam_flag flag() const noexcept
+    {
+        return static_cast<sam_flag>(field<uint16_t>(14));
+    }
+
+    //!\brief The id of the reference of the mate or std::nullopt if the mate is not placed.
+    std::optional<int32_t> mate_reference_id() const noexcept
+    {
+        return optional_field(20);
+    }
+
+    //!\brief The 0-based position of the mate or std::nullopt if the mate is not placed.
+    std::optional<int32_t> mate_position() const noexcept
+    {
+        return optional_field(24);
+    }
+
+    //!\brief The template length.
+    int32_t template_length() const noexcept
+    {
+        return field<int32_t>(28);
+    }
+    //!\}
+
+    /*!\name Variable length fields
+     * \{
+     */
+    //!\brief The id of the read, pointing into the record.
+    std::string_view id() const noexcept
+    {
+        return record.substr(fixed_size, read_name_size() - 1);
+    }
+
+    /*!\brief The CIGAR as a lazy view over seqan3::cigar.
+     * \returns A std::ranges::random_access_range over seqan3::cigar that decodes an operation when it is accessed.
+     */
+    auto cigar_sequence() const noexcept
+    {
+        return std::views::iota(size_t{0}, cigar_size())
+             | std::views::transform(
+                   [data = record.data() + cigar_offset()](size_t const i)
+                   {
+                       constexpr std::string_view operations{"MIDNSHP=X"};
+
+                       uint32_t operation_and_count{};
+                       std::memcpy(&operation_and_count, data + 4 * i, sizeof(operation_and_count));
+                       char const operation = operations[std::min<uint32_t>(operation_and_count & 0x0f, 8)];
+                       return cigar{operation_and_count >> 4, assign_char_to(operation, cigar::operation{})};
+                   });
+    }
+
+    //!\brief The length of the read sequence.
+    size_t sequence_size() const noexcept
+    {
+        return std::max(field<int32_t>(16), int32_t{0});
+    }
+
+    /*!\brief The read sequence as a lazy view over seqan3::dna16sam.
+     * \returns A std::ranges::random_access_range over seqan3::dna16sam that decodes a letter when it is accessed.
+     */
+    auto sequence() const noexcept
+    {
+        return std::views::iota(size_t{0}, sequence_size())
+             | std::views::transform(
+                   [data = record.data() + sequence_offset()](size_t const i)
+                   {
+                       // Two letters are stored in one byte, the first one in the upper 4 bits.
+                       uint8_t const byte = static_cast<uint8_t>(data[i / 2]);
+                       return assign_rank_to((i % 2 == 0) ? byte >> 4 : byte & 0x0f, dna16sam{});
+                   });
+    }
+
+    /*!\brief The base qualities as a lazy view over seqan3::phred94.
+     * \returns A std::ranges::random_access_range over seqan3::phred94 that decodes a quality when it is accessed.
+     *
+     * \details
+     *
+     * The range is empty if the record has no qualities, i.e. its first quality is 255.
+     */
+    auto base_qualities() const noexcept
+    {
+        std::string_view qualities = record.substr(sequence_offset() + (sequence_size() + 1) / 2, sequence_size());
+        if (!qualities.empty() && static_cast<uint8_t>(qualities.front()) == 255)
+            qualities = {};
+
+        return qualities
+             | std::views::transform(
+                   [](char const quality)
+                   {
+                       return assign_rank_to(std::min<uint8_t>(quality, 93), phred94{});
+                   });
+    }
+
+    /*!\brief Decodes a single tag.
+     * \param[in] tag_id The id of the tag, e.g. `"NM"_tag`.
+     * \returns The value of the tag or std::nullopt if the record has no such tag.
+     * \throws seqan3::format_error if the tags are corrupted.
+     *
+     * \details
+     *
+     * The tags in front of the requested one are skipped by their size without decoding them. Integer values are
+     * returned as `int32_t` like in the seqan3::sam_tag_dictionary.
+     */
+    std::optional<sam_tag_dictionary::variant_type> tag(uint16_t const tag_id) const
+    {
+        std::string_view const tags = tag_data();
+
+        for (size_t position = 0; position < tags.size();)
+        {
+            size_t const size = tag_size(tags, position);
+            uint16_t const current_id = static_cast<uint16_t>(static_cast<uint8_t>(tags[position]) << 8)
+                                      | static_cast<uint8_t>(tags[position + 1]);
+
+            if (current_id == tag_id)
+            {
+                flat_sam_tag_dictionary dictionary{};
+                format_bam{}.read_sam_dict(tags.substr(position, size), dictionary);
+                return std::move(dictionary.begin()->second);
+            }
+
+            position += size;
+        }
+
+        return std::nullopt;
+    }
+
+    /*!\brief Decodes all tags.
+     * \tparam tag_dict_type seqan3::sam_tag_dictionary (default) or seqan3::flat_sam_tag_dictionary.
+     * \returns The tags of the record.
+     * \throws seqan3::format_error if the tags are corrupted.
+     */
+    template <typename tag_dict_type = sam_tag_dictionary>
+        requires std::same_as<tag_dict_type, sam_tag_dictionary>
+                  || std::same_as<tag_dict_type, flat_sam_tag_dictionary>
+    tag_dict_type tags() const
+    {
+        tag_dict_type dictionary{};
+        format_bam{}.read_sam_dict(tag_data(), dictionary);
+        return dictionary;
+    }
+
+    //!\brief The bytes of the record behind its `block_size` field.
+    std::string_view bytes() const noexcept
+    {
+        return record;
+    }
+    //!\}
+
+private:
+    //!\brief The size of the fixed length fields behind the `block_size` field.
+    static constexpr size_t fixed_size = 32;
+
+    //!\brief Reads the field of the given type at the given offset.
+    template <typename value_t>
+    value_t field(size_t const offset) const noexcept
+    {
+        value_t value{};
+        std::memcpy(&value, record.data() + offset, sizeof(value));
+        return value;
+    }
+
+    //!\brief Reads the position or id at the given offset, which is negative if not available.
+    std::optional<int32_t> optional_field(size_t const offset) const noexcept
+    {
+        int32_t const value = field<int32_t>(offset);
+        return (value < 0) ? std::nullopt : std::optional<int32_t>{value};
+    }
+
+    //!\brief The length of the read name including the terminating null character.
+    size_t read_name_size() const noexcept
+    {
+        return std::max<size_t>(field<uint8_t>(8), 1u);
+    }
+
+    //!\brief The number of CIGAR operations.
+    size_t cigar_size() const noexcept
+    {
+        return field<uint16_t>(12);
+    }
+
+    //!\brief The offset of the CIGAR.
+    size_t cigar_offset() const noexcept
+    {
+        return fixed_size + read_name_size();
+    }
+
+    //!\brief The offset of the sequence.
+    size_t sequence_offset() const noexcept
+    {
+        return cigar_offset() + 4 * cigar_size();
+    }
+
+    //!\brief The bytes of the tags.
+    std::string_view tag_data() const noexcept
+    {
+        return record.substr(sequence_offset() + (sequence_size() + 1) / 2 + sequence_size());
+    }
+
+    /*!\brief Returns the number of bytes of the tag at the given position, including its name and type.
+     * \throws seqan3::format_error if the tag type is unknown or the tag exceeds the record.
+     */
+    static size_t tag_size(std::string_view const tags, size_t const position)
+    {
+        auto check_size = [&](size_t const size)
+        {
+            if (tags.size() - position < size)
+                throw format_error{"[CORRUPTED BAM FILE] A tag exceeds the record."};
+            return size;
+        };
+
+        auto value_size = [](char const type) -> size_t
+        {
+            switch (type)
+            {
+            case 'A':
+            case 'c':
+            case 'C':
+                return 1;
+            case 's':
+            case 'S':
+                return 2;
+            case 'i':
+            case 'I':
+            case 'f':
+                return 4;
+            default:
+                throw format_error{std::string{"[CORRUPTED BAM FILE] Unknown tag type '"} + type + "'."};
+            }
+        };
+
+        check_size(4);
+        char const type = tags[position + 2];
+
+        switch (type)
+        {
+        case 'Z':
+        case 'H':
+        {
+            size_t const end = tags.find('\0', position + 3);
+            if (end == std::string_view::npos)
+                throw format_error{"[CORRUPTED BAM FILE] A string tag is not terminated."};
+            return end + 1 - position;
+        }
+        case 'B':
+        {
+            check_size(8);
+            int32_t count{};
+            std::memcpy(&count, tags.data() + position + 4, sizeof(count));
+            if (count < 0)
+                throw format_error{"[CORRUPTED BAM FILE] An array tag has a negative size."};
+            return check_size(8 + count * value_size(tags[position + 3]));
+        }
+        default:
+            return check_size(3 + value_size(type));
+        }
+    }
+
+    //!\brief The bytes of the record.
+    std::string_view record{};
+};
+
+} // namespace seqan3
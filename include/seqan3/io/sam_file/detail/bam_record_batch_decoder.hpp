@@ -0,0 +1,276 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::bam_record_batch_decoder.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Decodes the records of a BAM stream in batches on a thread pool, keeping them in order.
+ * \tparam record_t The type of the decoded records, e.g. the record type of seqan3::sam_file_input.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * The records following the header of a BAM file are prefixed by their size in bytes. The calling thread only splits
+ * the (decompressed) stream at these record boundaries and copies the raw bytes of up to
+ * seqan3::detail::bam_record_batch_decoder::records_per_batch records into a batch. Every batch is decoded into
+ * records on one of the threads, which calls the given decode function for every record with a stream over the
+ * bytes of the batch. At most twice as many batches as threads are in flight, i.e. the memory usage is bounded.
+ *
+ * next() returns the records in the order of the file. An exception thrown while splitting or decoding the records is
+ * rethrown by next() after all records in front of the invalid one have been returned.
+ *
+ * \attention The decoder reads ahead of the last returned record. The stream must not be used by anyone else unless
+ *            reset() is called before next() is called again.
+ */
+template <typename record_t>
+class bam_record_batch_decoder
+{
+public:
+    //!\brief The type of the function decoding a single record from a stream over its bytes, called concurrently.
+    using decode_function_type = std::function<void(std::istream &, record_t &)>;
+
+    //!\brief The maximal number of records in a batch.
+    static constexpr size_t records_per_batch = 1024;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_record_batch_decoder() = delete;                                             //!< Deleted.
+    bam_record_batch_decoder(bam_record_batch_decoder const &) = delete;             //!< Deleted.
+    bam_record_batch_decoder(bam_record_batch_decoder &&) = default;                 //!< Defaulted.
+    bam_record_batch_decoder & operator=(bam_record_batch_decoder const &) = delete; //!< Deleted.
+    bam_record_batch_decoder & operator=(bam_record_batch_decoder &&) = default;     //!< Defaulted.
+
+    //!\brief Waits for the batches in flight.
+    ~bam_record_batch_decoder()
+    {
+        reset();
+    }
+
+    /*!\brief Constructs the decoder and spawns the threads.
+     * \param[in] stream       The stream positioned at the first record to decode; must outlive the decoder.
+     * \param[in] thread_count The number of threads decoding the records; must be greater than 0.
+     * \param[in] decode       The function decoding a single record.
+     */
+    bam_record_batch_decoder(std::istream & stream, size_t const thread_count, decode_function_type decode) :
+        stream{&stream},
+        max_batches_in_flight{2 * thread_count},
+        decode{std::move(decode)},
+        thread_pool{thread_count}
+    {
+        assert(thread_count > 0);
+    }
+    //!\}
+
+    /*!\brief Moves the next record and its position in the stream into the given arguments.
+     * \param[out] record   The record to move the next record into.
+     * \param[out] position The position of the record in the stream, i.e. the result of `tellg()` before reading it.
+     * \returns `false` if there are no more records, `true` otherwise.
+     * \throws seqan3::format_error or any exception thrown by the decode function for an invalid record.
+     */
+    bool next(record_t & record, std::streampos & position)
+    {
+        for (;;)
+        {
+            fill_pipeline();
+
+            if (pending.empty())
+                return false;
+
+            batch & front = *pending.front();
+
+            if (front.decoded.valid())
+                front.decoded.get();
+
+            if (next_record < front.records.size())
+            {
+                record = std::move(front.records[next_record]);
+                position = front.positions[next_record];
+                ++next_record;
+                return true;
+            }
+
+            std::exception_ptr error = front.error;
+            pending.pop_front();
+            next_record = 0;
+
+            if (error)
+            {
+                reset();
+                stream_at_end = true;
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    //!\brief Waits for and discards all batches in flight, e.g. before seeking in the stream.
+    void reset()
+    {
+        for (auto & pending_batch : pending)
+            if (pending_batch->decoded.valid())
+                pending_batch->decoded.wait();
+
+        pending.clear();
+        next_record = 0;
+        stream_at_end = false;
+    }
+
+private:
+    //!\brief The raw bytes of consecutive records and their decoded records.
+    struct batch
+    {
+        //!\brief The bytes of the records, including their sizes.
+        std::vector<char> bytes{};
+        //!\brief The positions of the records in the stream.
+        std::vector<std::streampos> positions{};
+        //!\brief The decoded records.
+        std::vector<record_t> records{};
+        //!\brief The exception thrown for the record behind the decoded records, if any.
+        std::exception_ptr error{};
+        //!\brief Signals that the records were decoded.
+        std::promise<void> done{};
+        //!\brief Becomes ready when the records were decoded.
+        std::future<void> decoded{done.get_future()};
+    };
+
+    //!\brief A stream buffer over the bytes of a batch.
+    class batch_streambuf : public std::streambuf
+    {
+    public:
+        //!\brief Constructs the stream buffer over the given bytes.
+        explicit batch_streambuf(std::vector<char> & bytes)
+        {
+            setg(bytes.data(), bytes.data(), bytes.data() + bytes.size());
+        }
+    };
+
+    //!\brief Reads the bytes of the next records into a new batch.
+    std::shared_ptr<batch> read_batch()
+    {
+        auto new_batch = std::make_shared<batch>();
+        std::streambuf & buffer = *stream->rdbuf();
+
+        try
+        {
+            while (new_batch->positions.size() < records_per_batch)
+            {
+                if (std::istream::traits_type::eq_int_type(buffer.sgetc(), std::istream::traits_type::eof()))
+                {
+                    stream_at_end = true;
+                    break;
+                }
+
+                std::streampos const position = stream->tellg();
+
+                int32_t block_size{};
+                if (buffer.sgetn(reinterpret_cast<char *>(&block_size), sizeof(block_size)) != sizeof(block_size))
+                    throw format_error{"Unexpected end of input while reading the size of a BAM record."};
+
+                // The block size does not include itself; the fixed length fields take 32 bytes.
+                if (block_size < 32)
+                    throw format_error{"The BAM record size " + std::to_string(block_size) + " is invalid."};
+
+                size_t const offset = new_batch->bytes.size();
+                new_batch->bytes.resize(offset + sizeof(block_size) + block_size);
+                std::memcpy(new_batch->bytes.data() + offset, &block_size, sizeof(block_size));
+
+                if (buffer.sgetn(new_batch->bytes.data() + offset + sizeof(block_size), block_size) != block_size)
+                    throw format_error{"Unexpected end of input while reading a BAM record."};
+
+                new_batch->positions.push_back(position);
+            }
+        }
+        catch (...)
+        {
+            new_batch->error = std::current_exception();
+            stream_at_end = true;
+        }
+
+        return new_batch;
+    }
+
+    //!\brief Reads and schedules new batches until enough batches are in flight or the stream is at end.
+    void fill_pipeline()
+    {
+        while (!stream_at_end && pending.size() < max_batches_in_flight)
+        {
+            std::shared_ptr<batch> new_batch = read_batch();
+
+            if (new_batch->positions.empty() && !new_batch->error)
+                break;
+
+            pending.push_back(new_batch);
+            thread_pool.execute(
+                [decode = decode](std::shared_ptr<batch> current, auto && callback)
+                {
+                    batch_streambuf buffer{current->bytes};
+                    std::istream batch_stream{&buffer};
+
+                    current->records.resize(current->positions.size());
+                    for (size_t i = 0; i < current->records.size(); ++i)
+                    {
+                        try
+                        {
+                            decode(batch_stream, current->records[i]);
+                        }
+                        catch (...)
+                        {
+                            // An invalid record hides the records and any error behind it.
+                            current->records.resize(i);
+                            current->error = std::current_exception();
+                            break;
+                        }
+                    }
+
+                    callback(*current);
+                },
+                std::move(new_batch),
+                [](batch & current)
+                {
+                    current.done.set_value();
+                });
+        }
+    }
+
+    //!\brief The stream to read the records from.
+    std::istream * stream{};
+    //!\brief The maximal number of batches read ahead.
+    size_t max_batches_in_flight{};
+    //!\brief The function decoding a single record.
+    decode_function_type decode{};
+    //!\brief The batches in flight in the order of the stream.
+    std::deque<std::shared_ptr<batch>> pending{};
+    //!\brief The position of the next record in the front batch.
+    size_t next_record{};
+    //!\brief Whether all records of the stream were read into batches.
+    bool stream_at_end{false};
+    //!\brief The threads decoding the batches; destroyed first to join them before the batches are gone.
+    execution_handler_parallel thread_pool;
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,189 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::bam_record_range.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
+
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/sam_file/bam_record_view.hpp>
+#include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A single-pass view over the records of a BAM stream as seqan3::bam_record_view.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * The stream must be positioned behind the header. Every increment reads the `block_size` of the next record and
+ * returns a seqan3::bam_record_view over its bytes. The bytes are not copied if the record lies within the get area
+ * of the stream buffer, otherwise they are copied into a buffer of the view. Either way, a record view is only valid
+ * until the next increment.
+ *
+ * The iterators store a pointer to the view, i.e. the view must not be moved once iteration has begun.
+ */
+class bam_record_range : public std::ranges::view_interface<bam_record_range>
+{
+private:
+    //!\brief The iterator of the view.
+    class iterator
+    {
+    public:
+        /*!\name Associated types
+         * \{
+         */
+        using value_type = bam_record_view;               //!< The record view type.
+        using reference = bam_record_view const &;        //!< The record view reference type.
+        using difference_type = std::ptrdiff_t;           //!< The difference type.
+        using iterator_concept = std::input_iterator_tag; //!< Tag this class as an input iterator.
+        //!\}
+
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        iterator() = default;                             //!< Defaulted.
+        iterator(iterator const &) = default;             //!< Defaulted.
+        iterator(iterator &&) = default;                  //!< Defaulted.
+        iterator & operator=(iterator const &) = default; //!< Defaulted.
+        iterator & operator=(iterator &&) = default;      //!< Defaulted.
+        ~iterator() = default;                            //!< Defaulted.
+
+        //!\brief Constructs from the view.
+        explicit iterator(bam_record_range & view) noexcept : view{&view}
+        {}
+        //!\}
+
+        //!\brief Moves to the next record.
+        iterator & operator++()
+        {
+            assert(view != nullptr);
+            view->read_next_record();
+            return *this;
+        }
+
+        //!\brief Post-increment is the same as pre-increment, but returns void.
+        void operator++(int)
+        {
+            ++(*this);
+        }
+
+        //!\brief Returns the current record.
+        reference operator*() const noexcept
+        {
+            assert(view != nullptr);
+            return view->record;
+        }
+
+        //!\brief Checks whether the view is exhausted.
+        bool operator==(std::default_sentinel_t const &) const noexcept
+        {
+            assert(view != nullptr);
+            return view->at_end;
+        }
+
+    private:
+        //!\brief The view.
+        bam_record_range * view{};
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_record_range() = default;                                     //!< Defaulted.
+    bam_record_range(bam_record_range const &) = delete;              //!< Deleted, the view is single-pass.
+    bam_record_range(bam_record_range &&) = default;                  //!< Defaulted.
+    bam_record_range & operator=(bam_record_range const &) = delete;  //!< Deleted, the view is single-pass.
+    bam_record_range & operator=(bam_record_range &&) = default;      //!< Defaulted.
+    ~bam_record_range() = default;                                    //!< Defaulted.
+
+    /*!\brief Constructs the view over the records of the given stream.
+     * \param[in] stream          The stream positioned behind the header; must outlive the view.
+     * \param[in] reference_count The number of references in the header, used to validate the reference ids.
+     */
+    bam_record_range(std::istream & stream, size_t const reference_count) :
+        stream{&stream},
+        stream_it{*stream.rdbuf()},
+        reference_count{reference_count}
+    {}
+    //!\}
+
+    //!\brief Reads the first record and returns an iterator to it.
+    iterator begin()
+    {
+        if (!started)
+        {
+            started = true;
+            read_next_record();
+        }
+
+        return iterator{*this};
+    }
+
+    //!\brief Returns the sentinel.
+    std::default_sentinel_t end() const noexcept
+    {
+        return {};
+    }
+
+private:
+    //!\brief Reads the next record into the record view.
+    void read_next_record()
+    {
+        assert(stream != nullptr);
+
+        if (std::istream::traits_type::eq_int_type(stream->rdbuf()->sgetc(), std::istream::traits_type::eof()))
+        {
+            at_end = true;
+            record = bam_record_view{};
+            return;
+        }
+
+        int32_t block_size{};
+        std::memcpy(&block_size, stream_it.cache_bytes(sizeof(block_size)).data(), sizeof(block_size));
+
+        if (block_size < 0)
+            throw format_error{"The BAM record size " + std::to_string(block_size) + " is invalid."};
+
+        record = bam_record_view{stream_it.cache_bytes(block_size)};
+
+        std::optional<int32_t> const reference_id = record.reference_id();
+        if (reference_id && static_cast<size_t>(*reference_id) >= reference_count) // [[unlikely]]
+        {
+            throw format_error{"Reference id index '" + std::to_string(*reference_id)
+                               + "' is not in range of header.ref_ids(), which has size "
+                               + std::to_string(reference_count) + "."};
+        }
+    }
+
+    //!\brief The stream to read from.
+    std::istream * stream{};
+    //!\brief Reads the records from the stream buffer; keeps the buffer for records overlapping the get area.
+    fast_istreambuf_iterator<char> stream_it{};
+    //!\brief The current record.
+    bam_record_view record{};
+    //!\brief The number of references in the header.
+    size_t reference_count{};
+    //!\brief Whether the first record was read.
+    bool started{false};
+    //!\brief Whether the stream is exhausted.
+    bool at_end{false};
+};
+
+} // namespace seqan3::detail
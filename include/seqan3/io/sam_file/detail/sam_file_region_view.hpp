@@ -0,0 +1,243 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::sam_file_region_view.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <ios>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/io/sam_file/bam_index.hpp>
+#include <seqan3/io/sam_file/detail/cigar.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A single-pass view over the records of a BAM file that overlap a region.
+ * \tparam file_type The type of the seqan3::sam_file_input.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * The view seeks to the chunks returned by seqan3::bam_index::query via their virtual file offsets and decodes only
+ * the records of these chunks. Records that do not overlap the region are skipped, and the view ends as soon as a
+ * record begins behind the region, because the file is sorted by coordinate.
+ *
+ * Like the file itself, the view is an input range: all iterators refer to the record buffered by the file. The
+ * iterators store a pointer to the view, i.e. the view must not be moved once iteration has begun.
+ */
+template <typename file_type>
+class sam_file_region_view : public std::ranges::view_interface<sam_file_region_view<file_type>>
+{
+private:
+    //!\brief The iterator of the file.
+    using file_iterator_type = typename file_type::iterator;
+
+    //!\brief The iterator of the view.
+    class iterator
+    {
+    public:
+        /*!\name Associated types
+         * \{
+         */
+        using value_type = typename file_type::value_type;           //!< The record type.
+        using reference = typename file_type::reference;             //!< The record reference type.
+        using difference_type = typename file_type::difference_type; //!< The difference type.
+        using iterator_concept = std::input_iterator_tag;            //!< Tag this class as an input iterator.
+        //!\}
+
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        iterator() = default;                             //!< Defaulted.
+        iterator(iterator const &) = default;             //!< Defaulted.
+        iterator(iterator &&) = default;                  //!< Defaulted.
+        iterator & operator=(iterator const &) = default; //!< Defaulted.
+        iterator & operator=(iterator &&) = default;      //!< Defaulted.
+        ~iterator() = default;                            //!< Defaulted.
+
+        //!\brief Constructs from the view.
+        explicit iterator(sam_file_region_view & view) noexcept : view{&view}
+        {}
+        //!\}
+
+        //!\brief Moves to the next record that overlaps the region.
+        iterator & operator++()
+        {
+            assert(view != nullptr);
+            ++view->file_it;
+            view->find_overlapping_record();
+            return *this;
+        }
+
+        //!\brief Post-increment is the same as pre-increment, but returns void.
+        void operator++(int)
+        {
+            ++(*this);
+        }
+
+        //!\brief Returns the currently buffered record.
+        reference operator*() const noexcept
+        {
+            assert(view != nullptr);
+            return *view->file_it;
+        }
+
+        //!\brief Checks whether the view is exhausted.
+        bool operator==(std::default_sentinel_t const &) const noexcept
+        {
+            assert(view != nullptr);
+            return view->at_end;
+        }
+
+    private:
+        //!\brief The view.
+        sam_file_region_view * view{};
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sam_file_region_view() = default;                                         //!< Defaulted.
+    sam_file_region_view(sam_file_region_view const &) = delete;              //!< Deleted, the view is single-pass.
+    sam_file_region_view(sam_file_region_view &&) = default;                  //!< Defaulted.
+    sam_file_region_view & operator=(sam_file_region_view const &) = delete;  //!< Deleted, the view is single-pass.
+    sam_file_region_view & operator=(sam_file_region_view &&) = default;      //!< Defaulted.
+    ~sam_file_region_view() = default;                                        //!< Defaulted.
+
+    /*!\brief Constructs the view for the given chunks and region.
+     * \param[in] file         The file to read from; its header must have been read.
+     * \param[in] chunks       The chunks that may contain records of the region, see seqan3::bam_index::query.
+     * \param[in] reference_id The reference id of the region.
+     * \param[in] begin        The first position of the region (0-based).
+     * \param[in] end          The position behind the region.
+     */
+    sam_file_region_view(file_type & file,
+                         std::vector<bam_index_chunk> chunks,
+                         int32_t const reference_id,
+                         int64_t const begin,
+                         int64_t const end) :
+        file_it{file.begin()},
+        chunks{std::move(chunks)},
+        reference_id{reference_id},
+        region_begin{begin},
+        region_end{end}
+    {}
+    //!\}
+
+    //!\brief Seeks to the first chunk and returns an iterator to the first record overlapping the region.
+    iterator begin()
+    {
+        if (!started)
+        {
+            started = true;
+
+            if (chunks.empty())
+            {
+                at_end = true;
+            }
+            else
+            {
+                file_it.seek_to(static_cast<std::streamoff>(chunks.front().begin));
+                find_overlapping_record();
+            }
+        }
+
+        return iterator{*this};
+    }
+
+    //!\brief Returns the sentinel.
+    std::default_sentinel_t end() const noexcept
+    {
+        return {};
+    }
+
+private:
+    //!\brief The iterator of the file, all iterators of the file refer to the same record.
+    file_iterator_type file_it{};
+    //!\brief The chunks to decode.
+    std::vector<bam_index_chunk> chunks{};
+    //!\brief The chunk of the current record.
+    size_t current_chunk{};
+    //!\brief The reference id of the region.
+    int32_t reference_id{};
+    //!\brief The first position of the region.
+    int64_t region_begin{};
+    //!\brief The position behind the region.
+    int64_t region_end{};
+    //!\brief Whether begin() has seeked to the first chunk.
+    bool started{false};
+    //!\brief Whether all records of the region have been read.
+    bool at_end{false};
+
+    //!\brief Skips records until the current record overlaps the region, moving on to the next chunk if needed.
+    void find_overlapping_record()
+    {
+        while (true)
+        {
+            if (file_it == std::default_sentinel)
+            {
+                at_end = true;
+                return;
+            }
+
+            uint64_t const position = static_cast<std::streamoff>(file_it.file_position());
+            if (position >= chunks[current_chunk].end)
+            {
+                if (++current_chunk == chunks.size())
+                {
+                    at_end = true;
+                    return;
+                }
+
+                // Adjacent chunks are merged by the index, so a gap always needs a seek.
+                if (position != chunks[current_chunk].begin)
+                    file_it.seek_to(static_cast<std::streamoff>(chunks[current_chunk].begin));
+                continue;
+            }
+
+            auto & record = *file_it;
+            auto const & record_reference_id = record.reference_id();
+            auto const & record_position = record.reference_position();
+
+            // The file is sorted by coordinate, so no later record can overlap the region.
+            if (!record_reference_id || !record_position || *record_reference_id > reference_id
+                || (*record_reference_id == reference_id && *record_position >= region_end))
+            {
+                at_end = true;
+                return;
+            }
+
+            if (*record_reference_id == reference_id && record_end(record) > region_begin)
+                return;
+
+            ++file_it;
+        }
+    }
+
+    //!\brief Returns the position behind the last reference position covered by the record.
+    template <typename record_type>
+    static int64_t record_end(record_type & record)
+    {
+        int32_t reference_length{};
+        int32_t sequence_length{};
+        for (auto && [count, operation] : record.cigar_sequence())
+            update_alignment_lengths(reference_length, sequence_length, operation.to_char(), count);
+
+        return *record.reference_position() + std::max<int32_t>(reference_length, 1);
+    }
+};
+
+} // namespace seqan3::detail
@@ -14,6 +14,7 @@
 
 #include <bit>
 #include <cstring>
+#include <filesystem>
 #include <iterator>
 #include <ranges>
 #include <string>
@@ -21,6 +22,7 @@
 
 #include <seqan3/alphabet/nucleotide/dna16sam.hpp>
 #include <seqan3/core/debug_stream/optional.hpp>
+#include <seqan3/io/sam_file/bam_index.hpp>
 #include <seqan3/io/sam_file/detail/cigar.hpp>
 #include <seqan3/io/sam_file/detail/format_sam_base.hpp>
 #include <seqan3/io/sam_file/header.hpp>
@@ -35,6 +37,8 @@
 namespace seqan3
 {
 
+class bam_record_view;
+
 /*!\brief       The BAM format.
  * \implements  AlignmentFileFormat
  * \ingroup io_sam_file
@@ -132,13 +136,25 @@ protected:
                                 [[maybe_unused]] double SEQAN3_DOXYGEN_ONLY(bit_score));
 
     //!\privatesection
+    template <typename stream_type, typename ref_seqs_type, typename ref_ids_type>
+    void read_bam_header(stream_type & stream, ref_seqs_type & ref_seqs, sam_file_header<ref_ids_type> & header);
+
     template <typename stream_t, typename header_type>
     void write_header(stream_t & stream, sam_file_output_options const & options, header_type & header);
 
+    template <typename stream_t>
+    void write_index(stream_t & stream, sam_file_output_options const & options, std::filesystem::path file_name);
+
 private:
+    //!\brief Befriend seqan3::bam_record_view to decode its tags.
+    friend bam_record_view;
+
     //!\brief A variable that tracks whether the content of header has been read or not.
     bool header_was_read{false};
 
+    //!\brief The index of the written records if seqan3::sam_file_output_options::write_bam_index is set.
+    bam_index record_index{};
+
     //!\brief Local buffer to read into while avoiding reallocation.
     std::string string_buffer{};
 
@@ -237,13 +253,103 @@ private:
                                  std::string_view const str,
                                  value_type const & SEQAN3_DOXYGEN_ONLY(value));
 
-    void read_sam_dict(std::string_view const tag_str, sam_tag_dictionary & target);
+    template <typename tag_dict_type>
+    void read_sam_dict(std::string_view const tag_str, tag_dict_type & target);
 
     std::vector<cigar> parse_binary_cigar(std::string_view const cigar_str) const;
 
-    static std::string get_tag_dict_str(sam_tag_dictionary const & tag_dict);
+    template <typename tag_dict_type>
+    static std::string get_tag_dict_str(tag_dict_type const & tag_dict);
 };
 
+/*!\brief Reads the header of a BAM file, i.e. everything in front of the first record.
+ * \param[in, out] stream   The stream to read from.
+ * \param[in]      ref_seqs The reference sequences given on construction of the file or std::ignore.
+ * \param[in, out] header   The header to fill or to check against the reference information.
+ * \throws seqan3::format_error if the stream is not a BAM file or its references do not match the given ones.
+ */
+template <typename stream_type, typename ref_seqs_type, typename ref_ids_type>
+inline void format_bam::read_bam_header(stream_type & stream,
+                                        ref_seqs_type & ref_seqs,
+                                        sam_file_header<ref_ids_type> & header)
+{
+    auto stream_view = seqan3::detail::istreambuf(stream);
+
+    // magic BAM string
+    if (!std::ranges::equal(stream_view | detail::take_exactly_or_throw(4), std::string_view{"BAM\1"}))
+        throw format_error{"File is not in BAM format."};
+
+    int32_t l_text{}; // length of header text including \0 character
+    int32_t n_ref{};  // number of reference sequences
+    int32_t l_name{}; // 1 + length of reference name including \0 character
+    int32_t l_ref{};  // length of reference sequence
+
+    read_integral_byte_field(stream_view, l_text);
+
+    if (l_text > 0) // header text is present
+        read_header(stream_view | detail::take_exactly_or_throw(l_text), header, ref_seqs);
+
+    read_integral_byte_field(stream_view, n_ref);
+
+    for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
+    {
+        read_integral_byte_field(stream_view, l_name);
+
+        string_buffer.resize(l_name - 1);
+        std::ranges::copy_n(std::ranges::begin(stream_view),
+                            l_name - 1,
+                            string_buffer.data()); // copy without \0 character
+        ++std::ranges::begin(stream_view);         // skip \0 character
+
+        read_integral_byte_field(stream_view, l_ref);
+
+        if constexpr (detail::decays_to_ignore_v<ref_seqs_type>) // no reference information given
+        {
+            // If there was no header text, we parse reference sequences block as header information
+            if (l_text == 0)
+            {
+                auto & reference_ids = header.ref_ids();
+                // put the length of the reference sequence into ref_id_info
+                header.ref_id_info.emplace_back(l_ref, "");
+                // put the reference name into reference_ids
+                reference_ids.push_back(string_buffer);
+                // assign the reference name an ascending reference id (starts at index 0).
+                header.ref_dict.emplace(reference_ids.back(), reference_ids.size() - 1);
+                continue;
+            }
+        }
+
+        auto id_it = header.ref_dict.find(string_buffer);
+
+        // sanity checks of reference information to existing header object:
+        if (id_it == header.ref_dict.end()) // [unlikely]
+        {
+            throw format_error{detail::to_string("Unknown reference name '" + string_buffer
+                                                     + "' found in BAM file header (header.ref_ids():",
+                                                 header.ref_ids(),
+                                                 ").")};
+        }
+        else if (id_it->second != ref_idx) // [unlikely]
+        {
+            throw format_error{detail::to_string("Reference id '",
+                                                 string_buffer,
+                                                 "' at position ",
+                                                 ref_idx,
+                                                 " does not correspond to the position ",
+                                                 id_it->second,
+                                                 " in the header (header.ref_ids():",
+                                                 header.ref_ids(),
+                                                 ").")};
+        }
+        else if (std::get<0>(header.ref_id_info[id_it->second]) != l_ref) // [unlikely]
+        {
+            throw format_error{"Provided reference has unequal length as specified in the header."};
+        }
+    }
+
+    header_was_read = true;
+}
+
 //!\copydoc seqan3::sam_file_input_format::read_alignment_record
 template <typename stream_type, // constraints checked by file
           typename seq_legal_alph_type,
@@ -293,86 +399,13 @@ format_bam::read_alignment_record(stream_type & stream,
     static_assert(detail::decays_to_ignore_v<flag_type> || std::same_as<flag_type, sam_flag>,
                   "The type of field::flag must be seqan3::sam_flag.");
 
-    auto stream_view = seqan3::detail::istreambuf(stream);
-
     // Header
     // -------------------------------------------------------------------------------------------------------------
     if (!header_was_read)
     {
-        // magic BAM string
-        if (!std::ranges::equal(stream_view | detail::take_exactly_or_throw(4), std::string_view{"BAM\1"}))
-            throw format_error{"File is not in BAM format."};
-
-        int32_t l_text{}; // length of header text including \0 character
-        int32_t n_ref{};  // number of reference sequences
-        int32_t l_name{}; // 1 + length of reference name including \0 character
-        int32_t l_ref{};  // length of reference sequence
-
-        read_integral_byte_field(stream_view, l_text);
-
-        if (l_text > 0) // header text is present
-            read_header(stream_view | detail::take_exactly_or_throw(l_text), header, ref_seqs);
-
-        read_integral_byte_field(stream_view, n_ref);
-
-        for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
-        {
-            read_integral_byte_field(stream_view, l_name);
-
-            string_buffer.resize(l_name - 1);
-            std::ranges::copy_n(std::ranges::begin(stream_view),
-                                l_name - 1,
-                                string_buffer.data()); // copy without \0 character
-            ++std::ranges::begin(stream_view);         // skip \0 character
-
-            read_integral_byte_field(stream_view, l_ref);
-
-            if constexpr (detail::decays_to_ignore_v<ref_seqs_type>) // no reference information given
-            {
-                // If there was no header text, we parse reference sequences block as header information
-                if (l_text == 0)
-                {
-                    auto & reference_ids = header.ref_ids();
-                    // put the length of the reference sequence into ref_id_info
-                    header.ref_id_info.emplace_back(l_ref, "");
-                    // put the reference name into reference_ids
-                    reference_ids.push_back(string_buffer);
-                    // assign the reference name an ascending reference id (starts at index 0).
-                    header.ref_dict.emplace(reference_ids.back(), reference_ids.size() - 1);
-                    continue;
-                }
-            }
-
-            auto id_it = header.ref_dict.find(string_buffer);
-
-            // sanity checks of reference information to existing header object:
-            if (id_it == header.ref_dict.end()) // [unlikely]
-            {
-                throw format_error{detail::to_string("Unknown reference name '" + string_buffer
-                                                         + "' found in BAM file header (header.ref_ids():",
-                                                     header.ref_ids(),
-                                                     ").")};
-            }
-            else if (id_it->second != ref_idx) // [unlikely]
-            {
-                throw format_error{detail::to_string("Reference id '",
-                                                     string_buffer,
-                                                     "' at position ",
-                                                     ref_idx,
-                                                     " does not correspond to the position ",
-                                                     id_it->second,
-                                                     " in the header (header.ref_ids():",
-                                                     header.ref_ids(),
-                                                     ").")};
-            }
-            else if (std::get<0>(header.ref_id_info[id_it->second]) != l_ref) // [unlikely]
-            {
-                throw format_error{"Provided reference has unequal length as specified in the header."};
-            }
-        }
-
-        header_was_read = true;
+        read_bam_header(stream, ref_seqs, header);
 
+        auto stream_view = seqan3::detail::istreambuf(stream);
         if (std::ranges::begin(stream_view) == std::ranges::end(stream_view)) // no records follow
             return;
     }
@@ -594,8 +627,10 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type & st
         "2) a std::integral or std::optional<std::integral>, and "
         "3) a std::integral.");
 
-    static_assert(std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary>,
-                  "The tag_dict object must be of type seqan3::sam_tag_dictionary.");
+    static_assert(std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary>
+                      || std::same_as<std::remove_cvref_t<tag_dict_type>, flat_sam_tag_dictionary>,
+                  "The tag_dict object must be of type seqan3::sam_tag_dictionary or "
+                  "seqan3::flat_sam_tag_dictionary.");
 
     if constexpr (detail::decays_to_ignore_v<header_type>)
     {
@@ -624,6 +659,10 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type & st
             header_was_written = true;
         }
 
+        // The offsets in the uncompressed stream are translated to virtual offsets by write_index().
+        bool const index_record = options.write_bam_index != bam_index_format::none;
+        uint64_t const record_begin = index_record ? static_cast<uint64_t>(stream.tellp()) : 0u;
+
         // ---------------------------------------------------------------------
         // Writing the Record
         // ---------------------------------------------------------------------
@@ -794,6 +833,15 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type & st
 
         // write optional fields
         stream << tag_dict_binary_str;
+
+        if (index_record)
+        {
+            record_index.insert(core.refID,
+                                core.pos,
+                                core.pos + ref_length,
+                                !static_cast<bool>(flag & sam_flag::unmapped),
+                                bam_index_chunk{record_begin, static_cast<uint64_t>(stream.tellp())});
+        }
     } // if constexpr (!detail::decays_to_ignore_v<header_type>)
 }
 
@@ -810,6 +858,36 @@ inline void format_bam::write_header(stream_t & stream, sam_file_output_options
     }
     else
     {
+        if (options.write_bam_index != bam_index_format::none)
+        {
+#if defined(SEQAN3_HAS_ZLIB)
+            bool const is_bgzf = dynamic_cast<contrib::basic_bgzf_ostreambuf<char> *>(stream.rdbuf()) != nullptr;
+#else
+            bool const is_bgzf = false;
+#endif
+            if (!is_bgzf)
+                throw format_error{"A BAM index can only be written for BGZF compressed output."};
+
+            // Like htslib, choose the smallest CSI depth that covers the longest reference.
+            int64_t max_length{};
+            for (auto const & [length, tags] : header.ref_id_info)
+                max_length = std::max<int64_t>(max_length, length);
+
+            uint8_t depth{5};
+            if (options.write_bam_index == bam_index_format::csi)
+            {
+                depth = 0;
+                for (int64_t span = int64_t{1} << 14; max_length + 256 > span; span <<= 3)
+                    ++depth;
+            }
+            else if (max_length > (int64_t{1} << 29))
+            {
+                throw format_error{"A BAI index supports references of up to 2^29 bases. Write a CSI index instead."};
+            }
+
+            record_index = bam_index{header.ref_ids().size(), 14, depth};
+        }
+
         detail::fast_ostreambuf_iterator stream_it{*stream.rdbuf()};
 
         std::ranges::copy_n("BAM\1", 4, stream_it); // Do not copy the null terminator
@@ -849,6 +927,43 @@ inline void format_bam::write_header(stream_t & stream, sam_file_output_options
     }
 }
 
+/*!\brief Writes the index of all written records next to the BAM file.
+ * \tparam stream_t The type of the output stream.
+ * \param[in, out] stream  The BGZF compressed output stream; all data is flushed.
+ * \param[in]      options The file options; seqan3::sam_file_output_options::write_bam_index selects the index format.
+ * \param[in]      file_name The path of the BAM file; the index is written to `<file_name>.bai` or
+ *                          `<file_name>.csi`.
+ *
+ * \details
+ *
+ * While writing, the records are indexed by their offsets in the uncompressed stream. Once all blocks are compressed
+ * and written, these offsets are translated to the virtual offsets of the BGZF file.
+ */
+template <typename stream_t>
+inline void
+format_bam::write_index(stream_t & stream, sam_file_output_options const & options, std::filesystem::path file_name)
+{
+#if defined(SEQAN3_HAS_ZLIB)
+    auto * bgzf_buffer = dynamic_cast<contrib::basic_bgzf_ostreambuf<char> *>(stream.rdbuf());
+    if (bgzf_buffer == nullptr)
+        throw format_error{"A BAM index can only be written for BGZF compressed output."};
+
+    stream.flush();       // compress the last block
+    bgzf_buffer->flush(); // wait until all blocks are written
+
+    record_index.transform_offsets(
+        [bgzf_buffer](uint64_t const offset)
+        {
+            return bgzf_buffer->virtualOffset(offset);
+        });
+
+    file_name += (options.write_bam_index == bam_index_format::csi) ? ".csi" : ".bai";
+    record_index.write(file_name);
+#else
+    throw format_error{"A BAM index can only be written for BGZF compressed output."};
+#endif
+}
+
 /*!\brief Reads a list of values separated by comma as it is the case for SAM tag arrays.
  * \tparam value_type       The type of values to be stored in the tag array.
  *
@@ -910,6 +1025,7 @@ inline int32_t format_bam::read_sam_dict_vector(seqan3::detail::sam_tag_variant
 }
 
 /*!\brief Reads the optional tag fields into the seqan3::sam_tag_dictionary.
+ * \tparam tag_dict_type        seqan3::sam_tag_dictionary or seqan3::flat_sam_tag_dictionary.
  * \param[in, out] tag_str      The string_view to parse.
  * \param[out]     target       The seqan3::sam_tag_dictionary to store the tag information.
  *
@@ -924,7 +1040,8 @@ inline int32_t format_bam::read_sam_dict_vector(seqan3::detail::sam_tag_variant
  * format is not in a correct state (e.g. required fields are not given), but throwing might occur downstream of
  * the actual error.
  */
-inline void format_bam::read_sam_dict(std::string_view const tag_str, sam_tag_dictionary & target)
+template <typename tag_dict_type>
+inline void format_bam::read_sam_dict(std::string_view const tag_str, tag_dict_type & target)
 {
     /* Every BAM tag has the format "[TAG][TYPE_ID][VALUE]", where TAG is a two letter
        name tag which is converted to a unique integer identifier and TYPE_ID is one character in [A,i,Z,H,B,f]
@@ -1134,9 +1251,11 @@ inline std::vector<cigar> format_bam::parse_binary_cigar(std::string_view const
 }
 
 /*!\brief Writes the optional fields of the seqan3::sam_tag_dictionary.
+ * \tparam tag_dict_type seqan3::sam_tag_dictionary or seqan3::flat_sam_tag_dictionary.
  * \param[in] tag_dict The tag dictionary to print.
  */
-inline std::string format_bam::get_tag_dict_str(sam_tag_dictionary const & tag_dict)
+template <typename tag_dict_type>
+inline std::string format_bam::get_tag_dict_str(tag_dict_type const & tag_dict)
 {
     std::string result{};
 
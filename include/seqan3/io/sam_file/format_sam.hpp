@@ -248,7 +248,8 @@ private:
 
     void read_sam_byte_vector(seqan3::detail::sam_tag_variant & variant, std::string_view const str);
 
-    void read_sam_dict(std::string_view const tag_str, sam_tag_dictionary & target);
+    template <typename tag_dict_type>
+    void read_sam_dict(std::string_view const tag_str, tag_dict_type & target);
 
     template <typename stream_it_t, std::ranges::forward_range field_type>
     void write_range_or_asterisk(stream_it_t & stream_it, field_type && field_value);
@@ -256,8 +257,8 @@ private:
     template <typename stream_it_t>
     void write_range_or_asterisk(stream_it_t & stream_it, char const * const field_value);
 
-    template <typename stream_it_t>
-    void write_tag_fields(stream_it_t & stream, sam_tag_dictionary const & tag_dict, char const separator);
+    template <typename stream_it_t, typename tag_dict_type>
+    void write_tag_fields(stream_it_t & stream, tag_dict_type const & tag_dict, char const separator);
 };
 
 //!\copydoc sequence_file_input_format::read_sequence_record
@@ -638,8 +639,10 @@ inline void format_sam::write_alignment_record(stream_type & stream,
         static_assert(!detail::decays_to_ignore_v<header_type>,
                       "If you give indices as mate reference id information the header must also be present.");
 
-    static_assert(std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary>,
-                  "The tag_dict object must be of type seqan3::sam_tag_dictionary.");
+    static_assert(std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary>
+                      || std::same_as<std::remove_cvref_t<tag_dict_type>, flat_sam_tag_dictionary>,
+                  "The tag_dict object must be of type seqan3::sam_tag_dictionary or "
+                  "seqan3::flat_sam_tag_dictionary.");
 
     // ---------------------------------------------------------------------
     // logical Requirements
@@ -871,6 +874,7 @@ inline void format_sam::read_sam_byte_vector(seqan3::detail::sam_tag_variant & v
 }
 
 /*!\brief Reads the optional tag fields into the seqan3::sam_tag_dictionary.
+ * \tparam tag_dict_type        seqan3::sam_tag_dictionary or seqan3::flat_sam_tag_dictionary.
  * \param[in, out] tag_str      The string_view to parse for the sam_tag_dictionary entries.
  * \param[in, out] target       The seqan3::sam_tag_dictionary to store the tag information.
  *
@@ -885,7 +889,8 @@ inline void format_sam::read_sam_byte_vector(seqan3::detail::sam_tag_variant & v
  * format is not in a correct state (e.g. required fields are not given), but throwing might occur downstream of
  * the actual error.
  */
-inline void format_sam::read_sam_dict(std::string_view const tag_str, sam_tag_dictionary & target)
+template <typename tag_dict_type>
+inline void format_sam::read_sam_dict(std::string_view const tag_str, tag_dict_type & target)
 {
     /* Every SAM tag has the format "[TAG]:[TYPE_ID]:[VALUE]", where TAG is a two letter
        name tag which is converted to a unique integer identifier and TYPE_ID is one character in [A,i,Z,H,B,f]
@@ -1010,14 +1015,15 @@ inline void format_sam::write_range_or_asterisk(stream_it_t & stream_it, char co
 
 /*!\brief Writes the optional fields of the seqan3::sam_tag_dictionary.
  * \tparam stream_it_t      The stream iterator's type.
+ * \tparam tag_dict_type    seqan3::sam_tag_dictionary or seqan3::flat_sam_tag_dictionary.
  *
  * \param[in,out] stream_it The stream iterator to print to.
  * \param[in]     tag_dict  The tag dictionary to print.
  * \param[in]     separator The field separator to append.
  */
-template <typename stream_it_t>
+template <typename stream_it_t, typename tag_dict_type>
 inline void
-format_sam::write_tag_fields(stream_it_t & stream_it, sam_tag_dictionary const & tag_dict, char const separator)
+format_sam::write_tag_fields(stream_it_t & stream_it, tag_dict_type const & tag_dict, char const separator)
 {
     auto const stream_variant_fn = [&stream_it](auto && arg) // helper to print a std::variant
     {
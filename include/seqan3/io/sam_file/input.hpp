@@ -13,11 +13,16 @@
 #pragma once
 
 #include <cassert>
+#include <charconv>
 #include <concepts>
 #include <filesystem>
 #include <fstream>
+#include <limits>
+#include <optional>
 #include <ranges>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -32,6 +37,11 @@
 #include <seqan3/io/detail/misc_input.hpp>
 #include <seqan3/io/detail/record.hpp>
 #include <seqan3/io/exception.hpp>
+#include <seqan3/io/sam_file/bam_index.hpp>
+#include <seqan3/io/sam_file/bam_record_view.hpp>
+#include <seqan3/io/sam_file/detail/bam_record_batch_decoder.hpp>
+#include <seqan3/io/sam_file/detail/bam_record_range.hpp>
+#include <seqan3/io/sam_file/detail/sam_file_region_view.hpp>
 #include <seqan3/io/sam_file/format_bam.hpp>
 #include <seqan3/io/sam_file/format_sam.hpp>
 #include <seqan3/io/sam_file/input_format_concept.hpp>
@@ -107,6 +117,13 @@ namespace seqan3
  *            manually configured in order to allow for automatic type deduction from reference information input on
  *            construction.
  */
+/*!\typedef using tag_dictionary
+ * \brief The type of seqan3::field::tags; seqan3::sam_tag_dictionary or seqan3::flat_sam_tag_dictionary.
+ *
+ * \details
+ *
+ * This member type is optional, seqan3::sam_tag_dictionary is used if it is not defined.
+ */
 //!\}
 //!\cond
 template <typename t>
@@ -141,6 +158,11 @@ concept sam_file_input_traits =
         requires std::ranges::forward_range<std::ranges::range_reference_t<typename t::ref_ids>>;
         requires std::ranges::forward_range<typename t::ref_ids>;
 
+        // field::tags
+        requires !requires { typename t::tag_dictionary; }
+                     || std::same_as<typename t::tag_dictionary, sam_tag_dictionary>
+                     || std::same_as<typename t::tag_dictionary, flat_sam_tag_dictionary>;
+
         // field::ref_offset is fixed to std::optional<int32_t>
         // field::flag is fixed to seqan3::sam_flag
         // field::mapq is fixed to uint8_t
@@ -203,9 +225,41 @@ struct sam_file_input_default_traits
 
     //!\brief The type of the reference identifiers is deduced on construction.
     using ref_ids = ref_ids_t;
+
+    //!\brief The optional SAM fields are stored in a seqan3::sam_tag_dictionary.
+    using tag_dictionary = sam_tag_dictionary;
     //!\}
 };
 
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief The type of seqan3::field::tags of a seqan3::sam_file_input with the traits `traits_t`.
+ * \ingroup io_sam_file
+ * \tparam traits_t A type that models seqan3::sam_file_input_traits.
+ *
+ * \details
+ *
+ * The `tag_dictionary` member type of the traits is optional, seqan3::sam_tag_dictionary is the default.
+ */
+template <typename traits_t>
+struct sam_file_input_tag_dictionary : std::type_identity<sam_tag_dictionary>
+{};
+
+//!\cond
+template <typename traits_t>
+    requires requires { typename traits_t::tag_dictionary; }
+struct sam_file_input_tag_dictionary<traits_t> : std::type_identity<typename traits_t::tag_dictionary>
+{};
+//!\endcond
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
 // ---------------------------------------------------------------------------------------------------------------------
 // sam_file_input
 // ---------------------------------------------------------------------------------------------------------------------
@@ -315,6 +369,8 @@ public:
     using mate_type = std::tuple<ref_id_type, ref_offset_type, int32_t>;
     //!\brief The type of field::header_ptr (default: sam_file_header<typename traits_type::ref_ids>).
     using header_type = sam_file_header<typename traits_type::ref_ids>;
+    //!\brief The type of field::tags (default seqan3::sam_tag_dictionary).
+    using tag_dictionary_type = typename detail::sam_file_input_tag_dictionary<traits_type>::type;
 
     //!\brief The previously defined types aggregated in a seqan3::type_list.
     using field_types = type_list<sequence_type,
@@ -326,7 +382,7 @@ public:
                                   quality_type,
                                   flag_type,
                                   mate_type,
-                                  sam_tag_dictionary,
+                                  tag_dictionary_type,
                                   header_type *>;
 
     /*!\brief The subset of seqan3::field tags valid for this file; order corresponds to the types in \ref field_types.
@@ -708,12 +764,181 @@ public:
         return *header_ptr;
     }
 
+    /*!\name Region queries
+     * \brief Provides reading only the records of a BAM file that overlap a region of a reference.
+     * \{
+     */
+    /*!\brief Loads the BAI or CSI index that is used by region().
+     * \param[in] index_file_name The path of the index.
+     * \throws seqan3::file_open_error if the file cannot be opened.
+     * \throws seqan3::format_error if the file is neither a valid BAI nor a valid CSI index.
+     *
+     * \details
+     *
+     * This is only needed if the index is not stored next to the BAM file (`<file>.bam.bai`, `<file>.bam.csi` or
+     * `<file>.bai`) or if the file was constructed from a stream.
+     */
+    void load_index(std::filesystem::path const & index_file_name)
+    {
+        index = bam_index{index_file_name};
+    }
+
+    /*!\brief Returns the records that overlap a region.
+     * \param[in] reference_name The name of the reference as given in the header.
+     * \param[in] begin          The first position of the region (0-based).
+     * \param[in] end            The position behind the region.
+     * \returns A single-pass std::ranges::input_range over the records that overlap [begin, end).
+     * \throws std::invalid_argument if the reference name is unknown.
+     * \throws seqan3::file_open_error if no index was loaded and none is found next to the file.
+     * \throws seqan3::format_error if the file is not a BAM file.
+     *
+     * \details
+     *
+     * The coordinate sorted BAM file needs a BAI or CSI index, e.g. written by seqan3::sam_file_output with
+     * seqan3::sam_file_output_options::write_bam_index. Unless an index was set with load_index(), it is loaded from
+     * `<file>.bam.bai`, `<file>.bam.csi` or `<file>.bai` on the first query.
+     *
+     * Only the chunks of the file that the index reports for the region are decompressed and decoded, by seeking to
+     * their BGZF virtual file offsets. A record overlaps the region if the reference span of its alignment, computed
+     * from field::cigar, intersects [begin, end).
+     *
+     * The returned range reads from this file, i.e. iterating it changes the current record of the file, and it must
+     * not outlive the file. Several regions may be queried one after another.
+     *
+     * ### Example
+     *
+     * \include test/snippet/io/sam_file/sam_file_input_region.cpp
+     */
+    auto region(std::string_view const reference_name, int64_t const begin, int64_t const end)
+    {
+        static_assert(selected_field_ids::contains(field::ref_id) && selected_field_ids::contains(field::ref_offset)
+                          && selected_field_ids::contains(field::cigar),
+                      "Region queries require the fields field::ref_id, field::ref_offset and field::cigar.");
+
+        if constexpr (list_traits::contains<format_bam, valid_formats>)
+        {
+            if (!std::holds_alternative<detail::sam_file_input_format_exposer<format_bam>>(format))
+                throw format_error{"Region queries are only supported for BAM files."};
+        }
+        else
+        {
+            throw format_error{"Region queries are only supported for BAM files."};
+        }
+
+        int32_t const reference_id = find_reference_id(reference_name);
+
+        if (!index)
+            load_index_next_to_file();
+
+        return detail::sam_file_region_view<sam_file_input>{*this,
+                                                            index->query(reference_id, begin, end),
+                                                            reference_id,
+                                                            begin,
+                                                            end};
+    }
+
+    /*!\brief Returns the records that overlap a region given in the samtools notation.
+     * \param[in] region_string The region as `reference`, `reference:begin` or `reference:begin-end` with
+     *                          1-based, inclusive positions, e.g. `chr1:1001-2000`.
+     * \returns A single-pass std::ranges::input_range over the records that overlap the region.
+     * \throws std::invalid_argument if the region cannot be parsed or the reference name is unknown.
+     *
+     * \details
+     *
+     * See the overload above for details. If the whole string is the name of a reference, the region spans the whole
+     * reference, even if the name contains a colon.
+     */
+    auto region(std::string_view const region_string)
+    {
+        int64_t begin{0};
+        int64_t end{std::numeric_limits<int32_t>::max()};
+        std::string_view reference_name = region_string;
+
+        size_t const colon = region_string.rfind(':');
+        if (colon != std::string_view::npos && !has_reference(region_string))
+        {
+            reference_name = region_string.substr(0, colon);
+            std::string_view const range = region_string.substr(colon + 1);
+
+            auto parse_position = [&region_string](std::string_view const str)
+            {
+                int64_t position{};
+                auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), position);
+                if (ec != std::errc{} || ptr != str.data() + str.size() || position < 1)
+                    throw std::invalid_argument{"Invalid region " + std::string{region_string} + "."};
+                return position;
+            };
+
+            size_t const dash = range.find('-');
+            begin = parse_position(range.substr(0, dash)) - 1;
+            if (dash != std::string_view::npos)
+                end = parse_position(range.substr(dash + 1));
+        }
+
+        return region(reference_name, begin, end);
+    }
+    //!\}
+
+    /*!\name Lazy records
+     * \{
+     */
+    /*!\brief Returns the records of a BAM file as seqan3::bam_record_view, which decode their fields on access.
+     * \returns A single-pass std::ranges::input_range over seqan3::bam_record_view.
+     * \throws seqan3::format_error if the file is not a BAM file or its header is invalid.
+     * \throws std::logic_error if the header or a record was already read.
+     *
+     * \details
+     *
+     * The header is read immediately and can be accessed with header() afterwards. The returned range only splits
+     * the decompressed stream into records; the fields of a record are decoded when they are accessed. This makes
+     * passes that only look at a few fields, e.g. filtering by flag(), reference_position() or mapping_quality(),
+     * much faster than reading seqan3::sam_record objects. A record view is only valid until the next record is read.
+     *
+     * The file is read either via this range or via begin() and end(): the file itself is at end after calling this
+     * function. The returned range must not outlive the file.
+     *
+     * ### Example
+     *
+     * \include test/snippet/io/sam_file/sam_file_input_bam_records.cpp
+     */
+    detail::bam_record_range bam_records()
+    {
+        if constexpr (list_traits::contains<format_bam, valid_formats>)
+        {
+            auto * bam = std::get_if<detail::sam_file_input_format_exposer<format_bam>>(&format);
+
+            if (bam == nullptr)
+                throw format_error{"Lazy records are only supported for BAM files."};
+
+            if (first_record_was_read)
+                throw std::logic_error{"bam_records() must be called before the header or a record is read."};
+
+            if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
+                bam->read_bam_header(*secondary_stream, *reference_sequences_ptr, *header_ptr);
+            else
+                bam->read_bam_header(*secondary_stream, std::ignore, *header_ptr);
+
+            // From now on, the records are only read by the returned range.
+            first_record_was_read = true;
+            at_end = true;
+
+            return detail::bam_record_range{*secondary_stream, std::ranges::size(header_ptr->ref_ids())};
+        }
+        else
+        {
+            throw format_error{"Lazy records are only supported for BAM files."};
+        }
+    }
+    //!\}
+
 protected:
     //!\privatesection
 
     //!/brief Initialisation based on a filename.
     void init_by_filename(std::filesystem::path filename)
     {
+        file_name = filename;
+
         primary_stream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
         static_cast<std::basic_ifstream<char> *>(primary_stream.get())
             ->open(filename, std::ios_base::in | std::ios::binary);
@@ -770,6 +995,13 @@ protected:
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
 
+    //!\brief The path of the file if constructed from a file name; used to find the index.
+    std::filesystem::path file_name{};
+    //!\brief The index used by region(), loaded on the first query.
+    std::optional<bam_index> index{};
+    //!\brief Decodes the BAM records on seqan3::sam_file_input_options::bam_decode_thread_count threads.
+    std::optional<detail::bam_record_batch_decoder<record_type>> record_decoder{};
+
     //!\brief Tracks whether the very first record is buffered when calling begin().
     bool first_record_was_read{false};
     //!\brief File is one position behind the last record.
@@ -831,6 +1063,17 @@ protected:
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
+        // The header is always read on this thread, all following BAM records may be decoded in parallel.
+        if constexpr (list_traits::contains<format_bam, valid_formats>)
+        {
+            if (first_record_was_read && options.bam_decode_thread_count > 0
+                && std::holds_alternative<detail::sam_file_input_format_exposer<format_bam>>(format))
+            {
+                read_next_decoded_record();
+                return;
+            }
+        }
+
         // clear the record
         record_buffer.clear();
         detail::get_or_ignore<field::header_ptr>(record_buffer) = header_ptr.get();
@@ -843,41 +1086,146 @@ protected:
             return;
         }
 
-        auto call_read_func = [this](auto & ref_seq_info)
+        assert(!format.valueless_by_exception());
+
+        std::visit(
+            [&](auto & f)
+            {
+                read_record(f,
+                            *secondary_stream,
+                            options,
+                            *header_ptr,
+                            reference_sequences_ptr,
+                            position_buffer,
+                            record_buffer);
+            },
+            format);
+    }
+
+    //!\brief Moves the next record decoded by the seqan3::detail::bam_record_batch_decoder into the buffer.
+    void read_next_decoded_record()
+    {
+        if (!record_decoder)
         {
-            std::visit(
-                [&](auto & f)
+            // Every batch is decoded with its own copy of the format, whose header has already been read.
+            record_decoder.emplace(
+                *secondary_stream,
+                options.bam_decode_thread_count,
+                [format = std::get<detail::sam_file_input_format_exposer<format_bam>>(format),
+                 options = options,
+                 header = header_ptr.get(),
+                 reference_sequences = reference_sequences_ptr](std::basic_istream<stream_char_type> & stream,
+                                                                 record_type & record) mutable
                 {
-                    f.read_alignment_record(*secondary_stream,
-                                            options,
-                                            ref_seq_info,
-                                            *header_ptr,
-                                            position_buffer,
-                                            detail::get_or_ignore<field::seq>(record_buffer),
-                                            detail::get_or_ignore<field::qual>(record_buffer),
-                                            detail::get_or_ignore<field::id>(record_buffer),
-                                            detail::get_or_ignore<field::ref_seq>(record_buffer),
-                                            detail::get_or_ignore<field::ref_id>(record_buffer),
-                                            detail::get_or_ignore<field::ref_offset>(record_buffer),
-                                            detail::get_or_ignore<field::cigar>(record_buffer),
-                                            detail::get_or_ignore<field::flag>(record_buffer),
-                                            detail::get_or_ignore<field::mapq>(record_buffer),
-                                            detail::get_or_ignore<field::mate>(record_buffer),
-                                            detail::get_or_ignore<field::tags>(record_buffer),
-                                            detail::get_or_ignore<field::evalue>(record_buffer),
-                                            detail::get_or_ignore<field::bit_score>(record_buffer));
-                },
-                format);
-        };
+                    std::streampos position{};
+                    detail::get_or_ignore<field::header_ptr>(record) = header;
+                    read_record(format, stream, options, *header, reference_sequences, position, record);
+                });
+        }
 
-        assert(!format.valueless_by_exception());
+        if (!record_decoder->next(record_buffer, position_buffer))
+        {
+            record_buffer.clear();
+            at_end = true;
+        }
+    }
+
+    //!\brief Discards the records read ahead by the seqan3::detail::bam_record_batch_decoder before seeking.
+    void discard_read_ahead_records()
+    {
+        if (record_decoder)
+            record_decoder->reset();
+    }
+
+    //!\brief Reads a single record with the given format from the given stream into the given record.
+    template <typename format_t>
+    static void read_record(format_t & format,
+                            std::basic_istream<stream_char_type> & stream,
+                            sam_file_input_options<typename traits_type::sequence_legal_alphabet> const & options,
+                            header_type & header,
+                            typename traits_type::ref_sequences const * reference_sequences,
+                            std::streampos & position,
+                            record_type & record)
+    {
+        auto call_read_func = [&](auto & ref_seq_info)
+        {
+            format.read_alignment_record(stream,
+                                         options,
+                                         ref_seq_info,
+                                         header,
+                                         position,
+                                         detail::get_or_ignore<field::seq>(record),
+                                         detail::get_or_ignore<field::qual>(record),
+                                         detail::get_or_ignore<field::id>(record),
+                                         detail::get_or_ignore<field::ref_seq>(record),
+                                         detail::get_or_ignore<field::ref_id>(record),
+                                         detail::get_or_ignore<field::ref_offset>(record),
+                                         detail::get_or_ignore<field::cigar>(record),
+                                         detail::get_or_ignore<field::flag>(record),
+                                         detail::get_or_ignore<field::mapq>(record),
+                                         detail::get_or_ignore<field::mate>(record),
+                                         detail::get_or_ignore<field::tags>(record),
+                                         detail::get_or_ignore<field::evalue>(record),
+                                         detail::get_or_ignore<field::bit_score>(record));
+        };
 
         if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
-            call_read_func(*reference_sequences_ptr);
+            call_read_func(*reference_sequences);
         else
             call_read_func(std::ignore);
     }
 
+    /*!\name Region queries
+     * \{
+     */
+    //!\brief Whether the header contains a reference of the given name.
+    bool has_reference(std::string_view const reference_name)
+    {
+        return std::ranges::any_of(header().ref_ids(),
+                                   [&reference_name](auto const & id)
+                                   {
+                                       return std::ranges::equal(id, reference_name);
+                                   });
+    }
+
+    //!\brief Returns the id of the reference of the given name.
+    int32_t find_reference_id(std::string_view const reference_name)
+    {
+        auto const & ref_ids = header().ref_ids();
+        auto it = std::ranges::find_if(ref_ids,
+                                       [&reference_name](auto const & id)
+                                       {
+                                           return std::ranges::equal(id, reference_name);
+                                       });
+
+        if (it == std::ranges::end(ref_ids))
+            throw std::invalid_argument{"Unknown reference name " + std::string{reference_name} + "."};
+
+        return std::ranges::distance(std::ranges::begin(ref_ids), it);
+    }
+
+    //!\brief Loads the index from `<file>.bai`, `<file>.csi` or `<file without extension>.bai`.
+    void load_index_next_to_file()
+    {
+        if (!file_name.empty())
+        {
+            for (std::filesystem::path candidate : {std::filesystem::path{file_name} += ".bai",
+                                                    std::filesystem::path{file_name} += ".csi",
+                                                    std::filesystem::path{file_name}.replace_extension(".bai")})
+            {
+                if (std::filesystem::exists(candidate))
+                {
+                    load_index(candidate);
+                    return;
+                }
+            }
+        }
+
+        throw file_open_error{"Could not find a BAI or CSI index for " + file_name.string()
+                              + ". Please load the index with load_index()."};
+    }
+    //!\}
+
     //!\brief Befriend iterator so it can access the buffers.
     friend iterator;
 };
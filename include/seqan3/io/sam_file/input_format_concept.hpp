@@ -54,6 +54,13 @@ public:
     {
         format_type::read_alignment_record(std::forward<ts>(args)...);
     }
+
+    //!\brief Forwards to `format_type::read_bam_header`; only provided by seqan3::format_bam.
+    template <typename... ts>
+    void read_bam_header(ts &&... args)
+    {
+        format_type::read_bam_header(std::forward<ts>(args)...);
+    }
 };
 
 } // namespace seqan3::detail
@@ -187,7 +194,7 @@ class sam_file_input_format
  * \tparam flag_type          Type of the seqan3::field::flag input (see seqan3::sam_file_input_traits).
  * \tparam mapq_type          Type of the seqan3::field::mapq input (see seqan3::sam_file_input_traits).
  * \tparam mate_type          std::tuple<ref_id_type, ref_offset_type, int32_t> or decltype(std::ignore).
- * \tparam tag_dict_type      seqan3::sam_tag_dictionary or decltype(std::ignore).
+ * \tparam tag_dict_type      seqan3::sam_tag_dictionary, seqan3::flat_sam_tag_dictionary or decltype(std::ignore).
  * \tparam e_value_type       Type of the seqan3::field::evalue input (see seqan3::sam_file_input_traits).
  * \tparam bit_score_type     Type of the seqan3::field::bit_score input (see seqan3::sam_file_input_traits).
  *
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <seqan3/core/platform.hpp>
 
 namespace seqan3
@@ -25,7 +27,18 @@ namespace seqan3
 template <typename sequence_legal_alphabet>
 struct sam_file_input_options
 {
-    // options to define
+    /*!\brief The number of threads decoding the records of a BAM file; `0` decodes them on the reading thread.
+     *
+     * \details
+     *
+     * If greater than `0`, the reading thread only splits the decompressed BAM stream at the record boundaries and
+     * batches of records are decoded on this many threads. The records are still returned in the order of the file.
+     * This option has no effect on SAM files and must be set before the first record is read.
+     *
+     * The decompression of the BGZF blocks is parallelised independently, see
+     * \ref setting_compression_threads "seqan3::contrib::bgzf_thread_count".
+     */
+    size_t bam_decode_thread_count{0};
 };
 
 } // namespace seqan3
@@ -155,9 +155,25 @@ public:
     sam_file_output(sam_file_output &&) = default;
     //!\brief Move assignment is defaulted.
     sam_file_output & operator=(sam_file_output &&) = default;
-    //!\brief The destructor will write the header if it has not been written before.
+    /*!\brief The destructor will write the header if it has not been written before, and the BAM index if
+     *        seqan3::sam_file_output_options::write_bam_index is set and write_index() has not been called.
+     *
+     * \details
+     *
+     * Errors while writing the BAM index are ignored; call write_index() before to handle them.
+     */
     ~sam_file_output()
     {
+        if (!index_has_been_written && options.write_bam_index != bam_index_format::none && !file_name.empty())
+        {
+            try
+            {
+                write_index();
+            }
+            catch (...)
+            {}
+        }
+
         if (header_has_been_written)
             return;
 
@@ -211,6 +227,8 @@ public:
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for writing."};
 
+        file_name = filename;
+
         // possibly add intermediate compression stream
         secondary_stream = detail::make_secondary_ostream(*primary_stream, filename);
 
@@ -589,6 +607,53 @@ public:
     }
     //!\endcond
 
+    /*!\brief Writes the BAM index of the written records next to the file, i.e. to `<file>.bai` or `<file>.csi`.
+     * \throws std::logic_error if the file was not constructed from a file name.
+     * \throws seqan3::format_error if the output is not BGZF compressed.
+     * \throws seqan3::file_open_error if the index file cannot be opened.
+     *
+     * \details
+     *
+     * Does nothing unless the format is seqan3::format_bam and seqan3::sam_file_output_options::write_bam_index is
+     * set. The header is written first if no record has been written. No records can be written afterwards.
+     *
+     * The destructor writes the index if this function has not been called, but it cannot report errors.
+     */
+    void write_index()
+    {
+        assert(!format.valueless_by_exception());
+
+        std::visit(
+            [&](auto & f)
+            {
+                if constexpr (std::same_as<std::remove_cvref_t<decltype(f)>,
+                                           detail::sam_file_output_format_exposer<format_bam>>)
+                {
+                    if (options.write_bam_index == bam_index_format::none || index_has_been_written)
+                        return;
+
+                    if (file_name.empty())
+                        throw std::logic_error{"A BAM index can only be written if the file was constructed from a "
+                                               "file name."};
+
+                    if (!header_has_been_written)
+                    {
+                        if constexpr (std::same_as<ref_ids_type, ref_info_not_given>)
+                            f.write_header(*secondary_stream, options, std::ignore);
+                        else
+                            f.write_header(*secondary_stream, options, *header_ptr);
+
+                        header_has_been_written = true;
+                    }
+
+                    // The destructor must not try again if writing the index fails.
+                    index_has_been_written = true;
+                    f.write_index(*secondary_stream, options, file_name);
+                }
+            },
+            format);
+    }
+
     /*!\brief Access the file's header.
      *
      * \details
@@ -616,6 +681,12 @@ protected:
     //!\brief A larger (compared to stl default) stream buffer to use when reading from a file.
     std::vector<char> stream_buffer{std::vector<char>(1'000'000)};
 
+    //!\brief The path of the file if constructed from a file name; the BAM index is written next to it.
+    std::filesystem::path file_name{};
+
+    //!\brief Whether write_index() has been called; no records can be written afterwards.
+    bool index_has_been_written{false};
+
     /*!\name Stream / file access
      * \{
      */
@@ -687,6 +758,17 @@ protected:
         std::visit(
             [&](auto & f)
             {
+                if constexpr (std::same_as<std::remove_cvref_t<decltype(f)>,
+                                           detail::sam_file_output_format_exposer<format_bam>>)
+                {
+                    if (options.write_bam_index != bam_index_format::none && file_name.empty())
+                        throw std::logic_error{"A BAM index can only be written if the file was constructed from a "
+                                               "file name."};
+
+                    if (index_has_been_written)
+                        throw std::logic_error{"No records can be written after the BAM index has been written."};
+                }
+
                 // use header from record if explicitly given, e.g. file_output = file_input
                 if constexpr (!std::same_as<record_header_ptr_t, std::nullptr_t>)
                 {
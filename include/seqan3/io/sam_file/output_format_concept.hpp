@@ -61,6 +61,13 @@ public:
     {
         format_type::write_header(stream, options, header);
     }
+
+    //!\brief Forwards to `format_type::write_index`; only provided by seqan3::format_bam.
+    template <typename... ts>
+    void write_index(ts &&... args)
+    {
+        format_type::write_index(std::forward<ts>(args)...);
+    }
 };
 
 } // namespace seqan3::detail
@@ -12,11 +12,25 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <seqan3/core/platform.hpp>
 
 namespace seqan3
 {
 
+/*!\brief The kinds of coordinate index that can be written alongside a BAM file.
+ * \ingroup io_sam_file
+ *
+ * \sa seqan3::bam_index
+ */
+enum class bam_index_format : uint8_t
+{
+    none, //!< Do not write an index.
+    bai,  //!< Write a BAI index (`<file>.bam.bai`); supports references of up to 2^29 bases.
+    csi   //!< Write a CSI index (`<file>.bam.csi`); supports references of any length.
+};
+
 /*!\brief The options type defines various option members that influence the behavior of all or some formats.
  * \ingroup io_sam_file
  *
@@ -42,6 +56,20 @@ struct sam_file_output_options
      * `false`.
      */
     bool sam_require_header = true;
+
+    /*!\brief Whether to write a coordinate index for BAM files.
+     *
+     * \details
+     *
+     * If set to seqan3::bam_index_format::bai or seqan3::bam_index_format::csi, the BAM format records the
+     * position of every record while writing and the index is written next to the file (`<file>.bai` or `<file>.csi`)
+     * by seqan3::sam_file_output::write_index() or, ignoring errors, when the seqan3::sam_file_output is destructed.
+     * The records must be sorted by coordinate and the file must have been constructed from a file name. This option
+     * is ignored by the SAM format.
+     *
+     * \sa seqan3::bam_index
+     */
+    bam_index_format write_bam_index = bam_index_format::none;
 };
 
 } // namespace seqan3
@@ -6,15 +6,21 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides the seqan3::sam_tag_dictionary class and auxiliaries.
+ * \brief Provides the seqan3::sam_tag_dictionary and seqan3::flat_sam_tag_dictionary classes and auxiliaries.
  * \author Svenja Mehringer <svenja.mehringer AT fu-berlin.de>
  */
 
 #pragma once
 
+#include <algorithm>
 #include <concepts>
+#include <initializer_list>
 #include <map>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include <seqan3/core/detail/template_inspection.hpp>
 #include <seqan3/utility/char_operations/predicate.hpp>
@@ -406,4 +412,329 @@ public:
     //!\}
 };
 
+/*!\brief A SAM tag dictionary that stores the optional SAM fields in a sorted vector.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * This class offers the same interface as the seqan3::sam_tag_dictionary, i.e. the typed access via
+ * seqan3::flat_sam_tag_dictionary::get() and the map-like member functions used by the SAM and BAM formats
+ * (`find`, `count`, `contains`, `at`, `operator[]`, `erase`, iteration in the order of the tag ids, ...).
+ *
+ * The seqan3::sam_tag_dictionary is a std::map and allocates a node for every tag.
+ * The seqan3::flat_sam_tag_dictionary stores all tags in a single std::vector that is sorted by the tag id and
+ * keeps its capacity on clear(). When a seqan3::sam_file_input reuses its record buffer, reading the tags of a
+ * record does not allocate anymore, apart from tag values that are containers themselves, e.g. strings that
+ * exceed the small string buffer. Finding a tag is a binary search over the few tags of a record.
+ *
+ * To read the tags into a seqan3::flat_sam_tag_dictionary, set the `tag_dictionary` member type of the traits
+ * of the seqan3::sam_file_input:
+ *
+ * \include test/snippet/io/sam_file/sam_tag_dictionary/flat_sam_tag_dictionary.cpp
+ *
+ * \attention The keys of the elements must not be changed through the iterators, since the dictionary relies on
+ *            the elements being sorted by their key.
+ *
+ * \remark For a complete overview, take a look at \ref io_sam_file
+ *
+ * \sa seqan3::sam_tag_dictionary
+ */
+class flat_sam_tag_dictionary
+{
+public:
+    //!\brief The variant type defining all valid SAM tag field types.
+    using variant_type = detail::sam_tag_variant;
+
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The key type, the unique id of a SAM tag.
+    using key_type = uint16_t;
+    //!\brief The mapped type.
+    using mapped_type = variant_type;
+    //!\brief The type of the stored elements.
+    using value_type = std::pair<key_type, mapped_type>;
+    //!\brief The reference type.
+    using reference = value_type &;
+    //!\brief The const reference type.
+    using const_reference = value_type const &;
+    //!\brief The iterator type.
+    using iterator = typename std::vector<value_type>::iterator;
+    //!\brief The const iterator type.
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+    //!\brief The size type.
+    using size_type = typename std::vector<value_type>::size_type;
+    //!\brief The difference type.
+    using difference_type = typename std::vector<value_type>::difference_type;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    flat_sam_tag_dictionary() = default;                                            //!< Defaulted.
+    flat_sam_tag_dictionary(flat_sam_tag_dictionary const &) = default;             //!< Defaulted.
+    flat_sam_tag_dictionary(flat_sam_tag_dictionary &&) = default;                  //!< Defaulted.
+    flat_sam_tag_dictionary & operator=(flat_sam_tag_dictionary const &) = default; //!< Defaulted.
+    flat_sam_tag_dictionary & operator=(flat_sam_tag_dictionary &&) = default;      //!< Defaulted.
+    ~flat_sam_tag_dictionary() = default;                                           //!< Defaulted.
+
+    /*!\brief Constructs the dictionary from a list of tags.
+     * \param[in] init The tags and values; if a tag occurs more than once, the first value is stored.
+     */
+    flat_sam_tag_dictionary(std::initializer_list<value_type> init)
+    {
+        for (value_type const & element : init)
+            insert(element);
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the tag with the smallest id.
+    iterator begin() noexcept
+    {
+        return data.begin();
+    }
+
+    //!\copydoc begin()
+    const_iterator begin() const noexcept
+    {
+        return data.begin();
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return data.cbegin();
+    }
+
+    //!\brief Returns an iterator behind the tag with the largest id.
+    iterator end() noexcept
+    {
+        return data.end();
+    }
+
+    //!\copydoc end()
+    const_iterator end() const noexcept
+    {
+        return data.end();
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return data.cend();
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of stored tags.
+    size_type size() const noexcept
+    {
+        return data.size();
+    }
+
+    //!\brief Checks whether the dictionary stores no tags.
+    bool empty() const noexcept
+    {
+        return data.empty();
+    }
+
+    //!\brief Reserves storage for `new_capacity` tags.
+    void reserve(size_type const new_capacity)
+    {
+        data.reserve(new_capacity);
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    //!\brief Returns an iterator to the tag `tag` or end() if the tag is not stored.
+    iterator find(key_type const tag)
+    {
+        iterator it = lower_bound(tag);
+        return (it != data.end() && it->first == tag) ? it : data.end();
+    }
+
+    //!\copydoc find()
+    const_iterator find(key_type const tag) const
+    {
+        const_iterator it = lower_bound(tag);
+        return (it != data.end() && it->first == tag) ? it : data.end();
+    }
+
+    //!\brief Returns 1 if the tag `tag` is stored and 0 otherwise.
+    size_type count(key_type const tag) const
+    {
+        return contains(tag);
+    }
+
+    //!\brief Checks whether the tag `tag` is stored.
+    bool contains(key_type const tag) const
+    {
+        return find(tag) != data.end();
+    }
+
+    /*!\brief Returns the value of the tag `tag`.
+     * \throws std::out_of_range if the tag is not stored.
+     */
+    mapped_type & at(key_type const tag)
+    {
+        iterator it = find(tag);
+
+        if (it == data.end())
+            throw std::out_of_range{"The SAM tag is not stored in the seqan3::flat_sam_tag_dictionary."};
+
+        return it->second;
+    }
+
+    //!\copydoc at()
+    mapped_type const & at(key_type const tag) const
+    {
+        const_iterator it = find(tag);
+
+        if (it == data.end())
+            throw std::out_of_range{"The SAM tag is not stored in the seqan3::flat_sam_tag_dictionary."};
+
+        return it->second;
+    }
+
+    //!\brief Returns the value of the tag `tag` and inserts a default initialised value if the tag is not stored.
+    mapped_type & operator[](key_type const tag)
+    {
+        return try_emplace(tag).first->second;
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    //!\brief Removes all tags but keeps the allocated storage.
+    void clear() noexcept
+    {
+        data.clear();
+    }
+
+    /*!\brief Inserts a tag if it is not stored yet.
+     * \returns An iterator to the tag and whether the tag was inserted.
+     */
+    std::pair<iterator, bool> insert(value_type const & element)
+    {
+        return try_emplace(element.first, element.second);
+    }
+
+    /*!\brief Inserts a tag with a value constructed from `args` if the tag is not stored yet.
+     * \returns An iterator to the tag and whether the tag was inserted.
+     */
+    template <typename... args_t>
+    std::pair<iterator, bool> try_emplace(key_type const tag, args_t &&... args)
+    {
+        // The tags of a record are often already sorted, appending them does not need to move any element.
+        iterator it = (data.empty() || data.back().first < tag) ? data.end() : lower_bound(tag);
+
+        if (it != data.end() && it->first == tag)
+            return {it, false};
+
+        it = data.emplace(it,
+                          std::piecewise_construct,
+                          std::forward_as_tuple(tag),
+                          std::forward_as_tuple(std::forward<args_t>(args)...));
+        return {it, true};
+    }
+
+    //!\brief Removes the tag at `position`. \returns An iterator behind the removed tag.
+    iterator erase(const_iterator const position)
+    {
+        return data.erase(position);
+    }
+
+    //!\brief Removes the tag `tag`. \returns The number of removed tags (0 or 1).
+    size_type erase(key_type const tag)
+    {
+        iterator it = find(tag);
+
+        if (it == data.end())
+            return 0u;
+
+        data.erase(it);
+        return 1u;
+    }
+    //!\}
+
+    /*!\name Getter function for the seqan3::flat_sam_tag_dictionary.
+     *\brief Gets the value of known SAM tags by its correct type instead of the std::variant.
+     * \tparam tag The unique tag id of a SAM tag.
+     * \returns The value corresponding to the key `tag` of type seqan3::sam_tag_type<tag>::type.
+     *
+     * \details
+     *
+     * This behaves like seqan3::sam_tag_dictionary::get().
+     *
+     * \attention This function is only available for tags that have an
+     *            seqan3::sam_tag_type<tag>::type overload. See the type trait
+     *            documentation for further details.
+     * \{
+     */
+
+    //!\brief Default initializes the value if the tag is not stored yet.
+    template <uint16_t tag>
+        requires (!std::same_as<sam_tag_type_t<tag>, variant_type>)
+    auto & get() &
+    {
+        auto [it, inserted] = try_emplace(tag, sam_tag_type_t<tag>{}); // set correct type if tag is not set yet on
+        return std::get<sam_tag_type_t<tag>>(it->second);
+    }
+
+    //!\brief Default initializes the value if the tag is not stored yet.
+    template <uint16_t tag>
+        requires (!std::same_as<sam_tag_type_t<tag>, variant_type>)
+    auto && get() &&
+    {
+        auto [it, inserted] = try_emplace(tag, sam_tag_type_t<tag>{}); // set correct type if tag is not set yet on
+        return std::get<sam_tag_type_t<tag>>(std::move(it->second));
+    }
+
+    //!\brief Uses at() for access and throws when the tag is not stored.
+    //!\throws std::out_of_range if the tag is not stored.
+    template <uint16_t tag>
+        requires (!std::same_as<sam_tag_type_t<tag>, variant_type>)
+    auto const & get() const &
+    {
+        return std::get<sam_tag_type_t<tag>>(at(tag));
+    }
+
+    //!\brief Uses at() for access and throws when the tag is not stored.
+    //!\throws std::out_of_range if the tag is not stored.
+    template <uint16_t tag>
+        requires (!std::same_as<sam_tag_type_t<tag>, variant_type>)
+    auto const && get() const &&
+    {
+        return std::get<sam_tag_type_t<tag>>(std::move(at(tag)));
+    }
+    //!\}
+
+    //!\brief Two dictionaries are equal if they store the same tags with the same values.
+    friend bool operator==(flat_sam_tag_dictionary const &, flat_sam_tag_dictionary const &) = default;
+
+private:
+    //!\brief Returns an iterator to the first tag that is not smaller than `tag`.
+    iterator lower_bound(key_type const tag)
+    {
+        return std::ranges::lower_bound(data, tag, std::ranges::less{}, &value_type::first);
+    }
+
+    //!\copydoc lower_bound()
+    const_iterator lower_bound(key_type const tag) const
+    {
+        return std::ranges::lower_bound(data, tag, std::ranges::less{}, &value_type::first);
+    }
+
+    //!\brief The tags sorted by their id.
+    std::vector<value_type> data{};
+};
+
 } // namespace seqan3
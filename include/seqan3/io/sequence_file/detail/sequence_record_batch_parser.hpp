@@ -0,0 +1,345 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::sequence_record_batch_parser.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <exception>
+#include <functional>
+#include <future>
+#include <istream>
+#include <memory>
+#include <span>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Parses the records of a sequence file in batches on a thread pool, keeping them in order.
+ * \tparam record_t The type of the parsed records, e.g. the record type of seqan3::sequence_file_input.
+ * \ingroup io_sequence_file
+ *
+ * \details
+ *
+ * A reader thread reads the (decompressed) stream in chunks of
+ * seqan3::detail::sequence_record_batch_parser::bytes_per_batch characters and cuts every chunk behind its last
+ * complete record, as determined by the given split function; the rest is carried over to the next chunk. Every chunk
+ * is parsed into a batch of records on one of the threads, which calls the given parse function with a stream over the
+ * chunk until the chunk is exhausted. At most twice as many batches as threads are read ahead, i.e. the memory usage
+ * is bounded.
+ *
+ * next() returns the records in the order of the file. An exception thrown while parsing a record is rethrown by
+ * next() after all records in front of it have been returned, an exception thrown while reading the stream after the
+ * records of the preceding chunks.
+ *
+ * \attention The reader thread reads ahead of the last returned record. The stream must not be used by anyone else
+ *            unless reset() is called before next() is called again.
+ */
+template <typename record_t>
+class sequence_record_batch_parser
+{
+public:
+    //!\brief The type of the function returning the size of the complete records at the front of the given characters.
+    using split_function_type = std::function<size_t(std::span<char const>)>;
+    //!\brief The type of the function parsing a single record and its position from a stream, called concurrently.
+    using parse_function_type = std::function<void(std::istream &, record_t &, std::streampos &)>;
+
+    //!\brief The number of characters read for a batch; more if a single record is longer.
+    static constexpr size_t bytes_per_batch = 1u << 20;
+
+    /*!\name Constructors, destructor and assignment
+     * \brief Not movable, because the reader thread refers to the parser.
+     * \{
+     */
+    sequence_record_batch_parser() = delete;                                                 //!< Deleted.
+    sequence_record_batch_parser(sequence_record_batch_parser const &) = delete;             //!< Deleted.
+    sequence_record_batch_parser(sequence_record_batch_parser &&) = delete;                  //!< Deleted.
+    sequence_record_batch_parser & operator=(sequence_record_batch_parser const &) = delete; //!< Deleted.
+    sequence_record_batch_parser & operator=(sequence_record_batch_parser &&) = delete;      //!< Deleted.
+
+    //!\brief Stops the reader thread and waits for the batches in flight.
+    ~sequence_record_batch_parser()
+    {
+        reset();
+    }
+
+    /*!\brief Constructs the parser and spawns the threads.
+     * \param[in] stream       The stream positioned at the first record to parse; must outlive the parser.
+     * \param[in] thread_count The number of threads parsing the records; must be greater than 0.
+     * \param[in] split        The function returning the size of the complete records at the front of the given
+     *                         characters, which start with a record; `0` if there is no complete record.
+     * \param[in] parse        The function parsing a single record.
+     */
+    sequence_record_batch_parser(std::istream & stream,
+                                 size_t const thread_count,
+                                 split_function_type split,
+                                 parse_function_type parse) :
+        stream{&stream},
+        max_batches_in_flight{2 * thread_count},
+        split{std::move(split)},
+        parse{std::move(parse)},
+        thread_pool{thread_count}
+    {
+        assert(thread_count > 0);
+    }
+    //!\}
+
+    /*!\brief Moves the next record and its position in the stream into the given arguments.
+     * \param[out] record   The record to move the next record into.
+     * \param[out] position The position of the record in the stream, or `-1` if the stream does not report positions.
+     * \returns `false` if there are no more records, `true` otherwise.
+     * \throws seqan3::parse_error or any exception thrown by the parse function or by reading the stream.
+     */
+    bool next(record_t & record, std::streampos & position)
+    {
+        for (;;)
+        {
+            if (!current)
+            {
+                if (at_end)
+                    return false;
+
+                if (!reader.joinable())
+                    start_reader();
+
+                if (batches->wait_pop(current) == contrib::queue_op_status::closed)
+                {
+                    reset();
+                    at_end = true;
+                    return false;
+                }
+
+                current->parsed.wait();
+                next_record = 0;
+            }
+
+            if (next_record < current->records.size())
+            {
+                record = std::move(current->records[next_record]);
+                position = current->positions[next_record];
+                ++next_record;
+                return true;
+            }
+
+            std::exception_ptr error = current->error;
+            current.reset();
+
+            if (error)
+            {
+                reset();
+                at_end = true;
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    //!\brief Stops the reader thread and discards all batches read ahead, e.g. before seeking in the stream.
+    void reset()
+    {
+        if (reader.joinable())
+        {
+            batches->close();
+            reader.join();
+
+            // Every batch in the queue is parsed by the threads, which must be done before the batch is discarded.
+            std::shared_ptr<batch> pending{};
+            while (batches->try_pop(pending) == contrib::queue_op_status::success)
+                pending->parsed.wait();
+        }
+
+        batches.reset();
+        current.reset();
+        next_record = 0;
+        at_end = false;
+    }
+
+private:
+    //!\brief The characters of consecutive records and their parsed records.
+    struct batch
+    {
+        //!\brief The characters of the records.
+        std::vector<char> bytes{};
+        //!\brief The position of the first character in the stream.
+        std::streampos position{};
+        //!\brief The parsed records.
+        std::vector<record_t> records{};
+        //!\brief The positions of the records in the stream.
+        std::vector<std::streampos> positions{};
+        //!\brief The exception thrown for the record behind the parsed records or while reading the stream, if any.
+        std::exception_ptr error{};
+        //!\brief Signals that the records were parsed.
+        std::promise<void> done{};
+        //!\brief Becomes ready when the records were parsed.
+        std::future<void> parsed{done.get_future()};
+    };
+
+    //!\brief A stream buffer over the characters of a batch, reporting the position in the batch.
+    class batch_streambuf : public std::streambuf
+    {
+    public:
+        //!\brief Constructs the stream buffer over the given characters.
+        explicit batch_streambuf(std::vector<char> & bytes)
+        {
+            setg(bytes.data(), bytes.data(), bytes.data() + bytes.size());
+        }
+
+    protected:
+        //!\brief Returns the position in the batch for `tellg()`; other seeks fail.
+        pos_type seekoff(off_type const off, std::ios_base::seekdir const dir, std::ios_base::openmode const which)
+            override
+        {
+            if (off != 0 || dir != std::ios_base::cur || !(which & std::ios_base::in))
+                return pos_type(off_type(-1));
+
+            return pos_type(gptr() - eback());
+        }
+    };
+
+    //!\brief Parses the records of the given batch.
+    static void parse_batch(parse_function_type const & parse, batch & current)
+    {
+        batch_streambuf buffer{current.bytes};
+        std::istream batch_stream{&buffer};
+        bool const has_position = current.position != std::streampos(-1);
+
+        while (!std::istream::traits_type::eq_int_type(buffer.sgetc(), std::istream::traits_type::eof()))
+        {
+            std::streampos offset{};
+            current.records.emplace_back();
+
+            try
+            {
+                parse(batch_stream, current.records.back(), offset);
+            }
+            catch (...)
+            {
+                // An invalid record hides the records and any error behind it.
+                current.records.pop_back();
+                current.error = std::current_exception();
+                break;
+            }
+
+            current.positions.push_back(has_position ? current.position + std::streamoff(offset) : std::streampos(-1));
+        }
+    }
+
+    //!\brief Starts the reader thread at the current position of the stream.
+    void start_reader()
+    {
+        batches = std::make_unique<contrib::fixed_buffer_queue<std::shared_ptr<batch>>>(max_batches_in_flight);
+
+        std::streampos const position = stream->rdbuf()->pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+        reader = std::thread{[this, position]()
+                             {
+                                 read_batches(position);
+                             }};
+    }
+
+    //!\brief Reads the stream into batches and schedules them until the stream ends or reset() is called.
+    void read_batches(std::streampos position)
+    {
+        std::vector<char> rest{};
+        bool stream_end = false;
+
+        while (!stream_end)
+        {
+            auto new_batch = std::make_shared<batch>();
+            new_batch->position = position;
+            new_batch->bytes = std::move(rest);
+            rest.clear();
+
+            try
+            {
+                // Read until the characters contain a complete record; the first ones always start a record.
+                size_t records_end = 0;
+                while (records_end == 0 && !stream_end)
+                {
+                    size_t const size = new_batch->bytes.size();
+                    size_t const count = std::max(bytes_per_batch, size);
+                    new_batch->bytes.resize(size + count);
+                    size_t const read = stream->rdbuf()->sgetn(new_batch->bytes.data() + size, count);
+                    new_batch->bytes.resize(size + read);
+
+                    stream_end = read < count;
+                    records_end = stream_end ? new_batch->bytes.size() : split(new_batch->bytes);
+                }
+
+                rest.assign(new_batch->bytes.begin() + records_end, new_batch->bytes.end());
+                new_batch->bytes.resize(records_end);
+            }
+            catch (...)
+            {
+                new_batch->bytes.clear();
+                new_batch->error = std::current_exception();
+                stream_end = true;
+            }
+
+            if (new_batch->bytes.empty() && !new_batch->error)
+                break;
+
+            if (position != std::streampos(-1))
+                position += std::streamoff(new_batch->bytes.size());
+
+            if (new_batch->bytes.empty())
+            {
+                new_batch->done.set_value();
+            }
+            else
+            {
+                thread_pool.execute(
+                    [parse = parse](std::shared_ptr<batch> current, auto && callback)
+                    {
+                        parse_batch(parse, *current);
+                        callback(*current);
+                    },
+                    std::shared_ptr<batch>{new_batch},
+                    [](batch & current)
+                    {
+                        current.done.set_value();
+                    });
+            }
+
+            if (batches->wait_push(std::move(new_batch)) == contrib::queue_op_status::closed)
+                break;
+        }
+
+        batches->close();
+    }
+
+    //!\brief The stream to read the records from.
+    std::istream * stream{};
+    //!\brief The maximal number of batches read ahead.
+    size_t max_batches_in_flight{};
+    //!\brief The function finding the end of the complete records.
+    split_function_type split{};
+    //!\brief The function parsing a single record.
+    parse_function_type parse{};
+    //!\brief The batches read ahead in the order of the stream, filled by the reader thread.
+    std::unique_ptr<contrib::fixed_buffer_queue<std::shared_ptr<batch>>> batches{};
+    //!\brief The batch the records are currently returned from.
+    std::shared_ptr<batch> current{};
+    //!\brief The position of the next record in the current batch.
+    size_t next_record{};
+    //!\brief Whether all records were returned.
+    bool at_end{false};
+    //!\brief The threads parsing the batches.
+    execution_handler_parallel thread_pool;
+    //!\brief The thread reading the stream into batches; joined by reset() before the other members are gone.
+    std::thread reader{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,266 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::fasta_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <seqan3/io/exception.hpp>
+#include <seqan3/utility/char_operations/predicate.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The index entry of a single sequence of a FASTA file, i.e. one line of a `.fai` file.
+ * \ingroup io_sequence_file
+ */
+struct fasta_index_entry
+{
+    std::string id{};      //!< The id of the sequence, i.e. the header line up to the first whitespace.
+    uint64_t length{};     //!< The number of bases of the sequence.
+    uint64_t offset{};     //!< The byte offset of the first base in the file.
+    uint64_t line_bases{}; //!< The number of bases per line.
+    uint64_t line_width{}; //!< The number of bytes per line, including the line break.
+
+    //!\brief Defaulted comparison.
+    friend bool operator==(fasta_index_entry const &, fasta_index_entry const &) = default;
+};
+
+/*!\brief An index of a FASTA file in the `.fai` format of `samtools faidx`.
+ * \ingroup io_sequence_file
+ *
+ * \details
+ *
+ * For every sequence of a FASTA file, the index stores the position of its first base in the file, its length and the
+ * length of its lines. Together, these values give the byte offset of every single base. This requires that all lines
+ * of a sequence but the last one have the same length, which is checked when the index is created.
+ *
+ * The index is used by seqan3::indexed_fasta_file to access subsequences without reading the whole file.
+ * The index files are compatible with the ones created by `samtools faidx`.
+ */
+class fasta_index
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    fasta_index() = default;                                //!< Defaulted.
+    fasta_index(fasta_index const &) = default;             //!< Defaulted.
+    fasta_index(fasta_index &&) = default;                  //!< Defaulted.
+    fasta_index & operator=(fasta_index const &) = default; //!< Defaulted.
+    fasta_index & operator=(fasta_index &&) = default;      //!< Defaulted.
+    ~fasta_index() = default;                               //!< Defaulted.
+
+    /*!\brief Reads an index from a `.fai` file.
+     * \param[in] file_name The path to the index.
+     * \throws seqan3::file_open_error if the file cannot be opened.
+     * \throws seqan3::format_error if the file is not a valid FASTA index.
+     */
+    explicit fasta_index(std::filesystem::path const & file_name)
+    {
+        std::ifstream file{file_name, std::ios_base::in | std::ios::binary};
+        if (!file.good())
+            throw file_open_error{"Could not open file " + file_name.string() + " for reading."};
+
+        std::string line{};
+        while (std::getline(file, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            if (line.empty())
+                continue;
+
+            std::vector<std::string_view> columns{};
+            for (size_t begin = 0, end = 0; end != std::string::npos; begin = end + 1)
+            {
+                end = line.find('\t', begin);
+                columns.push_back(std::string_view{line}.substr(begin, end - begin));
+            }
+
+            if (columns.size() != 5u)
+                throw format_error{"A line of the FASTA index " + file_name.string() + " does not have 5 columns: "
+                                   + line};
+
+            fasta_index_entry entry{std::string{columns[0]}};
+            for (auto [column, value] : {std::pair{columns[1], &entry.length},
+                                         std::pair{columns[2], &entry.offset},
+                                         std::pair{columns[3], &entry.line_bases},
+                                         std::pair{columns[4], &entry.line_width}})
+            {
+                auto [ptr, errc] = std::from_chars(column.data(), column.data() + column.size(), *value);
+                if (errc != std::errc{} || ptr != column.data() + column.size())
+                    throw format_error{"The FASTA index " + file_name.string() + " contains an invalid number: "
+                                       + line};
+            }
+
+            if (entry.length > 0u && (entry.line_bases == 0u || entry.line_width <= entry.line_bases))
+                throw format_error{"The FASTA index " + file_name.string() + " contains invalid line lengths: " + line};
+
+            push_back(std::move(entry));
+        }
+    }
+    //!\}
+
+    /*!\brief Creates the index of a FASTA file.
+     * \param[in] fasta The content of the (uncompressed) FASTA file.
+     * \returns The index.
+     * \throws seqan3::format_error if the content is not a valid FASTA file or if the lines of a sequence do not
+     *                              have the same length.
+     *
+     * \details
+     *
+     * Like in `samtools faidx`, the id of a sequence is its header line up to the first whitespace, and the last line
+     * of a sequence may be shorter than the others. Empty lines are only allowed at the end of a sequence.
+     * Line breaks can be `\n` or `\r\n`.
+     */
+    static fasta_index create(std::string_view const fasta)
+    {
+        fasta_index index{};
+        size_t position = 0u;
+
+        // Skip empty lines in front of the first header.
+        while (position < fasta.size() && is_space(fasta[position]))
+            ++position;
+
+        while (position < fasta.size())
+        {
+            if (fasta[position] != '>')
+                throw format_error{"Expected a FASTA header starting with '>' at byte " + std::to_string(position)
+                                   + "."};
+
+            size_t const header_end = std::min(fasta.find('\n', position), fasta.size());
+            std::string_view const header = fasta.substr(position + 1, header_end - position - 1);
+            size_t const id_end = std::ranges::find_if(header, is_space) - header.begin();
+
+            fasta_index_entry entry{std::string{header.substr(0, id_end)}};
+            entry.offset = std::min(header_end + 1, fasta.size());
+            position = entry.offset;
+
+            bool last_line_seen = false; // A line shorter than the first one or an empty line was seen.
+
+            while (position < fasta.size() && fasta[position] != '>')
+            {
+                size_t const line_end = std::min(fasta.find('\n', position), fasta.size());
+                size_t const line_width = line_end - position + (line_end < fasta.size());
+                size_t line_bases = line_end - position;
+
+                if (line_bases > 0u && fasta[line_end - 1] == '\r')
+                    --line_bases;
+
+                if (line_bases > 0u)
+                {
+                    if (last_line_seen)
+                        throw format_error{"The sequence " + entry.id
+                                           + " contains a line after a shorter or an empty line."};
+
+                    if (entry.line_bases == 0u)
+                    {
+                        entry.line_bases = line_bases;
+                        entry.line_width = line_width;
+                    }
+                    else if (line_bases > entry.line_bases
+                             || (line_bases == entry.line_bases && line_width != entry.line_width
+                                 && line_end < fasta.size()))
+                    {
+                        throw format_error{"The lines of the sequence " + entry.id + " have different lengths."};
+                    }
+
+                    last_line_seen = line_bases < entry.line_bases;
+                    entry.length += line_bases;
+                }
+                else
+                {
+                    last_line_seen = true;
+                }
+
+                position = line_end + 1;
+            }
+
+            index.push_back(std::move(entry));
+        }
+
+        return index;
+    }
+
+    /*!\brief Writes the index to a `.fai` file.
+     * \param[in] file_name The path of the index.
+     * \throws seqan3::file_open_error if the file cannot be opened.
+     */
+    void write(std::filesystem::path const & file_name) const
+    {
+        std::ofstream file{file_name, std::ios_base::out | std::ios::binary};
+        if (!file.good())
+            throw file_open_error{"Could not open file " + file_name.string() + " for writing."};
+
+        for (fasta_index_entry const & entry : entry_list)
+        {
+            file << entry.id << '\t' << entry.length << '\t' << entry.offset << '\t' << entry.line_bases << '\t'
+                 << entry.line_width << '\n';
+        }
+    }
+
+    //!\brief Returns the entries in the order of the file.
+    std::vector<fasta_index_entry> const & entries() const noexcept
+    {
+        return entry_list;
+    }
+
+    //!\brief Returns the number of indexed sequences.
+    size_t size() const noexcept
+    {
+        return entry_list.size();
+    }
+
+    /*!\brief Returns the position of the sequence `id` in entries().
+     * \param[in] id The id of the sequence.
+     * \returns The position or std::nullopt if the index contains no such sequence.
+     */
+    std::optional<size_t> find(std::string_view const id) const
+    {
+        if (auto it = positions.find(id); it != positions.end())
+            return it->second;
+
+        return std::nullopt;
+    }
+
+    //!\brief Two indices are equal if they have the same entries.
+    friend bool operator==(fasta_index const & lhs, fasta_index const & rhs)
+    {
+        return lhs.entry_list == rhs.entry_list;
+    }
+
+private:
+    //!\brief Adds an entry.
+    void push_back(fasta_index_entry entry)
+    {
+        if (!positions.emplace(entry.id, entry_list.size()).second)
+            throw format_error{"The FASTA file contains the id " + entry.id + " more than once."};
+
+        entry_list.push_back(std::move(entry));
+    }
+
+    //!\brief The entries in the order of the file.
+    std::vector<fasta_index_entry> entry_list{};
+    //!\brief Maps the ids to their position in entry_list.
+    std::map<std::string, size_t, std::less<>> positions{};
+};
+
+} // namespace seqan3
@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <iterator>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -170,8 +171,38 @@ protected:
         }
     }
 
+    /*!\brief Returns the end of the last complete record in the given characters.
+     * \param[in] data Characters starting at the beginning of a record.
+     * \returns The position of the last record start behind the beginning of `data`, or `0` if there is none.
+     *
+     * \details
+     *
+     * A `'>'` or `';'` at the beginning of a line always starts a record in read_sequence_record(), because an ID line
+     * ends with the newline and the sequence ends at the next `'>'` or `';'`. This is used to split the input for
+     * parsing in parallel, see seqan3::sequence_file_input_options::parse_thread_count.
+     */
+    static size_t find_records_end(std::span<char const> const data)
+    {
+        for (size_t i = data.size(); i > 1; --i)
+            if ((data[i - 1] == '>' || data[i - 1] == ';') && data[i - 2] == '\n')
+                return i - 1;
+
+        return 0;
+    }
+
 private:
     //!\privatesection
+    //!\brief Returns a callback for seqan3::detail::fast_istreambuf_iterator::skip_until appending to the ID.
+    template <typename id_type>
+    static auto append_to(id_type & id)
+    {
+        return [&id](std::string_view const chunk)
+        {
+            for (char const c : chunk)
+                id.push_back(assign_char_to(c, std::ranges::range_value_t<id_type>{}));
+        };
+    }
+
     //!\brief Implementation of reading the ID.
     template <typename stream_view_t, typename seq_legal_alph_type, typename id_type>
     void
@@ -197,27 +228,14 @@ private:
                 ++it; // already checked `is_id`
 
                 if (options.fasta_ignore_blanks_before_id)
-                {
-                    for (; (it != e) && (is_blank)(*it); ++it) // skip leading ' '
-                    {}
-                }
+                    it.skip_until(!is_blank); // skip leading ' '
 
-                bool at_delimiter = false;
-                for (; it != e; ++it)
-                {
-                    if ((is_cntrl || is_blank)(*it))
-                    {
-                        at_delimiter = true;
-                        break;
-                    }
-                    id.push_back(assign_char_to(*it, std::ranges::range_value_t<id_type>{}));
-                }
+                it.skip_until(is_cntrl || is_blank, append_to(id));
 
-                if (!at_delimiter)
+                if (it == e)
                     throw unexpected_end_of_input{"FASTA ID line did not end in newline."};
 
-                for (; (it != e) && ((!is_char<'\n'>)(*it)); ++it)
-                {}
+                it.skip_until(is_char<'\n'>);
 
 #else  // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
                 if (options.fasta_ignore_blanks_before_id)
@@ -250,23 +268,11 @@ private:
                 ++it; // skip leading '>' or ';'
 
                 if (options.fasta_ignore_blanks_before_id)
-                {
-                    for (; (it != e) && (is_blank)(*it); ++it) // skip leading ' '
-                    {}
-                }
+                    it.skip_until(!is_blank); // skip leading ' '
 
-                bool at_delimiter = false;
-                for (; it != e; ++it)
-                {
-                    if ((is_char<'\n'>)(*it))
-                    {
-                        at_delimiter = true;
-                        break;
-                    }
-                    id.push_back(assign_char_to(*it, std::ranges::range_value_t<id_type>{}));
-                }
+                it.skip_until(is_char<'\n'>, append_to(id));
 
-                if (!at_delimiter)
+                if (it == e)
                     throw unexpected_end_of_input{"FASTA ID line did not end in newline."};
 
 #else  // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
@@ -307,24 +313,28 @@ private:
             if (it == e)
                 throw unexpected_end_of_input{"No sequence information given!"};
 
-            for (; (it != e) && ((!is_id)(*it)); ++it)
-            {
-                if ((is_space || is_digit)(*it))
-                {
-                    continue;
-                }
-                else if (is_legal_alph(*it))
-                {
-                    seq.push_back(assign_char_to(*it, std::ranges::range_value_t<seq_type>{}));
-                }
-                else
-                {
-
-                    throw parse_error{std::string{"Encountered an unexpected letter: "} + "char_is_valid_for<"
-                                      + detail::type_name_as_string<seq_legal_alph_type>
-                                      + "> evaluated to false on " + detail::make_printable(*it)};
-                }
-            }
+            it.skip_until(is_id,
+                          [&seq, is_legal_alph](std::string_view const chunk)
+                          {
+                              for (char const c : chunk)
+                              {
+                                  if ((is_space || is_digit)(c))
+                                  {
+                                      continue;
+                                  }
+                                  else if (is_legal_alph(c))
+                                  {
+                                      seq.push_back(assign_char_to(c, std::ranges::range_value_t<seq_type>{}));
+                                  }
+                                  else
+                                  {
+                                      throw parse_error{std::string{"Encountered an unexpected letter: "}
+                                                        + "char_is_valid_for<"
+                                                        + detail::type_name_as_string<seq_legal_alph_type>
+                                                        + "> evaluated to false on " + detail::make_printable(c)};
+                                  }
+                              }
+                          });
 
 #else  // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
 
@@ -13,8 +13,11 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
+#include <functional>
 #include <iterator>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -131,33 +134,28 @@ protected:
         auto e = std::ranges::end(stream_view);
         if constexpr (!detail::decays_to_ignore_v<id_type>)
         {
+            auto append_to_id = [&id](std::string_view const chunk)
+            {
+                if constexpr (builtin_character<std::ranges::range_value_t<id_type>>)
+                    std::ranges::copy(chunk, std::back_inserter(id));
+                else
+                    for (char const c : chunk)
+                        id.push_back(assign_char_to(c, std::ranges::range_value_t<id_type>{}));
+            };
+
             if (options.truncate_ids)
             {
-                for (; (stream_it != e) && (!(is_cntrl || is_blank))(*stream_it); ++stream_it)
-                {
-                    if constexpr (builtin_character<std::ranges::range_value_t<id_type>>)
-                        id.push_back(*stream_it);
-                    else
-                        id.push_back(assign_char_to(*stream_it, std::ranges::range_value_t<id_type>{}));
-                }
-                for (; (stream_it != e) && (!is_char<'\n'>)(*stream_it); ++stream_it)
-                {}
+                stream_it.skip_until(is_cntrl || is_blank, append_to_id);
+                stream_it.skip_until(is_char<'\n'>);
             }
             else
             {
-                for (; (stream_it != e) && (!is_char<'\n'>)(*stream_it); ++stream_it)
-                {
-                    if constexpr (builtin_character<std::ranges::range_value_t<id_type>>)
-                        id.push_back(*stream_it);
-                    else
-                        id.push_back(assign_char_to(*stream_it, std::ranges::range_value_t<id_type>{}));
-                }
+                stream_it.skip_until(is_char<'\n'>, append_to_id);
             }
         }
         else
         {
-            for (; (stream_it != e) && (!is_char<'\n'>)(*stream_it); ++stream_it)
-            {}
+            stream_it.skip_until(is_char<'\n'>);
         }
 
         if (stream_it == e)
@@ -169,32 +167,39 @@ protected:
         /* Sequence */
         if constexpr (!detail::decays_to_ignore_v<seq_type>)
         {
-            for (; (stream_it != e) && (!is_char<'+'>)(*stream_it); ++stream_it)
-            {
-                if ((!is_space)(*stream_it))
-                {
-                    if constexpr (builtin_character<std::ranges::range_value_t<seq_type>>)
-                    {
-                        sequence.push_back(*stream_it);
-                    }
-                    else
-                    {
-                        if (!char_is_valid_for<seq_legal_alph_type>(*stream_it))
-                        {
-                            throw parse_error{std::string{"Encountered bad letter for seq: "}
-                                              + detail::make_printable(*stream_it)};
-                        }
-                        sequence.push_back(assign_char_to(*stream_it, std::ranges::range_value_t<seq_type>{}));
-                    }
-                }
-            }
+            stream_it.skip_until(is_char<'+'>,
+                                 [&sequence](std::string_view const chunk)
+                                 {
+                                     for (char const c : chunk)
+                                     {
+                                         if ((is_space)(c))
+                                             continue;
+
+                                         if constexpr (builtin_character<std::ranges::range_value_t<seq_type>>)
+                                         {
+                                             sequence.push_back(c);
+                                         }
+                                         else
+                                         {
+                                             if (!char_is_valid_for<seq_legal_alph_type>(c))
+                                             {
+                                                 throw parse_error{std::string{"Encountered bad letter for seq: "}
+                                                                   + detail::make_printable(c)};
+                                             }
+                                             sequence.push_back(
+                                                 assign_char_to(c, std::ranges::range_value_t<seq_type>{}));
+                                         }
+                                     }
+                                 });
             sequence_size_after = size(sequence);
         }
         else // consume, but count
         {
-            for (; (stream_it != e) && (!is_char<'+'>)(*stream_it); ++stream_it)
-                if ((!is_space)(*stream_it))
-                    ++sequence_size_after;
+            stream_it.skip_until(is_char<'+'>,
+                                 [&sequence_size_after](std::string_view const chunk)
+                                 {
+                                     sequence_size_after += std::ranges::count_if(chunk, !is_space);
+                                 });
         }
 
         /* 2nd ID line */
@@ -207,8 +212,7 @@ protected:
                               + detail::make_printable(*stream_it)};
         }
 
-        for (; (stream_it != e) && (!is_char<'\n'>)(*stream_it); ++stream_it)
-        {}
+        stream_it.skip_until(is_char<'\n'>);
 
         if (stream_it == e)
             throw unexpected_end_of_input{"Expected end of second ID-line, got end-of-file."};
@@ -413,6 +417,56 @@ protected:
             stream_it.write_end_of_line(options.add_carriage_return);
         }
     }
+
+    /*!\brief Returns the end of the last complete record in the given characters.
+     * \param[in] data Characters starting at the beginning of a record.
+     * \returns The size of the complete records at the front of `data`. If the records are followed by a malformed
+     *          record, the size of `data` is returned, such that read_sequence_record() reports the error.
+     *
+     * \details
+     *
+     * The records are delimited like by read_sequence_record(): the sequence ends at the next `'+'` and the qualities
+     * end after as many non-space characters as the sequence has, followed by a newline. This is used to split the
+     * input for parsing in parallel, see seqan3::sequence_file_input_options::parse_thread_count.
+     */
+    static size_t find_records_end(std::span<char const> const data)
+    {
+        char const * const begin = data.data();
+        char const * const end = begin + data.size();
+        char const * record_end = begin;
+
+        // Returns the first occurrence of `c` in [first, end) or nullptr.
+        auto find = [end](char const * const first, char const c)
+        {
+            return static_cast<char const *>(std::memchr(first, c, end - first));
+        };
+
+        while (record_end != end)
+        {
+            if (*record_end != '@')
+                return data.size();
+
+            char const * const id_end = find(record_end, '\n');
+            char const * const sequence_end = id_end ? find(id_end, '+') : nullptr;
+            char const * const second_id_end = sequence_end ? find(sequence_end, '\n') : nullptr;
+            if (second_id_end == nullptr)
+                break;
+
+            size_t sequence_size = std::count_if(id_end, sequence_end, std::not_fn(is_space));
+            char const * it = second_id_end + 1;
+            for (; sequence_size > 0 && it != end; ++it)
+                sequence_size -= !is_space(*it);
+
+            if (it == end)
+                break;
+            if (*it != '\n')
+                return data.size();
+
+            record_end = it + 1;
+        }
+
+        return record_end - begin;
+    }
 };
 
 } // namespace seqan3
@@ -0,0 +1,189 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::indexed_fasta_file.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/views/char_to.hpp>
+#include <seqan3/io/detail/memory_mapped_file.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/sequence_file/fasta_index.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Random access to the subsequences of an uncompressed FASTA file.
+ * \ingroup io_sequence_file
+ * \tparam alphabet_type The alphabet of the returned sequences; must model seqan3::writable_alphabet.
+ *
+ * \details
+ *
+ * The FASTA file is mapped into memory and a seqan3::fasta_index gives the position of every base in the file.
+ * A subsequence is returned as a view that converts the characters of the file to `alphabet_type` when it is
+ * accessed, i.e. neither the file is parsed nor the subsequence is copied. Only the pages of the file that contain
+ * the accessed bases are loaded by the operating system, so extracting many short windows of a genome needs neither
+ * the time to read nor the memory to store the whole genome.
+ *
+ * The index is read from `<fasta_file>.fai` if this file exists, and created by scanning the FASTA file otherwise.
+ * seqan3::fasta_index::write can be used to store a created index for later runs.
+ *
+ * \include test/snippet/io/sequence_file/indexed_fasta_file.cpp
+ *
+ * The characters are converted by seqan3::views::char_to, i.e. characters that are not valid for `alphabet_type`
+ * are converted like by seqan3::assign_char_to and no exception is thrown.
+ * The returned views are valid as long as the seqan3::indexed_fasta_file exists. All member functions are const and
+ * can be called from multiple threads at the same time.
+ *
+ * \attention Compressed FASTA files are not supported.
+ */
+template <writable_alphabet alphabet_type = dna5>
+class indexed_fasta_file
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    indexed_fasta_file() = delete;                                       //!< Deleted.
+    indexed_fasta_file(indexed_fasta_file const &) = delete;             //!< Deleted.
+    indexed_fasta_file(indexed_fasta_file &&) = default;                 //!< Defaulted.
+    indexed_fasta_file & operator=(indexed_fasta_file const &) = delete; //!< Deleted.
+    indexed_fasta_file & operator=(indexed_fasta_file &&) = default;     //!< Defaulted.
+    ~indexed_fasta_file() = default;                                     //!< Defaulted.
+
+    /*!\brief Opens a FASTA file and reads or creates its index.
+     * \param[in] fasta_file The path of the FASTA file.
+     * \throws seqan3::file_open_error if the FASTA file cannot be opened.
+     * \throws seqan3::format_error if the FASTA file is compressed, if it cannot be indexed, or if the index does not
+     *                              fit the file.
+     */
+    explicit indexed_fasta_file(std::filesystem::path const & fasta_file) : file{fasta_file}
+    {
+        std::filesystem::path index_file{fasta_file};
+        index_file += ".fai";
+
+        check_uncompressed(fasta_file);
+        fai = std::filesystem::exists(index_file) ? fasta_index{index_file} : fasta_index::create(file.data());
+        check_index(fasta_file);
+    }
+
+    /*!\brief Opens a FASTA file with the given index.
+     * \param[in] fasta_file The path of the FASTA file.
+     * \param[in] index      The index of the FASTA file.
+     * \throws seqan3::file_open_error if the FASTA file cannot be opened.
+     * \throws seqan3::format_error if the FASTA file is compressed or if the index does not fit the file.
+     */
+    indexed_fasta_file(std::filesystem::path const & fasta_file, fasta_index index) :
+        file{fasta_file},
+        fai{std::move(index)}
+    {
+        check_uncompressed(fasta_file);
+        check_index(fasta_file);
+    }
+    //!\}
+
+    //!\brief Returns the index of the file.
+    fasta_index const & index() const noexcept
+    {
+        return fai;
+    }
+
+    /*!\brief Returns the subsequence `[begin, end)` of the sequence `id`.
+     * \param[in] id    The id of the sequence.
+     * \param[in] begin The 0-based position of the first base.
+     * \param[in] end   The position behind the last base; positions behind the sequence are ignored.
+     * \returns A std::ranges::random_access_range and std::ranges::sized_range over `alphabet_type`.
+     * \throws std::out_of_range if the file contains no sequence `id`.
+     */
+    auto sequence(std::string_view const id, uint64_t const begin, uint64_t const end) const
+    {
+        std::optional<size_t> const position = fai.find(id);
+
+        if (!position)
+            throw std::out_of_range{"The FASTA file contains no sequence " + std::string{id} + "."};
+
+        return sequence(*position, begin, end);
+    }
+
+    /*!\brief Returns the sequence `id`.
+     * \param[in] id The id of the sequence.
+     * \returns A std::ranges::random_access_range and std::ranges::sized_range over `alphabet_type`.
+     * \throws std::out_of_range if the file contains no sequence `id`.
+     */
+    auto sequence(std::string_view const id) const
+    {
+        return sequence(id, 0u, std::numeric_limits<uint64_t>::max());
+    }
+
+    /*!\brief Returns the subsequence `[begin, end)` of the sequence at `position` in the index.
+     * \param[in] position The position of the sequence in seqan3::fasta_index::entries.
+     * \param[in] begin    The 0-based position of the first base.
+     * \param[in] end      The position behind the last base; positions behind the sequence are ignored.
+     * \returns A std::ranges::random_access_range and std::ranges::sized_range over `alphabet_type`.
+     * \throws std::out_of_range if `position` is not smaller than the number of sequences.
+     */
+    auto sequence(size_t const position, uint64_t begin, uint64_t end) const
+    {
+        fasta_index_entry const & entry = fai.entries().at(position);
+        end = std::min(end, entry.length);
+        begin = std::min(begin, end);
+
+        return std::views::iota(begin, end)
+             | std::views::transform(
+                   [data = file.data().data() + entry.offset, bases = entry.line_bases, width = entry.line_width](
+                       uint64_t const i)
+                   {
+                       return data[i / bases * width + i % bases];
+                   })
+             | views::char_to<alphabet_type>;
+    }
+
+private:
+    //!\brief Throws if the file is compressed.
+    void check_uncompressed(std::filesystem::path const & fasta_file) const
+    {
+        if (file.data().starts_with("\x1f\x8b"))
+            throw format_error{"The FASTA file " + fasta_file.string() + " is compressed and cannot be accessed "
+                               "randomly."};
+    }
+
+    //!\brief Throws if a sequence of the index ends behind the file.
+    void check_index(std::filesystem::path const & fasta_file) const
+    {
+        for (fasta_index_entry const & entry : fai.entries())
+        {
+            if (entry.length == 0u)
+                continue;
+
+            uint64_t const last = entry.length - 1;
+            if (entry.offset + last / entry.line_bases * entry.line_width + last % entry.line_bases
+                >= file.data().size())
+                throw format_error{"The index does not fit the FASTA file " + fasta_file.string()
+                                   + ", the sequence " + entry.id + " ends behind the file."};
+        }
+    }
+
+    //!\brief The mapped FASTA file.
+    detail::memory_mapped_file file;
+    //!\brief The index of the FASTA file.
+    fasta_index fai{};
+};
+
+} // namespace seqan3
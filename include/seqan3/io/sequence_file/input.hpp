@@ -15,6 +15,8 @@
 #include <cassert>
 #include <filesystem>
 #include <fstream>
+#include <memory>
+#include <span>
 #include <string>
 #include <variant>
 #include <vector>
@@ -30,6 +32,7 @@
 #include <seqan3/io/detail/record.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/io/sam_file/format_sam.hpp>
+#include <seqan3/io/sequence_file/detail/sequence_record_batch_parser.hpp>
 #include <seqan3/io/sequence_file/format_embl.hpp>
 #include <seqan3/io/sequence_file/format_fasta.hpp>
 #include <seqan3/io/sequence_file/format_fastq.hpp>
@@ -518,6 +521,19 @@ private:
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
+        if (options.parse_thread_count > 0 && !record_parser && !first_record_was_read)
+            record_parser = format->make_batch_parser(*secondary_stream, options);
+
+        if (record_parser)
+        {
+            if (!record_parser->next(record_buffer, position_buffer))
+            {
+                record_buffer.clear();
+                at_end = true;
+            }
+            return;
+        }
+
         // clear the record
         record_buffer.clear();
 
@@ -532,6 +548,16 @@ private:
         format->read_sequence_record(*secondary_stream, record_buffer, position_buffer, options);
     }
 
+    //!\brief Discards the records read ahead by the seqan3::detail::sequence_record_batch_parser before seeking.
+    void discard_read_ahead_records()
+    {
+        if (record_parser)
+            record_parser->reset();
+    }
+
+    //!\brief The type of the parser reading the records in parallel.
+    using batch_parser_type = detail::sequence_record_batch_parser<record_type>;
+
     /*!\brief An abstract base class to store the selected input format.
      *
      * \details
@@ -570,6 +596,15 @@ private:
                                           record_type & record_buffer,
                                           std::streampos & position_buffer,
                                           sequence_file_input_options_type const & options) = 0;
+
+        /*!\brief Creates a parser reading the records of the selected format from the given istream in parallel.
+         *
+         * \param[in, out] instream The input stream to extract the records from.
+         * \param[in] options User specific format options set from outside.
+         * \returns The parser, or `nullptr` if the format cannot be parsed in parallel.
+         */
+        virtual std::unique_ptr<batch_parser_type>
+        make_batch_parser(std::istream & instream, sequence_file_input_options_type const & options) const = 0;
     };
 
     /*!\brief The specific selected format to read the records from.
@@ -614,12 +649,48 @@ private:
             }
         }
 
+        //!\copydoc sequence_format_base::make_batch_parser
+        std::unique_ptr<batch_parser_type>
+        make_batch_parser(std::istream & instream, sequence_file_input_options_type const & options) const override
+        {
+            using exposer_t = detail::sequence_file_input_format_exposer<format_t>;
+
+            if constexpr (requires { exposer_t::find_records_end(std::span<char const>{}); })
+            {
+                // Every batch is parsed with its own copy of the format.
+                return std::make_unique<batch_parser_type>(
+                    instream,
+                    options.parse_thread_count,
+                    [](std::span<char const> data)
+                    {
+                        return exposer_t::find_records_end(data);
+                    },
+                    [format = _format, options](std::istream & stream,
+                                                record_type & record,
+                                                std::streampos & position) mutable
+                    {
+                        format.read_sequence_record(stream,
+                                                    options,
+                                                    position,
+                                                    detail::get_or_ignore<field::seq>(record),
+                                                    detail::get_or_ignore<field::id>(record),
+                                                    detail::get_or_ignore<field::qual>(record));
+                    });
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+
         //!\brief The selected format stored as a format exposer object.
         detail::sequence_file_input_format_exposer<format_t> _format{};
     };
 
     //!\brief An instance of the detected/selected format.
     std::unique_ptr<sequence_format_base> format{};
+    //!\brief Parses the records on seqan3::sequence_file_input_options::parse_thread_count threads.
+    std::unique_ptr<batch_parser_type> record_parser{};
 
     //!\brief Befriend iterator so it can access the buffers.
     friend iterator;
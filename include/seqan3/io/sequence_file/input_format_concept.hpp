@@ -48,6 +48,14 @@ public:
     {
         format_type::read_sequence_record(std::forward<ts>(args)...);
     }
+
+    //!\brief Forwards to `find_records_end` of the formats that can be parsed in parallel, e.g. seqan3::format_fastq.
+    template <typename... ts>
+        requires requires (ts &&... args) { format_type::find_records_end(std::forward<ts>(args)...); }
+    static size_t find_records_end(ts &&... args)
+    {
+        return format_type::find_records_end(std::forward<ts>(args)...);
+    }
 };
 
 } // namespace seqan3::detail
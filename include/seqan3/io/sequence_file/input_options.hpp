@@ -31,6 +31,15 @@ struct sequence_file_input_options
     bool embl_genbank_complete_header = false;
     //!\brief Remove spaces after ">" (or ";") before the actual ID.
     bool fasta_ignore_blanks_before_id = true;
+    /*!\brief The number of threads parsing the records of a FASTA or FASTQ file; `0` parses them on the reading thread.
+     *
+     * \details
+     *
+     * If greater than `0`, a separate thread reads the (decompressed) file in chunks that are cut at record
+     * boundaries, and the chunks are parsed on this many threads. The records are still returned in the order of the
+     * file. This option has no effect on the other formats and must be set before the first record is read.
+     */
+    size_t parse_thread_count{0};
 };
 
 } // namespace seqan3
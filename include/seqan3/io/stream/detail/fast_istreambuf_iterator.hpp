@@ -15,10 +15,13 @@
 
 #include <algorithm>
 #include <cassert>
+#include <concepts>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include <seqan3/io/stream/detail/simd_find.hpp>
 #include <seqan3/io/stream/detail/stream_buffer_exposer.hpp>
 
 namespace seqan3::detail
@@ -105,7 +108,7 @@ public:
 
         while (number_of_seen_fields < number_of_fields - 1)
         {
-            ptr = std::find(ptr, static_cast<char const *>(stream_buf->egptr()), field_sep);
+            ptr = simd_find(ptr, stream_buf->egptr(), field_sep);
 
             if (ptr != stream_buf->egptr()) // found an end of field
             {
@@ -125,7 +128,7 @@ public:
 
         while (true) // Note: Might run idefinitely in release mode if no record_end is in input.
         {
-            ptr = std::find(ptr, static_cast<char const *>(stream_buf->egptr()), record_end);
+            ptr = simd_find(ptr, stream_buf->egptr(), record_end);
 
             if (ptr == stream_buf->egptr()) // stop_chr could not be found in current buffer
             {
@@ -159,6 +162,44 @@ public:
             raw_record[i] = std::string_view{data_begin + field_positions[i - 1] + 1, data_begin + field_positions[i]};
     }
 
+    /*!\brief Moves to the first character for which `predicate` is `true`, or to the end of the stream.
+     * \param[in] predicate The predicate, e.g. `seqan3::is_char<'\n'>`.
+     * \param[in] callback  Invoked with the skipped characters, in chunks as large as the stream buffer allows.
+     *
+     * \details
+     *
+     * The stream buffer is scanned with seqan3::detail::simd_find_if, i.e. in blocks of 32 characters for most
+     * seqan3::detail::char_predicate, instead of incrementing the iterator for every character.
+     */
+    template <typename predicate_t, std::invocable<std::string_view> callback_t>
+        requires std::same_as<char_t, char>
+    void skip_until(predicate_t const & predicate, callback_t && callback)
+    {
+        assert(stream_buf != nullptr);
+
+        while (stream_buf->gptr() != stream_buf->egptr())
+        {
+            char const * const chunk_begin = stream_buf->gptr();
+            char const * const chunk_end = simd_find_if(chunk_begin, stream_buf->egptr(), predicate);
+
+            callback(std::string_view{chunk_begin, chunk_end});
+            stream_buf->gbump(chunk_end - chunk_begin);
+
+            if (chunk_end != stream_buf->egptr())
+                return;
+
+            stream_buf->underflow();
+        }
+    }
+
+    //!\overload
+    template <typename predicate_t>
+        requires std::same_as<char_t, char>
+    void skip_until(predicate_t const & predicate)
+    {
+        skip_until(predicate, [](std::string_view) {});
+    }
+
     //!\brief Cache `size` bytes from input stream.
     std::string_view cache_bytes(int32_t const size)
     {
@@ -0,0 +1,179 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::simd_find_if and seqan3::detail::simd_find.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include <seqan3/utility/char_operations/predicate_detail.hpp>
+#include <seqan3/utility/simd/detail/builtin_simd_intrinsics.hpp>
+
+namespace seqan3::detail
+{
+
+//!\brief A closed interval of characters, e.g. `{'\t', '\r'}`.
+//!\ingroup io_stream
+struct char_interval
+{
+    //!\brief The first character in the interval.
+    unsigned char first{};
+    //!\brief The last character in the interval.
+    unsigned char last{};
+};
+
+/*!\brief The number of maximal intervals of characters for which the seqan3::detail::char_predicate is `true`.
+ * \ingroup io_stream
+ * \tparam predicate_t The type of the predicate.
+ */
+template <char_predicate predicate_t>
+inline constexpr size_t char_interval_count = []() constexpr
+{
+    size_t count{};
+    for (size_t c = 0; c < 256; ++c)
+        count += predicate_t::data[c] && (c == 0 || !predicate_t::data[c - 1]);
+    return count;
+}();
+
+/*!\brief The maximal intervals of characters for which the seqan3::detail::char_predicate is `true`; `EOF` is ignored.
+ * \ingroup io_stream
+ * \tparam predicate_t The type of the predicate.
+ */
+template <char_predicate predicate_t>
+inline constexpr std::array<char_interval, char_interval_count<predicate_t>> char_intervals = []() constexpr
+{
+    std::array<char_interval, char_interval_count<predicate_t>> intervals{};
+    size_t count{};
+    for (size_t c = 0; c < 256; ++c)
+    {
+        if (!predicate_t::data[c])
+            continue;
+
+        if (c == 0 || !predicate_t::data[c - 1])
+            intervals[count++].first = static_cast<unsigned char>(c);
+
+        intervals[count - 1].last = static_cast<unsigned char>(c);
+    }
+    return intervals;
+}();
+
+/*!\brief Returns the first character in `[first, last)` that lies in one of the given intervals, or `last`.
+ * \ingroup io_stream
+ * \tparam count The number of intervals.
+ * \param[in] first     The begin of the characters.
+ * \param[in] last      The end of the characters.
+ * \param[in] intervals The intervals of characters to find.
+ *
+ * \details
+ *
+ * Compares 32 characters at once with AVX2 and 16 characters with SSE2; the remaining ones are compared one at a
+ * time. A character `c` lies in the interval `[f, l]` iff `c - f <= l - f` as unsigned 8-bit integers, i.e. every
+ * interval costs a subtraction, a minimum and a comparison per block.
+ */
+template <size_t count>
+inline char const *
+simd_find_first_in(char const * first, char const * const last, std::array<char_interval, count> const & intervals)
+{
+#if defined(__AVX2__)
+    for (; last - first >= 32; first += 32)
+    {
+        __m256i const block = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(first));
+        __m256i match = _mm256_setzero_si256();
+        for (char_interval const interval : intervals)
+        {
+            __m256i const shifted = _mm256_sub_epi8(block, _mm256_set1_epi8(static_cast<char>(interval.first)));
+            __m256i const width = _mm256_set1_epi8(static_cast<char>(interval.last - interval.first));
+            match = _mm256_or_si256(match, _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, width), shifted));
+        }
+
+        if (uint32_t const mask = _mm256_movemask_epi8(match); mask != 0)
+            return first + std::countr_zero(mask);
+    }
+#endif // defined(__AVX2__)
+
+#if defined(__SSE2__)
+    for (; last - first >= 16; first += 16)
+    {
+        __m128i const block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+        __m128i match = _mm_setzero_si128();
+        for (char_interval const interval : intervals)
+        {
+            __m128i const shifted = _mm_sub_epi8(block, _mm_set1_epi8(static_cast<char>(interval.first)));
+            __m128i const width = _mm_set1_epi8(static_cast<char>(interval.last - interval.first));
+            match = _mm_or_si128(match, _mm_cmpeq_epi8(_mm_min_epu8(shifted, width), shifted));
+        }
+
+        if (uint32_t const mask = static_cast<uint32_t>(_mm_movemask_epi8(match)); mask != 0)
+            return first + std::countr_zero(mask);
+    }
+#endif // defined(__SSE2__)
+
+    auto const in_intervals = [&intervals](unsigned char const c)
+    {
+        return std::ranges::any_of(intervals,
+                                   [c](char_interval const interval)
+                                   {
+                                       return static_cast<unsigned char>(c - interval.first)
+                                           <= static_cast<unsigned char>(interval.last - interval.first);
+                                   });
+    };
+
+    for (; first != last && !in_intervals(static_cast<unsigned char>(*first)); ++first)
+    {}
+
+    return first;
+}
+
+/*!\brief Returns the first character in `[first, last)` for which the predicate is `true`, or `last`.
+ * \ingroup io_stream
+ * \tparam predicate_t The type of the predicate.
+ * \param[in] first     The begin of the characters.
+ * \param[in] last      The end of the characters.
+ * \param[in] predicate The predicate, e.g. `seqan3::is_char<'\n'>` or `seqan3::is_space`.
+ *
+ * \details
+ *
+ * A seqan3::detail::char_predicate that is `true` for at most four intervals of characters, e.g. `seqan3::is_space`,
+ * `seqan3::is_cntrl || seqan3::is_blank` or `!seqan3::is_space`, is evaluated on whole blocks of characters, see
+ * seqan3::detail::simd_find_first_in. Other predicates are evaluated on every character.
+ */
+template <typename predicate_t>
+inline char const * simd_find_if(char const * const first, char const * const last, predicate_t const & predicate)
+{
+    if constexpr (char_predicate<predicate_t>)
+    {
+        if constexpr (char_interval_count<predicate_t> <= 4)
+            return simd_find_first_in(first, last, char_intervals<predicate_t>);
+        else
+            return std::find_if(first, last, predicate);
+    }
+    else
+    {
+        return std::find_if(first, last, predicate);
+    }
+}
+
+/*!\brief Returns the first occurrence of `value` in `[first, last)`, or `last`.
+ * \ingroup io_stream
+ * \param[in] first The begin of the characters.
+ * \param[in] last  The end of the characters.
+ * \param[in] value The character to find.
+ */
+inline char const * simd_find(char const * const first, char const * const last, char const value)
+{
+    unsigned char const c = static_cast<unsigned char>(value);
+    return simd_find_first_in(first, last, std::array<char_interval, 1>{char_interval{c, c}});
+}
+
+} // namespace seqan3::detail
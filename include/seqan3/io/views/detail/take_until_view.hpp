@@ -22,8 +22,11 @@
 #include <seqan3/core/detail/iterator_traits.hpp>
 #include <seqan3/core/range/detail/adaptor_from_functor.hpp>
 #include <seqan3/core/range/detail/inherited_iterator_base.hpp>
+#include <seqan3/core/range/detail/misc.hpp>
 #include <seqan3/core/range/type_traits.hpp>
 #include <seqan3/io/exception.hpp>
+#include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
+#include <seqan3/utility/char_operations/predicate_detail.hpp>
 #include <seqan3/utility/range/concept.hpp>
 #include <seqan3/utility/type_traits/detail/transformation_trait_or.hpp>
 
@@ -184,6 +187,13 @@ public:
             return basic_sentinel<true>{std::ranges::cend(urange), fun};
     }
     //!\}
+
+    //!\brief Returns a copy of the underlying range.
+    urng_t base() const &
+        requires std::copy_constructible<urng_t>
+    {
+        return urange;
+    }
 };
 
 //!\brief Type deduction guide that strips references.
@@ -601,4 +611,46 @@ inline constexpr auto take_until_and_consume = take_until_fn<false, true>{};
  */
 inline constexpr auto take_until_or_throw_and_consume = take_until_fn<true, true>{};
 
+// ============================================================================
+//  consume (overload for seqan3::detail::istreambuf)
+// ============================================================================
+
+/*!\brief Consumes a seqan3::detail::take_until view over a seqan3::detail::istreambuf by scanning the stream buffer.
+ * \ingroup io_views
+ * \tparam fun_t       The type of the predicate; must model seqan3::detail::char_predicate.
+ * \tparam or_throw    Whether to throw an exception when the stream ends before the predicate is `true`.
+ * \tparam and_consume Whether to also consume the characters for which the predicate is `true`.
+ * \param[in] view     The view to consume.
+ * \throws seqan3::unexpected_end_of_input If `or_throw` is set and the stream ends before the predicate is `true`.
+ *
+ * \details
+ *
+ * Has the same effect as the generic seqan3::detail::consume, e.g. on
+ * `detail::consume(stream_view | detail::take_line_or_throw)`, but skips the characters with
+ * seqan3::detail::fast_istreambuf_iterator::skip_until instead of evaluating the predicate on every character.
+ */
+template <typename fun_t, bool or_throw, bool and_consume>
+    requires char_predicate<fun_t>
+void consume(view_take_until<std::ranges::subrange<fast_istreambuf_iterator<char>, std::default_sentinel_t>,
+                             fun_t,
+                             or_throw,
+                             and_consume> && view)
+{
+    auto it = std::ranges::begin(view.base());
+    std::remove_cvref_t<fun_t> const predicate{};
+
+    it.skip_until(predicate);
+
+    if (it == std::default_sentinel)
+    {
+        if constexpr (or_throw)
+            throw unexpected_end_of_input{"Reached end of input before functor evaluated to true."};
+        else
+            return;
+    }
+
+    if constexpr (and_consume)
+        it.skip_until(!predicate);
+}
+
 } // namespace seqan3::detail
@@ -127,7 +127,9 @@
 
 #pragma once
 
+#include <seqan3/search/chaining/all.hpp>
 #include <seqan3/search/configuration/all.hpp>
+#include <seqan3/search/database_search/all.hpp>
 #include <seqan3/search/dream_index/all.hpp>
 #include <seqan3/search/fm_index/all.hpp>
 #include <seqan3/search/kmer_index/all.hpp>
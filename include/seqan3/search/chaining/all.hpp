@@ -0,0 +1,28 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Meta-header for the \link search_chaining Search / Chaining submodule \endlink.
+ */
+
+/*!\defgroup search_chaining Chaining
+ * \brief Provides seqan3::chain_anchors, which computes colinear chains of seed hits.
+ * \ingroup search
+ * \see search
+ *
+ * \details
+ *
+ * Read mappers typically find exact seed hits (anchors) of a read in the reference, e.g. shared minimisers or k-mer
+ * search hits, and chain them before aligning the best candidate regions. seqan3::chain_anchors computes the best
+ * colinear chains of a set of seqan3::anchor objects with sparse dynamic programming.
+ */
+
+#pragma once
+
+#include <seqan3/search/chaining/anchor.hpp>
+#include <seqan3/search/chaining/chain_anchors.hpp>
+#include <seqan3/search/chaining/configuration/all.hpp>
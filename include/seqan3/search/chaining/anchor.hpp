@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::anchor and seqan3::anchor_chain.
+ */
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <vector>
+
+#include <seqan3/core/debug_stream/debug_stream_type.hpp>
+#include <seqan3/core/debug_stream/range.hpp>
+
+namespace seqan3
+{
+
+/*!\brief An exact match of a part of the query in a reference, e.g. a shared minimiser or a k-mer search hit.
+ * \ingroup search_chaining
+ *
+ * \details
+ *
+ * The anchor covers the positions `[reference_position, reference_position + span)` of the reference with the id
+ * `reference_id` and the positions `[query_position, query_position + span)` of the query.
+ * Anchors can, for example, be obtained from the seqan3::search_result of a k-mer search (the reference id and the
+ * reference begin position of the hit, the position of the k-mer in the query and `k` as span).
+ */
+struct anchor
+{
+    //!\brief The id of the reference the anchor lies in.
+    size_t reference_id{};
+    //!\brief The begin position of the anchor in the reference.
+    size_t reference_position{};
+    //!\brief The begin position of the anchor in the query.
+    size_t query_position{};
+    //!\brief The number of bases covered by the anchor.
+    size_t span{};
+
+    //!\brief Anchors are ordered by their reference id, reference position, query position and span.
+    friend constexpr auto operator<=>(anchor const &, anchor const &) = default;
+};
+
+/*!\brief A colinear chain of anchors as computed by seqan3::chain_anchors.
+ * \ingroup search_chaining
+ *
+ * \details
+ *
+ * The anchors of a chain lie in the same reference and do not overlap. They are sorted by their position, i.e. every
+ * anchor ends before the next anchor begins, both in the reference and in the query.
+ */
+struct anchor_chain
+{
+    //!\brief The score of the chain, i.e. the number of covered bases minus the gap costs.
+    double score{};
+    //!\brief The anchors of the chain.
+    std::vector<anchor> anchors{};
+
+    //!\brief Two chains are equal if they have the same score and anchors.
+    friend bool operator==(anchor_chain const &, anchor_chain const &) = default;
+};
+
+/*!\name Formatted output
+ * \{
+ */
+/*!\brief Prints an anchor to the seqan3::debug_stream.
+ * \tparam char_t The underlying character type for the seqan3::debug_stream_type.
+ * \param[in,out] stream The output stream.
+ * \param[in] value The anchor to print.
+ * \relates seqan3::debug_stream_type
+ */
+template <typename char_t>
+inline debug_stream_type<char_t> & operator<<(debug_stream_type<char_t> & stream, anchor const & value)
+{
+    return stream << "<reference_id:" << value.reference_id << ", reference_pos:" << value.reference_position
+                  << ", query_pos:" << value.query_position << ", span:" << value.span << ">";
+}
+
+/*!\brief Prints a chain to the seqan3::debug_stream.
+ * \tparam char_t The underlying character type for the seqan3::debug_stream_type.
+ * \param[in,out] stream The output stream.
+ * \param[in] value The chain to print.
+ * \relates seqan3::debug_stream_type
+ */
+template <typename char_t>
+inline debug_stream_type<char_t> & operator<<(debug_stream_type<char_t> & stream, anchor_chain const & value)
+{
+    return stream << "<score:" << value.score << ", anchors:" << value.anchors << ">";
+}
+//!\}
+
+} // namespace seqan3
@@ -0,0 +1,136 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::chain_anchors.
+ */
+
+#pragma once
+
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
+#include <seqan3/core/algorithm/detail/execution_handler_sequential.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/search/chaining/anchor.hpp>
+#include <seqan3/search/chaining/configuration/default_configuration.hpp>
+#include <seqan3/search/chaining/configuration/parallel.hpp>
+#include <seqan3/search/chaining/detail/chaining_algorithm.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+namespace seqan3
+{
+/*!\brief Computes the best colinear chains of a set of anchors.
+ * \ingroup search_chaining
+ * \tparam anchors_t The type of the anchor range; must model std::ranges::input_range over seqan3::anchor.
+ * \tparam configuration_t The type of the chaining configuration.
+ * \param[in] anchors The anchors to chain, e.g. the shared minimisers or the k-mer search hits of a read.
+ * \param[in] cfg A configuration object specifying the chaining parameters (see \ref chaining_configuration).
+ * \returns The chains as a std::vector of seqan3::anchor_chain, sorted by their score in decreasing order.
+ *
+ * \details
+ *
+ * \header_file{seqan3/search/chaining/chain_anchors.hpp}
+ *
+ * A chain is a sequence of anchors of the same reference that do not overlap and are colinear, i.e. every anchor
+ * ends before the next anchor begins, both in the reference and in the query. The score of a chain is the number of
+ * bases covered by its anchors minus the costs of the gaps between them (see \ref chaining_configuration).
+ * Every anchor is reported in at most one chain. Anchors with a span of `0` are ignored.
+ *
+ * The chains can be used to select the candidate regions of a read, which are then aligned with
+ * seqan3::align_pairwise.
+ *
+ * ### Complexity
+ *
+ * \f$O(n \log n)\f$ for \f$n\f$ anchors, or \f$O(n \cdot c)\f$ with seqan3::chain_cfg::look_back of `c` anchors.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/chaining/chain_anchors.cpp
+ */
+template <std::ranges::input_range anchors_t, typename configuration_t = decltype(chain_cfg::default_configuration)>
+    requires std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<anchors_t>>, anchor>
+inline std::vector<anchor_chain> chain_anchors(anchors_t && anchors,
+                                               configuration_t const & cfg = chain_cfg::default_configuration)
+{
+    configuration const complete_config{cfg};
+    detail::chaining_algorithm algorithm{complete_config};
+    return algorithm(std::forward<anchors_t>(anchors));
+}
+
+/*!\brief Computes the best colinear chains of every anchor set of a batch, optionally in parallel.
+ * \ingroup search_chaining
+ * \tparam anchor_sets_t The type of the batch; must model std::ranges::forward_range over ranges that model
+ *                       std::ranges::input_range over seqan3::anchor.
+ * \tparam configuration_t The type of the chaining configuration.
+ * \param[in] anchor_sets The anchor sets to chain, e.g. the anchors of every read.
+ * \param[in] cfg A configuration object specifying the chaining parameters (see \ref chaining_configuration).
+ * \returns The chains of every anchor set in the order of the batch.
+ * \throws std::runtime_error if seqan3::chain_cfg::parallel is given without a number of threads.
+ *
+ * \details
+ *
+ * \header_file{seqan3/search/chaining/chain_anchors.hpp}
+ *
+ * Every anchor set is chained independently like in the overload for a single anchor set. With
+ * seqan3::chain_cfg::parallel, the anchor sets are distributed over the given number of threads.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/chaining/chain_anchors_batch.cpp
+ */
+template <std::ranges::forward_range anchor_sets_t,
+          typename configuration_t = decltype(chain_cfg::default_configuration)>
+    requires std::ranges::input_range<std::ranges::range_reference_t<anchor_sets_t>>
+          && std::same_as<std::ranges::range_value_t<std::ranges::range_reference_t<anchor_sets_t>>, anchor>
+inline std::vector<std::vector<anchor_chain>>
+chain_anchors(anchor_sets_t && anchor_sets, configuration_t const & cfg = chain_cfg::default_configuration)
+{
+    configuration const complete_config{cfg};
+    using complete_configuration_t = decltype(complete_config);
+    using execution_handler_t = std::conditional_t<complete_configuration_t::template exists<chain_cfg::parallel>(),
+                                                   detail::execution_handler_parallel,
+                                                   detail::execution_handler_sequential>;
+
+    auto select_execution_handler = [parallel = complete_config.get_or(chain_cfg::parallel{})]()
+    {
+        if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
+        {
+            auto thread_count = parallel.thread_count;
+            if (!thread_count)
+                throw std::runtime_error{"You must configure the number of threads in seqan3::chain_cfg::parallel."};
+
+            return execution_handler_t{*thread_count};
+        }
+        else
+        {
+            return execution_handler_t{};
+        }
+    };
+
+    std::vector<std::vector<anchor_chain>> chains(std::ranges::distance(anchor_sets));
+    detail::chaining_algorithm algorithm{complete_config};
+
+    // Every task writes the chains of one anchor set into its own slot of the result.
+    select_execution_handler().bulk_execute(
+        [&algorithm](auto && indexed_anchors, auto && callback)
+        {
+            auto && [index, anchors] = indexed_anchors;
+            callback(index, algorithm(anchors));
+        },
+        views::zip(std::views::iota(size_t{0}, chains.size()), std::forward<anchor_sets_t>(anchor_sets)),
+        [&chains](size_t const index, std::vector<anchor_chain> result)
+        {
+            chains[index] = std::move(result);
+        });
+
+    return chains;
+}
+
+} // namespace seqan3
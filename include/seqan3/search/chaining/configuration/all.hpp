@@ -0,0 +1,51 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Meta-header for the \link chaining_configuration chaining configuration module \endlink.
+ */
+
+/*!\namespace seqan3::chain_cfg
+ * \brief A special sub namespace for the chaining configurations.
+ */
+
+/*!\defgroup chaining_configuration Configuration
+ * \ingroup search_chaining
+ * \see search_chaining
+ * \brief Data structures and utility functions for configuring the chaining algorithm.
+ *
+ * \details
+ *
+ * The seqan3::chain_anchors algorithm uses a configuration object to determine the gap cost model, the maximal gap
+ * between two chained anchors, the minimal score of a reported chain, whether the exact range maximum computation
+ * or the bounded look-back is used and how many threads chain a batch of anchor sets.
+ * These configurations exist in their own namespace, namely seqan3::chain_cfg, to disambiguate them from the
+ * configuration of other algorithms.
+ *
+ * If no configuration is provided upon invoking seqan3::chain_anchors, seqan3::chain_cfg::default_configuration is
+ * used. Elements that are not given are set to their default values.
+ *
+ * | **Configuration group**                                          | **0** | **1** | **2** | **3** | **4** |
+ * |:-----------------------------------------------------------------|:-----:|:-----:|:-----:|:-----:|:-----:|
+ * | \ref seqan3::chain_cfg::gap_cost_linear "0: Gap cost"            |  ❌   |  ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref seqan3::chain_cfg::look_back "1: Look-back"                 |  ✅   |  ❌   |  ✅   |  ✅   |  ✅   |
+ * | \ref seqan3::chain_cfg::max_gap "2: Max gap"                     |  ✅   |  ✅   |  ❌   |  ✅   |  ✅   |
+ * | \ref seqan3::chain_cfg::min_score "3: Min score"                 |  ✅   |  ✅   |  ✅   |  ❌   |  ✅   |
+ * | \ref seqan3::chain_cfg::parallel "4: Parallel"                   |  ✅   |  ✅   |  ✅   |  ✅   |  ❌   |
+ *
+ * The gap cost group consists of seqan3::chain_cfg::gap_cost_linear and seqan3::chain_cfg::gap_cost_log.
+ * seqan3::chain_cfg::gap_cost_log can only be used together with seqan3::chain_cfg::look_back.
+ */
+
+#pragma once
+
+#include <seqan3/search/chaining/configuration/default_configuration.hpp>
+#include <seqan3/search/chaining/configuration/gap_cost.hpp>
+#include <seqan3/search/chaining/configuration/look_back.hpp>
+#include <seqan3/search/chaining/configuration/max_gap.hpp>
+#include <seqan3/search/chaining/configuration/min_score.hpp>
+#include <seqan3/search/chaining/configuration/parallel.hpp>
@@ -0,0 +1,28 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the default configuration for seqan3::chain_anchors.
+ */
+
+#pragma once
+
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/search/chaining/configuration/gap_cost.hpp>
+#include <seqan3/search/chaining/configuration/max_gap.hpp>
+#include <seqan3/search/chaining/configuration/min_score.hpp>
+
+namespace seqan3::chain_cfg
+{
+
+/*!\brief The default configuration: Report all chains with the linear gap cost and a maximal gap of 5000 bases.
+ * \ingroup chaining_configuration
+ * \see chaining_configuration
+ */
+constexpr configuration default_configuration = gap_cost_linear{} | max_gap{} | min_score{};
+
+} // namespace seqan3::chain_cfg
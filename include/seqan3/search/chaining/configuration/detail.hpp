@@ -0,0 +1,76 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides compatibility matrix for chaining configurations.
+ */
+
+#pragma once
+
+#include <seqan3/core/configuration/detail/concept.hpp>
+
+namespace seqan3::detail
+{
+
+// ----------------------------------------------------------------------------
+// chain_config_id
+// ----------------------------------------------------------------------------
+
+/*!\brief Specifies an id for every configuration element.
+ * \ingroup chaining_configuration
+ * \see chaining_configuration
+ *
+ * \details
+ *
+ * The seqan3::detail::chain_config_id is used to identify a specific chaining configuration element independent of
+ * its concrete type and position within the \ref seqan3::chain_cfg "chaining configuration object".
+ */
+enum struct chain_config_id : uint8_t
+{
+    gap_cost,  //!< Identifier for the gap cost configuration (linear or logarithmic).
+    look_back, //!< Identifier for the bounded look-back configuration.
+    max_gap,   //!< Identifier for the maximal gap configuration.
+    min_score, //!< Identifier for the minimal chain score configuration.
+    parallel,  //!< Identifier for the parallel execution configuration.
+    //!\cond
+    // ATTENTION: Must always be the last item; will be used to determine the number of ids.
+    SIZE //!< Determines the size of the enum.
+    //!\endcond
+};
+
+// ----------------------------------------------------------------------------
+// chain_config_validation_matrix
+// ----------------------------------------------------------------------------
+
+/*!\brief Compatibility matrix to check how chaining configuration elements can be combined.
+ * \ingroup chaining_configuration
+ * \see chaining_configuration
+ *
+ * \details
+ *
+ * This matrix is used to check if the specified chaining configurations can be combined with each other.
+ * A cell value `true`, indicates that the corresponding seqan3::detail::chain_config_id in the current column can
+ * be combined with the associated seqan3::detail::chain_config_id in the current row. The size of the matrix is
+ * determined by the enum value `SIZE` of seqan3::detail::chain_config_id.
+ */
+template <>
+inline constexpr std::array<std::array<bool, static_cast<uint8_t>(chain_config_id::SIZE)>,
+                            static_cast<uint8_t>(chain_config_id::SIZE)>
+    compatibility_table<chain_config_id> = {{
+        // gap_cost,
+        // |  look_back,
+        // |  |  max_gap,
+        // |  |  |  min_score,
+        // |  |  |  |  parallel
+        {0, 1, 1, 1, 1}, // gap_cost
+        {1, 0, 1, 1, 1}, // look_back
+        {1, 1, 0, 1, 1}, // max_gap
+        {1, 1, 1, 0, 1}, // min_score
+        {1, 1, 1, 1, 0}  // parallel
+    }};
+
+} // namespace seqan3::detail
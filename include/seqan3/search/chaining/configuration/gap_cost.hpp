@@ -0,0 +1,108 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::chain_cfg::gap_cost_linear and seqan3::chain_cfg::gap_cost_log.
+ */
+
+#pragma once
+
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/search/chaining/configuration/detail.hpp>
+
+namespace seqan3::chain_cfg
+{
+/*!\brief Penalises every base between two chained anchors linearly.
+ * \ingroup chaining_configuration
+ *
+ * \details
+ *
+ * If two anchors are chained, every base between the end of the first anchor and the begin of the second anchor
+ * costs `weight`, both in the reference and in the query. The cost of connecting two anchors whose gaps in the
+ * reference and in the query are \f$g_r\f$ and \f$g_q\f$ is thus \f$weight \cdot (g_r + g_q)\f$.
+ * This is the default gap cost model. It can be computed exactly in \f$O(n \log n)\f$ time for \f$n\f$ anchors.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/chaining/chain_cfg_gap_cost.cpp
+ */
+class gap_cost_linear : private pipeable_config_element
+{
+public:
+    //!\brief The cost of a single base between two chained anchors [default: 0.5].
+    double weight{0.5};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr gap_cost_linear() noexcept = default;                                    //!< Defaulted
+    constexpr gap_cost_linear(gap_cost_linear const &) noexcept = default;             //!< Defaulted
+    constexpr gap_cost_linear(gap_cost_linear &&) noexcept = default;                  //!< Defaulted
+    constexpr gap_cost_linear & operator=(gap_cost_linear const &) noexcept = default; //!< Defaulted
+    constexpr gap_cost_linear & operator=(gap_cost_linear &&) noexcept = default;      //!< Defaulted
+    ~gap_cost_linear() noexcept = default;                                             //!< Defaulted
+
+    /*!\brief Initialises the linear gap cost.
+     * \param weight \copybrief weight
+     */
+    constexpr gap_cost_linear(double const weight) noexcept : weight{weight}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::chain_config_id id{seqan3::detail::chain_config_id::gap_cost};
+};
+
+/*!\brief Penalises the difference of the gaps between two chained anchors like minimap2.
+ * \ingroup chaining_configuration
+ *
+ * \details
+ *
+ * If two anchors are chained and \f$l\f$ is the absolute difference between the gap in the reference and the gap
+ * in the query, the cost of connecting the anchors is
+ * \f$linear\_factor \cdot \bar{w} \cdot l + log\_factor \cdot \log_2 l\f$, where \f$\bar{w}\f$ is the average span of
+ * the anchors. Gaps of the same length in both sequences, i.e. anchors on the same diagonal, are free.
+ *
+ * This cost cannot be decomposed for the range maximum computation, hence it requires seqan3::chain_cfg::look_back.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/chaining/chain_cfg_gap_cost.cpp
+ */
+class gap_cost_log : private pipeable_config_element
+{
+public:
+    //!\brief The factor of the linear term, which is multiplied with the average anchor span [default: 0.01].
+    double linear_factor{0.01};
+    //!\brief The factor of the logarithmic term [default: 0.5].
+    double log_factor{0.5};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr gap_cost_log() noexcept = default;                                 //!< Defaulted
+    constexpr gap_cost_log(gap_cost_log const &) noexcept = default;             //!< Defaulted
+    constexpr gap_cost_log(gap_cost_log &&) noexcept = default;                  //!< Defaulted
+    constexpr gap_cost_log & operator=(gap_cost_log const &) noexcept = default; //!< Defaulted
+    constexpr gap_cost_log & operator=(gap_cost_log &&) noexcept = default;      //!< Defaulted
+    ~gap_cost_log() noexcept = default;                                          //!< Defaulted
+
+    /*!\brief Initialises the logarithmic gap cost.
+     * \param linear_factor \copybrief linear_factor
+     * \param log_factor \copybrief log_factor
+     */
+    constexpr gap_cost_log(double const linear_factor, double const log_factor) noexcept :
+        linear_factor{linear_factor},
+        log_factor{log_factor}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::chain_config_id id{seqan3::detail::chain_config_id::gap_cost};
+};
+
+} // namespace seqan3::chain_cfg
@@ -0,0 +1,62 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::chain_cfg::look_back.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/search/chaining/configuration/detail.hpp>
+
+namespace seqan3::chain_cfg
+{
+/*!\brief Chains every anchor only with a bounded number of preceding anchors.
+ * \ingroup chaining_configuration
+ *
+ * \details
+ *
+ * Instead of the exact range maximum computation, every anchor only considers the `count` anchors that precede it
+ * in the reference as its predecessor in a chain, like the chaining of minimap2. This bounds the running time to
+ * \f$O(n \cdot count)\f$ for \f$n\f$ anchors and works with every gap cost model, but might miss the optimal
+ * predecessor if there are many anchors in a small region of the reference, e.g. in repeats.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/chaining/chain_cfg_look_back.cpp
+ */
+class look_back : private pipeable_config_element
+{
+public:
+    //!\brief The maximal number of preceding anchors that are considered as predecessor [default: 50].
+    size_t count{50};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr look_back() noexcept = default;                              //!< Defaulted
+    constexpr look_back(look_back const &) noexcept = default;             //!< Defaulted
+    constexpr look_back(look_back &&) noexcept = default;                  //!< Defaulted
+    constexpr look_back & operator=(look_back const &) noexcept = default; //!< Defaulted
+    constexpr look_back & operator=(look_back &&) noexcept = default;      //!< Defaulted
+    ~look_back() noexcept = default;                                       //!< Defaulted
+
+    /*!\brief Initialises the number of preceding anchors.
+     * \param count \copybrief count
+     */
+    constexpr look_back(size_t const count) noexcept : count{count}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::chain_config_id id{seqan3::detail::chain_config_id::look_back};
+};
+
+} // namespace seqan3::chain_cfg
@@ -0,0 +1,60 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::chain_cfg::max_gap.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/search/chaining/configuration/detail.hpp>
+
+namespace seqan3::chain_cfg
+{
+/*!\brief Sets the maximal gap between two chained anchors.
+ * \ingroup chaining_configuration
+ *
+ * \details
+ *
+ * Two anchors are only chained if the gap between the end of the first and the begin of the second anchor is at most
+ * `length` bases, both in the reference and in the query.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/chaining/chain_cfg_look_back.cpp
+ */
+class max_gap : private pipeable_config_element
+{
+public:
+    //!\brief The maximal gap between two chained anchors [default: 5000].
+    size_t length{5000};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr max_gap() noexcept = default;                            //!< Defaulted
+    constexpr max_gap(max_gap const &) noexcept = default;             //!< Defaulted
+    constexpr max_gap(max_gap &&) noexcept = default;                  //!< Defaulted
+    constexpr max_gap & operator=(max_gap const &) noexcept = default; //!< Defaulted
+    constexpr max_gap & operator=(max_gap &&) noexcept = default;      //!< Defaulted
+    ~max_gap() noexcept = default;                                     //!< Defaulted
+
+    /*!\brief Initialises the maximal gap.
+     * \param length \copybrief length
+     */
+    constexpr max_gap(size_t const length) noexcept : length{length}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::chain_config_id id{seqan3::detail::chain_config_id::max_gap};
+};
+
+} // namespace seqan3::chain_cfg
@@ -0,0 +1,57 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::chain_cfg::min_score.
+ */
+
+#pragma once
+
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/search/chaining/configuration/detail.hpp>
+
+namespace seqan3::chain_cfg
+{
+/*!\brief Sets the minimal score of a reported chain.
+ * \ingroup chaining_configuration
+ *
+ * \details
+ *
+ * Only chains whose score is at least `score` are reported. By default, every chain is reported.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/chaining/chain_cfg_look_back.cpp
+ */
+class min_score : private pipeable_config_element
+{
+public:
+    //!\brief The minimal score of a reported chain [default: 0].
+    double score{0};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr min_score() noexcept = default;                              //!< Defaulted
+    constexpr min_score(min_score const &) noexcept = default;             //!< Defaulted
+    constexpr min_score(min_score &&) noexcept = default;                  //!< Defaulted
+    constexpr min_score & operator=(min_score const &) noexcept = default; //!< Defaulted
+    constexpr min_score & operator=(min_score &&) noexcept = default;      //!< Defaulted
+    ~min_score() noexcept = default;                                       //!< Defaulted
+
+    /*!\brief Initialises the minimal score.
+     * \param score \copybrief score
+     */
+    constexpr min_score(double const score) noexcept : score{score}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::chain_config_id id{seqan3::detail::chain_config_id::min_score};
+};
+
+} // namespace seqan3::chain_cfg
@@ -0,0 +1,36 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::chain_cfg::parallel configuration.
+ */
+
+#pragma once
+
+#include <seqan3/core/configuration/detail/configuration_element_parallel_mode.hpp>
+#include <seqan3/search/chaining/configuration/detail.hpp>
+
+namespace seqan3::chain_cfg
+{
+/*!\brief Enables the parallel chaining of a batch of anchor sets.
+ * \ingroup chaining_configuration
+ *
+ * \details
+ *
+ * With this configuration you can chain the anchor sets of a batch, e.g. the anchors of every read, in parallel.
+ * The anchors of a single set are always chained by one thread.
+ *
+ * The config element takes the number of threads as a parameter, which must be greater than `0`.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/chaining/chain_anchors_batch.cpp
+ */
+using parallel =
+    seqan3::detail::parallel_mode<std::integral_constant<detail::chain_config_id, detail::chain_config_id::parallel>>;
+
+} // namespace seqan3::chain_cfg
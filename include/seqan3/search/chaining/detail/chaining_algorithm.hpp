@@ -0,0 +1,378 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::chaining_algorithm.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/search/chaining/anchor.hpp>
+#include <seqan3/search/chaining/configuration/gap_cost.hpp>
+#include <seqan3/search/chaining/configuration/look_back.hpp>
+#include <seqan3/search/chaining/configuration/max_gap.hpp>
+#include <seqan3/search/chaining/configuration/min_score.hpp>
+#include <seqan3/search/chaining/detail/range_maximum_tree.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the colinear chains of a set of anchors with sparse dynamic programming.
+ * \ingroup search_chaining
+ * \tparam config_t The type of the chaining configuration; must be a specialisation of seqan3::configuration.
+ *
+ * \details
+ *
+ * The anchors are sorted by their reference id and their position. For every anchor \f$i\f$ the best score \f$f(i)\f$
+ * of a chain ending in it is computed as
+ * \f$f(i) = span_i + \max(0, \max_j f(j) - cost(g_r(j, i), g_q(j, i)))\f$, where \f$j\f$ ranges over all anchors of
+ * the same reference ending before \f$i\f$ begins in the reference and in the query with gaps of at most
+ * seqan3::chain_cfg::max_gap bases.
+ *
+ * By default, the maximum is found exactly with a seqan3::detail::range_maximum_tree: the anchors are processed by
+ * their reference begin position, while the anchors ending before it in the reference are inserted into the tree at
+ * the slot of their query end position. Since the linear gap cost decomposes into a part of \f$j\f$ and a part of
+ * \f$i\f$, the best predecessor is a range maximum query over the query end positions. This takes
+ * \f$O(n \log n)\f$ time for \f$n\f$ anchors.
+ * With seqan3::chain_cfg::look_back, only a bounded number of anchors preceding \f$i\f$ in the reference is
+ * considered instead, which supports arbitrary gap costs.
+ *
+ * Afterwards, the chains are reported like in minimap2: starting with the anchor with the highest score, the
+ * predecessors are followed until an anchor is found that already belongs to a reported chain. Every anchor belongs
+ * to at most one chain and the chains are sorted by their score in decreasing order.
+ */
+template <typename config_t>
+    requires is_type_specialisation_of_v<config_t, configuration>
+class chaining_algorithm
+{
+private:
+    //!\brief Whether the bounded look-back is used instead of the range maximum computation.
+    static constexpr bool use_look_back = config_t::template exists<chain_cfg::look_back>();
+    //!\brief Whether the logarithmic gap cost of minimap2 is used.
+    static constexpr bool use_log_gap_cost = config_t::template exists<chain_cfg::gap_cost_log>();
+    //!\brief Marks an anchor without predecessor.
+    static constexpr size_t no_predecessor = std::numeric_limits<size_t>::max();
+
+    static_assert(!use_log_gap_cost || use_look_back,
+                  "The chain_cfg::gap_cost_log configuration requires the chain_cfg::look_back configuration.");
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    chaining_algorithm() = default;                                       //!< Defaulted.
+    chaining_algorithm(chaining_algorithm const &) = default;             //!< Defaulted.
+    chaining_algorithm(chaining_algorithm &&) = default;                  //!< Defaulted.
+    chaining_algorithm & operator=(chaining_algorithm const &) = default; //!< Defaulted.
+    chaining_algorithm & operator=(chaining_algorithm &&) = default;      //!< Defaulted.
+    ~chaining_algorithm() = default;                                      //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the given configuration.
+     * \param[in] config The chaining configuration.
+     */
+    explicit chaining_algorithm(config_t const & config) :
+        max_gap{config.get_or(chain_cfg::max_gap{}).length},
+        min_score{config.get_or(chain_cfg::min_score{}).score},
+        look_back{config.get_or(chain_cfg::look_back{}).count}
+    {
+        if constexpr (use_log_gap_cost)
+            log_gap_cost = get<chain_cfg::gap_cost_log>(config);
+        else
+            linear_gap_cost = config.get_or(chain_cfg::gap_cost_linear{});
+    }
+    //!\}
+
+    /*!\brief Computes the chains of the given anchors.
+     * \tparam anchors_t The type of the anchor range; must model std::ranges::input_range over seqan3::anchor.
+     * \param[in] anchors The anchors to chain.
+     * \returns The chains sorted by their score in decreasing order.
+     *
+     * \details
+     *
+     * Anchors with a span of `0` are ignored.
+     */
+    template <std::ranges::input_range anchors_t>
+    std::vector<anchor_chain> operator()(anchors_t && anchors) const
+    {
+        std::vector<anchor> sorted_anchors{};
+        for (anchor const & current : anchors)
+            if (current.span > 0)
+                sorted_anchors.push_back(current);
+        std::ranges::sort(sorted_anchors);
+
+        std::vector<double> scores(sorted_anchors.size());
+        std::vector<size_t> predecessors(sorted_anchors.size(), no_predecessor);
+
+        double average_span = 0;
+        for (anchor const & current : sorted_anchors)
+            average_span += current.span;
+        if (!sorted_anchors.empty())
+            average_span /= sorted_anchors.size();
+
+        // Anchors of different references are never chained.
+        for (size_t group_begin = 0, group_end = 0; group_begin < sorted_anchors.size(); group_begin = group_end)
+        {
+            for (group_end = group_begin + 1; group_end < sorted_anchors.size()
+                                              && sorted_anchors[group_end].reference_id
+                                                     == sorted_anchors[group_begin].reference_id;
+                 ++group_end)
+            {}
+
+            std::span const group{sorted_anchors.data() + group_begin, group_end - group_begin};
+            std::span const group_scores{scores.data() + group_begin, group.size()};
+            std::span const group_predecessors{predecessors.data() + group_begin, group.size()};
+
+            if constexpr (use_look_back)
+                compute_scores_with_look_back(group, group_scores, group_predecessors, average_span);
+            else
+                compute_scores_with_range_maximum(group, group_scores, group_predecessors);
+
+            for (size_t & predecessor : group_predecessors)
+                if (predecessor != no_predecessor)
+                    predecessor += group_begin;
+        }
+
+        return report_chains(sorted_anchors, scores, predecessors);
+    }
+
+private:
+    /*!\brief Returns the cost of chaining two anchors with the given gaps.
+     * \param[in] reference_gap The gap between the anchors in the reference.
+     * \param[in] query_gap The gap between the anchors in the query.
+     * \param[in] average_span The average span of all anchors.
+     */
+    double gap_cost(size_t const reference_gap,
+                    size_t const query_gap,
+                    [[maybe_unused]] double const average_span) const noexcept
+    {
+        if constexpr (use_log_gap_cost)
+        {
+            size_t const gap_difference =
+                (reference_gap > query_gap) ? reference_gap - query_gap : query_gap - reference_gap;
+            if (gap_difference == 0)
+                return 0;
+
+            return log_gap_cost.linear_factor * average_span * gap_difference
+                 + log_gap_cost.log_factor * std::log2(static_cast<double>(gap_difference));
+        }
+        else
+        {
+            return linear_gap_cost.weight * static_cast<double>(reference_gap + query_gap);
+        }
+    }
+
+    /*!\brief Computes the chain scores of the anchors of one reference by looking back a bounded number of anchors.
+     * \param[in] group The anchors of one reference sorted by their position.
+     * \param[out] scores The best score of a chain ending in the respective anchor.
+     * \param[out] predecessors The predecessor of the respective anchor in its best chain.
+     * \param[in] average_span The average span of all anchors.
+     */
+    void compute_scores_with_look_back(std::span<anchor const> group,
+                                       std::span<double> scores,
+                                       std::span<size_t> predecessors,
+                                       double const average_span) const
+    {
+        size_t const max_span = std::ranges::max(group | std::views::transform(&anchor::span));
+        size_t const reach = (max_gap > std::numeric_limits<size_t>::max() - max_span) ? max_gap : max_gap + max_span;
+
+        for (size_t current = 0; current < group.size(); ++current)
+        {
+            anchor const & anchor_i = group[current];
+            scores[current] = anchor_i.span;
+
+            size_t examined = 0;
+            for (size_t previous = current; previous-- > 0 && examined < look_back; ++examined)
+            {
+                anchor const & anchor_j = group[previous];
+                // The anchors are sorted by their reference position, so no preceding anchor can be chained anymore.
+                if (anchor_i.reference_position - anchor_j.reference_position > reach)
+                    break;
+
+                size_t const reference_end = anchor_j.reference_position + anchor_j.span;
+                size_t const query_end = anchor_j.query_position + anchor_j.span;
+                if (reference_end > anchor_i.reference_position || query_end > anchor_i.query_position)
+                    continue;
+
+                size_t const reference_gap = anchor_i.reference_position - reference_end;
+                size_t const query_gap = anchor_i.query_position - query_end;
+                if (reference_gap > max_gap || query_gap > max_gap)
+                    continue;
+
+                double const gain = scores[previous] - gap_cost(reference_gap, query_gap, average_span);
+                if (gain > 0 && anchor_i.span + gain > scores[current])
+                {
+                    scores[current] = anchor_i.span + gain;
+                    predecessors[current] = previous;
+                }
+            }
+        }
+    }
+
+    /*!\brief Computes the chain scores of the anchors of one reference exactly with range maximum queries.
+     * \param[in] group The anchors of one reference sorted by their position.
+     * \param[out] scores The best score of a chain ending in the respective anchor.
+     * \param[out] predecessors The predecessor of the respective anchor in its best chain.
+     */
+    void compute_scores_with_range_maximum(std::span<anchor const> group,
+                                           std::span<double> scores,
+                                           std::span<size_t> predecessors) const
+    {
+        auto reference_end = [&](size_t const index)
+        {
+            return group[index].reference_position + group[index].span;
+        };
+        auto query_end = [&](size_t const index)
+        {
+            return group[index].query_position + group[index].span;
+        };
+
+        // Every anchor gets the slot of its query end position in the tree.
+        std::vector<size_t> by_query_end(group.size());
+        std::iota(by_query_end.begin(), by_query_end.end(), 0);
+        std::ranges::sort(by_query_end,
+                          [&](size_t const lhs, size_t const rhs)
+                          {
+                              return std::pair{query_end(lhs), lhs} < std::pair{query_end(rhs), rhs};
+                          });
+
+        std::vector<size_t> slots(group.size());
+        std::vector<size_t> query_ends(group.size());
+        for (size_t slot = 0; slot < group.size(); ++slot)
+        {
+            slots[by_query_end[slot]] = slot;
+            query_ends[slot] = query_end(by_query_end[slot]);
+        }
+
+        // The anchors are inserted into the tree in the order of their reference end position.
+        std::vector<size_t> by_reference_end(group.size());
+        std::iota(by_reference_end.begin(), by_reference_end.end(), 0);
+        std::ranges::sort(by_reference_end,
+                          [&](size_t const lhs, size_t const rhs)
+                          {
+                              return std::pair{reference_end(lhs), lhs} < std::pair{reference_end(rhs), rhs};
+                          });
+
+        range_maximum_tree tree{group.size()};
+        size_t inserted = 0;
+        size_t removed = 0;
+        for (size_t current = 0; current < group.size(); ++current)
+        {
+            anchor const & anchor_i = group[current];
+
+            // All anchors ending before the current one in the reference have been processed already, because they
+            // also begin before it.
+            for (; inserted < group.size() && reference_end(by_reference_end[inserted]) <= anchor_i.reference_position;
+                 ++inserted)
+            {
+                size_t const previous = by_reference_end[inserted];
+                double const previous_end_sum = static_cast<double>(reference_end(previous) + query_end(previous));
+                tree.set(slots[previous], scores[previous] + linear_gap_cost.weight * previous_end_sum);
+            }
+
+            auto is_too_far = [&](size_t const previous)
+            {
+                return anchor_i.reference_position - reference_end(previous) > max_gap;
+            };
+
+            for (; removed < inserted && is_too_far(by_reference_end[removed]); ++removed)
+            {
+                tree.set(slots[by_reference_end[removed]], range_maximum_tree::minus_infinity);
+            }
+
+            size_t const min_query_end = (anchor_i.query_position > max_gap) ? anchor_i.query_position - max_gap : 0;
+            size_t const first_slot = std::ranges::lower_bound(query_ends, min_query_end) - query_ends.begin();
+            size_t const last_slot = std::ranges::upper_bound(query_ends, anchor_i.query_position) - query_ends.begin();
+
+            scores[current] = anchor_i.span;
+            auto [best_value, best_slot] = tree.max(first_slot, last_slot);
+            if (best_slot == group.size())
+                continue;
+
+            double const gain =
+                best_value
+                - linear_gap_cost.weight * static_cast<double>(anchor_i.reference_position + anchor_i.query_position);
+            if (gain > 0)
+            {
+                scores[current] = anchor_i.span + gain;
+                predecessors[current] = by_query_end[best_slot];
+            }
+        }
+    }
+
+    /*!\brief Extracts the chains from the computed scores and predecessors.
+     * \param[in] sorted_anchors The sorted anchors.
+     * \param[in] scores The best score of a chain ending in the respective anchor.
+     * \param[in] predecessors The predecessor of the respective anchor in its best chain.
+     * \returns The chains sorted by their score in decreasing order.
+     */
+    std::vector<anchor_chain> report_chains(std::vector<anchor> const & sorted_anchors,
+                                            std::vector<double> const & scores,
+                                            std::vector<size_t> const & predecessors) const
+    {
+        std::vector<size_t> by_score(sorted_anchors.size());
+        std::iota(by_score.begin(), by_score.end(), 0);
+        std::ranges::stable_sort(by_score,
+                                 [&](size_t const lhs, size_t const rhs)
+                                 {
+                                     return scores[lhs] > scores[rhs];
+                                 });
+
+        std::vector<anchor_chain> chains{};
+        std::vector<bool> used(sorted_anchors.size(), false);
+        for (size_t const last : by_score)
+        {
+            if (used[last])
+                continue;
+
+            anchor_chain chain{};
+            size_t current = last;
+            for (; current != no_predecessor && !used[current]; current = predecessors[current])
+            {
+                used[current] = true;
+                chain.anchors.push_back(sorted_anchors[current]);
+            }
+
+            // If the chain runs into an already reported chain, only the part after it counts.
+            chain.score = scores[last] - ((current != no_predecessor) ? scores[current] : 0);
+            if (chain.score < min_score)
+                continue;
+
+            std::ranges::reverse(chain.anchors);
+            chains.push_back(std::move(chain));
+        }
+
+        std::ranges::stable_sort(chains,
+                                 [](anchor_chain const & lhs, anchor_chain const & rhs)
+                                 {
+                                     return lhs.score > rhs.score;
+                                 });
+        return chains;
+    }
+
+    //!\brief The linear gap cost.
+    chain_cfg::gap_cost_linear linear_gap_cost{};
+    //!\brief The logarithmic gap cost.
+    chain_cfg::gap_cost_log log_gap_cost{};
+    //!\brief The maximal gap between two chained anchors.
+    size_t max_gap{};
+    //!\brief The minimal score of a reported chain.
+    double min_score{};
+    //!\brief The number of preceding anchors considered in the look-back.
+    size_t look_back{};
+};
+
+} // namespace seqan3::detail
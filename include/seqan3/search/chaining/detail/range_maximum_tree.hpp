@@ -0,0 +1,108 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::range_maximum_tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace seqan3::detail
+{
+
+/*!\brief A segment tree over a fixed number of slots that answers range maximum queries in logarithmic time.
+ * \ingroup search_chaining
+ *
+ * \details
+ *
+ * Every slot stores a value, which is initially minus infinity. Setting the value of a slot and querying the maximum
+ * value together with its slot in a half-open range of slots takes \f$O(\log n)\f$ time for \f$n\f$ slots.
+ * If several slots store the maximum, the leftmost one is returned.
+ */
+class range_maximum_tree
+{
+public:
+    //!\brief The value representing an empty slot.
+    static constexpr double minus_infinity = std::numeric_limits<double>::lowest();
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    range_maximum_tree() = default;                                       //!< Defaulted.
+    range_maximum_tree(range_maximum_tree const &) = default;             //!< Defaulted.
+    range_maximum_tree(range_maximum_tree &&) = default;                  //!< Defaulted.
+    range_maximum_tree & operator=(range_maximum_tree const &) = default; //!< Defaulted.
+    range_maximum_tree & operator=(range_maximum_tree &&) = default;      //!< Defaulted.
+    ~range_maximum_tree() = default;                                      //!< Defaulted.
+
+    /*!\brief Constructs a tree with the given number of empty slots.
+     * \param[in] size The number of slots.
+     */
+    explicit range_maximum_tree(size_t const size) : slot_count{size}, nodes(2 * size, {minus_infinity, size})
+    {
+        for (size_t slot = 0; slot < size; ++slot)
+            nodes[size + slot].second = slot;
+    }
+    //!\}
+
+    /*!\brief Sets the value of a slot.
+     * \param[in] slot The slot to set.
+     * \param[in] value The new value; use seqan3::detail::range_maximum_tree::minus_infinity to clear the slot.
+     */
+    void set(size_t slot, double const value) noexcept
+    {
+        assert(slot < slot_count);
+
+        slot += slot_count;
+        nodes[slot].first = value;
+        for (slot >>= 1; slot > 0; slot >>= 1)
+            nodes[slot] = max_of(nodes[2 * slot], nodes[2 * slot + 1]);
+    }
+
+    /*!\brief Returns the maximum value and its slot in the half-open range `[first, last)`.
+     * \param[in] first The first slot of the range.
+     * \param[in] last The slot behind the last slot of the range.
+     * \returns A pair of the maximum value and its slot; minus infinity and the number of slots if all slots of the
+     *          range are empty.
+     */
+    std::pair<double, size_t> max(size_t first, size_t last) const noexcept
+    {
+        assert(first <= last && last <= slot_count);
+
+        std::pair<double, size_t> result{minus_infinity, slot_count};
+        for (first += slot_count, last += slot_count; first < last; first >>= 1, last >>= 1)
+        {
+            if (first & 1)
+                result = max_of(result, nodes[first++]);
+            if (last & 1)
+                result = max_of(result, nodes[--last]);
+        }
+        return result;
+    }
+
+private:
+    //!\brief Returns the node with the larger value and the leftmost slot among equal values.
+    static std::pair<double, size_t> max_of(std::pair<double, size_t> const & lhs,
+                                            std::pair<double, size_t> const & rhs) noexcept
+    {
+        if (lhs.first != rhs.first)
+            return (lhs.first > rhs.first) ? lhs : rhs;
+        return (lhs.second < rhs.second) ? lhs : rhs;
+    }
+
+    //!\brief The number of slots.
+    size_t slot_count{};
+    //!\brief The nodes of the tree; the leaves are stored behind the inner nodes.
+    std::vector<std::pair<double, size_t>> nodes{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,28 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+/*!\file
+ * \brief Meta-header for the \link search_database_search Search / Database Search submodule \endlink.
+ */
+
+/*!\defgroup search_database_search Database Search
+ * \brief Provides seqan3::search_database, which finds the best alignments of queries in a sequence database.
+ * \ingroup search
+ * \see search
+ *
+ * \details
+ *
+ * A one-vs-all database search aligns every query against every sequence of a database, e.g. a set of proteins
+ * stored in seqan3::concatenated_sequences, and reports only the best hits of every query. seqan3::search_database
+ * computes the scores of all alignments with a vectorised prefilter and the configured outputs only for the
+ * reported seqan3::database_hit objects.
+ */
+
+#pragma once
+
+#include <seqan3/search/database_search/configuration/all.hpp>
+#include <seqan3/search/database_search/database_hit.hpp>
+#include <seqan3/search/database_search/search_database.hpp>
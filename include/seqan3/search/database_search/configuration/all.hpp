@@ -0,0 +1,44 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Meta-header for the \link database_search_configuration database search configuration module \endlink.
+ */
+
+/*!\namespace seqan3::database_cfg
+ * \brief A special sub namespace for the database search configurations.
+ */
+
+/*!\defgroup database_search_configuration Configuration
+ * \ingroup search_database_search
+ * \see search_database_search
+ * \brief Data structures and utility functions for configuring the database search.
+ *
+ * \details
+ *
+ * The seqan3::search_database algorithm uses a configuration object to determine which hits are reported for every
+ * query and how many threads search the database. The alignment itself is configured with an alignment configuration
+ * (see \ref alignment_configuration).
+ * These configurations exist in their own namespace, namely seqan3::database_cfg, to disambiguate them from the
+ * configuration of other algorithms.
+ *
+ * If no configuration is provided upon invoking seqan3::search_database, seqan3::database_cfg::default_configuration
+ * is used. A configuration without seqan3::database_cfg::top_k is completed with the one of the default configuration.
+ *
+ * | **Configuration group**                                          | **0** | **1** | **2** |
+ * |:-----------------------------------------------------------------|:-----:|:-----:|:-----:|
+ * | \ref seqan3::database_cfg::min_score "0: Min score"              |  ❌   |  ✅   |  ✅   |
+ * | \ref seqan3::database_cfg::parallel "1: Parallel"                |  ✅   |  ❌   |  ✅   |
+ * | \ref seqan3::database_cfg::top_k "2: Top k"                      |  ✅   |  ✅   |  ❌   |
+ */
+
+#pragma once
+
+#include <seqan3/search/database_search/configuration/default_configuration.hpp>
+#include <seqan3/search/database_search/configuration/min_score.hpp>
+#include <seqan3/search/database_search/configuration/parallel.hpp>
+#include <seqan3/search/database_search/configuration/top_k.hpp>
@@ -0,0 +1,25 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the default configuration for seqan3::search_database.
+ */
+
+#pragma once
+
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/search/database_search/configuration/top_k.hpp>
+
+namespace seqan3::database_cfg
+{
+
+//!\brief The default configuration: Report the 10 best hits of every query.
+//!\ingroup database_search_configuration
+//!\see database_search_configuration
+constexpr configuration default_configuration = top_k{};
+
+} // namespace seqan3::database_cfg
@@ -0,0 +1,67 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides compatibility matrix for database search configurations.
+ */
+
+#pragma once
+
+#include <seqan3/core/configuration/detail/concept.hpp>
+
+namespace seqan3::detail
+{
+
+// database_config_id
+
+/*!\brief Specifies an id for every configuration element.
+ * \ingroup database_search_configuration
+ * \see database_search_configuration
+ *
+ * \details
+ *
+ * The seqan3::detail::database_config_id is used to identify a specific database search configuration element
+ * independent of its concrete type and position within the \ref seqan3::database_cfg "database search configuration
+ * object".
+ */
+enum struct database_config_id : uint8_t
+{
+    min_score, //!< Identifier for the minimal score configuration.
+    parallel,  //!< Identifier for the parallel execution configuration.
+    top_k,     //!< Identifier for the configuration of the number of reported hits per query.
+    //!\cond
+    // ATTENTION: Must always be the last item; will be used to determine the number of ids.
+    SIZE //!< Determines the size of the enum.
+    //!\endcond
+};
+
+// database_config_validation_matrix
+
+/*!\brief Compatibility matrix to check how database search configuration elements can be combined.
+ * \ingroup database_search_configuration
+ * \see database_search_configuration
+ *
+ * \details
+ *
+ * This matrix is used to check if the specified database search configurations can be combined with each other.
+ * A cell value `true`, indicates that the corresponding seqan3::detail::database_config_id in the current column
+ * can be combined with the associated seqan3::detail::database_config_id in the current row. The size of the matrix
+ * is determined by the enum value `SIZE` of seqan3::detail::database_config_id.
+ */
+template <>
+inline constexpr std::array<std::array<bool, static_cast<uint8_t>(database_config_id::SIZE)>,
+                            static_cast<uint8_t>(database_config_id::SIZE)>
+    compatibility_table<database_config_id> = {{
+        // min_score,
+        // |  parallel,
+        // |  |  top_k
+        {0, 1, 1}, // min_score
+        {1, 0, 1}, // parallel
+        {1, 1, 0}  // top_k
+    }};
+
+} // namespace seqan3::detail
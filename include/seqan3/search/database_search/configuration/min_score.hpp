@@ -0,0 +1,60 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::database_cfg::min_score.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/search/database_search/configuration/detail.hpp>
+
+namespace seqan3::database_cfg
+{
+/*!\brief Sets the minimal alignment score of a reported hit.
+ * \ingroup database_search_configuration
+ *
+ * \details
+ *
+ * Only database sequences whose alignment with the query scores at least `score` are reported. By default, the
+ * hits are not filtered by their score.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/database_search/search_database.cpp
+ */
+class min_score : private pipeable_config_element
+{
+public:
+    //!\brief The minimal alignment score of a reported hit.
+    int32_t score{};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr min_score() noexcept = default;                              //!< Defaulted
+    constexpr min_score(min_score const &) noexcept = default;             //!< Defaulted
+    constexpr min_score(min_score &&) noexcept = default;                  //!< Defaulted
+    constexpr min_score & operator=(min_score const &) noexcept = default; //!< Defaulted
+    constexpr min_score & operator=(min_score &&) noexcept = default;      //!< Defaulted
+    ~min_score() noexcept = default;                                       //!< Defaulted
+
+    /*!\brief Initialises the minimal score.
+     * \param score \copybrief score
+     */
+    constexpr min_score(int32_t const score) noexcept : score{score}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::database_config_id id{seqan3::detail::database_config_id::min_score};
+};
+
+} // namespace seqan3::database_cfg
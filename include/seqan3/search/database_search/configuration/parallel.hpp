@@ -0,0 +1,35 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::database_cfg::parallel configuration.
+ */
+
+#pragma once
+
+#include <seqan3/core/configuration/detail/configuration_element_parallel_mode.hpp>
+#include <seqan3/search/database_search/configuration/detail.hpp>
+
+namespace seqan3::database_cfg
+{
+/*!\brief Enables the parallel database search.
+ * \ingroup database_search_configuration
+ *
+ * \details
+ *
+ * With this configuration the database is split into blocks, which are searched in parallel for every query.
+ *
+ * The config element takes the number of threads as a parameter, which must be greater than `0`.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/database_search/search_database.cpp
+ */
+using parallel = seqan3::detail::parallel_mode<
+    std::integral_constant<detail::database_config_id, detail::database_config_id::parallel>>;
+
+} // namespace seqan3::database_cfg
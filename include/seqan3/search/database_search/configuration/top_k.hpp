@@ -0,0 +1,62 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::database_cfg::top_k.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/search/database_search/configuration/detail.hpp>
+
+namespace seqan3::database_cfg
+{
+/*!\brief Reports only the best hits of every query.
+ * \ingroup database_search_configuration
+ *
+ * \details
+ *
+ * Only the `count` database sequences with the highest alignment score are reported for every query. Hits with the
+ * same score are ordered by their position in the database. During the search, only the best `count` candidates of
+ * every block of the database are kept in a bounded heap.
+ * Without this configuration, the 10 best hits are reported (see seqan3::database_cfg::default_configuration).
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/database_search/search_database.cpp
+ */
+class top_k : private pipeable_config_element
+{
+public:
+    //!\brief The maximal number of reported hits per query [default: 10].
+    size_t count{10};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr top_k() noexcept = default;                          //!< Defaulted
+    constexpr top_k(top_k const &) noexcept = default;             //!< Defaulted
+    constexpr top_k(top_k &&) noexcept = default;                  //!< Defaulted
+    constexpr top_k & operator=(top_k const &) noexcept = default; //!< Defaulted
+    constexpr top_k & operator=(top_k &&) noexcept = default;      //!< Defaulted
+    ~top_k() noexcept = default;                                   //!< Defaulted
+
+    /*!\brief Initialises the number of reported hits.
+     * \param count \copybrief count
+     */
+    constexpr top_k(size_t const count) noexcept : count{count}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::database_config_id id{seqan3::detail::database_config_id::top_k};
+};
+
+} // namespace seqan3::database_cfg
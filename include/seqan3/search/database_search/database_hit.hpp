@@ -0,0 +1,55 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+/*!\file
+ * \brief Provides seqan3::database_hit.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/core/debug_stream/debug_stream_type.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A database sequence found by seqan3::search_database together with its alignment to the query.
+ * \ingroup search_database_search
+ * \tparam alignment_result_t The type of the alignment result; must be a type specialisation of
+ *                            seqan3::alignment_result.
+ *
+ * \details
+ *
+ * The database sequence is the first and the query the second sequence of the alignment. The alignment result
+ * contains the outputs of the alignment configuration passed to seqan3::search_database.
+ */
+template <typename alignment_result_t>
+    requires detail::is_type_specialisation_of_v<alignment_result_t, alignment_result>
+struct database_hit
+{
+    //!\brief The position of the hit in the database.
+    size_t database_id{};
+    //!\brief The alignment of the database sequence and the query.
+    alignment_result_t alignment{};
+};
+
+/*!\brief Prints a database hit to the seqan3::debug_stream.
+ * \tparam char_t The underlying character type for the seqan3::debug_stream_type.
+ * \tparam alignment_result_t The type of the alignment result.
+ * \param[in,out] stream The output stream.
+ * \param[in] hit The hit to print.
+ * \relates seqan3::debug_stream_type
+ */
+template <typename char_t, typename alignment_result_t>
+inline debug_stream_type<char_t> & operator<<(debug_stream_type<char_t> & stream,
+                                              database_hit<alignment_result_t> const & hit)
+{
+    return stream << "<database_id:" << hit.database_id << ", alignment:" << hit.alignment << ">";
+}
+
+} // namespace seqan3
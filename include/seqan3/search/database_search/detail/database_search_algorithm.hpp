@@ -0,0 +1,308 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+/*!\file
+ * \brief Provides seqan3::detail::database_search_algorithm.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_on_result.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/search/database_search/configuration/min_score.hpp>
+#include <seqan3/search/database_search/configuration/top_k.hpp>
+#include <seqan3/search/database_search/database_hit.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Searches a database for the best alignments of a query with a score-only prefilter.
+ * \ingroup search_database_search
+ * \tparam search_config_t The type of the database search configuration; must be a specialisation of
+ *                         seqan3::configuration.
+ * \tparam alignment_config_t The type of the alignment configuration; must be a specialisation of
+ *                            seqan3::configuration.
+ *
+ * \details
+ *
+ * The search of one query runs in two steps:
+ *
+ * 1. seqan3::detail::database_search_algorithm::prefilter computes the scores of the query against a block of the
+ *    database with a score-only configuration. It is vectorised with seqan3::align_cfg::vectorised, such that all
+ *    lanes share the query and the columns are scored with a query profile. The best candidates of the block are
+ *    kept in a heap bounded by seqan3::database_cfg::top_k.
+ *    Since vectorised alignments with free trailing end-gaps are not reliable for sequences of different length,
+ *    the prefilter is computed without vectorisation for such configurations.
+ * 2. seqan3::detail::database_search_algorithm::select merges the candidates of all blocks and
+ *    seqan3::detail::database_search_algorithm::align computes the configured outputs, e.g. the alignment, only for
+ *    the selected candidates.
+ *
+ * The database sequence is always the first and the query the second sequence of an alignment.
+ */
+template <typename search_config_t, typename alignment_config_t>
+    requires is_type_specialisation_of_v<search_config_t, configuration>
+          && is_type_specialisation_of_v<alignment_config_t, configuration>
+class database_search_algorithm
+{
+private:
+    static_assert(!alignment_config_t::template exists<align_cfg::parallel>(),
+                  "The database search is parallelised with seqan3::database_cfg::parallel instead of "
+                  "seqan3::align_cfg::parallel.");
+    static_assert(!alignment_config_t::template exists<align_cfg::on_result>(),
+                  "The database search returns the hits and cannot be configured with seqan3::align_cfg::on_result.");
+    static_assert(!alignment_config_t::template exists<align_cfg::output_sequence1_id>()
+                      && !alignment_config_t::template exists<align_cfg::output_sequence2_id>(),
+                  "The database search reports the position of a hit in seqan3::database_hit::database_id. "
+                  "The sequence ids cannot be configured.");
+
+    //!\brief The configured alignment score type.
+    using score_type = typename std::remove_reference_t<decltype(std::declval<alignment_config_t>().get_or(
+        align_cfg::score_type<int32_t>{}))>::type;
+
+    //!\brief Whether the number of hits per query is bounded.
+    static constexpr bool has_top_k = search_config_t::template exists<database_cfg::top_k>();
+    //!\brief Whether the hits are filtered by their score.
+    static constexpr bool has_min_score = search_config_t::template exists<database_cfg::min_score>();
+
+public:
+    //!\brief The number of database sequences that are prefiltered at once.
+    static constexpr size_t block_size = 2048;
+
+    //!\brief A database sequence that passed the prefilter.
+    struct candidate
+    {
+        //!\brief The score of the database sequence against the query.
+        score_type score{};
+        //!\brief The position of the sequence in the database.
+        size_t database_id{};
+
+        //!\brief Whether this candidate is better than the other one, i.e. has a higher score or a lower position.
+        constexpr bool is_better_than(candidate const & other) const noexcept
+        {
+            return std::tie(other.score, database_id) < std::tie(score, other.database_id);
+        }
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    database_search_algorithm() = default;                                              //!< Defaulted.
+    database_search_algorithm(database_search_algorithm const &) = default;             //!< Defaulted.
+    database_search_algorithm(database_search_algorithm &&) = default;                  //!< Defaulted.
+    database_search_algorithm & operator=(database_search_algorithm const &) = default; //!< Defaulted.
+    database_search_algorithm & operator=(database_search_algorithm &&) = default;      //!< Defaulted.
+    ~database_search_algorithm() = default;                                             //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the given configurations.
+     * \param[in] search_config The database search configuration.
+     * \param[in] alignment_config The alignment configuration.
+     */
+    database_search_algorithm(search_config_t const & search_config, alignment_config_t const & alignment_config) :
+        score_config{make_score_config(alignment_config)},
+        output_config{make_output_config(alignment_config)}
+    {
+        if constexpr (has_top_k)
+            top_k = get<database_cfg::top_k>(search_config).count;
+        if constexpr (has_min_score)
+            min_score = get<database_cfg::min_score>(search_config).score;
+
+        if constexpr (alignment_config_t::template exists<align_cfg::method_global>())
+        {
+            auto const & method_global_config = get<align_cfg::method_global>(alignment_config);
+            vectorise_prefilter = !method_global_config.free_end_gaps_sequence1_trailing
+                               && !method_global_config.free_end_gaps_sequence2_trailing;
+        }
+    }
+    //!\}
+
+    /*!\brief Computes the best candidates of a block of the database.
+     * \tparam query_t The type of the query; must model std::ranges::random_access_range and std::ranges::sized_range.
+     * \tparam database_t The type of the database; must model std::ranges::random_access_range over sequences.
+     * \param[in] query The query to search.
+     * \param[in] database The database to search in.
+     * \param[in] block_begin The position of the first database sequence of the block.
+     * \param[in] block_end The position behind the last database sequence of the block.
+     * \returns The candidates of the block in arbitrary order.
+     */
+    template <typename query_t, typename database_t>
+    std::vector<candidate> prefilter(query_t const & query,
+                                     database_t const & database,
+                                     size_t const block_begin,
+                                     size_t const block_end) const
+    {
+        auto sequence_pairs = make_sequence_pairs(query, database, std::views::iota(block_begin, block_end));
+
+        std::vector<candidate> heap{};
+        auto collect = [&](auto && results)
+        {
+            for (auto && result : results)
+            {
+                candidate const current{result.score(), block_begin + result.sequence1_id()};
+                if (!has_min_score || current.score >= min_score)
+                    push(heap, current);
+            }
+        };
+
+        if (vectorise_prefilter)
+            collect(align_pairwise(sequence_pairs, score_config | align_cfg::vectorised{}));
+        else
+            collect(align_pairwise(sequence_pairs, score_config));
+
+        return heap;
+    }
+
+    /*!\brief Selects the best candidates of a query from the candidates of its blocks.
+     * \param[in] candidates The candidates of all blocks.
+     * \returns The reported candidates sorted by their score in decreasing order.
+     */
+    std::vector<candidate> select(std::vector<candidate> candidates) const
+    {
+        auto is_better = [](candidate const & lhs, candidate const & rhs)
+        {
+            return lhs.is_better_than(rhs);
+        };
+
+        if (candidates.size() > top_k)
+        {
+            std::ranges::nth_element(candidates, candidates.begin() + top_k, is_better);
+            candidates.resize(top_k);
+        }
+
+        std::ranges::sort(candidates, is_better);
+        return candidates;
+    }
+
+    /*!\brief Computes the configured alignment outputs of the selected candidates.
+     * \tparam query_t The type of the query; must model std::ranges::random_access_range and std::ranges::sized_range.
+     * \tparam database_t The type of the database; must model std::ranges::random_access_range over sequences.
+     * \param[in] query The query to search.
+     * \param[in] database The database to search in.
+     * \param[in] candidates The selected candidates.
+     * \returns A seqan3::database_hit for every candidate in the same order.
+     */
+    template <typename query_t, typename database_t>
+    auto align(query_t const & query, database_t const & database, std::vector<candidate> const & candidates) const
+    {
+        auto sequence_pairs
+            = make_sequence_pairs(query, database, candidates | std::views::transform(&candidate::database_id));
+        auto results = align_pairwise(sequence_pairs, output_config);
+
+        using alignment_result_t = std::ranges::range_value_t<decltype(results)>;
+        std::vector<database_hit<alignment_result_t>> hits{};
+        hits.reserve(candidates.size());
+
+        auto candidate_it = candidates.begin();
+        for (auto && result : results)
+            hits.push_back(database_hit<alignment_result_t>{(candidate_it++)->database_id, std::move(result)});
+
+        return hits;
+    }
+
+private:
+    /*!\brief Pairs every given database sequence with the query.
+     * \param[in] query The query.
+     * \param[in] database The database.
+     * \param[in] database_ids The positions of the database sequences to pair with the query.
+     */
+    template <typename query_t, typename database_t, typename database_ids_t>
+    static auto make_sequence_pairs(query_t const & query, database_t const & database, database_ids_t && database_ids)
+    {
+        using database_sequence_t = decltype(std::views::all(database[0]));
+        using query_view_t = decltype(std::views::all(query));
+
+        std::vector<std::pair<database_sequence_t, query_view_t>> sequence_pairs{};
+        for (size_t const database_id : database_ids)
+            sequence_pairs.emplace_back(std::views::all(database[database_id]), std::views::all(query));
+
+        return sequence_pairs;
+    }
+
+    /*!\brief Adds a candidate to the heap, which keeps the seqan3::database_cfg::top_k best candidates.
+     * \param[in,out] heap The heap whose top is the worst kept candidate.
+     * \param[in] current The candidate to add.
+     */
+    void push(std::vector<candidate> & heap, candidate const & current) const
+    {
+        auto is_better = [](candidate const & lhs, candidate const & rhs)
+        {
+            return lhs.is_better_than(rhs);
+        };
+
+        if (heap.size() < top_k)
+        {
+            heap.push_back(current);
+            std::ranges::push_heap(heap, is_better);
+        }
+        else if (top_k > 0 && current.is_better_than(heap.front()))
+        {
+            std::ranges::pop_heap(heap, is_better);
+            heap.back() = current;
+            std::ranges::push_heap(heap, is_better);
+        }
+    }
+
+    //!\brief Removes the given config element from the configuration if it exists.
+    template <typename element_t, typename config_t>
+    static constexpr auto remove_if_exists(config_t const & config)
+    {
+        if constexpr (config_t::template exists<element_t>())
+            return config.template remove<element_t>();
+        else
+            return config;
+    }
+
+    //!\brief Creates the score-only configuration of the prefilter.
+    static constexpr auto make_score_config(alignment_config_t const & config)
+    {
+        auto without_output = remove_if_exists<align_cfg::output_cigar>(
+            remove_if_exists<align_cfg::output_alignment>(remove_if_exists<align_cfg::output_begin_position>(
+                remove_if_exists<align_cfg::output_end_position>(remove_if_exists<align_cfg::output_score>(
+                    remove_if_exists<align_cfg::vectorised>(config))))));
+
+        return without_output | align_cfg::output_score{} | align_cfg::output_sequence1_id{};
+    }
+
+    //!\brief Creates the configuration of the selected candidates; all outputs except the ids by default.
+    static constexpr auto make_output_config(alignment_config_t const & config)
+    {
+        using traits_t = alignment_configuration_traits<alignment_config_t>;
+
+        if constexpr (traits_t::has_output_configuration)
+            return config;
+        else
+            return config | align_cfg::output_score{} | align_cfg::output_begin_position{}
+                 | align_cfg::output_end_position{} | align_cfg::output_alignment{};
+    }
+
+    //!\brief The score-only configuration of the prefilter.
+    decltype(make_score_config(std::declval<alignment_config_t>())) score_config{};
+    //!\brief The configuration of the selected candidates.
+    decltype(make_output_config(std::declval<alignment_config_t>())) output_config{};
+    //!\brief The maximal number of reported hits per query.
+    size_t top_k{std::numeric_limits<size_t>::max()};
+    //!\brief The minimal score of a reported hit.
+    score_type min_score{};
+    //!\brief Whether the prefilter is vectorised.
+    bool vectorise_prefilter{true};
+};
+
+} // namespace seqan3::detail
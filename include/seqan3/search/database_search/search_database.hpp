@@ -0,0 +1,171 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+/*!\file
+ * \brief Provides seqan3::search_database.
+ */
+
+#pragma once
+
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
+#include <seqan3/core/algorithm/detail/execution_handler_sequential.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/search/database_search/configuration/default_configuration.hpp>
+#include <seqan3/search/database_search/configuration/parallel.hpp>
+#include <seqan3/search/database_search/database_hit.hpp>
+#include <seqan3/search/database_search/detail/database_search_algorithm.hpp>
+
+namespace seqan3
+{
+/*!\brief Searches a database for the best alignments of every query, optionally in parallel.
+ * \ingroup search_database_search
+ * \tparam queries_t The type of the queries; must model std::ranges::forward_range over ranges that model
+ *                   std::ranges::random_access_range and std::ranges::sized_range.
+ * \tparam database_t The type of the database, e.g. seqan3::concatenated_sequences; must model
+ *                    std::ranges::random_access_range and std::ranges::sized_range over ranges that model
+ *                    std::ranges::random_access_range and std::ranges::sized_range.
+ * \tparam alignment_config_t The type of the alignment configuration; must be a specialisation of
+ *                            seqan3::configuration.
+ * \tparam search_config_t The type of the database search configuration.
+ * \param[in] queries The queries to search.
+ * \param[in] database The database sequences to align the queries against.
+ * \param[in] alignment_config The alignment configuration (see \ref alignment_configuration).
+ * \param[in] search_config A configuration object specifying the search parameters
+ *                          (see \ref database_search_configuration).
+ * \returns For every query a std::vector of seqan3::database_hit, sorted by the score in decreasing order and the
+ *          position in the database.
+ * \throws std::runtime_error if seqan3::database_cfg::parallel is given without a number of threads.
+ *
+ * \details
+ *
+ * \header_file{seqan3/search/database_search/search_database.hpp}
+ *
+ * Every query is aligned against every database sequence, where the database sequence is the first and the query
+ * the second sequence of the alignment. Only the seqan3::database_cfg::top_k best hits of a query with a score of at
+ * least seqan3::database_cfg::min_score are reported. Hits with the same score are ordered by their position in the
+ * database. If seqan3::database_cfg::top_k is not configured, the one of seqan3::database_cfg::default_configuration
+ * is added, i.e. the 10 best hits are reported.
+ *
+ * The alignments are first computed without any output but the score. For this prefilter, the database is split into
+ * blocks, which are aligned with seqan3::align_cfg::vectorised against a shared query. The configured outputs, e.g.
+ * the alignment, are only computed for the reported hits. If the alignment configuration does not contain any
+ * output, the score, the begin and end positions and the alignment are computed.
+ * The alignment configuration must not contain seqan3::align_cfg::parallel, seqan3::align_cfg::on_result or the
+ * output of the sequence ids. The position of a hit in the database is stored in seqan3::database_hit::database_id.
+ *
+ * With seqan3::database_cfg::parallel, the blocks of all queries are distributed over the given number of threads.
+ *
+ * ### Complexity
+ *
+ * The prefilter computes \f$O(n \cdot m)\f$ cells for a query of length \f$m\f$ and a database of total length
+ * \f$n\f$. The configured outputs are computed for at most seqan3::database_cfg::top_k hits per query.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/database_search/search_database.cpp
+ */
+template <std::ranges::forward_range queries_t,
+          std::ranges::random_access_range database_t,
+          typename alignment_config_t,
+          typename search_config_t = decltype(database_cfg::default_configuration)>
+    requires std::ranges::random_access_range<std::ranges::range_reference_t<queries_t const>>
+          && std::ranges::sized_range<std::ranges::range_reference_t<queries_t const>>
+          && std::ranges::sized_range<database_t>
+          && std::ranges::random_access_range<std::ranges::range_reference_t<database_t const>>
+          && std::ranges::sized_range<std::ranges::range_reference_t<database_t const>>
+          && detail::is_type_specialisation_of_v<alignment_config_t, configuration>
+inline auto search_database(queries_t const & queries,
+                            database_t const & database,
+                            alignment_config_t const & alignment_config,
+                            search_config_t const & search_config = database_cfg::default_configuration)
+{
+    // Add the default number of reported hits if it is not configured.
+    auto const complete_config = [&search_config]()
+    {
+        configuration const user_config{search_config};
+        if constexpr (decltype(user_config)::template exists<database_cfg::top_k>())
+            return user_config;
+        else
+            return user_config | database_cfg::default_configuration;
+    }();
+    using complete_configuration_t = std::remove_cvref_t<decltype(complete_config)>;
+    using execution_handler_t = std::conditional_t<complete_configuration_t::template exists<database_cfg::parallel>(),
+                                                   detail::execution_handler_parallel,
+                                                   detail::execution_handler_sequential>;
+
+    auto select_execution_handler = [parallel = complete_config.get_or(database_cfg::parallel{})]()
+    {
+        if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
+        {
+            auto thread_count = parallel.thread_count;
+            if (!thread_count)
+                throw std::runtime_error{"You must configure the number of threads in seqan3::database_cfg::parallel."};
+
+            return execution_handler_t{*thread_count};
+        }
+        else
+        {
+            return execution_handler_t{};
+        }
+    };
+
+    detail::database_search_algorithm algorithm{complete_config, alignment_config};
+    using algorithm_t = decltype(algorithm);
+    using candidate_t = typename algorithm_t::candidate;
+
+    using query_view_t = decltype(std::views::all(*std::ranges::begin(queries)));
+    std::vector<query_view_t> query_views{};
+    for (auto && query : queries)
+        query_views.push_back(std::views::all(query));
+
+    using hits_t = decltype(algorithm.align(query_views[0], database, std::vector<candidate_t>{}));
+    std::vector<hits_t> hits(query_views.size());
+    if (query_views.empty())
+        return hits;
+
+    // Every task prefilters one block of the database for one query.
+    size_t const database_size = std::ranges::size(database);
+    size_t const block_count = (database_size + algorithm_t::block_size - 1) / algorithm_t::block_size;
+    std::vector<std::vector<candidate_t>> block_candidates(query_views.size() * block_count);
+
+    select_execution_handler().bulk_execute(
+        [&](size_t const task, auto && callback)
+        {
+            size_t const block_begin = (task % block_count) * algorithm_t::block_size;
+            size_t const block_end = std::min(block_begin + algorithm_t::block_size, database_size);
+            callback(task, algorithm.prefilter(query_views[task / block_count], database, block_begin, block_end));
+        },
+        std::views::iota(size_t{0}, block_candidates.size()),
+        [&block_candidates](size_t const task, std::vector<candidate_t> candidates)
+        {
+            block_candidates[task] = std::move(candidates);
+        });
+
+    // Every task selects the hits of one query and computes their outputs.
+    select_execution_handler().bulk_execute(
+        [&](size_t const query_id, auto && callback)
+        {
+            std::vector<candidate_t> candidates{};
+            for (size_t task = query_id * block_count; task < (query_id + 1) * block_count; ++task)
+                candidates.insert(candidates.end(), block_candidates[task].begin(), block_candidates[task].end());
+
+            callback(query_id,
+                     algorithm.align(query_views[query_id], database, algorithm.select(std::move(candidates))));
+        },
+        std::views::iota(size_t{0}, hits.size()),
+        [&hits](size_t const query_id, hits_t result)
+        {
+            hits[query_id] = std::move(result);
+        });
+
+    return hits;
+}
+
+} // namespace seqan3
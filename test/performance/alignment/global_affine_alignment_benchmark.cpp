@@ -251,6 +251,87 @@ void seqan2_affine_dna4_trace_collection(benchmark::State & state)
 BENCHMARK(seqan2_affine_dna4_trace_collection);
 #endif // SEQAN3_HAS_SEQAN2
 
+// ============================================================================
+//  affine; trace; dna4; similar sequences
+// ============================================================================
+
+// Generates a sequence pair, where the second sequence differs from the first one by roughly 1% of random edits.
+auto generate_similar_sequences(size_t const sequence_length)
+{
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    decltype(seq1) seq2{};
+
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<size_t> edit_distribution{0, 299};
+    for (seqan3::dna4 const symbol : seq1)
+    {
+        switch (edit_distribution(generator))
+        {
+            case 0: // substitution
+                seq2.push_back(seqan3::assign_rank_to((symbol.to_rank() + 1) % 4, seqan3::dna4{}));
+                break;
+            case 1: // deletion
+                break;
+            case 2: // insertion
+                seq2.push_back(symbol);
+                seq2.push_back(symbol);
+                break;
+            default:
+                seq2.push_back(symbol);
+        }
+    }
+
+    return std::pair{std::move(seq1), std::move(seq2)};
+}
+
+template <bool use_wavefront>
+void seqan3_affine_dna4_similar_trace(benchmark::State & state)
+{
+    auto [seq1, seq2] = generate_similar_sequences(state.range(0));
+
+    auto cfg = [&]()
+    {
+        if constexpr (use_wavefront)
+            return affine_cfg | seqan3::align_cfg::wavefront{} | seqan3::align_cfg::output_alignment{};
+        else
+            return affine_cfg | seqan3::align_cfg::output_alignment{};
+    }();
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        *std::ranges::begin(rng);
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+// Dynamic programming versus the wavefront alignment algorithm.
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_similar_trace, false)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_similar_trace, true)->Arg(1000)->Arg(10000);
+
+void seqan3_affine_dna4_similar_trace_adaptive_band(benchmark::State & state)
+{
+    auto [seq1, seq2] = generate_similar_sequences(state.range(0));
+
+    auto cfg = affine_cfg | seqan3::align_cfg::band_adaptive{static_cast<uint32_t>(state.range(1))}
+             | seqan3::align_cfg::output_alignment{};
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        *std::ranges::begin(rng);
+    }
+
+    // The cells of the full matrix are counted to compare the throughput with the unbanded algorithm.
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+// Dynamic programming within an adaptive band of 64 cells.
+BENCHMARK(seqan3_affine_dna4_similar_trace_adaptive_band)->Args({1000, 64})->Args({10000, 64});
+
 // ============================================================================
 //  instantiate tests
 // ============================================================================
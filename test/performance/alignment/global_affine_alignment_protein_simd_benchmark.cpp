@@ -45,6 +45,38 @@ BENCHMARK_CAPTURE(seqan3_affine_accelerated,
     ->UseRealTime()
     ->DenseRange(deviation_begin, deviation_end, deviation_step);
 
+// One query aligned against many sequences: the columns are scored with a query profile.
+template <typename alphabet_t, typename... align_configs_t>
+void seqan3_affine_accelerated_shared_query(benchmark::State & state, alphabet_t, align_configs_t &&... configs)
+{
+    size_t sequence_length_variance = state.range(0);
+    auto data = seqan3::test::generate_sequence_pairs<alphabet_t>(sequence_length, set_size, sequence_length_variance);
+    for (auto & [sequence1, sequence2] : data)
+        sequence2 = data.front().second;
+
+    int64_t total = 0;
+    auto accelerate_config = (configs | ...);
+    for (auto _ : state)
+    {
+        for (auto && res : seqan3::align_pairwise(data, accelerate_config))
+            total += res.score();
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(data, accelerate_config);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["total"] = total;
+}
+
+BENCHMARK_CAPTURE(seqan3_affine_accelerated_shared_query,
+                  simd_with_score,
+                  seqan3::aa27{},
+                  affine_cfg,
+                  seqan3::align_cfg::output_score{},
+                  seqan3::align_cfg::score_type<int16_t>{},
+                  seqan3::align_cfg::vectorised{})
+    ->UseRealTime()
+    ->DenseRange(deviation_begin, deviation_end, deviation_step);
+
 #ifdef SEQAN3_HAS_SEQAN2
 
 // ----------------------------------------------------------------------------
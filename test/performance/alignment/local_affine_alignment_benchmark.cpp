@@ -242,6 +242,52 @@ void seqan2_affine_dna4_trace_collection(benchmark::State & state)
 BENCHMARK(seqan2_affine_dna4_trace_collection);
 #endif // SEQAN3_HAS_SEQAN2
 
+// ============================================================================
+//  affine; score vs trace; dna4; long sequences with a short local match
+// ============================================================================
+
+// The sequences share a similar region of 10% of their length.
+auto generate_sequences_with_local_match(size_t const size)
+{
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(size, 0, 0);
+    auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(size, 0, 1);
+
+    size_t const match_size = size / 10;
+    std::mt19937 generator{42};
+    for (size_t i = 0; i < match_size; ++i)
+        seq2[size / 3 + i] = (generator() % 10 == 0) ? seq2[size / 3 + i] : seq1[size / 2 + i];
+
+    return std::pair{std::move(seq1), std::move(seq2)};
+}
+
+template <bool compute_alignment>
+void seqan3_affine_dna4_local_match(benchmark::State & state)
+{
+    auto [seq1, seq2] = generate_sequences_with_local_match(state.range(0));
+
+    auto cfg = [&]()
+    {
+        if constexpr (compute_alignment)
+            return local_affine_cfg | seqan3::align_cfg::output_alignment{} | seqan3::align_cfg::output_score{};
+        else
+            return local_affine_cfg | seqan3::align_cfg::output_score{};
+    }();
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), cfg);
+        *std::ranges::begin(rng);
+    }
+
+    state.counters["cells"] =
+        seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), local_affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+// The traceback is only computed within the window of the local match and adds little to the score computation.
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_local_match, false)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_local_match, true)->Arg(1000)->Arg(10000);
+
 // ============================================================================
 //  instantiate tests
 // ============================================================================
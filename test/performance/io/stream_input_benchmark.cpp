@@ -10,6 +10,7 @@
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
 
@@ -18,6 +19,7 @@
 #    include <seqan3/contrib/stream/bgzf_ostream.hpp>
 #    include <seqan3/contrib/stream/gz_istream.hpp>
 #    include <seqan3/contrib/stream/gz_ostream.hpp>
+#    include <seqan3/contrib/stream/parallel_gz_istream.hpp>
 #endif
 
 // only benchmark BZIP2 if explicitly requested, because slow setup
@@ -96,6 +98,9 @@ std::string const input_comp<seqan3::contrib::bgzf_istream>
     } ()
 };
 // clang-format on
+template <>
+std::string const & input_comp<seqan3::contrib::parallel_gz_istream> = input_comp<seqan3::contrib::gz_istream>;
+
 #    ifdef SEQAN3_HAS_SEQAN2
 template <>
 std::string const & input_comp<seqan::GZFile> = input_comp<seqan3::contrib::gz_istream>;
@@ -177,6 +182,7 @@ void compressed(benchmark::State & state)
 
 #if defined(SEQAN3_HAS_ZLIB)
 BENCHMARK_TEMPLATE(compressed, seqan3::contrib::gz_istream);
+BENCHMARK_TEMPLATE(compressed, seqan3::contrib::parallel_gz_istream);
 BENCHMARK_TEMPLATE(compressed, seqan3::contrib::bgzf_istream);
 #endif
 
@@ -252,6 +258,48 @@ BENCHMARK_TEMPLATE(compressed_type_erased2, seqan3::contrib::bgzf_istream);
 BENCHMARK_TEMPLATE(compressed_type_erased2, seqan3::contrib::bz2_istream);
 #endif
 
+// ============================================================================
+//  decompression of single BGZF blocks with the different codecs
+// ============================================================================
+
+#if defined(SEQAN3_HAS_ZLIB)
+template <typename codec_t>
+void bgzf_block_decompression(benchmark::State & state)
+{
+    size_t constexpr block_size = seqan3::contrib::DefaultPageSize<seqan3::detail::bgzf_compression>::VALUE;
+    size_t constexpr max_block_size =
+        seqan3::contrib::DefaultPageSize<seqan3::detail::bgzf_compression>::MAX_BLOCK_SIZE;
+
+    codec_t codec{};
+    std::vector<std::vector<char>> blocks{};
+    for (size_t pos = 0; pos < input.size(); pos += block_size)
+    {
+        std::vector<char> & block = blocks.emplace_back(max_block_size);
+        block.resize(seqan3::contrib::_compressBlock(block.data(),
+                                                     block.size(),
+                                                     input.data() + pos,
+                                                     std::min(block_size, input.size() - pos),
+                                                     codec));
+    }
+
+    std::vector<char> buffer(block_size);
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        for (std::vector<char> & block : blocks)
+            i += seqan3::contrib::_decompressBlock(buffer.data(), buffer.size(), block.data(), block.size(), codec);
+    }
+
+    state.counters["iterations_per_run"] = i;
+    state.SetBytesProcessed(i);
+}
+
+BENCHMARK_TEMPLATE(bgzf_block_decompression, seqan3::contrib::bgzf_zlib_codec);
+#    if defined(SEQAN3_HAS_LIBDEFLATE)
+BENCHMARK_TEMPLATE(bgzf_block_decompression, seqan3::contrib::bgzf_libdeflate_codec);
+#    endif
+#endif
+
 // ============================================================================
 //  seqan2 virtual stream
 // ============================================================================
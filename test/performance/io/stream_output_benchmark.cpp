@@ -10,6 +10,7 @@
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #if defined(SEQAN3_HAS_ZLIB)
 #    include <seqan3/contrib/stream/bgzf_ostream.hpp>
@@ -129,6 +130,38 @@ BENCHMARK_TEMPLATE(compressed_type_erased2, seqan3::contrib::bgzf_ostream);
 BENCHMARK_TEMPLATE(compressed_type_erased2, seqan3::contrib::bz2_ostream);
 #endif
 
+// ============================================================================
+//  compression of single BGZF blocks with the different codecs
+// ============================================================================
+
+#if defined(SEQAN3_HAS_ZLIB)
+template <typename codec_t>
+void bgzf_block_compression(benchmark::State & state)
+{
+    size_t constexpr block_size = seqan3::contrib::DefaultPageSize<seqan3::detail::bgzf_compression>::VALUE;
+
+    std::string input(block_size, ' ');
+    for (size_t i = 0; i < input.size(); ++i)
+        input[i] = "ACGT"[(i * i / 7) % 4];
+
+    codec_t codec{};
+    std::vector<char> block(seqan3::contrib::DefaultPageSize<seqan3::detail::bgzf_compression>::MAX_BLOCK_SIZE);
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        seqan3::contrib::_compressBlock(block.data(), block.size(), input.data(), input.size(), codec);
+        i += input.size();
+    }
+
+    state.SetBytesProcessed(i);
+}
+
+BENCHMARK_TEMPLATE(bgzf_block_compression, seqan3::contrib::bgzf_zlib_codec);
+#    if defined(SEQAN3_HAS_LIBDEFLATE)
+BENCHMARK_TEMPLATE(bgzf_block_compression, seqan3::contrib::bgzf_libdeflate_codec);
+#    endif
+#endif
+
 // ============================================================================
 //  seqan2 virtual stream
 // ============================================================================
@@ -0,0 +1,53 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/search/chaining/all.hpp>
+
+// The anchors of a long read: a colinear run of the given size and the same number of random anchors.
+std::vector<seqan3::anchor> generate_anchors(size_t const count)
+{
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<size_t> position{0, count * 20};
+    std::uniform_int_distribution<size_t> gap{0, 20};
+
+    std::vector<seqan3::anchor> anchors{};
+    seqan3::anchor current{0, 1000, 0, 15};
+    for (size_t i = 0; i < count; ++i)
+    {
+        anchors.push_back(current);
+        anchors.push_back(seqan3::anchor{0, position(generator), position(generator), 15});
+        current.reference_position += current.span + gap(generator);
+        current.query_position += current.span + gap(generator);
+    }
+    return anchors;
+}
+
+template <typename configuration_t>
+void chain_anchors(benchmark::State & state, configuration_t const & cfg)
+{
+    std::vector<seqan3::anchor> anchors = generate_anchors(state.range(0));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(seqan3::chain_anchors(anchors, cfg));
+
+    state.counters["anchors/s"] = benchmark::Counter(anchors.size(), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK_CAPTURE(chain_anchors, range_maximum, seqan3::chain_cfg::default_configuration)->Arg(1000)->Arg(100000);
+BENCHMARK_CAPTURE(chain_anchors, look_back, seqan3::chain_cfg::look_back{50})->Arg(1000)->Arg(100000);
+BENCHMARK_CAPTURE(chain_anchors,
+                  look_back_gap_cost_log,
+                  seqan3::chain_cfg::gap_cost_log{} | seqan3::chain_cfg::look_back{50})
+    ->Arg(1000)
+    ->Arg(100000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/container/concatenated_sequences.hpp>
+#include <seqan3/search/database_search/all.hpp>
+
+// Random protein sequences with a length between 50 and 250.
+template <typename sequences_t>
+sequences_t generate_sequences(size_t const count, size_t const seed)
+{
+    std::mt19937_64 generator{seed};
+    std::uniform_int_distribution<size_t> length{50, 250};
+    std::uniform_int_distribution<uint8_t> rank{0, 25};
+
+    sequences_t sequences{};
+    for (size_t i = 0; i < count; ++i)
+    {
+        seqan3::aa27_vector sequence(length(generator));
+        for (seqan3::aa27 & symbol : sequence)
+            seqan3::assign_rank_to(rank(generator), symbol);
+        sequences.push_back(sequence);
+    }
+    return sequences;
+}
+
+auto const alignment_config = seqan3::align_cfg::method_local{}
+                            | seqan3::align_cfg::scoring_scheme{seqan3::aminoacid_scoring_scheme{
+                                seqan3::aminoacid_similarity_matrix::blosum62}}
+                            | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                 seqan3::align_cfg::extension_score{-1}};
+
+// Aligns every query with every database sequence and computes all outputs.
+void align_all(benchmark::State & state)
+{
+    auto queries = generate_sequences<std::vector<seqan3::aa27_vector>>(4, 0);
+    auto database = generate_sequences<seqan3::concatenated_sequences<seqan3::aa27_vector>>(state.range(0), 1);
+
+    for (auto _ : state)
+    {
+        for (auto const & query : queries)
+        {
+            std::vector<std::pair<decltype(database[0]), seqan3::aa27_vector const &>> sequence_pairs{};
+            for (auto const & sequence : database)
+                sequence_pairs.emplace_back(sequence, query);
+
+            for (auto && result : seqan3::align_pairwise(sequence_pairs, alignment_config))
+                benchmark::DoNotOptimize(result.score());
+        }
+    }
+
+    state.counters["sequences/s"] =
+        benchmark::Counter(queries.size() * database.size(), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Searches the database with the vectorised prefilter and computes all outputs of the best hits.
+template <typename search_config_t>
+void search_database(benchmark::State & state, search_config_t const & search_config)
+{
+    auto queries = generate_sequences<std::vector<seqan3::aa27_vector>>(4, 0);
+    auto database = generate_sequences<seqan3::concatenated_sequences<seqan3::aa27_vector>>(state.range(0), 1);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(seqan3::search_database(queries, database, alignment_config, search_config));
+
+    state.counters["sequences/s"] =
+        benchmark::Counter(queries.size() * database.size(), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(align_all)->Arg(5000)->UseRealTime();
+BENCHMARK_CAPTURE(search_database, top_k, seqan3::database_cfg::top_k{10})->Arg(5000)->UseRealTime();
+BENCHMARK_CAPTURE(search_database,
+                  top_k_parallel,
+                  seqan3::database_cfg::top_k{10} | seqan3::database_cfg::parallel{4})
+    ->Arg(5000)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
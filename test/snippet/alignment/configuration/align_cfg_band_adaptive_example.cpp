@@ -0,0 +1,29 @@
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    std::vector<seqan3::dna4> sequence1 = "ACGTGAACTGACT"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "ACGAACCGACT"_dna4;
+
+    // Computes the global alignment within an adaptive band of 8 cells per anti-diagonal.
+    auto cfg = seqan3::align_cfg::method_global{}
+             | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                   seqan3::mismatch_score{-4}}}
+             | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-4},
+                                                  seqan3::align_cfg::extension_score{-2}}
+             | seqan3::align_cfg::band_adaptive{8} | seqan3::align_cfg::output_score{}
+             | seqan3::align_cfg::output_alignment{};
+
+    for (auto const & result : seqan3::align_pairwise(std::tie(sequence1, sequence2), cfg))
+        seqan3::debug_stream << "Score: " << result.score() << '\n' << result.alignment() << '\n';
+}
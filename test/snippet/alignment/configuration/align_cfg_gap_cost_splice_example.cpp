@@ -0,0 +1,42 @@
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_splice.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    // Two exons separated by an intron that begins with GT and ends with AG.
+    std::vector<seqan3::dna4> genome = "TTGACCATGCAGTCAGGTAAGTTTTTTTTTTTTCTTTTCAGCCTGATTGCATGTT"_dna4;
+    std::vector<seqan3::dna4> read = "CATGCAGTCAGCCTGATTGCA"_dna4;
+
+    // The read is aligned completely, the flanking bases of the genome are free.
+    auto method = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                   seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+    // An intron of any length costs -16, a non-canonical splice site another -9.
+    auto cfg = method
+             | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                   seqan3::mismatch_score{-4}}}
+             | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-4},
+                                                  seqan3::align_cfg::extension_score{-2}}
+             | seqan3::align_cfg::gap_cost_splice{seqan3::align_cfg::intron_open_score{-16},
+                                                  seqan3::align_cfg::non_canonical_score{-9}}
+             | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_begin_position{}
+             | seqan3::align_cfg::output_cigar{};
+
+    for (auto const & result : seqan3::align_pairwise(std::tie(genome, read), cfg))
+    {
+        seqan3::debug_stream << "Score: " << result.score() << '\n';
+        seqan3::debug_stream << "Begin: " << result.sequence1_begin_position() << '\n';
+        seqan3::debug_stream << "CIGAR: " << result.cigar_sequence() << '\n';
+    }
+}
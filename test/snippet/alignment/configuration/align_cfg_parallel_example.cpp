@@ -9,5 +9,11 @@ int main()
 
     // Enables parallel computation with the number of concurrent threads supported by the current architecture.
     seqan3::align_cfg::parallel cfg_n{std::thread::hardware_concurrency()};
+
+    // Enables parallel computation with four threads and at most 64 chunks of sequence pairs in flight.
+    // The results are reported as soon as they are computed.
+    seqan3::align_cfg::parallel cfg_stream{4,
+                                           seqan3::align_cfg::streaming_window{64},
+                                           seqan3::align_cfg::result_order::completion};
     ;
 }
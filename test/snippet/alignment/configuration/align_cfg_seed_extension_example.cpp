@@ -0,0 +1,22 @@
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_seed_extension.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+int main()
+{
+    // Extends the sequence infixes right of a seed until the score drops 20 below the best score.
+    auto right_cfg = seqan3::align_cfg::method_global{}
+                   | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                         seqan3::mismatch_score{-4}}}
+                   | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-4},
+                                                        seqan3::align_cfg::extension_score{-2}}
+                   | seqan3::align_cfg::seed_extension{seqan3::align_cfg::x_drop{20}};
+
+    // Extends the sequence infixes left of a seed using the Z-drop criterion.
+    auto left_cfg = seqan3::align_cfg::method_global{}
+                  | seqan3::align_cfg::seed_extension{seqan3::align_cfg::z_drop{100},
+                                                      seqan3::align_cfg::extension_direction::left};
+}
@@ -4,4 +4,10 @@ int main()
 {
     // Enable SIMD vectorised alignment computation.
     auto cfg = seqan3::align_cfg::vectorised{};
+
+    // Sort windows of 1024 sequence pairs by length before they are packed into the SIMD vectors.
+    auto cfg_sorted = seqan3::align_cfg::vectorised{seqan3::align_cfg::length_sorting_window{1024}};
+
+    // Compute global alignments on 8 bit score differences, which fit more sequence pairs into a SIMD vector.
+    auto cfg_difference = seqan3::align_cfg::vectorised{seqan3::align_cfg::score_encoding::difference};
 }
@@ -0,0 +1,17 @@
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+int main()
+{
+    // Computes the global alignment with the wavefront alignment algorithm.
+    auto cfg = seqan3::align_cfg::method_global{}
+             | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                   seqan3::mismatch_score{-4}}}
+             | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-6},
+                                                  seqan3::align_cfg::extension_score{-2}}
+             | seqan3::align_cfg::wavefront{};
+}
@@ -0,0 +1,49 @@
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/io/sam_file/output.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    auto bam_file = std::filesystem::temp_directory_path() / "records.bam";
+
+    {
+        using fields_t = seqan3::fields<seqan3::field::id,
+                                        seqan3::field::seq,
+                                        seqan3::field::ref_id,
+                                        seqan3::field::ref_offset,
+                                        seqan3::field::cigar,
+                                        seqan3::field::mapq,
+                                        seqan3::field::tags>;
+        std::vector<std::string> ref_ids{"chr1"};
+        std::vector<size_t> ref_lengths{10000};
+        seqan3::sam_file_output fout{bam_file, ref_ids, ref_lengths, fields_t{}};
+
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            std::vector<seqan3::cigar> cigar{{4, 'M'_cigar_operation}};
+            seqan3::sam_tag_dictionary tags{};
+            tags["NM"_tag] = i;
+            fout.emplace_back("read" + std::to_string(i), "ACGT"_dna5, 0, 100 * i, cigar, 20 * i, tags);
+        }
+    }
+
+    seqan3::sam_file_input fin{bam_file};
+
+    // Only the accessed fields are decoded; the sequence and the tags of the other records are skipped.
+    for (seqan3::bam_record_view const & record : fin.bam_records())
+    {
+        if (record.mapping_quality() < 30)
+            continue;
+
+        seqan3::debug_stream << record.id() << ' ' << record.reference_position() << ' ' << record.sequence() << ' '
+                             << record.tag("NM"_tag) << '\n';
+    }
+
+    std::filesystem::remove(bam_file);
+}
@@ -0,0 +1,45 @@
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/io/sam_file/output.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    auto bam_file = std::filesystem::temp_directory_path() / "sorted.bam";
+    std::vector<std::string> ref_ids{"chr1", "chr2"};
+    std::vector<size_t> ref_lengths{100000, 50000};
+
+    {
+        using fields_t =
+            seqan3::fields<seqan3::field::id, seqan3::field::ref_id, seqan3::field::ref_offset, seqan3::field::cigar>;
+        seqan3::sam_file_output fout{bam_file, ref_ids, ref_lengths, fields_t{}};
+        fout.options.write_bam_index = seqan3::bam_index_format::bai; // writes sorted.bam.bai
+
+        // The records must be sorted by coordinate.
+        for (int32_t position = 0; position < 50000; position += 100)
+        {
+            std::vector<seqan3::cigar> cigar{{100, 'M'_cigar_operation}};
+            fout.emplace_back("read" + std::to_string(position), 0, position, cigar);
+        }
+
+        std::vector<seqan3::cigar> spliced{{20, 'M'_cigar_operation},
+                                           {1000, 'N'_cigar_operation},
+                                           {30, 'M'_cigar_operation}};
+        fout.emplace_back("spliced", 1, 200, spliced);
+        fout.write_index(); // Otherwise, the destructor writes the index and ignores errors.
+    }
+
+    seqan3::sam_file_input fin{bam_file};
+
+    // Only the chunks of the file that overlap the region are decompressed.
+    for (auto & record : fin.region("chr1:20001-20150"))
+        seqan3::debug_stream << record.id() << ' ' << record.reference_position() << '\n';
+
+    std::filesystem::remove(bam_file);
+    std::filesystem::remove(bam_file += ".bai");
+}
@@ -0,0 +1,25 @@
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+
+auto sam_file_raw = R"(@HD	VN:1.6	SO:coordinate
+@SQ	SN:ref	LN:45
+r001	99	ref	7	30	8M2I4M1D3M	=	37	39	TTAGATAAAGGATACTG	*	NM:i:1	AS:i:30
+r003	0	ref	29	30	5S6M	*	0	0	GCCTAAGCTAA	*	AS:i:25
+)";
+
+struct my_traits : seqan3::sam_file_input_default_traits<>
+{
+    using tag_dictionary = seqan3::flat_sam_tag_dictionary; // instead of seqan3::sam_tag_dictionary
+};
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    seqan3::sam_file_input<my_traits> fin{std::istringstream{sam_file_raw}, seqan3::format_sam{}};
+
+    for (auto & record : fin)
+        seqan3::debug_stream << record.tags().get<"AS"_tag>() << '\n';
+}
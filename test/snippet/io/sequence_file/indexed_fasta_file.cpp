@@ -0,0 +1,27 @@
+#include <filesystem>
+#include <fstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/indexed_fasta_file.hpp>
+
+int main()
+{
+    auto fasta_file = std::filesystem::temp_directory_path() / "genome.fasta";
+
+    {
+        std::ofstream file{fasta_file};
+        file << ">chr1 first chromosome\nACGTACGTAC\nGGGGCCCCTT\nAAAA\n"
+             << ">chr2\nTTTTTGGGGG\nCC\n";
+    }
+
+    seqan3::indexed_fasta_file genome{fasta_file};
+
+    seqan3::debug_stream << genome.sequence("chr1", 8, 14) << '\n'; // ACGGGG
+    seqan3::debug_stream << genome.sequence("chr2") << '\n';        // TTTTTGGGGGCC
+
+    // Store the index next to the FASTA file, it is read instead of scanning the file when it is opened again.
+    genome.index().write(fasta_file.string() + ".fai");
+
+    std::filesystem::remove(fasta_file.string() + ".fai");
+    std::filesystem::remove(fasta_file);
+}
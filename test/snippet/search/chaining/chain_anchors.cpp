@@ -0,0 +1,18 @@
+#include <vector>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/chaining/all.hpp>
+
+int main()
+{
+    // The anchors of a read, e.g. k-mer search hits: reference id, reference position, query position and span.
+    std::vector<seqan3::anchor> anchors{{0, 100, 0, 15},
+                                        {0, 120, 20, 15},
+                                        {0, 138, 40, 15},
+                                        {0, 900, 25, 15},
+                                        {1, 50, 60, 15}};
+
+    // Chains the anchors with the default configuration.
+    for (seqan3::anchor_chain const & chain : seqan3::chain_anchors(anchors))
+        seqan3::debug_stream << chain.score << ": " << chain.anchors.size() << " anchors\n";
+}
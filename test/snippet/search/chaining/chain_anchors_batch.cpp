@@ -0,0 +1,17 @@
+#include <vector>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/chaining/all.hpp>
+
+int main()
+{
+    // The anchors of two reads.
+    std::vector<std::vector<seqan3::anchor>> anchor_sets{{{0, 100, 0, 15}, {0, 120, 20, 15}},
+                                                         {{0, 500, 10, 20}, {1, 50, 60, 15}}};
+
+    // Chains the anchors of every read with four threads.
+    auto chains = seqan3::chain_anchors(anchor_sets, seqan3::chain_cfg::parallel{4});
+
+    for (auto const & read_chains : chains)
+        seqan3::debug_stream << "best chain score: " << read_chains.front().score << '\n';
+}
@@ -0,0 +1,10 @@
+#include <seqan3/search/chaining/configuration/all.hpp>
+
+int main()
+{
+    // Every base between two chained anchors costs 0.25.
+    seqan3::configuration linear_cfg = seqan3::chain_cfg::gap_cost_linear{0.25};
+
+    // The gap cost of minimap2, which requires the bounded look-back.
+    seqan3::configuration log_cfg = seqan3::chain_cfg::gap_cost_log{0.01, 0.5} | seqan3::chain_cfg::look_back{50};
+}
@@ -0,0 +1,9 @@
+#include <seqan3/search/chaining/configuration/all.hpp>
+
+int main()
+{
+    // Considers at most 25 preceding anchors, chains only anchors at most 1000 bases apart and reports only chains with
+    // a score of at least 40.
+    seqan3::configuration cfg =
+        seqan3::chain_cfg::look_back{25} | seqan3::chain_cfg::max_gap{1000} | seqan3::chain_cfg::min_score{40};
+}
@@ -0,0 +1,37 @@
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/container/concatenated_sequences.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/database_search/all.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    seqan3::concatenated_sequences<seqan3::aa27_vector> database{};
+    database.push_back("MKVLAAGIVGLLLAQ"_aa27);
+    database.push_back("PEPTIDEPEPTIDE"_aa27);
+    database.push_back("MKVLSAGIVALLLAQWS"_aa27);
+    database.push_back("WWWWYYYYHHHH"_aa27);
+
+    std::vector<seqan3::aa27_vector> queries{"KVLAAGIVG"_aa27, "PEPTIDE"_aa27};
+
+    // Local alignments scored with BLOSUM62; only the alignment end positions are computed for the hits.
+    auto alignment_config = seqan3::align_cfg::method_local{}
+                          | seqan3::align_cfg::scoring_scheme{seqan3::aminoacid_scoring_scheme{
+                              seqan3::aminoacid_similarity_matrix::blosum62}}
+                          | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                               seqan3::align_cfg::extension_score{-1}}
+                          | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    // Reports the two best hits of every query with a score of at least 20.
+    auto search_config = seqan3::database_cfg::top_k{2} | seqan3::database_cfg::min_score{20};
+
+    auto hits = seqan3::search_database(queries, database, alignment_config, search_config);
+    for (size_t query_id = 0; query_id < hits.size(); ++query_id)
+        for (auto const & hit : hits[query_id])
+            seqan3::debug_stream << "query " << query_id << ": " << hit << '\n';
+}
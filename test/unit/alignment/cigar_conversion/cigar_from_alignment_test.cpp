@@ -124,3 +124,28 @@ TEST_F(cigar_from_alignment, hard_clipping)
 
     EXPECT_RANGE_EQ(cigar, this->cigar_with_hard_clipping);
 }
+
+TEST_F(cigar_from_alignment, min_intron_length)
+{
+    seqan3::gap const g{};
+    std::vector<seqan3::gapped<seqan3::dna5>> gapped_ref{'A'_dna5, 'C'_dna5, 'G'_dna5, 'T'_dna5, 'A'_dna5, 'G'_dna5,
+                                                         'T'_dna5, 'C'_dna5, 'A'_dna5, 'T'_dna5, 'G'_dna5};
+    std::vector<seqan3::gapped<seqan3::dna5>> gapped_seq{'A'_dna5, 'C'_dna5, g, g,        g,        g,
+                                                         'T'_dna5, g,        'A'_dna5, 'T'_dna5, 'G'_dna5};
+
+    // Without the minimal intron length, all gaps are deletions.
+    EXPECT_RANGE_EQ(seqan3::cigar_from_alignment(std::tie(gapped_ref, gapped_seq)),
+                    (std::vector<seqan3::cigar>{{2, 'M'_cigar_operation},
+                                                {4, 'D'_cigar_operation},
+                                                {1, 'M'_cigar_operation},
+                                                {1, 'D'_cigar_operation},
+                                                {3, 'M'_cigar_operation}}));
+
+    EXPECT_RANGE_EQ(seqan3::cigar_from_alignment(std::tie(gapped_ref, gapped_seq), {.soft_back = 2}, false, 3),
+                    (std::vector<seqan3::cigar>{{2, 'M'_cigar_operation},
+                                                {4, 'N'_cigar_operation},
+                                                {1, 'M'_cigar_operation},
+                                                {1, 'D'_cigar_operation},
+                                                {3, 'M'_cigar_operation},
+                                                {2, 'S'_cigar_operation}}));
+}
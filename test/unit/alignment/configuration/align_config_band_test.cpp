@@ -69,3 +69,26 @@ TEST(band_fixed_size, get_and_assign)
     EXPECT_EQ(get<seqan3::align_cfg::band_fixed_size>(config).lower_diagonal, -4);
     EXPECT_EQ(get<seqan3::align_cfg::band_fixed_size>(config).upper_diagonal, 8);
 }
+
+TEST(band_adaptive, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::band_adaptive>));
+}
+
+TEST(band_adaptive, construct)
+{
+    EXPECT_EQ(seqan3::align_cfg::band_adaptive{}.width, 128u);
+    EXPECT_EQ(seqan3::align_cfg::band_adaptive{32}.width, 32u);
+    EXPECT_FALSE((std::is_convertible_v<uint32_t, seqan3::align_cfg::band_adaptive>));
+}
+
+TEST(band_adaptive, get_and_assign)
+{
+    using seqan3::get;
+
+    seqan3::configuration config{seqan3::align_cfg::band_adaptive{32}};
+    EXPECT_EQ(get<seqan3::align_cfg::band_adaptive>(config).width, 32u);
+
+    get<seqan3::align_cfg::band_adaptive>(config).width = 64;
+    EXPECT_EQ(get<seqan3::align_cfg::band_adaptive>(config).width, 64u);
+}
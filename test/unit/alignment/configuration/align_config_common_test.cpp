@@ -12,6 +12,7 @@
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
 #include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_splice.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/configuration/align_config_min_score.hpp>
 #include <seqan3/alignment/configuration/align_config_on_result.hpp>
@@ -20,7 +21,9 @@
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
 #include <seqan3/alignment/configuration/align_config_score_type.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_seed_extension.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
 #include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
 #include <seqan3/utility/type_list/traits.hpp>
 
@@ -42,7 +45,13 @@ using callback_t = decltype(on_result_callback);
 using align_config_and_taboo_types = seqan3::type_list<
     // method configs
     std::pair<cfg::method_global, seqan3::type_list<cfg::method_global, cfg::method_local>>,
-    std::pair<cfg::method_local, seqan3::type_list<cfg::method_local, cfg::method_global, cfg::min_score>>,
+    std::pair<cfg::method_local,
+              seqan3::type_list<cfg::method_local,
+                                cfg::method_global,
+                                cfg::band_adaptive,
+                                cfg::min_score,
+                                cfg::seed_extension,
+                                cfg::wavefront>>,
     // output configs
     std::pair<cfg::output_sequence1_id, seqan3::type_list<cfg::output_sequence1_id>>,
     std::pair<cfg::output_sequence2_id, seqan3::type_list<cfg::output_sequence2_id>>,
@@ -50,18 +59,74 @@ using align_config_and_taboo_types = seqan3::type_list<
     std::pair<cfg::output_begin_position, seqan3::type_list<cfg::output_begin_position>>,
     std::pair<cfg::output_end_position, seqan3::type_list<cfg::output_end_position>>,
     std::pair<cfg::output_alignment, seqan3::type_list<cfg::output_alignment>>,
+    std::pair<cfg::output_cigar, seqan3::type_list<cfg::output_cigar>>,
     // other configs
-    std::pair<cfg::band_fixed_size, seqan3::type_list<cfg::band_fixed_size>>,
-    std::pair<cfg::detail::debug, seqan3::type_list<cfg::detail::debug>>,
+    std::pair<cfg::band_adaptive,
+              seqan3::type_list<cfg::band_adaptive,
+                                cfg::band_fixed_size,
+                                cfg::detail::debug,
+                                cfg::gap_cost_splice,
+                                cfg::method_local,
+                                cfg::min_score,
+                                cfg::seed_extension,
+                                cfg::vectorised,
+                                cfg::wavefront>>,
+    std::pair<cfg::band_fixed_size,
+              seqan3::type_list<cfg::band_fixed_size,
+                                cfg::band_adaptive,
+                                cfg::gap_cost_splice,
+                                cfg::seed_extension,
+                                cfg::wavefront>>,
+    std::pair<cfg::detail::debug,
+              seqan3::type_list<cfg::detail::debug,
+                                cfg::band_adaptive,
+                                cfg::gap_cost_splice,
+                                cfg::seed_extension,
+                                cfg::wavefront>>,
     std::pair<cfg::gap_cost_affine, seqan3::type_list<cfg::gap_cost_affine>>,
-    std::pair<cfg::min_score, seqan3::type_list<cfg::min_score, cfg::method_local>>,
+    std::pair<cfg::gap_cost_splice,
+              seqan3::type_list<cfg::gap_cost_splice,
+                                cfg::band_adaptive,
+                                cfg::band_fixed_size,
+                                cfg::detail::debug,
+                                cfg::min_score,
+                                cfg::seed_extension,
+                                cfg::vectorised,
+                                cfg::wavefront>>,
+    std::pair<cfg::min_score,
+              seqan3::type_list<cfg::min_score,
+                                cfg::band_adaptive,
+                                cfg::gap_cost_splice,
+                                cfg::method_local,
+                                cfg::seed_extension,
+                                cfg::wavefront>>,
     std::pair<cfg::on_result<callback_t>, seqan3::type_list<cfg::on_result<callback_t>>>,
     std::pair<cfg::parallel, seqan3::type_list<cfg::parallel>>,
     std::pair<cfg::detail::result_type<alignment_result_t>,
               seqan3::type_list<cfg::detail::result_type<alignment_result_t>>>,
     std::pair<cfg::score_type<int32_t>, seqan3::type_list<cfg::score_type<int32_t>>>,
     std::pair<cfg::scoring_scheme<nt_scheme>, seqan3::type_list<cfg::scoring_scheme<nt_scheme>>>,
-    std::pair<cfg::vectorised, seqan3::type_list<cfg::vectorised>>>;
+    std::pair<cfg::seed_extension,
+              seqan3::type_list<cfg::seed_extension,
+                                cfg::band_adaptive,
+                                cfg::band_fixed_size,
+                                cfg::detail::debug,
+                                cfg::gap_cost_splice,
+                                cfg::method_local,
+                                cfg::min_score,
+                                cfg::wavefront>>,
+    std::pair<cfg::vectorised,
+              seqan3::type_list<cfg::vectorised, cfg::band_adaptive, cfg::gap_cost_splice, cfg::wavefront>>,
+    std::pair<cfg::wavefront,
+              seqan3::type_list<cfg::wavefront,
+                                cfg::band_adaptive,
+                                cfg::band_fixed_size,
+                                cfg::detail::debug,
+                                cfg::gap_cost_splice,
+                                cfg::method_local,
+                                cfg::min_score,
+                                cfg::seed_extension,
+                                cfg::vectorised>>>;
 
 // The pure list of configuration elements to instantiate the typed test case with.
 using align_config_types = pure_config_type_list<align_config_and_taboo_types>;
@@ -85,7 +150,7 @@ public:
     // NOTE: You must update this number if you add a new entity to seqan3::detail::align_config_id.
     // config_count is used to check that the config size is correct.
     // And don't forget to add the new config into the above test fixture (via align_config_and_taboo_types).
-    static constexpr int8_t config_count = 18;
+    static constexpr int8_t config_count = 23;
 };
 
 // Configuration element type list as gtest suitable testing::Types
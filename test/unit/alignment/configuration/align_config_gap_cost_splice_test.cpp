@@ -0,0 +1,33 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_splice.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_gap_cost_splice, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::gap_cost_splice>));
+}
+
+TEST(align_config_gap_cost_splice, configuration)
+{
+    using seqan3::get;
+    {
+        seqan3::configuration cfg{seqan3::align_cfg::gap_cost_splice{}}; // default construction
+        EXPECT_EQ((get<seqan3::align_cfg::gap_cost_splice>(cfg).intron_open_score), -32);
+        EXPECT_EQ((get<seqan3::align_cfg::gap_cost_splice>(cfg).non_canonical_score), -9);
+    }
+
+    {
+        seqan3::align_cfg::gap_cost_splice scheme{seqan3::align_cfg::intron_open_score{-20},
+                                                  seqan3::align_cfg::non_canonical_score{0}};
+        EXPECT_EQ((scheme.intron_open_score), -20);
+        EXPECT_EQ((scheme.non_canonical_score), 0);
+    }
+}
@@ -37,6 +37,12 @@ TEST(align_config_output, alignment)
                               seqan3::align_cfg::output_alignment>));
 }
 
+TEST(align_config_output, cigar)
+{
+    EXPECT_TRUE((std::same_as<std::remove_cvref_t<decltype(seqan3::align_cfg::output_cigar{})>,
+                              seqan3::align_cfg::output_cigar>));
+}
+
 TEST(align_config_output, sequence1_id)
 {
     EXPECT_TRUE((std::same_as<std::remove_cvref_t<decltype(seqan3::align_cfg::output_sequence1_id{})>,
@@ -53,12 +59,14 @@ TEST(align_config_output, combine_outputs)
 {
     seqan3::configuration cfg = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
                               | seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::output_alignment{}
-                              | seqan3::align_cfg::output_sequence1_id{} | seqan3::align_cfg::output_sequence2_id{};
+                              | seqan3::align_cfg::output_cigar{} | seqan3::align_cfg::output_sequence1_id{}
+                              | seqan3::align_cfg::output_sequence2_id{};
 
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_score>());
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_end_position>());
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_begin_position>());
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_alignment>());
+    EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_cigar>());
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_sequence1_id>());
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_sequence2_id>());
 }
@@ -42,3 +42,17 @@ TEST(align_config_parallel, configuration)
         EXPECT_EQ(cfg_value, 2u);
     }
 }
+
+TEST(align_config_parallel, streaming_window)
+{
+    seqan3::align_cfg::parallel default_elem{2};
+    EXPECT_EQ(default_elem.streaming_window, 0u);
+    EXPECT_EQ(default_elem.result_order, seqan3::align_cfg::result_order::input);
+
+    seqan3::align_cfg::parallel elem{2,
+                                     seqan3::align_cfg::streaming_window{16},
+                                     seqan3::align_cfg::result_order::completion};
+    EXPECT_EQ(elem.thread_count, 2u);
+    EXPECT_EQ(elem.streaming_window, 16u);
+    EXPECT_EQ(elem.result_order, seqan3::align_cfg::result_order::completion);
+}
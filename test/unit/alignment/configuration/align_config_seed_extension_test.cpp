@@ -0,0 +1,42 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_seed_extension.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_seed_extension, config_element)
+{
+    seqan3::configuration cfg{seqan3::align_cfg::seed_extension{}};
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::seed_extension>());
+}
+
+TEST(align_config_seed_extension, x_drop)
+{
+    seqan3::align_cfg::seed_extension extension{seqan3::align_cfg::x_drop{20}};
+    EXPECT_EQ(extension.drop, 20);
+    EXPECT_FALSE(extension.use_z_drop);
+    EXPECT_EQ(extension.direction, seqan3::align_cfg::extension_direction::right);
+}
+
+TEST(align_config_seed_extension, z_drop)
+{
+    seqan3::align_cfg::seed_extension extension{seqan3::align_cfg::z_drop{100},
+                                                seqan3::align_cfg::extension_direction::left};
+    EXPECT_EQ(extension.drop, 100);
+    EXPECT_TRUE(extension.use_z_drop);
+    EXPECT_EQ(extension.direction, seqan3::align_cfg::extension_direction::left);
+}
+
+TEST(align_config_seed_extension, combine_with_method_global)
+{
+    auto cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::seed_extension{seqan3::align_cfg::x_drop{20}};
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::method_global>());
+    EXPECT_EQ(std::get<seqan3::align_cfg::seed_extension>(cfg).drop, 20);
+}
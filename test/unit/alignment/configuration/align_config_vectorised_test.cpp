@@ -18,3 +18,21 @@ TEST(align_config_vectorised, config_element)
     seqan3::configuration cfg{seqan3::align_cfg::vectorised{}};
     EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::vectorised>());
 }
+
+TEST(align_config_vectorised, length_sorting_window)
+{
+    EXPECT_EQ(seqan3::align_cfg::vectorised{}.length_sorting_window, 0u);
+
+    seqan3::align_cfg::vectorised cfg{seqan3::align_cfg::length_sorting_window{1024}};
+    EXPECT_EQ(cfg.length_sorting_window, 1024u);
+}
+
+TEST(align_config_vectorised, score_encoding)
+{
+    EXPECT_EQ(seqan3::align_cfg::vectorised{}.score_encoding, seqan3::align_cfg::score_encoding::absolute);
+
+    seqan3::align_cfg::vectorised cfg{seqan3::align_cfg::score_encoding::difference,
+                                      seqan3::align_cfg::length_sorting_window{1024}};
+    EXPECT_EQ(cfg.score_encoding, seqan3::align_cfg::score_encoding::difference);
+    EXPECT_EQ(cfg.length_sorting_window, 1024u);
+}
@@ -0,0 +1,25 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_wavefront, config_element)
+{
+    seqan3::configuration cfg{seqan3::align_cfg::wavefront{}};
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::wavefront>());
+}
+
+TEST(align_config_wavefront, combine_with_method_global)
+{
+    auto cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::wavefront{};
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::method_global>());
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::wavefront>());
+}
@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -123,3 +124,29 @@ TEST(trace_matrix, trace_path)
 
     EXPECT_TRUE(path.empty());
 }
+
+TEST(trace_matrix, resize)
+{
+    using seqan3::detail::trace_directions;
+
+    seqan3::detail::alignment_trace_matrix_full<trace_directions> matrix{"acgt", "acgt"};
+
+    // Write a trace into every cell of the matrix.
+    for (auto column : matrix)
+        for (auto cell : column)
+            cell.current = trace_directions::diagonal;
+
+    matrix.resize(std::string{"ac"}, std::string{"acg"});
+
+    size_t column_count = 0;
+    for (auto column : matrix)
+    {
+        EXPECT_EQ(std::ranges::distance(column), 4);
+        for (auto cell : column)
+            EXPECT_EQ(cell.current, trace_directions::none);
+
+        ++column_count;
+    }
+
+    EXPECT_EQ(column_count, 3u);
+}
@@ -0,0 +1,121 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/cigar_conversion/cigar_from_alignment.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
+#include <seqan3/alignment/matrix/detail/recorded_trace_path.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::operator|;
+using namespace seqan3::literals;
+
+struct cigar_builder_test : public ::testing::Test
+{
+    static constexpr seqan3::detail::trace_directions N = seqan3::detail::trace_directions::none;
+    static constexpr seqan3::detail::trace_directions D = seqan3::detail::trace_directions::diagonal;
+    static constexpr seqan3::detail::trace_directions U = seqan3::detail::trace_directions::up;
+    static constexpr seqan3::detail::trace_directions UO = seqan3::detail::trace_directions::up_open;
+    static constexpr seqan3::detail::trace_directions L = seqan3::detail::trace_directions::left;
+    static constexpr seqan3::detail::trace_directions LO = seqan3::detail::trace_directions::left_open;
+
+    seqan3::detail::two_dimensional_matrix<seqan3::detail::trace_directions> matrix{
+        seqan3::detail::number_rows{3},
+        seqan3::detail::number_cols{4},
+        std::vector{N, LO, L, L, UO, D | LO | UO, L, D | L | UO, U, LO | U, D, L}};
+
+    auto path(std::ptrdiff_t const row, std::ptrdiff_t const col)
+    {
+        seqan3::detail::matrix_offset const offset{seqan3::detail::row_index_type{row},
+                                                   seqan3::detail::column_index_type{col}};
+        using iterator_t = decltype(seqan3::detail::trace_iterator{matrix.begin() + offset});
+        return std::ranges::subrange<iterator_t, std::default_sentinel_t>{
+            seqan3::detail::trace_iterator{matrix.begin() + offset},
+            std::default_sentinel};
+    }
+
+    static seqan3::detail::matrix_coordinate coordinate(size_t const row, size_t const col)
+    {
+        return seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{row},
+                                                 seqan3::detail::column_index_type{col}};
+    }
+};
+
+TEST_F(cigar_builder_test, build_from_2_3)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_sequence] =
+        seqan3::detail::cigar_builder{}(path(2, 3));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 3u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 2u}));
+    EXPECT_RANGE_EQ(cigar_sequence, (std::vector<seqan3::cigar>{{2, 'I'_cigar_operation}, {3, 'D'_cigar_operation}}));
+}
+
+TEST_F(cigar_builder_test, build_from_2_2)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_sequence] =
+        seqan3::detail::cigar_builder{}(path(2, 2));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 2u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 2u}));
+    EXPECT_RANGE_EQ(cigar_sequence, (std::vector<seqan3::cigar>{{2, 'M'_cigar_operation}}));
+}
+
+TEST_F(cigar_builder_test, build_from_0_0)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_sequence] =
+        seqan3::detail::cigar_builder{}(path(0, 0));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 0u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 0u}));
+    EXPECT_TRUE(cigar_sequence.empty());
+}
+
+TEST_F(cigar_builder_test, recorded_trace_path)
+{
+    // Path from (3, 4) to (0, 0): D D L U L
+    seqan3::detail::recorded_trace_path trace_path{};
+    trace_path.clear(coordinate(3, 4));
+    trace_path.push_back(D, 2);
+    trace_path.push_back(L);
+    trace_path.push_back(U);
+    trace_path.push_back(L);
+
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_sequence] =
+        seqan3::detail::cigar_builder{}(trace_path);
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 4u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 3u}));
+    EXPECT_RANGE_EQ(cigar_sequence,
+                    (std::vector<seqan3::cigar>{{1, 'D'_cigar_operation},
+                                                {1, 'I'_cigar_operation},
+                                                {1, 'D'_cigar_operation},
+                                                {2, 'M'_cigar_operation}}));
+}
+
+TEST_F(cigar_builder_test, same_as_cigar_from_alignment)
+{
+    std::vector<seqan3::dna4> sequence1 = "ACG"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "AG"_dna4;
+
+    for (auto [row, col] : {std::pair<std::ptrdiff_t, std::ptrdiff_t>{2, 3}, {2, 2}, {1, 3}, {2, 1}})
+    {
+        seqan3::detail::aligned_sequence_builder builder{sequence1, sequence2};
+        auto alignment = builder(path(row, col)).alignment;
+
+        EXPECT_RANGE_EQ(seqan3::detail::cigar_builder{}(path(row, col)).cigar_sequence,
+                        seqan3::cigar_from_alignment(alignment));
+    }
+}
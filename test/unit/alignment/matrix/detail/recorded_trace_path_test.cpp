@@ -0,0 +1,115 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <ranges>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/recorded_trace_path.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::operator""_dna4;
+
+struct recorded_trace_path_test : public ::testing::Test
+{
+    static constexpr seqan3::detail::trace_directions D = seqan3::detail::trace_directions::diagonal;
+    static constexpr seqan3::detail::trace_directions U = seqan3::detail::trace_directions::up;
+    static constexpr seqan3::detail::trace_directions L = seqan3::detail::trace_directions::left;
+
+    static seqan3::detail::matrix_coordinate coordinate(size_t const row, size_t const col)
+    {
+        return seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{row},
+                                                 seqan3::detail::column_index_type{col}};
+    }
+
+    // Path from (3, 4) to (0, 0): D D L U L
+    seqan3::detail::recorded_trace_path make_path() const
+    {
+        seqan3::detail::recorded_trace_path path{};
+        path.clear(coordinate(3, 4));
+        path.push_back(D, 2);
+        path.push_back(L);
+        path.push_back(U);
+        path.push_back(L);
+        return path;
+    }
+};
+
+TEST_F(recorded_trace_path_test, concepts)
+{
+    EXPECT_TRUE(std::ranges::forward_range<seqan3::detail::recorded_trace_path>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<seqan3::detail::recorded_trace_path>);
+    EXPECT_TRUE((std::same_as<std::ranges::range_value_t<seqan3::detail::recorded_trace_path>,
+                              seqan3::detail::trace_directions>));
+}
+
+TEST_F(recorded_trace_path_test, empty)
+{
+    seqan3::detail::recorded_trace_path path{};
+    path.clear(coordinate(2, 2));
+    path.push_back(D, 0);
+
+    auto it = path.begin();
+    EXPECT_TRUE(it == path.end());
+    EXPECT_EQ(it.coordinate().row, 2u);
+    EXPECT_EQ(it.coordinate().col, 2u);
+}
+
+TEST_F(recorded_trace_path_test, directions)
+{
+    auto path = make_path();
+    EXPECT_RANGE_EQ(path, (std::vector{D, D, L, U, L}));
+}
+
+TEST_F(recorded_trace_path_test, coordinates)
+{
+    auto path = make_path();
+    std::vector<size_t> rows{};
+    std::vector<size_t> cols{};
+
+    auto it = path.begin();
+    for (; it != path.end(); ++it)
+    {
+        rows.push_back(it.coordinate().row);
+        cols.push_back(it.coordinate().col);
+    }
+    rows.push_back(it.coordinate().row);
+    cols.push_back(it.coordinate().col);
+
+    EXPECT_RANGE_EQ(rows, (std::vector<size_t>{3, 2, 1, 1, 0, 0}));
+    EXPECT_RANGE_EQ(cols, (std::vector<size_t>{4, 3, 2, 1, 1, 0}));
+}
+
+TEST_F(recorded_trace_path_test, clear)
+{
+    auto path = make_path();
+    path.clear(coordinate(1, 1));
+    path.push_back(D);
+
+    EXPECT_RANGE_EQ(path, (std::vector{D}));
+}
+
+TEST_F(recorded_trace_path_test, aligned_sequence_builder)
+{
+    std::vector sequence1 = "ACGT"_dna4;
+    std::vector sequence2 = "AGC"_dna4;
+
+    auto path = make_path();
+    seqan3::detail::aligned_sequence_builder builder{sequence1, sequence2};
+    auto result = builder(path);
+
+    EXPECT_EQ(result.first_sequence_slice_positions.first, 0u);
+    EXPECT_EQ(result.first_sequence_slice_positions.second, 4u);
+    EXPECT_EQ(result.second_sequence_slice_positions.first, 0u);
+    EXPECT_EQ(result.second_sequence_slice_positions.second, 3u);
+    EXPECT_RANGE_EQ(std::get<0>(result.alignment) | seqan3::views::to_char, std::string{"A-CGT"});
+    EXPECT_RANGE_EQ(std::get<1>(result.alignment) | seqan3::views::to_char, std::string{"-A-GC"});
+}
@@ -0,0 +1,181 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/cigar_conversion/cigar_from_alignment.hpp>
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_debug.hpp>
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_seed_extension.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+namespace cfg = seqan3::align_cfg;
+
+// Similar sequence pairs with mismatches, insertions and deletions.
+std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> generate_sequence_pairs()
+{
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequence_pairs{};
+    for (size_t seed = 0; seed < 20; ++seed)
+    {
+        auto sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(60 + (seed % 4) * 20, 0, seed);
+        std::vector<seqan3::dna4> sequence2{};
+        for (size_t i = 0; i < sequence1.size(); ++i)
+        {
+            if ((i + seed) % 17 == 3) // deletion
+                continue;
+            if ((i + seed) % 23 == 5) // insertion
+                sequence2.push_back(sequence1[(i * 7) % sequence1.size()]);
+            if ((i + seed) % 11 == 7) // mismatch
+                sequence2.push_back(seqan3::dna4{}.assign_rank((sequence1[i].to_rank() + 1) % 4));
+            else
+                sequence2.push_back(sequence1[i]);
+        }
+        sequence_pairs.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+    sequence_pairs.emplace_back(std::vector<seqan3::dna4>{}, std::vector<seqan3::dna4>{});
+    return sequence_pairs;
+}
+
+auto const affine_config = cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                 seqan3::mismatch_score{-5}}}
+                         | cfg::gap_cost_affine{cfg::open_score{-10}, cfg::extension_score{-1}};
+
+// The CIGAR sequence must be the same as the one converted from the alignment. If only the CIGAR sequence is
+// configured, the same CIGAR sequence and begin positions must be computed.
+template <typename config_t>
+void compare_with_alignment(config_t const & config)
+{
+    auto sequence_pairs = generate_sequence_pairs();
+
+    std::vector<std::vector<seqan3::cigar>> expected_cigars{};
+    std::vector<std::pair<size_t, size_t>> expected_begin_positions{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs,
+                                                 config | cfg::output_score{} | cfg::output_begin_position{}
+                                                     | cfg::output_alignment{} | cfg::output_cigar{}))
+    {
+        // seqan3::cigar_from_alignment does not accept empty alignments.
+        if (std::ranges::empty(std::get<0>(result.alignment())))
+            EXPECT_TRUE(result.cigar_sequence().empty());
+        else
+            EXPECT_RANGE_EQ(result.cigar_sequence(), seqan3::cigar_from_alignment(result.alignment()));
+        expected_cigars.push_back(result.cigar_sequence());
+        expected_begin_positions.emplace_back(result.sequence1_begin_position(), result.sequence2_begin_position());
+    }
+    ASSERT_EQ(expected_cigars.size(), sequence_pairs.size());
+
+    size_t index = 0;
+    for (auto && result :
+         seqan3::align_pairwise(sequence_pairs, config | cfg::output_begin_position{} | cfg::output_cigar{}))
+    {
+        ASSERT_LT(index, expected_cigars.size());
+        EXPECT_RANGE_EQ(result.cigar_sequence(), expected_cigars[index]);
+        EXPECT_EQ(result.sequence1_begin_position(), expected_begin_positions[index].first);
+        EXPECT_EQ(result.sequence2_begin_position(), expected_begin_positions[index].second);
+        ++index;
+    }
+
+    index = 0;
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config | cfg::output_cigar{}))
+        EXPECT_RANGE_EQ(result.cigar_sequence(), expected_cigars[index++]);
+    EXPECT_EQ(index, sequence_pairs.size());
+}
+
+TEST(align_pairwise_output_cigar, global)
+{
+    compare_with_alignment(cfg::method_global{} | affine_config);
+}
+
+TEST(align_pairwise_output_cigar, semi_global)
+{
+    compare_with_alignment(cfg::method_global{cfg::free_end_gaps_sequence1_leading{true},
+                                              cfg::free_end_gaps_sequence2_leading{false},
+                                              cfg::free_end_gaps_sequence1_trailing{true},
+                                              cfg::free_end_gaps_sequence2_trailing{false}}
+                           | affine_config);
+}
+
+TEST(align_pairwise_output_cigar, global_banded)
+{
+    compare_with_alignment(cfg::method_global{} | affine_config
+                           | cfg::band_fixed_size{cfg::lower_diagonal{-40}, cfg::upper_diagonal{40}});
+}
+
+TEST(align_pairwise_output_cigar, local)
+{
+    compare_with_alignment(cfg::method_local{} | affine_config);
+}
+
+TEST(align_pairwise_output_cigar, local_vectorised)
+{
+    compare_with_alignment(cfg::method_local{} | affine_config | cfg::vectorised{});
+}
+
+TEST(align_pairwise_output_cigar, local_debug)
+{
+    compare_with_alignment(cfg::method_local{} | affine_config | cfg::detail::debug{});
+}
+
+TEST(align_pairwise_output_cigar, edit_distance)
+{
+    compare_with_alignment(cfg::method_global{} | cfg::edit_scheme);
+}
+
+TEST(align_pairwise_output_cigar, semi_global_edit_distance)
+{
+    compare_with_alignment(cfg::method_global{cfg::free_end_gaps_sequence1_leading{true},
+                                              cfg::free_end_gaps_sequence2_leading{false},
+                                              cfg::free_end_gaps_sequence1_trailing{true},
+                                              cfg::free_end_gaps_sequence2_trailing{false}}
+                           | cfg::edit_scheme);
+}
+
+TEST(align_pairwise_output_cigar, wavefront)
+{
+    compare_with_alignment(cfg::method_global{}
+                           | cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                  seqan3::mismatch_score{-4}}}
+                           | cfg::gap_cost_affine{cfg::open_score{-6}, cfg::extension_score{-2}} | cfg::wavefront{});
+}
+
+TEST(align_pairwise_output_cigar, seed_extension)
+{
+    compare_with_alignment(cfg::method_global{} | affine_config | cfg::seed_extension{cfg::x_drop{20}});
+}
+
+TEST(align_pairwise_output_cigar, seed_extension_vectorised)
+{
+    compare_with_alignment(cfg::method_global{} | affine_config | cfg::seed_extension{cfg::x_drop{20}}
+                           | cfg::vectorised{});
+}
+
+TEST(align_pairwise_output_cigar, cigar_string)
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4> sequence1 = "ACGTGAATTCGTGA"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "ACGTAATTAACGTGA"_dna4;
+
+    auto config = cfg::method_global{} | cfg::edit_scheme | cfg::output_score{} | cfg::output_cigar{};
+    auto result = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config).begin();
+
+    EXPECT_EQ(result.score(), -3);
+    EXPECT_RANGE_EQ(result.cigar_sequence(),
+                    (std::vector<seqan3::cigar>{{4, 'M'_cigar_operation},
+                                                {1, 'D'_cigar_operation},
+                                                {4, 'M'_cigar_operation},
+                                                {2, 'I'_cigar_operation},
+                                                {5, 'M'_cigar_operation}}));
+}
@@ -7,13 +7,19 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <functional>
 #include <ranges>
 #include <stdexcept>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/alphabet/views/to_char.hpp>
@@ -266,6 +272,43 @@ TYPED_TEST(align_pairwise_test, collection_with_double_score_type)
     }
 }
 
+TYPED_TEST(align_pairwise_test, collection_sorted_by_length)
+{
+    std::vector<seqan3::dna4_vector> sequences{"ACGTGATGACGTAGCTAGCAGTCGAT"_dna4,
+                                               "AGT"_dna4,
+                                               "ACGTGATG"_dna4,
+                                               "AGTGATACTTTACGATCGACTAGC"_dna4,
+                                               "A"_dna4,
+                                               "AGTGATACT"_dna4,
+                                               "GGACGACATGACGTACG"_dna4};
+
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> pairs{};
+    for (size_t i = 0; i < 50; ++i)
+        pairs.emplace_back(sequences[i % sequences.size()], sequences[(i * 3 + 1) % sequences.size()]);
+
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{}
+                              | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}}
+                              | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                   seqan3::align_cfg::extension_score{-1}}
+                              | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_sequence1_id{};
+
+    std::vector<int32_t> expected_scores{};
+    for (auto && res : call_alignment<TypeParam>(pairs, cfg))
+        expected_scores.push_back(res.score());
+
+    auto sorted_cfg = cfg | seqan3::align_cfg::vectorised{seqan3::align_cfg::length_sorting_window{20}};
+
+    size_t expected_id = 0;
+    for (auto && res : call_alignment<TypeParam>(pairs, sorted_cfg))
+    {
+        ASSERT_LT(expected_id, expected_scores.size());
+        EXPECT_EQ(res.sequence1_id(), expected_id);
+        EXPECT_EQ(res.score(), expected_scores[expected_id]);
+        ++expected_id;
+    }
+    EXPECT_EQ(expected_id, pairs.size());
+}
+
 TYPED_TEST(align_pairwise_test, bug_1598)
 {
     // https://github.com/seqan/seqan3/issues/1598
@@ -292,3 +335,64 @@ TEST(align_pairwise_test, parallel_without_parameter)
 
     EXPECT_THROW(seqan3::align_pairwise(std::tie(seq1, seq2), cfg), std::runtime_error);
 }
+
+TEST(align_pairwise_test, parallel_streaming)
+{
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> pairs{};
+    for (size_t i = 0; i < 100; ++i)
+        pairs.emplace_back("ACGTGATG"_dna4, seqan3::dna4_vector(i % 13, 'A'_dna4));
+
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
+                              | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_sequence2_id{};
+
+    std::vector<int32_t> expected_scores{};
+    for (auto && res : seqan3::align_pairwise(pairs, cfg))
+        expected_scores.push_back(res.score());
+
+    { // Results in input order.
+        auto streaming_cfg = cfg | seqan3::align_cfg::parallel{4, seqan3::align_cfg::streaming_window{3}};
+
+        size_t expected_id = 0;
+        for (auto && res : seqan3::align_pairwise(pairs, streaming_cfg))
+        {
+            ASSERT_LT(expected_id, expected_scores.size());
+            EXPECT_EQ(res.sequence2_id(), expected_id);
+            EXPECT_EQ(res.score(), expected_scores[expected_id]);
+            ++expected_id;
+        }
+        EXPECT_EQ(expected_id, pairs.size());
+    }
+
+    { // Results in completion order.
+        auto streaming_cfg = cfg
+                           | seqan3::align_cfg::parallel{4,
+                                                         seqan3::align_cfg::streaming_window{3},
+                                                         seqan3::align_cfg::result_order::completion};
+
+        std::vector<bool> seen(pairs.size(), false);
+        for (auto && res : seqan3::align_pairwise(pairs, streaming_cfg))
+        {
+            ASSERT_LT(res.sequence2_id(), pairs.size());
+            EXPECT_FALSE(seen[res.sequence2_id()]);
+            EXPECT_EQ(res.score(), expected_scores[res.sequence2_id()]);
+            seen[res.sequence2_id()] = true;
+        }
+        EXPECT_TRUE(std::ranges::all_of(seen, std::identity{}));
+    }
+
+    { // The callback is invoked on the calling thread in input order.
+        std::thread::id const caller_id = std::this_thread::get_id();
+        size_t expected_id = 0;
+        auto streaming_cfg = cfg | seqan3::align_cfg::parallel{4, seqan3::align_cfg::streaming_window{3}}
+                           | seqan3::align_cfg::on_result{[&](auto && res)
+                                                          {
+                                                              EXPECT_EQ(std::this_thread::get_id(), caller_id);
+                                                              EXPECT_EQ(res.sequence2_id(), expected_id);
+                                                              EXPECT_EQ(res.score(), expected_scores[expected_id]);
+                                                              ++expected_id;
+                                                          }};
+
+        seqan3::align_pairwise(pairs, streaming_cfg);
+        EXPECT_EQ(expected_id, pairs.size());
+    }
+}
@@ -0,0 +1,307 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/cigar_conversion/cigar_from_alignment.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+#include "fixture/global_affine_unbanded.hpp"
+
+using seqan3::operator""_aa27;
+
+template <auto _fixture>
+struct global_affine_adaptive_banded_fixture : public ::testing::Test
+{
+    auto fixture() -> decltype(seqan3::test::alignment::fixture::alignment_fixture{*_fixture}) const &
+    {
+        return *_fixture;
+    }
+};
+
+template <typename fixture_t>
+class global_affine_adaptive_banded_test : public fixture_t
+{};
+
+using global_affine_adaptive_banded_testing_types = ::testing::Types<
+    global_affine_adaptive_banded_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_01>,
+    global_affine_adaptive_banded_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_02>,
+    global_affine_adaptive_banded_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_03>,
+    global_affine_adaptive_banded_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_04>,
+    global_affine_adaptive_banded_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_05>,
+    global_affine_adaptive_banded_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq1_empty>,
+    global_affine_adaptive_banded_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq2_empty>,
+    global_affine_adaptive_banded_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_both_empty>,
+    global_affine_adaptive_banded_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::aa27_blosum62_gap_1_open_10>>;
+
+TYPED_TEST_SUITE(global_affine_adaptive_banded_test, global_affine_adaptive_banded_testing_types, );
+
+TYPED_TEST(global_affine_adaptive_banded_test, score)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg =
+        fixture.config | seqan3::align_cfg::band_adaptive{32} | seqan3::align_cfg::output_score{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+
+    EXPECT_EQ(res.score(), fixture.score);
+}
+
+TYPED_TEST(global_affine_adaptive_banded_test, end_positions)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg =
+        fixture.config | seqan3::align_cfg::band_adaptive{32} | seqan3::align_cfg::output_end_position{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+
+    EXPECT_EQ(res.sequence1_end_position(), fixture.sequence1_end_position);
+    EXPECT_EQ(res.sequence2_end_position(), fixture.sequence2_end_position);
+}
+
+TYPED_TEST(global_affine_adaptive_banded_test, begin_positions)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg =
+        fixture.config | seqan3::align_cfg::band_adaptive{32} | seqan3::align_cfg::output_begin_position{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+
+    EXPECT_EQ(res.sequence1_begin_position(), fixture.sequence1_begin_position);
+    EXPECT_EQ(res.sequence2_begin_position(), fixture.sequence2_begin_position);
+}
+
+TYPED_TEST(global_affine_adaptive_banded_test, alignment)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg =
+        fixture.config | seqan3::align_cfg::band_adaptive{32} | seqan3::align_cfg::output_alignment{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+    auto && [gapped_database, gapped_query] = res.alignment();
+
+    EXPECT_RANGE_EQ(gapped_database | seqan3::views::to_char, fixture.aligned_sequence1);
+    EXPECT_RANGE_EQ(gapped_query | seqan3::views::to_char, fixture.aligned_sequence2);
+}
+
+TYPED_TEST(global_affine_adaptive_banded_test, cigar)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | seqan3::align_cfg::band_adaptive{32}
+                                    | seqan3::align_cfg::output_alignment{} | seqan3::align_cfg::output_cigar{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+
+    if (std::ranges::empty(std::get<0>(res.alignment())))
+        EXPECT_TRUE(res.cigar_sequence().empty());
+    else
+        EXPECT_RANGE_EQ(res.cigar_sequence(), seqan3::cigar_from_alignment(res.alignment()));
+}
+
+// ----------------------------------------------------------------------------
+// Compare against the unbanded dynamic programming algorithm
+// ----------------------------------------------------------------------------
+
+struct global_affine_adaptive_banded_random_test : public ::testing::Test
+{
+    // Generates a pair of similar sequences by introducing random edits. Insertions are twice as likely as deletions,
+    // such that the optimal path drifts away from the main diagonal.
+    static std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>> generate_pair(size_t const size,
+                                                                                          size_t const seed)
+    {
+        std::vector<seqan3::dna4> sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(size, 0, seed);
+        std::vector<seqan3::dna4> sequence2{};
+
+        std::mt19937 generator{seed};
+        std::uniform_int_distribution<size_t> edit_dist{0, 19};
+        for (seqan3::dna4 symbol : sequence1)
+        {
+            switch (edit_dist(generator))
+            {
+                case 0: // substitution
+                    sequence2.push_back(seqan3::assign_rank_to((symbol.to_rank() + 1) % 4, seqan3::dna4{}));
+                    break;
+                case 1: // deletion
+                    break;
+                case 2: // insertion
+                case 3:
+                    sequence2.push_back(symbol);
+                    sequence2.push_back(seqan3::assign_rank_to(generator() % 4, seqan3::dna4{}));
+                    break;
+                default:
+                    sequence2.push_back(symbol);
+            }
+        }
+        return {std::move(sequence1), std::move(sequence2)};
+    }
+
+    template <typename config_t>
+    static void compare(config_t const & config, size_t const size)
+    {
+        for (size_t seed = 0; seed < 10; ++seed)
+        {
+            auto [sequence1, sequence2] = generate_pair(size, seed);
+
+            auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                                    config | seqan3::align_cfg::output_score{})
+                                 .begin();
+            auto res = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                               config | seqan3::align_cfg::band_adaptive{16}
+                                                   | seqan3::align_cfg::output_score{}
+                                                   | seqan3::align_cfg::output_alignment{}
+                                                   | seqan3::align_cfg::output_cigar{})
+                            .begin();
+
+            EXPECT_EQ(res.score(), expected.score()) << "seed: " << seed;
+            EXPECT_RANGE_EQ(std::get<0>(res.alignment()) | std::views::filter(
+                                [](auto const & c)
+                                {
+                                    return c != seqan3::gap{};
+                                }),
+                            sequence1);
+            EXPECT_RANGE_EQ(res.cigar_sequence(), seqan3::cigar_from_alignment(res.alignment()));
+        }
+    }
+};
+
+TEST_F(global_affine_adaptive_banded_random_test, affine_gaps)
+{
+    // The optimal path leaves any fixed band of the same width around the main diagonal.
+    compare(seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                      seqan3::mismatch_score{-4}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-4},
+                                                     seqan3::align_cfg::extension_score{-2}},
+            1000);
+}
+
+TEST_F(global_affine_adaptive_banded_random_test, linear_gaps)
+{
+    compare(seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{1},
+                                                                                      seqan3::mismatch_score{-1}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0},
+                                                     seqan3::align_cfg::extension_score{-1}},
+            500);
+}
+
+TEST_F(global_affine_adaptive_banded_random_test, default_gap_cost)
+{
+    // Without seqan3::align_cfg::gap_cost_affine, the same gap costs as in the unbanded alignment are used.
+    auto config = seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                      seqan3::mismatch_score{-5}}};
+    compare(config, 1000);
+
+    std::vector sequence1 = "ACGTACGTACGTAAAACGT"_dna4;
+    std::vector sequence2 = "ACGTACGTACGTACGT"_dna4;
+    auto score_config = config | seqan3::align_cfg::output_score{};
+
+    auto unbanded = *seqan3::align_pairwise(std::tie(sequence1, sequence2), score_config).begin();
+    auto banded = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                          score_config | seqan3::align_cfg::band_adaptive{32})
+                       .begin();
+    EXPECT_EQ(unbanded.score(), 51);
+    EXPECT_EQ(banded.score(), unbanded.score());
+}
+
+TEST_F(global_affine_adaptive_banded_random_test, collection)
+{
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequences{};
+    for (size_t seed = 0; seed < 10; ++seed)
+        sequences.push_back(generate_pair(200, seed));
+
+    auto config = seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                      seqan3::mismatch_score{-5}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                     seqan3::align_cfg::extension_score{-1}}
+                | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_sequence1_id{};
+
+    std::vector<int32_t> expected{};
+    for (auto && res : seqan3::align_pairwise(sequences, config))
+        expected.push_back(res.score());
+
+    for (auto && res : seqan3::align_pairwise(sequences,
+                                              config | seqan3::align_cfg::band_adaptive{32}
+                                                  | seqan3::align_cfg::parallel{2}))
+        EXPECT_EQ(res.score(), expected[res.sequence1_id()]);
+}
+
+TEST(global_affine_adaptive_banded_width_test, narrow_band)
+{
+    // With a band width of 1, only the cells of the first row and of the last column are computed.
+    std::vector sequence1 = "ACGT"_dna4;
+    std::vector sequence2 = "AC"_dna4;
+    auto config = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
+                | seqan3::align_cfg::band_adaptive{1} | seqan3::align_cfg::output_score{}
+                | seqan3::align_cfg::output_alignment{};
+
+    auto res = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config).begin();
+    EXPECT_EQ(res.score(), -5);
+    EXPECT_RANGE_EQ(std::get<0>(res.alignment()) | seqan3::views::to_char, std::string{"ACGT-"});
+    EXPECT_RANGE_EQ(std::get<1>(res.alignment()) | seqan3::views::to_char, std::string{"---AC"});
+}
+
+// ----------------------------------------------------------------------------
+// Invalid configurations
+// ----------------------------------------------------------------------------
+
+TEST(global_affine_adaptive_banded_invalid_test, free_end_gaps)
+{
+    std::vector sequence = "ACGT"_dna4;
+    auto config = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                   seqan3::align_cfg::free_end_gaps_sequence1_trailing{false},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+                | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::band_adaptive{};
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence, sequence), config),
+                 seqan3::invalid_alignment_configuration);
+}
+
+TEST(global_affine_adaptive_banded_invalid_test, width)
+{
+    std::vector sequence = "ACGT"_dna4;
+    auto config =
+        seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::band_adaptive{0};
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence, sequence), config),
+                 seqan3::invalid_alignment_configuration);
+}
@@ -0,0 +1,128 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/detail/anti_diagonal_alignment_kernel.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// Long sequence pairs, which are computed with the anti-diagonal kernel in one or several strips, and short ones.
+template <typename alphabet_t>
+std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> generate_sequence_pairs()
+{
+    std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> sequence_pairs{};
+    for (size_t seed = 0; seed < 12; ++seed)
+    {
+        size_t const size1 = (seed % 4) * 150 + (seed % 3) * 17 + 21 + (seed == 10 ? 2400 : 0);
+        size_t const size2 = size1 + (seed % 5) * 13 - 20 + (seed == 7 ? 300 : 0);
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<alphabet_t>(size1, 0, seed),
+                                    seqan3::test::generate_sequence<alphabet_t>(size2, 0, seed + 100));
+    }
+    return sequence_pairs;
+}
+
+// The alignment with trace is always computed column-wise.
+template <typename sequence_pairs_t, typename config_t>
+void compare_with_column_wise_computation(sequence_pairs_t sequence_pairs, config_t const & config)
+{
+    std::vector<int32_t> expected{};
+    auto trace_config = config | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_alignment{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, trace_config))
+        expected.push_back(result.score());
+
+    auto score_config = config | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                      | seqan3::align_cfg::output_sequence1_id{};
+
+    size_t index = 0;
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, score_config))
+    {
+        ASSERT_LT(index, expected.size());
+        EXPECT_EQ(result.sequence1_id(), index);
+        EXPECT_EQ(result.score(), expected[index]) << "pair: " << index;
+        EXPECT_EQ(result.sequence1_end_position(), sequence_pairs[index].first.size());
+        EXPECT_EQ(result.sequence2_end_position(), sequence_pairs[index].second.size());
+        ++index;
+    }
+    EXPECT_EQ(index, sequence_pairs.size());
+}
+
+auto const dna4_config =
+    seqan3::align_cfg::method_global{}
+    | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                          seqan3::mismatch_score{-5}}}
+    | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10}, seqan3::align_cfg::extension_score{-1}};
+
+auto const aa27_config =
+    seqan3::align_cfg::method_global{}
+    | seqan3::align_cfg::scoring_scheme{seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}}
+    | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-11}, seqan3::align_cfg::extension_score{-1}};
+
+TEST(global_affine_anti_diagonal, uniform_scores)
+{
+    compare_with_column_wise_computation(generate_sequence_pairs<seqan3::dna4>(), dna4_config);
+}
+
+TEST(global_affine_anti_diagonal, score_matrix)
+{
+    compare_with_column_wise_computation(generate_sequence_pairs<seqan3::aa27>(), aa27_config);
+}
+
+TEST(global_affine_anti_diagonal, score_type_int16)
+{
+    compare_with_column_wise_computation(generate_sequence_pairs<seqan3::dna4>(),
+                                         dna4_config | seqan3::align_cfg::score_type<int16_t>{});
+}
+
+TEST(global_affine_anti_diagonal, banded)
+{
+    auto sequence_pairs = generate_sequence_pairs<seqan3::dna4>();
+    std::erase_if(sequence_pairs,
+                  [](auto const & sequence_pair)
+                  {
+                      int64_t const size_difference = sequence_pair.first.size() - sequence_pair.second.size();
+                      return size_difference < -40 || size_difference > 40;
+                  });
+
+    for (auto [lower_diagonal, upper_diagonal] : {std::pair{-40, 40}, std::pair{-200, 45}, std::pair{-41, 1000}})
+    {
+        compare_with_column_wise_computation(
+            sequence_pairs,
+            dna4_config
+                | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{lower_diagonal},
+                                                     seqan3::align_cfg::upper_diagonal{upper_diagonal}});
+    }
+}
+
+TEST(global_affine_anti_diagonal, kernel)
+{
+    // Calls the kernel directly, which is independent of the available simd instructions.
+    seqan3::detail::anti_diagonal_alignment_kernel<int32_t, seqan3::nucleotide_scoring_scheme<int8_t>> kernel{
+        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}},
+        -10,
+        -1};
+
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4> sequence1 = "AACCGGTTAACCGGTT"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "ACGTACGTACGTACGT"_dna4;
+    // The score of the alignment computed column-wise.
+    EXPECT_EQ(kernel(sequence1, sequence2, -16, 16), -22);
+    EXPECT_EQ(kernel(sequence1, sequence1, -16, 16), 64);
+    EXPECT_EQ(kernel(sequence1, sequence1, 0, 0), 64);
+    EXPECT_EQ(kernel(std::vector<seqan3::dna4>{}, sequence2, -16, 0), -26);
+}
@@ -0,0 +1,154 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using sequence_pairs_t = std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>>;
+
+// Sequence pairs of different lengths, including empty sequences and sequences whose scores exceed the 8 bit range.
+sequence_pairs_t generate_sequence_pairs()
+{
+    sequence_pairs_t sequence_pairs{};
+    for (size_t seed = 0; seed < 70; ++seed)
+    {
+        size_t const size1 = (seed % 7) * 23 + (seed == 5 ? 1200 : 0);
+        size_t const size2 = (seed % 5) * 31 + (seed == 3 ? 900 : 0);
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(size1, 0, seed),
+                                    seqan3::test::generate_sequence<seqan3::dna4>(size2, 0, seed + 100));
+    }
+    return sequence_pairs;
+}
+
+template <typename config_t>
+void compare_with_absolute_scores(config_t const & config)
+{
+    sequence_pairs_t sequence_pairs = generate_sequence_pairs();
+
+    auto output_config = config | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                       | seqan3::align_cfg::output_sequence1_id{};
+
+    std::vector<std::tuple<int32_t, size_t, size_t>> expected{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, output_config))
+        expected.emplace_back(result.score(), result.sequence1_end_position(), result.sequence2_end_position());
+
+    auto difference_config =
+        output_config | seqan3::align_cfg::vectorised{seqan3::align_cfg::score_encoding::difference};
+
+    size_t index = 0;
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, difference_config))
+    {
+        ASSERT_LT(index, expected.size());
+        EXPECT_EQ(result.sequence1_id(), index);
+        EXPECT_EQ(result.score(), std::get<0>(expected[index])) << "pair: " << index;
+        EXPECT_EQ(result.sequence1_end_position(), std::get<1>(expected[index])) << "pair: " << index;
+        EXPECT_EQ(result.sequence2_end_position(), std::get<2>(expected[index])) << "pair: " << index;
+        ++index;
+    }
+    EXPECT_EQ(index, sequence_pairs.size());
+}
+
+TEST(global_affine_difference_recurrence, match_4_mismatch_5_gap_1_open_10)
+{
+    compare_with_absolute_scores(
+        seqan3::align_cfg::method_global{}
+        | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                              seqan3::mismatch_score{-5}}}
+        | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                             seqan3::align_cfg::extension_score{-1}});
+}
+
+TEST(global_affine_difference_recurrence, penalties)
+{
+    compare_with_absolute_scores(
+        seqan3::align_cfg::method_global{}
+        | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{0},
+                                                                              seqan3::mismatch_score{-4}}}
+        | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-6},
+                                             seqan3::align_cfg::extension_score{-2}});
+}
+
+TEST(global_affine_difference_recurrence, linear_gaps)
+{
+    compare_with_absolute_scores(
+        seqan3::align_cfg::method_global{}
+        | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                              seqan3::mismatch_score{-3}}}
+        | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0},
+                                             seqan3::align_cfg::extension_score{-2}});
+}
+
+TEST(global_affine_difference_recurrence, default_gap_cost)
+{
+    // Without seqan3::align_cfg::gap_cost_affine, both kernels use a gap open score of -10 and a gap extension score
+    // of -1.
+    compare_with_absolute_scores(
+        seqan3::align_cfg::method_global{}
+        | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                              seqan3::mismatch_score{-5}}});
+}
+
+TEST(global_affine_difference_recurrence, largest_representable_scores)
+{
+    // 2 * |open + extension| + max(|match|, |mismatch|) == 127
+    compare_with_absolute_scores(
+        seqan3::align_cfg::method_global{}
+        | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{17},
+                                                                              seqan3::mismatch_score{-15}}}
+        | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-40},
+                                             seqan3::align_cfg::extension_score{-15}});
+}
+
+TEST(global_affine_difference_recurrence, fallback_to_absolute_scores)
+{
+    // The scores are too large for 8 bit differences.
+    compare_with_absolute_scores(
+        seqan3::align_cfg::method_global{}
+        | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{40},
+                                                                              seqan3::mismatch_score{-50}}}
+        | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-40},
+                                             seqan3::align_cfg::extension_score{-10}});
+}
+
+TEST(global_affine_difference_recurrence, length_sorting_window)
+{
+    sequence_pairs_t sequence_pairs = generate_sequence_pairs();
+
+    auto config = seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                      seqan3::mismatch_score{-5}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                     seqan3::align_cfg::extension_score{-1}}
+                | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_sequence1_id{};
+
+    std::vector<int32_t> expected_scores{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config))
+        expected_scores.push_back(result.score());
+
+    auto sorted_config = config
+                       | seqan3::align_cfg::vectorised{seqan3::align_cfg::score_encoding::difference,
+                                                       seqan3::align_cfg::length_sorting_window{100}};
+
+    size_t index = 0;
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, sorted_config))
+    {
+        ASSERT_LT(index, expected_scores.size());
+        EXPECT_EQ(result.sequence1_id(), index);
+        EXPECT_EQ(result.score(), expected_scores[index]);
+        ++index;
+    }
+    EXPECT_EQ(index, sequence_pairs.size());
+}
@@ -7,9 +7,11 @@
 
 #include <gtest/gtest.h>
 
+#include <utility>
 #include <vector>
 
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
 
 #include "fixture/global_affine_unbanded.hpp"
 #include "pairwise_alignment_collection_test_template.hpp"
@@ -62,3 +64,34 @@ using pairwise_collection_simd_global_affine_unbanded_testing_types = ::testing:
 INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_collection_simd_global_affine_unbanded_aa27,
                                pairwise_alignment_collection_test,
                                pairwise_collection_simd_global_affine_unbanded_testing_types, );
+
+TEST(pairwise_collection_simd_global_affine_unbanded_aa27, shared_query)
+{
+    // All lanes share the second sequence, such that the columns are scored with a query profile.
+    std::vector<seqan3::aa27> const query = seqan3::test::generate_sequence<seqan3::aa27>(120, 0, 7);
+
+    std::vector<std::pair<std::vector<seqan3::aa27>, std::vector<seqan3::aa27>>> sequence_pairs{};
+    for (size_t seed = 0; seed < 50; ++seed)
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::aa27>(100, 40, seed), query);
+    sequence_pairs.emplace_back(std::vector<seqan3::aa27>{}, query);
+
+    auto get_scores = [&](auto const & config)
+    {
+        std::vector<int32_t> scores{};
+        for (auto && result : seqan3::align_pairwise(sequence_pairs, config | seqan3::align_cfg::output_score{}))
+            scores.push_back(result.score());
+        return scores;
+    };
+
+    auto const scoring_config =
+        seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10}, seqan3::align_cfg::extension_score{-1}}
+        | seqan3::align_cfg::scoring_scheme{
+            seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}};
+
+    std::vector<int32_t> const expected = get_scores(seqan3::align_cfg::method_global{} | scoring_config);
+    EXPECT_EQ(get_scores(seqan3::align_cfg::method_global{} | scoring_config | seqan3::align_cfg::vectorised{}),
+              expected);
+    EXPECT_EQ(get_scores(seqan3::align_cfg::method_global{} | scoring_config | seqan3::align_cfg::vectorised{}
+                         | seqan3::align_cfg::score_type<int16_t>{}),
+              expected);
+}
@@ -0,0 +1,304 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+#include "fixture/global_affine_unbanded.hpp"
+
+using seqan3::operator""_aa27;
+
+template <auto _fixture>
+struct global_affine_wavefront_fixture : public ::testing::Test
+{
+    auto fixture() -> decltype(seqan3::test::alignment::fixture::alignment_fixture{*_fixture}) const &
+    {
+        return *_fixture;
+    }
+};
+
+template <typename fixture_t>
+class global_affine_wavefront_test : public fixture_t
+{};
+
+using global_affine_wavefront_testing_types = ::testing::Types<
+    global_affine_wavefront_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_01>,
+    global_affine_wavefront_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_02>,
+    global_affine_wavefront_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_03>,
+    global_affine_wavefront_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_04>,
+    global_affine_wavefront_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_05>,
+    global_affine_wavefront_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq1_empty>,
+    global_affine_wavefront_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq2_empty>,
+    global_affine_wavefront_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_both_empty>>;
+
+TYPED_TEST_SUITE(global_affine_wavefront_test, global_affine_wavefront_testing_types, );
+
+// Recomputes the score of the given alignment. Co-optimal alignments might differ from the fixture, hence only the
+// score of the computed alignment is compared.
+template <typename alignment_t, typename scheme_t>
+int32_t score_of_alignment(alignment_t const & alignment, scheme_t const & scheme, int32_t open, int32_t extension)
+{
+    auto const & [gapped_sequence1, gapped_sequence2] = alignment;
+    EXPECT_EQ(std::ranges::size(gapped_sequence1), std::ranges::size(gapped_sequence2));
+
+    int32_t score = 0;
+    bool in_gap1 = false;
+    bool in_gap2 = false;
+    for (size_t i = 0; i < std::ranges::size(gapped_sequence1); ++i)
+    {
+        bool const is_gap1 = gapped_sequence1[i] == seqan3::gap{};
+        bool const is_gap2 = gapped_sequence2[i] == seqan3::gap{};
+        EXPECT_FALSE(is_gap1 && is_gap2);
+
+        if (is_gap1)
+            score += extension + (in_gap1 ? 0 : open);
+        else if (is_gap2)
+            score += extension + (in_gap2 ? 0 : open);
+        else
+            score += scheme.score(gapped_sequence1[i].template convert_to<seqan3::dna4>(),
+                                  gapped_sequence2[i].template convert_to<seqan3::dna4>());
+
+        in_gap1 = is_gap1;
+        in_gap2 = is_gap2;
+    }
+    return score;
+}
+
+TYPED_TEST(global_affine_wavefront_test, score)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg =
+        fixture.config | seqan3::align_cfg::wavefront{} | seqan3::align_cfg::output_score{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+
+    EXPECT_EQ(res.score(), fixture.score);
+}
+
+TYPED_TEST(global_affine_wavefront_test, positions)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | seqan3::align_cfg::wavefront{}
+                                    | seqan3::align_cfg::output_begin_position{}
+                                    | seqan3::align_cfg::output_end_position{} | seqan3::align_cfg::output_score{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+
+    EXPECT_EQ(res.score(), fixture.score);
+    EXPECT_EQ(res.sequence1_end_position(), fixture.sequence1_end_position);
+    EXPECT_EQ(res.sequence2_end_position(), fixture.sequence2_end_position);
+    EXPECT_EQ(res.sequence1_begin_position(), fixture.sequence1_begin_position);
+    EXPECT_EQ(res.sequence2_begin_position(), fixture.sequence2_begin_position);
+}
+
+TYPED_TEST(global_affine_wavefront_test, alignment)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | seqan3::align_cfg::wavefront{}
+                                    | seqan3::align_cfg::output_alignment{} | seqan3::align_cfg::output_score{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+
+    EXPECT_EQ(res.score(), fixture.score);
+    auto const & scheme = seqan3::get<seqan3::align_cfg::scoring_scheme>(fixture.config).scheme;
+    EXPECT_EQ(score_of_alignment(res.alignment(), scheme, -10, -1), fixture.score);
+}
+
+// ----------------------------------------------------------------------------
+// Compare against the dynamic programming algorithm
+// ----------------------------------------------------------------------------
+
+struct global_affine_wavefront_random_test : public ::testing::Test
+{
+    // Generates a pair of similar sequences by introducing random edits.
+    static std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>> generate_pair(size_t const size,
+                                                                                          size_t const seed)
+    {
+        std::vector<seqan3::dna4> sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(size, 0, seed);
+        std::vector<seqan3::dna4> sequence2{};
+
+        std::mt19937 generator{seed};
+        std::uniform_int_distribution<size_t> edit_dist{0, 19};
+        for (seqan3::dna4 symbol : sequence1)
+        {
+            switch (edit_dist(generator))
+            {
+                case 0: // substitution
+                    sequence2.push_back(seqan3::assign_rank_to((symbol.to_rank() + 1) % 4, seqan3::dna4{}));
+                    break;
+                case 1: // deletion
+                    break;
+                case 2: // insertion
+                    sequence2.push_back(symbol);
+                    sequence2.push_back('T'_dna4);
+                    break;
+                default:
+                    sequence2.push_back(symbol);
+            }
+        }
+        return {std::move(sequence1), std::move(sequence2)};
+    }
+
+    template <typename config_t>
+    static void compare(config_t const & config, int32_t open, int32_t extension)
+    {
+        for (size_t seed = 0; seed < 20; ++seed)
+        {
+            auto [sequence1, sequence2] = generate_pair(10 + seed * 7, seed);
+
+            auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                                    config | seqan3::align_cfg::output_score{})
+                                 .begin();
+            auto res = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                               config | seqan3::align_cfg::wavefront{}
+                                                   | seqan3::align_cfg::output_score{}
+                                                   | seqan3::align_cfg::output_alignment{})
+                            .begin();
+
+            auto const & scheme = seqan3::get<seqan3::align_cfg::scoring_scheme>(config).scheme;
+            EXPECT_EQ(res.score(), expected.score()) << "seed: " << seed;
+            EXPECT_EQ(score_of_alignment(res.alignment(), scheme, open, extension), expected.score())
+                << "seed: " << seed;
+        }
+    }
+};
+
+TEST_F(global_affine_wavefront_random_test, even_match_score)
+{
+    compare(seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                      seqan3::mismatch_score{-5}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                     seqan3::align_cfg::extension_score{-1}},
+            -10,
+            -1);
+}
+
+TEST_F(global_affine_wavefront_random_test, odd_match_score)
+{
+    compare(seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{3},
+                                                                                      seqan3::mismatch_score{-2}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-5},
+                                                     seqan3::align_cfg::extension_score{-2}},
+            -5,
+            -2);
+}
+
+TEST_F(global_affine_wavefront_random_test, penalties)
+{
+    compare(seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{0},
+                                                                                      seqan3::mismatch_score{-4}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-6},
+                                                     seqan3::align_cfg::extension_score{-2}},
+            -6,
+            -2);
+}
+
+TEST_F(global_affine_wavefront_random_test, linear_gaps)
+{
+    compare(seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                      seqan3::mismatch_score{-3}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0},
+                                                     seqan3::align_cfg::extension_score{-2}},
+            0,
+            -2);
+}
+
+TEST_F(global_affine_wavefront_random_test, edit_distance)
+{
+    compare(seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme, 0, -1);
+}
+
+TEST_F(global_affine_wavefront_random_test, collection)
+{
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequences{};
+    for (size_t seed = 0; seed < 10; ++seed)
+        sequences.push_back(generate_pair(50, seed));
+
+    auto config = seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                      seqan3::mismatch_score{-5}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                     seqan3::align_cfg::extension_score{-1}}
+                | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_sequence1_id{};
+
+    std::vector<int32_t> expected{};
+    for (auto && res : seqan3::align_pairwise(sequences, config))
+        expected.push_back(res.score());
+
+    for (auto && res : seqan3::align_pairwise(sequences, config | seqan3::align_cfg::wavefront{}))
+        EXPECT_EQ(res.score(), expected[res.sequence1_id()]);
+}
+
+// ----------------------------------------------------------------------------
+// Invalid configurations
+// ----------------------------------------------------------------------------
+
+TEST(global_affine_wavefront_invalid_test, free_end_gaps)
+{
+    std::vector sequence = "ACGT"_dna4;
+    auto config = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                   seqan3::align_cfg::free_end_gaps_sequence1_trailing{false},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+                | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::wavefront{};
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence, sequence), config),
+                 seqan3::invalid_alignment_configuration);
+}
+
+TEST(global_affine_wavefront_invalid_test, scoring_scheme)
+{
+    std::vector sequence = "ACGT"_aa27;
+    seqan3::aminoacid_scoring_scheme const scheme{seqan3::aminoacid_similarity_matrix::blosum62};
+    auto config = seqan3::align_cfg::method_global{} | seqan3::align_cfg::scoring_scheme{scheme}
+                | seqan3::align_cfg::wavefront{};
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence, sequence), config),
+                 seqan3::invalid_alignment_configuration);
+}
+
+TEST(global_affine_wavefront_invalid_test, penalties)
+{
+    std::vector sequence = "ACGT"_dna4;
+    auto config = seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                      seqan3::mismatch_score{-5}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                     seqan3::align_cfg::extension_score{2}}
+                | seqan3::align_cfg::wavefront{};
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence, sequence), config),
+                 seqan3::invalid_alignment_configuration);
+}
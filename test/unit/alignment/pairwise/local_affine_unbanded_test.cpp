@@ -7,7 +7,13 @@
 
 #include <gtest/gtest.h>
 
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
 
 #include "fixture/local_affine_unbanded.hpp"
 #include "pairwise_alignment_single_test_template.hpp"
@@ -25,3 +31,32 @@ using pairwise_local_affine_unbanded_testing_types =
 INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_local_affine_unbanded,
                                pairwise_alignment_test,
                                pairwise_local_affine_unbanded_testing_types, );
+
+TEST(pairwise_local_affine_unbanded_vectorised, sequences_of_different_lengths)
+{
+    using namespace seqan3::literals;
+
+    // The short pair is padded up to the length of the long pair in the same simd batch.
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequence_pairs{
+        {"ACGT"_dna4, "TTTT"_dna4},
+        {"ACGTACGTACGTACGTACGTACGTACGTACGTACGT"_dna4, "ACGTACGTACGTACGTACGTACGTACGTACGTACGT"_dna4}};
+
+    auto config = seqan3::align_cfg::method_local{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                      seqan3::mismatch_score{-5}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                     seqan3::align_cfg::extension_score{-1}}
+                | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    std::vector<std::pair<int32_t, size_t>> expected{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config))
+        expected.emplace_back(result.score(), result.sequence1_end_position());
+
+    EXPECT_EQ(expected[0].first, 4);
+
+    std::vector<std::pair<int32_t, size_t>> vectorised{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config | seqan3::align_cfg::vectorised{}))
+        vectorised.emplace_back(result.score(), result.sequence1_end_position());
+
+    EXPECT_EQ(vectorised, expected);
+}
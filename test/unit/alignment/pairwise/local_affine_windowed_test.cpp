@@ -0,0 +1,227 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_debug.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+#include "fixture/local_affine_unbanded.hpp"
+
+// The local alignments with traceback are computed in a window around the optimal alignment if the debug mode is not
+// enabled, which records the full matrices.
+template <auto _fixture>
+struct local_affine_fixture : public ::testing::Test
+{
+    auto fixture() -> decltype(seqan3::test::alignment::fixture::alignment_fixture{*_fixture}) const &
+    {
+        return *_fixture;
+    }
+};
+
+template <typename fixture_t>
+class local_affine_windowed : public fixture_t
+{};
+
+using local_affine_windowed_types =
+    ::testing::Types<local_affine_fixture<&seqan3::test::alignment::fixture::local::affine::unbanded::dna4_01>,
+                     local_affine_fixture<&seqan3::test::alignment::fixture::local::affine::unbanded::dna4_02>,
+                     local_affine_fixture<&seqan3::test::alignment::fixture::local::affine::unbanded::dna4_03>,
+                     local_affine_fixture<&seqan3::test::alignment::fixture::local::affine::unbanded::dna4_04>,
+                     local_affine_fixture<&seqan3::test::alignment::fixture::local::affine::unbanded::dna4_05>,
+                     local_affine_fixture<&seqan3::test::alignment::fixture::local::affine::unbanded::rna5_01>,
+                     local_affine_fixture<&seqan3::test::alignment::fixture::local::affine::unbanded::aa27_01>,
+                     local_affine_fixture<&seqan3::test::alignment::fixture::local::affine::unbanded::aa27_02>>;
+
+TYPED_TEST_SUITE(local_affine_windowed, local_affine_windowed_types, );
+
+TYPED_TEST(local_affine_windowed, alignment)
+{
+    auto const & fixture = this->fixture();
+    auto align_cfg = fixture.config | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                   | seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::output_alignment{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+
+    EXPECT_EQ(res.score(), fixture.score);
+    EXPECT_EQ(res.sequence1_end_position(), fixture.sequence1_end_position);
+    EXPECT_EQ(res.sequence2_end_position(), fixture.sequence2_end_position);
+    EXPECT_EQ(res.sequence1_begin_position(), fixture.sequence1_begin_position);
+    EXPECT_EQ(res.sequence2_begin_position(), fixture.sequence2_begin_position);
+
+    auto && [gapped_database, gapped_query] = res.alignment();
+    EXPECT_RANGE_EQ(gapped_database | seqan3::views::to_char, fixture.aligned_sequence1);
+    EXPECT_RANGE_EQ(gapped_query | seqan3::views::to_char, fixture.aligned_sequence2);
+}
+
+TYPED_TEST(local_affine_windowed, alignment_only)
+{
+    auto const & fixture = this->fixture();
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res =
+        *seqan3::align_pairwise(std::tie(database, query), fixture.config | seqan3::align_cfg::output_alignment{})
+             .begin();
+
+    auto && [gapped_database, gapped_query] = res.alignment();
+    EXPECT_RANGE_EQ(gapped_database | seqan3::views::to_char, fixture.aligned_sequence1);
+    EXPECT_RANGE_EQ(gapped_query | seqan3::views::to_char, fixture.aligned_sequence2);
+}
+
+// Sequence pairs that share a similar region at random positions.
+std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> generate_sequence_pairs()
+{
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequence_pairs{};
+    for (size_t seed = 0; seed < 40; ++seed)
+    {
+        auto sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(100 + (seed % 7) * 30, 0, seed);
+        auto sequence2 = seqan3::test::generate_sequence<seqan3::dna4>(80 + (seed % 5) * 40, 0, seed + 100);
+
+        size_t const region_size = 20 + seed % 30;
+        size_t const position1 = (seed * 13) % (sequence1.size() - region_size);
+        size_t const position2 = (seed * 29) % (sequence2.size() - region_size);
+        for (size_t i = 0; i < region_size; ++i)
+            if (i % 9 != 4)
+                sequence2[position2 + i] = sequence1[position1 + i];
+
+        sequence_pairs.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+    return sequence_pairs;
+}
+
+auto const dna4_config =
+    seqan3::align_cfg::method_local{}
+    | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                          seqan3::mismatch_score{-5}}}
+    | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10}, seqan3::align_cfg::extension_score{-1}};
+
+auto const output_config = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                         | seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::output_alignment{}
+                         | seqan3::align_cfg::output_sequence1_id{};
+
+// Scores the alignment with the affine gap costs of dna4_config.
+template <typename alignment_t>
+int32_t score_of(alignment_t const & alignment)
+{
+    auto const & [gapped_sequence1, gapped_sequence2] = alignment;
+    EXPECT_EQ(std::ranges::size(gapped_sequence1), std::ranges::size(gapped_sequence2));
+
+    int32_t score = 0;
+    bool in_gap1 = false;
+    bool in_gap2 = false;
+    for (size_t i = 0; i < std::ranges::size(gapped_sequence1); ++i)
+    {
+        bool const is_gap1 = gapped_sequence1[i] == seqan3::gap{};
+        bool const is_gap2 = gapped_sequence2[i] == seqan3::gap{};
+        if (is_gap1 || is_gap2)
+            score += ((is_gap1 && !in_gap1) || (is_gap2 && !in_gap2)) ? -11 : -1;
+        else
+            score += (gapped_sequence1[i] == gapped_sequence2[i]) ? 4 : -5;
+
+        in_gap1 = is_gap1;
+        in_gap2 = is_gap2;
+    }
+    return score;
+}
+
+// Compares the windowed traceback with the traceback of the full matrix computed in debug mode. If there are several
+// optimal alignments, the windowed traceback might report another one, which must have the same score.
+template <typename config_t>
+void compare_with_full_traceback(config_t const & config)
+{
+    auto sequence_pairs = generate_sequence_pairs();
+
+    std::vector<int32_t> expected_scores{};
+    std::vector<std::pair<size_t, size_t>> expected_end_positions{};
+    for (auto && result :
+         seqan3::align_pairwise(sequence_pairs, dna4_config | output_config | seqan3::align_cfg::detail::debug{}))
+    {
+        expected_scores.push_back(result.score());
+        expected_end_positions.emplace_back(result.sequence1_end_position(), result.sequence2_end_position());
+    }
+
+    size_t count = 0;
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config | output_config))
+    {
+        size_t const index = result.sequence1_id();
+        ASSERT_LT(index, sequence_pairs.size());
+        EXPECT_EQ(result.score(), expected_scores[index]);
+        EXPECT_EQ(result.sequence1_end_position(), expected_end_positions[index].first);
+        EXPECT_EQ(result.sequence2_end_position(), expected_end_positions[index].second);
+        EXPECT_GT(result.score(), 40);
+
+        // The alignment must cover exactly the sequences between the begin and the end positions.
+        auto const & [gapped_sequence1, gapped_sequence2] = result.alignment();
+        auto without_gaps = std::views::filter(
+            [](char const c)
+            {
+                return c != '-';
+            });
+        std::span const sequence1{sequence_pairs[index].first};
+        std::span const sequence2{sequence_pairs[index].second};
+        EXPECT_RANGE_EQ(gapped_sequence1 | seqan3::views::to_char | without_gaps,
+                        sequence1.subspan(result.sequence1_begin_position(),
+                                          result.sequence1_end_position() - result.sequence1_begin_position())
+                            | seqan3::views::to_char);
+        EXPECT_RANGE_EQ(gapped_sequence2 | seqan3::views::to_char | without_gaps,
+                        sequence2.subspan(result.sequence2_begin_position(),
+                                          result.sequence2_end_position() - result.sequence2_begin_position())
+                            | seqan3::views::to_char);
+        EXPECT_EQ(score_of(result.alignment()), result.score());
+        ++count;
+    }
+    EXPECT_EQ(count, sequence_pairs.size());
+}
+
+TEST(local_affine_windowed_collection, scalar)
+{
+    compare_with_full_traceback(dna4_config);
+}
+
+TEST(local_affine_windowed_collection, vectorised)
+{
+    compare_with_full_traceback(dna4_config | seqan3::align_cfg::vectorised{});
+}
+
+TEST(local_affine_windowed_collection, parallel)
+{
+    compare_with_full_traceback(dna4_config | seqan3::align_cfg::parallel{4});
+}
+
+TEST(local_affine_windowed_collection, no_local_similarity)
+{
+    using namespace seqan3::literals;
+
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequence_pairs{
+        {"AAAA"_dna4, "CCCC"_dna4},
+        {{}, "ACGT"_dna4},
+        {{}, {}}};
+
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, dna4_config | output_config))
+    {
+        EXPECT_EQ(result.score(), 0);
+        EXPECT_EQ(result.sequence1_begin_position(), result.sequence1_end_position());
+        EXPECT_EQ(result.sequence2_begin_position(), result.sequence2_end_position());
+        EXPECT_TRUE(std::ranges::empty(std::get<0>(result.alignment())));
+        EXPECT_TRUE(std::ranges::empty(std::get<1>(result.alignment())));
+    }
+}
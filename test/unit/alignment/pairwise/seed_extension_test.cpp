@@ -0,0 +1,361 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include <seqan3/alignment/configuration/align_config_seed_extension.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/utility/views/slice.hpp>
+
+using seqan3::operator""_dna4;
+
+namespace cfg = seqan3::align_cfg;
+
+static constexpr int32_t gap_open = -4;
+static constexpr int32_t gap_extension = -2;
+
+static auto const base_config = cfg::method_global{}
+                              | cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                      seqan3::mismatch_score{-4}}}
+                              | cfg::gap_cost_affine{cfg::open_score{gap_open}, cfg::extension_score{gap_extension}};
+
+// Computes the best score of all cells in the full affine dynamic programming matrix, i.e. the result of an extension
+// without any drop.
+int32_t best_prefix_score(std::vector<seqan3::dna4> const & sequence1, std::vector<seqan3::dna4> const & sequence2)
+{
+    constexpr int32_t minus_infinity = std::numeric_limits<int32_t>::lowest() / 2;
+    auto const & scheme = seqan3::get<cfg::scoring_scheme>(base_config).scheme;
+
+    size_t const columns = sequence1.size() + 1;
+    std::vector<int32_t> score(columns * (sequence2.size() + 1), minus_infinity);
+    std::vector<int32_t> horizontal(score.size(), minus_infinity);
+    std::vector<int32_t> vertical(score.size(), minus_infinity);
+
+    int32_t best = 0;
+    for (size_t i = 0; i <= sequence2.size(); ++i)
+    {
+        for (size_t j = 0; j <= sequence1.size(); ++j)
+        {
+            size_t const cell = i * columns + j;
+            if (i == 0 && j == 0)
+            {
+                score[cell] = 0;
+                continue;
+            }
+
+            if (j > 0)
+                horizontal[cell] = std::max(score[cell - 1] + gap_open + gap_extension,
+                                            horizontal[cell - 1] + gap_extension);
+            if (i > 0)
+                vertical[cell] = std::max(score[cell - columns] + gap_open + gap_extension,
+                                          vertical[cell - columns] + gap_extension);
+
+            score[cell] = std::max(horizontal[cell], vertical[cell]);
+            if (i > 0 && j > 0)
+                score[cell] = std::max(score[cell], score[cell - columns - 1] + scheme.score(sequence1[j - 1],
+                                                                                             sequence2[i - 1]));
+            best = std::max(best, score[cell]);
+        }
+    }
+    return best;
+}
+
+// Recomputes the score of the given alignment.
+template <typename alignment_t>
+int32_t score_of_alignment(alignment_t const & alignment)
+{
+    auto const & scheme = seqan3::get<cfg::scoring_scheme>(base_config).scheme;
+    auto const & [gapped_sequence1, gapped_sequence2] = alignment;
+
+    int32_t score = 0;
+    bool in_gap1 = false;
+    bool in_gap2 = false;
+    for (size_t i = 0; i < std::ranges::size(gapped_sequence1); ++i)
+    {
+        bool const is_gap1 = gapped_sequence1[i] == seqan3::gap{};
+        bool const is_gap2 = gapped_sequence2[i] == seqan3::gap{};
+
+        if (is_gap1)
+            score += gap_extension + (in_gap1 ? 0 : gap_open);
+        else if (is_gap2)
+            score += gap_extension + (in_gap2 ? 0 : gap_open);
+        else
+            score += scheme.score(gapped_sequence1[i].template convert_to<seqan3::dna4>(),
+                                  gapped_sequence2[i].template convert_to<seqan3::dna4>());
+
+        in_gap1 = is_gap1;
+        in_gap2 = is_gap2;
+    }
+    return score;
+}
+
+// Generates a pair of sequences that share a similar prefix followed by unrelated suffixes.
+std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>> generate_pair(size_t const seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<size_t> edit_dist{0, 9};
+
+    std::vector<seqan3::dna4> sequence1 = seqan3::test::generate_sequence<seqan3::dna4>(20 + seed * 3, 0, seed);
+    std::vector<seqan3::dna4> sequence2{};
+    for (seqan3::dna4 symbol : sequence1)
+    {
+        switch (edit_dist(generator))
+        {
+            case 0:
+                sequence2.push_back(seqan3::assign_rank_to((symbol.to_rank() + 1) % 4, seqan3::dna4{}));
+                break;
+            case 1:
+                break;
+            case 2:
+                sequence2.push_back(symbol);
+                sequence2.push_back('T'_dna4);
+                break;
+            default:
+                sequence2.push_back(symbol);
+        }
+    }
+
+    std::ranges::copy(seqan3::test::generate_sequence<seqan3::dna4>(seed % 17, 0, seed + 100),
+                      std::back_inserter(sequence1));
+    std::ranges::copy(seqan3::test::generate_sequence<seqan3::dna4>(seed % 13, 0, seed + 200),
+                      std::back_inserter(sequence2));
+    return {std::move(sequence1), std::move(sequence2)};
+}
+
+TEST(seed_extension_test, right_extension)
+{
+    std::vector sequence1 = "ACGTACGTACGTTTTTTTTT"_dna4;
+    std::vector sequence2 = "ACGTACGTACGTGGGGGGGGGG"_dna4;
+
+    auto config = base_config | cfg::seed_extension{cfg::x_drop{10}} | cfg::output_score{}
+                | cfg::output_begin_position{} | cfg::output_end_position{} | cfg::output_alignment{};
+
+    auto res = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config).begin();
+
+    EXPECT_EQ(res.score(), 24);
+    EXPECT_EQ(res.sequence1_begin_position(), 0u);
+    EXPECT_EQ(res.sequence2_begin_position(), 0u);
+    EXPECT_EQ(res.sequence1_end_position(), 12u);
+    EXPECT_EQ(res.sequence2_end_position(), 12u);
+    EXPECT_EQ(score_of_alignment(res.alignment()), 24);
+}
+
+TEST(seed_extension_test, left_extension)
+{
+    std::vector sequence1 = "TTTTTTTTACGTACGTACGT"_dna4;
+    std::vector sequence2 = "GGGGGGGGGGACGTACGTACGT"_dna4;
+
+    auto config = base_config | cfg::seed_extension{cfg::x_drop{10}, cfg::extension_direction::left}
+                | cfg::output_score{} | cfg::output_begin_position{} | cfg::output_end_position{}
+                | cfg::output_alignment{};
+
+    auto res = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config).begin();
+
+    EXPECT_EQ(res.score(), 24);
+    EXPECT_EQ(res.sequence1_begin_position(), 8u);
+    EXPECT_EQ(res.sequence2_begin_position(), 10u);
+    EXPECT_EQ(res.sequence1_end_position(), 20u);
+    EXPECT_EQ(res.sequence2_end_position(), 22u);
+    EXPECT_EQ(score_of_alignment(res.alignment()), 24);
+}
+
+TEST(seed_extension_test, empty_sequences)
+{
+    std::vector<seqan3::dna4> empty{};
+    std::vector sequence = "ACGT"_dna4;
+
+    auto config = base_config | cfg::seed_extension{cfg::x_drop{10}} | cfg::output_score{}
+                | cfg::output_end_position{} | cfg::output_alignment{};
+
+    auto res = *seqan3::align_pairwise(std::tie(empty, sequence), config).begin();
+    EXPECT_EQ(res.score(), 0);
+    EXPECT_EQ(res.sequence1_end_position(), 0u);
+    EXPECT_EQ(res.sequence2_end_position(), 0u);
+
+    res = *seqan3::align_pairwise(std::tie(empty, empty), config).begin();
+    EXPECT_EQ(res.score(), 0);
+}
+
+TEST(seed_extension_test, z_drop_bridges_long_gap)
+{
+    // Both sequences share a prefix and a suffix, but the first sequence contains a long insertion in between.
+    std::vector<seqan3::dna4> prefix = "ACGCAGGACCAGCAAGCCAGCAGGACGACG"_dna4;
+    std::vector<seqan3::dna4> suffix = "GCCAGAGCAGCGACCGACAAGGCGCAGACC"_dna4;
+    std::vector<seqan3::dna4> sequence1 = prefix;
+    sequence1.resize(sequence1.size() + 20, 'T'_dna4);
+    std::ranges::copy(suffix, std::back_inserter(sequence1));
+    std::vector<seqan3::dna4> sequence2 = prefix;
+    std::ranges::copy(suffix, std::back_inserter(sequence2));
+
+    auto output = cfg::output_score{} | cfg::output_end_position{};
+
+    auto x_drop_config = base_config | cfg::seed_extension{cfg::x_drop{30}} | output;
+    auto x_drop_res = *seqan3::align_pairwise(std::tie(sequence1, sequence2), x_drop_config).begin();
+    EXPECT_EQ(x_drop_res.score(), 60);
+    EXPECT_EQ(x_drop_res.sequence1_end_position(), 30u);
+    EXPECT_EQ(x_drop_res.sequence2_end_position(), 30u);
+
+    auto z_drop_config = base_config | cfg::seed_extension{cfg::z_drop{30}} | output;
+    auto z_drop_res = *seqan3::align_pairwise(std::tie(sequence1, sequence2), z_drop_config).begin();
+    EXPECT_EQ(z_drop_res.score(), 120 + gap_open + 20 * gap_extension);
+    EXPECT_EQ(z_drop_res.sequence1_end_position(), 80u);
+    EXPECT_EQ(z_drop_res.sequence2_end_position(), 60u);
+}
+
+TEST(seed_extension_test, without_drop_equals_best_cell)
+{
+    for (size_t seed = 0; seed < 20; ++seed)
+    {
+        auto [sequence1, sequence2] = generate_pair(seed);
+        int32_t const expected = best_prefix_score(sequence1, sequence2);
+
+        for (auto extension : {cfg::seed_extension{cfg::x_drop{100000}}, cfg::seed_extension{cfg::z_drop{100000}}})
+        {
+            auto res = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                               base_config | extension | cfg::output_score{} | cfg::output_alignment{})
+                            .begin();
+            EXPECT_EQ(res.score(), expected) << "seed: " << seed;
+            EXPECT_EQ(score_of_alignment(res.alignment()), expected) << "seed: " << seed;
+        }
+    }
+}
+
+TEST(seed_extension_test, alignment_matches_positions)
+{
+    for (size_t seed = 0; seed < 20; ++seed)
+    {
+        auto [sequence1, sequence2] = generate_pair(seed);
+
+        for (auto direction : {cfg::extension_direction::right, cfg::extension_direction::left})
+        {
+            auto res = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                               base_config | cfg::seed_extension{cfg::z_drop{15}, direction}
+                                                   | cfg::output_score{} | cfg::output_begin_position{}
+                                                   | cfg::output_end_position{} | cfg::output_alignment{})
+                            .begin();
+
+            EXPECT_EQ(score_of_alignment(res.alignment()), res.score()) << "seed: " << seed;
+
+            auto const & [gapped_sequence1, gapped_sequence2] = res.alignment();
+            auto without_gaps = std::views::filter(
+                [](auto const & symbol)
+                {
+                    return symbol != seqan3::gap{};
+                });
+            auto to_dna4 = std::views::transform(
+                [](auto const & symbol)
+                {
+                    return symbol.template convert_to<seqan3::dna4>();
+                });
+
+            EXPECT_TRUE(std::ranges::equal(gapped_sequence1 | without_gaps | to_dna4,
+                                           sequence1 | seqan3::views::slice(res.sequence1_begin_position(),
+                                                                            res.sequence1_end_position())))
+                << "seed: " << seed;
+            EXPECT_TRUE(std::ranges::equal(gapped_sequence2 | without_gaps | to_dna4,
+                                           sequence2 | seqan3::views::slice(res.sequence2_begin_position(),
+                                                                            res.sequence2_end_position())))
+                << "seed: " << seed;
+        }
+    }
+}
+
+TEST(seed_extension_test, vectorised)
+{
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequences{};
+    for (size_t seed = 0; seed < 21; ++seed)
+        sequences.push_back(generate_pair(seed));
+
+    auto output = cfg::output_score{} | cfg::output_begin_position{} | cfg::output_end_position{}
+                | cfg::output_sequence1_id{};
+
+    for (auto direction : {cfg::extension_direction::right, cfg::extension_direction::left})
+    {
+        for (auto extension : {cfg::seed_extension{cfg::x_drop{10}, direction},
+                               cfg::seed_extension{cfg::z_drop{10}, direction}})
+        {
+            auto config = base_config | extension | output;
+
+            std::vector<std::tuple<int32_t, size_t, size_t, size_t, size_t>> expected{};
+            for (auto && res : seqan3::align_pairwise(sequences, config))
+                expected.emplace_back(res.score(),
+                                      res.sequence1_begin_position(),
+                                      res.sequence2_begin_position(),
+                                      res.sequence1_end_position(),
+                                      res.sequence2_end_position());
+
+            size_t count = 0;
+            for (auto && res : seqan3::align_pairwise(sequences, config | cfg::vectorised{}))
+            {
+                EXPECT_EQ(std::make_tuple(res.score(),
+                                          res.sequence1_begin_position(),
+                                          res.sequence2_begin_position(),
+                                          res.sequence1_end_position(),
+                                          res.sequence2_end_position()),
+                          expected[res.sequence1_id()])
+                    << "id: " << res.sequence1_id();
+                ++count;
+            }
+            EXPECT_EQ(count, sequences.size());
+        }
+    }
+}
+
+TEST(seed_extension_test, vectorised_with_alignment)
+{
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequences{};
+    for (size_t seed = 0; seed < 10; ++seed)
+        sequences.push_back(generate_pair(seed));
+
+    auto config = base_config | cfg::seed_extension{cfg::x_drop{10}} | cfg::output_score{} | cfg::output_alignment{}
+                | cfg::output_sequence1_id{};
+
+    std::vector<int32_t> expected{};
+    for (auto && res : seqan3::align_pairwise(sequences, config))
+        expected.push_back(res.score());
+
+    for (auto && res : seqan3::align_pairwise(sequences, config | cfg::vectorised{}))
+    {
+        EXPECT_EQ(res.score(), expected[res.sequence1_id()]);
+        EXPECT_EQ(score_of_alignment(res.alignment()), res.score());
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Invalid configurations
+// ----------------------------------------------------------------------------
+
+TEST(seed_extension_invalid_test, free_end_gaps)
+{
+    std::vector sequence = "ACGT"_dna4;
+    auto config = cfg::method_global{cfg::free_end_gaps_sequence1_leading{true},
+                                     cfg::free_end_gaps_sequence2_leading{false},
+                                     cfg::free_end_gaps_sequence1_trailing{false},
+                                     cfg::free_end_gaps_sequence2_trailing{false}}
+                | cfg::edit_scheme | cfg::seed_extension{cfg::x_drop{10}};
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence, sequence), config),
+                 seqan3::invalid_alignment_configuration);
+}
+
+TEST(seed_extension_invalid_test, drop)
+{
+    std::vector sequence = "ACGT"_dna4;
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence, sequence),
+                                        base_config | cfg::seed_extension{cfg::x_drop{0}}),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence, sequence),
+                                        base_config | cfg::seed_extension{cfg::z_drop{-1}}),
+                 seqan3::invalid_alignment_configuration);
+}
@@ -0,0 +1,396 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <seqan3/alignment/cigar_conversion/cigar_from_alignment.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_splice.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+#include "fixture/global_affine_unbanded.hpp"
+#include "fixture/local_affine_unbanded.hpp"
+#include "fixture/semi_global_affine_unbanded.hpp"
+
+using seqan3::operator""_cigar_operation;
+using seqan3::operator""_dna4;
+
+// An intron is never cheaper than a deletion of the affine gap scheme, so the results equal the affine alignments.
+inline constexpr seqan3::align_cfg::gap_cost_splice prohibitive_introns{seqan3::align_cfg::intron_open_score{-100000},
+                                                                        seqan3::align_cfg::non_canonical_score{0}};
+
+template <auto _fixture>
+struct spliced_alignment_fixture : public ::testing::Test
+{
+    auto fixture() -> decltype(seqan3::test::alignment::fixture::alignment_fixture{*_fixture}) const &
+    {
+        return *_fixture;
+    }
+};
+
+template <typename fixture_t>
+class spliced_alignment_test : public fixture_t
+{};
+
+using spliced_alignment_testing_types = ::testing::Types<
+    spliced_alignment_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_01>,
+    spliced_alignment_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_02>,
+    spliced_alignment_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq1_empty>,
+    spliced_alignment_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq2_empty>,
+    spliced_alignment_fixture<
+        &seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_both_empty>,
+    spliced_alignment_fixture<&seqan3::test::alignment::fixture::global::affine::unbanded::aa27_blosum62_gap_1_open_10>,
+    spliced_alignment_fixture<&seqan3::test::alignment::fixture::local::affine::unbanded::dna4_01>,
+    spliced_alignment_fixture<&seqan3::test::alignment::fixture::local::affine::unbanded::dna4_02>,
+    spliced_alignment_fixture<&seqan3::test::alignment::fixture::local::affine::unbanded::aa27_01>,
+    spliced_alignment_fixture<&seqan3::test::alignment::fixture::semi_global::affine::unbanded::dna4_01_semi_first>,
+    spliced_alignment_fixture<&seqan3::test::alignment::fixture::semi_global::affine::unbanded::dna4_03_semi_second>>;
+
+TYPED_TEST_SUITE(spliced_alignment_test, spliced_alignment_testing_types, );
+
+TYPED_TEST(spliced_alignment_test, score)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | prohibitive_introns | seqan3::align_cfg::output_score{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+
+    EXPECT_EQ(res.score(), fixture.score);
+}
+
+TYPED_TEST(spliced_alignment_test, end_positions)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | prohibitive_introns | seqan3::align_cfg::output_end_position{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+
+    EXPECT_EQ(res.sequence1_end_position(), fixture.sequence1_end_position);
+    EXPECT_EQ(res.sequence2_end_position(), fixture.sequence2_end_position);
+}
+
+TYPED_TEST(spliced_alignment_test, begin_positions)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg =
+        fixture.config | prohibitive_introns | seqan3::align_cfg::output_begin_position{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+
+    EXPECT_EQ(res.sequence1_begin_position(), fixture.sequence1_begin_position);
+    EXPECT_EQ(res.sequence2_begin_position(), fixture.sequence2_begin_position);
+}
+
+TYPED_TEST(spliced_alignment_test, alignment)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | prohibitive_introns | seqan3::align_cfg::output_alignment{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+    auto && [gapped_database, gapped_query] = res.alignment();
+
+    EXPECT_RANGE_EQ(gapped_database | seqan3::views::to_char, fixture.aligned_sequence1);
+    EXPECT_RANGE_EQ(gapped_query | seqan3::views::to_char, fixture.aligned_sequence2);
+}
+
+TYPED_TEST(spliced_alignment_test, cigar)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | prohibitive_introns | seqan3::align_cfg::output_alignment{}
+                                    | seqan3::align_cfg::output_cigar{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+
+    if (std::ranges::empty(std::get<0>(res.alignment())))
+        EXPECT_TRUE(res.cigar_sequence().empty());
+    else
+        EXPECT_RANGE_EQ(res.cigar_sequence(), seqan3::cigar_from_alignment(res.alignment()));
+}
+
+// ----------------------------------------------------------------------------
+// Introns
+// ----------------------------------------------------------------------------
+
+struct spliced_alignment_intron_test : public ::testing::Test
+{
+    static constexpr auto scoring =
+        seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                            seqan3::mismatch_score{-4}}}
+        | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-4}, seqan3::align_cfg::extension_score{-2}};
+
+    static constexpr auto semi_global =
+        seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                         seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+    static constexpr seqan3::align_cfg::gap_cost_splice splice{seqan3::align_cfg::intron_open_score{-16},
+                                                               seqan3::align_cfg::non_canonical_score{-5}};
+
+    static constexpr auto output = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_begin_position{}
+                                 | seqan3::align_cfg::output_end_position{} | seqan3::align_cfg::output_alignment{}
+                                 | seqan3::align_cfg::output_cigar{};
+
+    // Two exons separated by an intron of 25 bases that begins with GT and ends with AG.
+    std::vector<seqan3::dna4> genome = "TTGACCATGCAGTCAGGTAAGTTTTTTTTTTTTCTTTTCAGCCTGATTGCATGTT"_dna4;
+    std::vector<seqan3::dna4> read = "CATGCAGTCAGCCTGATTGCA"_dna4;
+
+    // Rescores a spliced alignment given by its begin positions and its CIGAR.
+    static int32_t rescore(std::vector<seqan3::dna4> const & sequence1,
+                           std::vector<seqan3::dna4> const & sequence2,
+                           size_t position1,
+                           size_t position2,
+                           std::vector<seqan3::cigar> const & cigar,
+                           seqan3::align_cfg::gap_cost_splice const & splice)
+    {
+        auto is_motif = [&](size_t const position, char const first, char const second)
+        {
+            return seqan3::to_char(sequence1[position]) == first && seqan3::to_char(sequence1[position + 1]) == second;
+        };
+
+        int32_t score = 0;
+        for (auto [count, operation] : cigar)
+        {
+            if (operation == 'M'_cigar_operation)
+            {
+                for (size_t i = 0; i < count; ++i, ++position1, ++position2)
+                    score += sequence1[position1] == sequence2[position2] ? 2 : -4;
+            }
+            else if (operation == 'N'_cigar_operation)
+            {
+                score += splice.intron_open_score;
+                score += is_motif(position1, 'G', 'T') ? 0 : splice.non_canonical_score;
+                position1 += count;
+                score += is_motif(position1 - 2, 'A', 'G') ? 0 : splice.non_canonical_score;
+            }
+            else
+            {
+                score += -4 - 2 * static_cast<int32_t>(count);
+                (operation == 'D'_cigar_operation ? position1 : position2) += count;
+            }
+        }
+        return score;
+    }
+};
+
+TEST_F(spliced_alignment_intron_test, canonical)
+{
+    auto res = *seqan3::align_pairwise(std::tie(genome, read), semi_global | scoring | splice | output).begin();
+
+    EXPECT_EQ(res.score(), 42 - 16);
+    EXPECT_EQ(res.sequence1_begin_position(), 5u);
+    EXPECT_EQ(res.sequence2_begin_position(), 0u);
+    EXPECT_EQ(res.sequence1_end_position(), 51u);
+    EXPECT_EQ(res.sequence2_end_position(), 21u);
+    EXPECT_RANGE_EQ(res.cigar_sequence(),
+                    (std::vector<seqan3::cigar>{{11, 'M'_cigar_operation},
+                                                {25, 'N'_cigar_operation},
+                                                {10, 'M'_cigar_operation}}));
+
+    // The intron is a gap in the alignment.
+    auto && [gapped_genome, gapped_read] = res.alignment();
+    EXPECT_RANGE_EQ(gapped_genome | seqan3::views::to_char,
+                    std::string{"CATGCAGTCAGGTAAGTTTTTTTTTTTTCTTTTCAGCCTGATTGCA"});
+    EXPECT_RANGE_EQ(gapped_read | seqan3::views::to_char,
+                    std::string{"CATGCAGTCAG-------------------------CCTGATTGCA"});
+    EXPECT_RANGE_EQ(res.cigar_sequence(), seqan3::cigar_from_alignment(res.alignment(), {}, false, 20));
+}
+
+TEST_F(spliced_alignment_intron_test, expensive_intron)
+{
+    // An intron that is more expensive than the best alignment without an intron is not used.
+    seqan3::align_cfg::gap_cost_splice expensive{seqan3::align_cfg::intron_open_score{-60},
+                                                 seqan3::align_cfg::non_canonical_score{-5}};
+    auto res = *seqan3::align_pairwise(std::tie(genome, read), semi_global | scoring | expensive | output).begin();
+    auto expected = *seqan3::align_pairwise(std::tie(genome, read), semi_global | scoring | output).begin();
+
+    EXPECT_EQ(res.score(), expected.score());
+    EXPECT_EQ(res.sequence1_begin_position(), expected.sequence1_begin_position());
+    EXPECT_RANGE_EQ(res.cigar_sequence(), expected.cigar_sequence());
+}
+
+TEST_F(spliced_alignment_intron_test, default_gap_cost)
+{
+    // Without seqan3::align_cfg::gap_cost_affine, short gaps are scored like in any other alignment.
+    auto config = seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                      seqan3::mismatch_score{-4}}}
+                | seqan3::align_cfg::output_score{};
+
+    auto res = *seqan3::align_pairwise(std::tie(genome, read), config | prohibitive_introns).begin();
+    auto expected = *seqan3::align_pairwise(std::tie(genome, read), config).begin();
+
+    EXPECT_EQ(res.score(), expected.score());
+}
+
+TEST_F(spliced_alignment_intron_test, non_canonical)
+{
+    // Both splice sites are mutated: GT -> CT and AG -> AC.
+    genome[16] = 'C'_dna4;
+    genome[40] = 'C'_dna4;
+
+    auto res = *seqan3::align_pairwise(std::tie(genome, read), semi_global | scoring | splice | output).begin();
+    EXPECT_EQ(res.score(), 42 - 16 - 10);
+    EXPECT_EQ(res.score(),
+              rescore(genome, read, res.sequence1_begin_position(), 0, res.cigar_sequence(), splice));
+
+    // Without motif awareness, the intron costs the same at every position.
+    seqan3::align_cfg::gap_cost_splice motif_unaware{seqan3::align_cfg::intron_open_score{-16},
+                                                     seqan3::align_cfg::non_canonical_score{0}};
+    res = *seqan3::align_pairwise(std::tie(genome, read), semi_global | scoring | motif_unaware | output).begin();
+    EXPECT_EQ(res.score(), 42 - 16);
+}
+
+TEST_F(spliced_alignment_intron_test, motif_selects_splice_sites)
+{
+    // The exons end and begin with the same bases as the intron, so the intron can be shifted by one base to either
+    // side without changing the matches. Only the canonical position avoids the non-canonical score.
+    std::vector<seqan3::dna4> sequence1 = "ACCATGCAGGTAAGTTTTTTTTTTTTTCTTTTAGGCCTGATT"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "ACCATGCAGGCCTGATT"_dna4;
+
+    auto res = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                       seqan3::align_cfg::method_global{} | scoring
+                                           | seqan3::align_cfg::gap_cost_splice{} | output)
+                    .begin();
+
+    EXPECT_EQ(res.score(), 34 - 32);
+    EXPECT_RANGE_EQ(res.cigar_sequence(),
+                    (std::vector<seqan3::cigar>{{9, 'M'_cigar_operation},
+                                                {25, 'N'_cigar_operation},
+                                                {8, 'M'_cigar_operation}}));
+}
+
+TEST_F(spliced_alignment_intron_test, local)
+{
+    // The read is flanked by bases that do not match the genome. The intron is cheaper than above, because the last
+    // bases of the intron and the second exon are a local alignment of 14 matches on their own.
+    seqan3::align_cfg::gap_cost_splice cheap{seqan3::align_cfg::intron_open_score{-10},
+                                             seqan3::align_cfg::non_canonical_score{-5}};
+    std::vector<seqan3::dna4> flanked_read = "GGGGG"_dna4;
+    flanked_read.insert(flanked_read.end(), read.begin(), read.end());
+    flanked_read.insert(flanked_read.end(), 5, 'G'_dna4);
+
+    auto res = *seqan3::align_pairwise(std::tie(genome, flanked_read),
+                                       seqan3::align_cfg::method_local{} | scoring | cheap | output)
+                    .begin();
+
+    EXPECT_EQ(res.score(), 42 - 10);
+    EXPECT_EQ(res.sequence1_begin_position(), 5u);
+    EXPECT_EQ(res.sequence2_begin_position(), 5u);
+    EXPECT_EQ(res.sequence1_end_position(), 51u);
+    EXPECT_EQ(res.sequence2_end_position(), 26u);
+    EXPECT_RANGE_EQ(res.cigar_sequence(),
+                    (std::vector<seqan3::cigar>{{11, 'M'_cigar_operation},
+                                                {25, 'N'_cigar_operation},
+                                                {10, 'M'_cigar_operation}}));
+}
+
+TEST_F(spliced_alignment_intron_test, random_transcripts)
+{
+    // Reads of three exons with a few substitutions are aligned against their genomic region.
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<size_t> exon_size{20, 60};
+    std::uniform_int_distribution<size_t> intron_size{30, 400};
+
+    for (size_t seed = 0; seed < 20; ++seed)
+    {
+        std::vector<seqan3::dna4> region = seqan3::test::generate_sequence<seqan3::dna4>(30, 0, seed);
+        std::vector<seqan3::dna4> transcript{};
+        for (size_t exon = 0; exon < 3; ++exon)
+        {
+            std::vector<seqan3::dna4> bases =
+                seqan3::test::generate_sequence<seqan3::dna4>(exon_size(generator), 0, seed * 10 + exon);
+            region.insert(region.end(), bases.begin(), bases.end());
+            transcript.insert(transcript.end(), bases.begin(), bases.end());
+
+            std::vector<seqan3::dna4> intron =
+                seqan3::test::generate_sequence<seqan3::dna4>(exon == 2 ? 30 : intron_size(generator), 0, seed + 1000);
+            if (exon < 2)
+            {
+                intron.front() = 'G'_dna4;
+                intron[1] = 'T'_dna4;
+                intron[intron.size() - 2] = 'A'_dna4;
+                intron.back() = 'G'_dna4;
+            }
+            region.insert(region.end(), intron.begin(), intron.end());
+        }
+
+        for (size_t i = 0; i < transcript.size(); i += 17)
+            transcript[i] = seqan3::assign_rank_to((transcript[i].to_rank() + 1) % 4, seqan3::dna4{});
+
+        auto res = *seqan3::align_pairwise(std::tie(region, transcript), semi_global | scoring | splice | output)
+                        .begin();
+
+        EXPECT_EQ(res.sequence2_begin_position(), 0u) << "seed: " << seed;
+        EXPECT_EQ(res.score(),
+                  rescore(region, transcript, res.sequence1_begin_position(), 0, res.cigar_sequence(), splice))
+            << "seed: " << seed;
+        EXPECT_GE(std::ranges::count_if(res.cigar_sequence(),
+                                        [](seqan3::cigar const & element)
+                                        {
+                                            return element == 'N'_cigar_operation;
+                                        }),
+                  2)
+            << "seed: " << seed;
+        EXPECT_RANGE_EQ(std::get<0>(res.alignment()) | std::views::filter(
+                            [](auto const & c)
+                            {
+                                return c != seqan3::gap{};
+                            }),
+                        region | std::views::drop(res.sequence1_begin_position())
+                            | std::views::take(res.sequence1_end_position() - res.sequence1_begin_position()));
+
+        // The score-only computation finds the same optimum.
+        auto score_only =
+            *seqan3::align_pairwise(std::tie(region, transcript),
+                                    semi_global | scoring | splice | seqan3::align_cfg::output_score{})
+                 .begin();
+        EXPECT_EQ(score_only.score(), res.score()) << "seed: " << seed;
+    }
+}
+
+TEST_F(spliced_alignment_intron_test, collection)
+{
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequences{};
+    for (size_t i = 0; i < 10; ++i)
+        sequences.emplace_back(genome, std::vector<seqan3::dna4>(read.begin() + i, read.end()));
+
+    auto config = semi_global | scoring | splice | seqan3::align_cfg::output_score{}
+                | seqan3::align_cfg::output_cigar{} | seqan3::align_cfg::output_sequence1_id{};
+
+    std::vector<int32_t> expected{};
+    for (auto && res : seqan3::align_pairwise(sequences, config))
+        expected.push_back(res.score());
+
+    for (auto && res : seqan3::align_pairwise(sequences, config | seqan3::align_cfg::parallel{2}))
+        EXPECT_EQ(res.score(), expected[res.sequence1_id()]);
+}
@@ -203,3 +203,21 @@ TYPED_TEST(simd_match_mismatch_scoring_scheme_test, score_local_with_padding)
     simd_value2[0] = 3;
     SIMD_EQ(scheme.score(simd_value1, simd_value2), result);
 }
+
+TYPED_TEST(simd_match_mismatch_scoring_scheme_test, score_local_with_same_padding_symbol)
+{
+    // Both sequence packs are padded with the same symbol, which must not match itself in local alignment.
+    using scheme_t =
+        seqan3::detail::simd_match_mismatch_scoring_scheme<TypeParam, seqan3::dna4, seqan3::align_cfg::method_local>;
+
+    scheme_t scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}}};
+
+    TypeParam simd_value1 = seqan3::simd::fill<TypeParam>(2);
+    TypeParam simd_value2 = seqan3::simd::fill<TypeParam>(2);
+    TypeParam result = seqan3::simd::fill<TypeParam>(4);
+
+    simd_value1[0] = scheme_t::padding_symbol;
+    simd_value2[0] = scheme_t::padding_symbol;
+    result[0] = -5;
+    SIMD_EQ(scheme.score(simd_value1, simd_value2), result);
+}
@@ -7,6 +7,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
 #include <seqan3/alignment/scoring/detail/simd_matrix_scoring_scheme.hpp>
 #include <seqan3/alphabet/aminoacid/aa27.hpp>
@@ -230,3 +232,54 @@ TYPED_TEST(simd_matrix_scoring_scheme_test, score_local_with_padding)
         SIMD_EQ(scheme.score(scheme.make_score_profile(simd_value1), simd_value2), result);
     }
 }
+
+TYPED_TEST(simd_matrix_scoring_scheme_test, score_with_query_profile)
+{
+    using scheme_t =
+        seqan3::detail::simd_matrix_scoring_scheme<TypeParam, seqan3::aa27, seqan3::align_cfg::method_global>;
+
+    seqan3::aminoacid_scoring_scheme scalar_scheme{seqan3::aminoacid_similarity_matrix::blosum30};
+    scheme_t scheme{scalar_scheme};
+
+    // Every lane stores a different symbol; the last one is padded.
+    constexpr size_t length = seqan3::simd_traits<TypeParam>::length;
+    TypeParam simd_value1{};
+    for (size_t idx = 0; idx < length - 1; ++idx)
+        simd_value1[idx] = idx % seqan3::alphabet_size<seqan3::aa27>;
+    simd_value1[length - 1] = scheme.padding_symbol;
+    auto query_profile = scheme.make_query_profile(simd_value1);
+
+    for (size_t rank = 0; rank < seqan3::alphabet_size<seqan3::aa27>; ++rank)
+    {
+        TypeParam simd_value2 = seqan3::simd::fill<TypeParam>(rank);
+        TypeParam result{};
+        for (size_t idx = 0; idx < length - 1; ++idx)
+            result[idx] = scalar_scheme.score(seqan3::assign_rank_to(idx % seqan3::alphabet_size<seqan3::aa27>,
+                                                                     seqan3::aa27{}),
+                                              seqan3::assign_rank_to(rank, seqan3::aa27{}));
+        result[length - 1] = scheme.padding_match_score();
+
+        SIMD_EQ(scheme.score(query_profile, simd_value2), result);
+    }
+
+    // Second value is padded symbol => score of 1.
+    SIMD_EQ(scheme.score(query_profile, seqan3::simd::fill<TypeParam>(scheme.padding_symbol)),
+            seqan3::simd::fill<TypeParam>(scheme.padding_match_score()));
+}
+
+TYPED_TEST(simd_matrix_scoring_scheme_test, is_shared_sequence)
+{
+    using scheme_t =
+        seqan3::detail::simd_matrix_scoring_scheme<TypeParam, seqan3::aa27, seqan3::align_cfg::method_global>;
+
+    std::vector<TypeParam> simd_sequence{seqan3::simd::fill<TypeParam>(2),
+                                         seqan3::simd::fill<TypeParam>(scheme_t::padding_symbol)};
+    EXPECT_TRUE(scheme_t::is_shared_sequence(simd_sequence));
+    EXPECT_TRUE(scheme_t::is_shared_sequence(std::vector<TypeParam>{}));
+
+    if constexpr (seqan3::simd_traits<TypeParam>::length > 1)
+    {
+        simd_sequence[1][seqan3::simd_traits<TypeParam>::length - 1] = 2;
+        EXPECT_FALSE(scheme_t::is_shared_sequence(simd_sequence));
+    }
+}
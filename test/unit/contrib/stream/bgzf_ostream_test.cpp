@@ -8,8 +8,10 @@
 #include <gtest/gtest.h>
 
 #include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
 
-#include "../../io/stream/ostream_test_template.hpp"
+#if !defined(SEQAN3_HAS_LIBDEFLATE) // The expected output was compressed by zlib, libdeflate compresses differently.
+#    include "../../io/stream/ostream_test_template.hpp"
 
 template <>
 class ostream<seqan3::contrib::bgzf_ostream> : public ::testing::Test
@@ -32,3 +34,50 @@ public:
 using test_types = ::testing::Types<seqan3::contrib::bgzf_ostream>;
 
 INSTANTIATE_TYPED_TEST_SUITE_P(contrib_streams, ostream, test_types, );
+#endif // !defined(SEQAN3_HAS_LIBDEFLATE)
+
+template <typename codec_t>
+class bgzf_codec : public ::testing::Test
+{};
+
+using codec_types = ::testing::Types<seqan3::contrib::bgzf_zlib_codec, seqan3::contrib::bgzf_codec>;
+
+TYPED_TEST_SUITE(bgzf_codec, codec_types, );
+
+TYPED_TEST(bgzf_codec, block_round_trip)
+{
+    std::string input{};
+    for (size_t i = 0; i < 2000; ++i)
+        input += "ACGTTGCA" + std::to_string(i);
+
+    TypeParam codec{};
+    std::vector<char> block(seqan3::contrib::DefaultPageSize<seqan3::detail::bgzf_compression>::MAX_BLOCK_SIZE);
+    size_t const block_size =
+        seqan3::contrib::_compressBlock(block.data(), block.size(), input.data(), input.size(), codec);
+    ASSERT_LE(block_size, block.size());
+    EXPECT_TRUE(seqan3::detail::bgzf_compression::validate_header(std::span{block.data(), block_size}));
+
+    // Both codecs must be able to decompress the block.
+    seqan3::contrib::bgzf_zlib_codec zlib_codec{};
+    std::string output(input.size(), '\0');
+    EXPECT_EQ(seqan3::contrib::_decompressBlock(output.data(), output.size(), block.data(), block_size, zlib_codec),
+              input.size());
+    EXPECT_RANGE_EQ(output, input);
+
+    output.assign(input.size(), '\0');
+    EXPECT_EQ(seqan3::contrib::_decompressBlock(output.data(), output.size(), block.data(), block_size, codec),
+              input.size());
+    EXPECT_RANGE_EQ(output, input);
+
+    // A corrupted checksum is detected.
+    block[block_size - 5] ^= '\x01';
+    EXPECT_THROW(seqan3::contrib::_decompressBlock(output.data(), output.size(), block.data(), block_size, codec),
+                 seqan3::io_error);
+}
+
+TYPED_TEST(bgzf_codec, crc32)
+{
+    std::string const input{"The quick brown fox jumps over the lazy dog"};
+    EXPECT_EQ(TypeParam::crc32(input.data(), input.size()), 0x414FA339u);
+    EXPECT_EQ(TypeParam::crc32(input.data(), 0u), 0u);
+}
@@ -0,0 +1,133 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+
+#include <seqan3/contrib/stream/gz_ostream.hpp>
+#include <seqan3/contrib/stream/parallel_gz_istream.hpp>
+
+#include "../../io/stream/istream_test_template.hpp"
+
+template <>
+class istream<seqan3::contrib::parallel_gz_istream> : public ::testing::Test
+{
+public:
+    static constexpr bool zero_out_os_byte = false;
+
+    static inline std::string compressed{
+        '\x1f', '\x8b', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x03', '\x0b', '\xc9', '\x48',
+        '\x55', '\x28', '\x2c', '\xcd', '\x4c', '\xce', '\x56', '\x48', '\x2a', '\xca', '\x2f', '\xcf', '\x53',
+        '\x48', '\xcb', '\xaf', '\x50', '\xc8', '\x2a', '\xcd', '\x2d', '\x28', '\x56', '\xc8', '\x2f', '\x4b',
+        '\x2d', '\x52', '\x28', '\x01', '\x4a', '\xe7', '\x24', '\x56', '\x55', '\x2a', '\xa4', '\xe4', '\xa7',
+        '\x03', '\x00', '\x39', '\xa3', '\x4f', '\x41', '\x2b', '\x00', '\x00', '\x00'};
+};
+
+using test_types = ::testing::Types<seqan3::contrib::parallel_gz_istream>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(contrib_streams, istream, test_types, );
+
+// FASTQ records with random sequences and qualities.
+std::string const long_uncompressed = []()
+{
+    std::mt19937_64 generator{42};
+    std::string data{};
+    for (size_t i = 0; data.size() < 1'500'000; ++i)
+    {
+        data += "@read" + std::to_string(i) + '\n';
+        for (size_t j = 0; j < 100; ++j)
+            data += "ACGT"[generator() % 4];
+        data += "\n+\n";
+        for (size_t j = 0; j < 100; ++j)
+            data += static_cast<char>('!' + generator() % 40);
+        data += '\n';
+    }
+    return data;
+}();
+
+std::string compress(std::string const & data,
+                     size_t const level = Z_DEFAULT_COMPRESSION,
+                     seqan3::contrib::EStrategy const strategy = seqan3::contrib::DefaultStrategy)
+{
+    std::ostringstream out{};
+    {
+        seqan3::contrib::gz_ostream gz_out{out, level, strategy};
+        gz_out << data;
+    }
+    return out.str();
+}
+
+std::string decompress(std::string const & compressed, size_t const thread_count, size_t const chunk_size)
+{
+    std::istringstream in{compressed};
+    seqan3::contrib::parallel_gz_istream gz_in{in, thread_count, chunk_size};
+    return std::string{std::istreambuf_iterator<char>{gz_in}, std::istreambuf_iterator<char>{}};
+}
+
+TEST(parallel_gz_istream, parallel)
+{
+    for (size_t level : {0u, 1u, 6u, 9u})
+    {
+        std::string const compressed = compress(long_uncompressed, level);
+
+        for (size_t thread_count : {0u, 1u, 4u})
+            for (size_t chunk_size : {1u << 20, 1u << 16, 5000u})
+                EXPECT_TRUE(decompress(compressed, thread_count, chunk_size) == long_uncompressed)
+                    << "level " << level << ", " << thread_count << " threads, chunk size " << chunk_size;
+    }
+}
+
+TEST(parallel_gz_istream, huffman_only)
+{
+    std::string const compressed = compress(long_uncompressed, 6u, seqan3::contrib::StrategyHuffmanOnly);
+
+    EXPECT_TRUE(decompress(compressed, 4u, 1u << 16) == long_uncompressed);
+}
+
+TEST(parallel_gz_istream, highly_compressible)
+{
+    // Every chunk is decompressed in several parts.
+    std::string const uncompressed = std::string(5'000'000, 'A') + long_uncompressed.substr(0, 100'000);
+    std::string const compressed = compress(uncompressed);
+
+    for (size_t thread_count : {1u, 4u})
+        EXPECT_TRUE(decompress(compressed, thread_count, 1000u) == uncompressed);
+}
+
+TEST(parallel_gz_istream, multiple_members)
+{
+    std::string const compressed = compress(long_uncompressed.substr(0, 700'000)) + compress("")
+                                 + compress(long_uncompressed.substr(700'000));
+
+    EXPECT_TRUE(decompress(compressed, 4u, 1u << 16) == long_uncompressed);
+
+    // Trailing zeros after the last member are ignored.
+    EXPECT_TRUE(decompress(compressed + std::string(100, '\0'), 4u, 1u << 16) == long_uncompressed);
+}
+
+TEST(parallel_gz_istream, corrupted)
+{
+    std::string const compressed = compress(long_uncompressed);
+
+    for (size_t position : {size_t{100}, compressed.size() / 2, compressed.size() - 6})
+    {
+        std::string corrupted = compressed;
+        corrupted[position] ^= 0x10;
+
+        EXPECT_THROW(decompress(corrupted, 4u, 1u << 16), seqan3::io_error) << "position " << position;
+    }
+}
+
+TEST(parallel_gz_istream, truncated)
+{
+    std::string const compressed = compress(long_uncompressed);
+
+    for (size_t size : {size_t{5}, compressed.size() / 2, compressed.size() - 4})
+        EXPECT_THROW(decompress(compressed.substr(0, size), 4u, 1u << 16), seqan3::io_error) << "size " << size;
+}
@@ -0,0 +1,124 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+
+#include <seqan3/contrib/stream/zstd_istream.hpp>
+#include <seqan3/contrib/stream/zstd_ostream.hpp>
+
+#include "../../io/stream/istream_test_template.hpp"
+
+template <>
+class istream<seqan3::contrib::zstd_istream> : public ::testing::Test
+{
+public:
+    static constexpr bool zero_out_os_byte = false;
+
+    static inline std::string compressed{
+        '\x28', '\xB5', '\x2F', '\xFD', '\x24', '\x2B', '\x59', '\x01', '\x00', '\x54', '\x68', '\x65', '\x20', '\x71',
+        '\x75', '\x69', '\x63', '\x6B', '\x20', '\x62', '\x72', '\x6F', '\x77', '\x6E', '\x20', '\x66', '\x6F', '\x78',
+        '\x20', '\x6A', '\x75', '\x6D', '\x70', '\x73', '\x20', '\x6F', '\x76', '\x65', '\x72', '\x20', '\x74', '\x68',
+        '\x65', '\x20', '\x6C', '\x61', '\x7A', '\x79', '\x20', '\x64', '\x6F', '\x67', '\xBC', '\x71', '\xDA', '\x1F',
+        '\x5E', '\x2A', '\x4D', '\x18', '\x11', '\x00', '\x00', '\x00', '\x38', '\x00', '\x00', '\x00', '\x2B', '\x00',
+        '\x00', '\x00', '\x01', '\x00', '\x00', '\x00', '\x00', '\xB1', '\xEA', '\x92', '\x8F',
+    };
+};
+
+using test_types = ::testing::Types<seqan3::contrib::zstd_istream>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(contrib_streams, istream, test_types, );
+
+// Several frames of random DNA.
+std::string const long_uncompressed = []()
+{
+    std::mt19937_64 generator{42};
+    std::string data(2'500'000, ' ');
+    for (char & c : data)
+        c = "ACGT\n"[generator() % 5];
+    return data;
+}();
+
+std::string compress(std::string const & data, size_t const frame_size = 1u << 18)
+{
+    std::ostringstream out{};
+    {
+        seqan3::contrib::zstd_ostream zstd_out{out, ZSTD_CLEVEL_DEFAULT, frame_size, 1u};
+        zstd_out << data;
+    }
+    return out.str();
+}
+
+TEST(zstd_istream, seekable_parallel)
+{
+    std::string const compressed = compress(long_uncompressed);
+
+    for (size_t thread_count : {0u, 1u, 4u})
+    {
+        std::istringstream in{compressed};
+        seqan3::contrib::zstd_istream zstd_in{in, thread_count};
+        std::string buffer{std::istreambuf_iterator<char>{zstd_in}, std::istreambuf_iterator<char>{}};
+
+        EXPECT_TRUE(buffer == long_uncompressed);
+    }
+}
+
+TEST(zstd_istream, seek)
+{
+    std::istringstream in{compress(long_uncompressed)};
+    seqan3::contrib::zstd_istream zstd_in{in};
+
+    std::string buffer(100, ' ');
+    for (size_t position : {1'500'000u, 10u, 262'143u, 262'144u, 262'100u, 2'499'900u, 20u})
+    {
+        zstd_in.seekg(position);
+        ASSERT_TRUE(zstd_in.read(buffer.data(), buffer.size()));
+        EXPECT_EQ(buffer, long_uncompressed.substr(position, buffer.size()));
+        EXPECT_EQ(zstd_in.tellg(), static_cast<std::streamoff>(position + buffer.size()));
+    }
+
+    zstd_in.seekg(long_uncompressed.size());
+    EXPECT_EQ(zstd_in.get(), EOF);
+
+    zstd_in.clear();
+    zstd_in.seekg(long_uncompressed.size() + 1);
+    EXPECT_TRUE(zstd_in.fail());
+}
+
+TEST(zstd_istream, not_seekable)
+{
+    // Two concatenated frames without a seek table, e.g. written by the zstd command line tool.
+    std::string frame(ZSTD_compressBound(long_uncompressed.size()), ' ');
+    frame.resize(ZSTD_compress(frame.data(), frame.size(), long_uncompressed.data(), long_uncompressed.size(), 1));
+
+    std::istringstream in{frame + frame};
+    seqan3::contrib::zstd_istream zstd_in{in};
+    std::string buffer{std::istreambuf_iterator<char>{zstd_in}, std::istreambuf_iterator<char>{}};
+
+    EXPECT_TRUE(buffer == long_uncompressed + long_uncompressed);
+    EXPECT_EQ(zstd_in.tellg(), static_cast<std::streamoff>(buffer.size()));
+
+    zstd_in.seekg(0);
+    EXPECT_TRUE(zstd_in.fail());
+}
+
+TEST(zstd_istream, truncated)
+{
+    std::string const compressed = compress(long_uncompressed);
+
+    for (std::string const & truncated : {compressed.substr(0, compressed.size() / 2), // without seek table
+                                          compressed.substr(100)})                      // invalid frame
+    {
+        std::istringstream in{truncated};
+        seqan3::contrib::zstd_istream zstd_in{in};
+
+        EXPECT_THROW((std::string{std::istreambuf_iterator<char>{zstd_in}, std::istreambuf_iterator<char>{}}),
+                     seqan3::io_error);
+    }
+}
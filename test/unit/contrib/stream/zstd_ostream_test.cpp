@@ -0,0 +1,84 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <seqan3/contrib/stream/zstd_ostream.hpp>
+
+#include "../../io/stream/ostream_test_template.hpp"
+
+template <>
+class ostream<seqan3::contrib::zstd_ostream> : public ::testing::Test
+{
+public:
+    static constexpr bool zero_out_os_byte = false;
+
+    static inline std::string compressed{
+        '\x28', '\xB5', '\x2F', '\xFD', '\x24', '\x2B', '\x59', '\x01', '\x00', '\x54', '\x68', '\x65', '\x20', '\x71',
+        '\x75', '\x69', '\x63', '\x6B', '\x20', '\x62', '\x72', '\x6F', '\x77', '\x6E', '\x20', '\x66', '\x6F', '\x78',
+        '\x20', '\x6A', '\x75', '\x6D', '\x70', '\x73', '\x20', '\x6F', '\x76', '\x65', '\x72', '\x20', '\x74', '\x68',
+        '\x65', '\x20', '\x6C', '\x61', '\x7A', '\x79', '\x20', '\x64', '\x6F', '\x67', '\xBC', '\x71', '\xDA', '\x1F',
+        '\x5E', '\x2A', '\x4D', '\x18', '\x11', '\x00', '\x00', '\x00', '\x38', '\x00', '\x00', '\x00', '\x2B', '\x00',
+        '\x00', '\x00', '\x01', '\x00', '\x00', '\x00', '\x00', '\xB1', '\xEA', '\x92', '\x8F',
+    };
+};
+
+using test_types = ::testing::Types<seqan3::contrib::zstd_ostream>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(contrib_streams, ostream, test_types, );
+
+uint32_t read_uint32(std::string const & bytes, size_t const position)
+{
+    uint32_t value{};
+    for (size_t i = 0; i < sizeof(value); ++i)
+        value |= static_cast<uint32_t>(static_cast<unsigned char>(bytes[position + i])) << (8 * i);
+    return value;
+}
+
+TEST(zstd_ostream, seek_table)
+{
+    std::string uncompressed_data{};
+    for (size_t i = 0; i < 100'000; ++i)
+        uncompressed_data += std::to_string(i);
+
+    for (size_t thread_count : {0u, 1u, 4u})
+    {
+        std::ostringstream out{};
+        {
+            seqan3::contrib::zstd_ostream zstd_out{out, ZSTD_CLEVEL_DEFAULT, 100'000u, thread_count};
+            zstd_out << uncompressed_data;
+        }
+        std::string const compressed = out.str();
+
+        // The frames and the seek table can be read by any zstd decompressor.
+        std::string buffer(uncompressed_data.size(), ' ');
+        size_t const result = ZSTD_decompress(buffer.data(), buffer.size(), compressed.data(), compressed.size());
+        ASSERT_FALSE(ZSTD_isError(result));
+        EXPECT_EQ(result, uncompressed_data.size());
+        EXPECT_TRUE(buffer == uncompressed_data);
+
+        // The seek table lists 4 frames of 100'000 bytes and one of 88'890 bytes.
+        size_t const footer = compressed.size() - seqan3::contrib::zstd_seekable_format::footer_size;
+        EXPECT_EQ(read_uint32(compressed, footer + 5), seqan3::contrib::zstd_seekable_format::seekable_magic_number);
+        ASSERT_EQ(read_uint32(compressed, footer), 5u);
+        EXPECT_EQ(compressed[footer + 4], '\0');
+
+        size_t const table = footer - 5 * 8;
+        EXPECT_EQ(read_uint32(compressed, table - 8), seqan3::contrib::zstd_seekable_format::skippable_magic_number);
+        EXPECT_EQ(read_uint32(compressed, table - 4), 5u * 8u + 9u);
+
+        size_t compressed_size{};
+        for (size_t i = 0; i < 5; ++i)
+        {
+            compressed_size += read_uint32(compressed, table + 8 * i);
+            EXPECT_EQ(read_uint32(compressed, table + 8 * i + 4), (i < 4) ? 100'000u : 88'890u);
+        }
+        EXPECT_EQ(compressed_size, table - 8);
+    }
+}
@@ -0,0 +1,160 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/algorithm_executor_streaming.hpp>
+
+using callback_t = std::function<void(size_t)>;
+using algorithm_t = std::function<void(size_t, callback_t)>;
+using executor_t = seqan3::detail::algorithm_executor_streaming<std::vector<size_t> &, algorithm_t, size_t>;
+
+// Reports each input twice, larger inputs finish earlier.
+algorithm_t const delayed_algorithm = [](size_t const input, callback_t callback)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds{(10 - input % 10) * 2});
+    callback(input);
+    callback(input);
+};
+
+struct algorithm_executor_streaming_test : public ::testing::Test
+{
+    std::vector<size_t> inputs = []()
+    {
+        std::vector<size_t> values(40);
+        std::iota(values.begin(), values.end(), 0u);
+        return values;
+    }();
+
+    seqan3::detail::execution_handler_parallel execution_handler()
+    {
+        return seqan3::detail::execution_handler_parallel{std::min<uint32_t>(4, std::thread::hardware_concurrency())};
+    }
+};
+
+TEST_F(algorithm_executor_streaming_test, construction)
+{
+    EXPECT_FALSE(std::is_default_constructible_v<executor_t>);
+    EXPECT_FALSE(std::is_copy_constructible_v<executor_t>);
+    EXPECT_TRUE(std::is_move_constructible_v<executor_t>);
+    EXPECT_FALSE(std::is_copy_assignable_v<executor_t>);
+    EXPECT_TRUE(std::is_move_assignable_v<executor_t>);
+}
+
+TEST_F(algorithm_executor_streaming_test, type_deduction)
+{
+    seqan3::detail::algorithm_executor_streaming exec{inputs, delayed_algorithm, size_t{}, execution_handler(), 4u};
+    EXPECT_TRUE((std::same_as<decltype(exec), executor_t>));
+    EXPECT_FALSE(exec.is_eof());
+}
+
+TEST_F(algorithm_executor_streaming_test, input_order)
+{
+    for (size_t window_size : {0u, 1u, 3u, 8u, 100u})
+    {
+        executor_t exec{inputs, delayed_algorithm, 0u, execution_handler(), window_size};
+
+        for (size_t input : inputs)
+        {
+            EXPECT_EQ(exec.next_result().value(), input);
+            EXPECT_EQ(exec.next_result().value(), input);
+        }
+        EXPECT_FALSE(exec.next_result().has_value());
+        EXPECT_TRUE(exec.is_eof());
+    }
+}
+
+TEST_F(algorithm_executor_streaming_test, completion_order)
+{
+    executor_t exec{inputs, delayed_algorithm, 0u, execution_handler(), 8u, false};
+
+    std::vector<size_t> results{};
+    for (auto result = exec.next_result(); result.has_value(); result = exec.next_result())
+        results.push_back(*result);
+
+    ASSERT_EQ(results.size(), 2 * inputs.size());
+    // The results of one invocation are reported together.
+    for (size_t i = 0; i < results.size(); i += 2)
+        EXPECT_EQ(results[i], results[i + 1]);
+
+    std::ranges::sort(results);
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        EXPECT_EQ(results[2 * i], inputs[i]);
+        EXPECT_EQ(results[2 * i + 1], inputs[i]);
+    }
+}
+
+TEST_F(algorithm_executor_streaming_test, bounded_window)
+{
+    std::atomic<size_t> started{};
+    algorithm_t counting_algorithm = [&](size_t const input, callback_t callback)
+    {
+        ++started;
+        callback(input);
+    };
+
+    executor_t exec{inputs, counting_algorithm, 0u, execution_handler(), 3u};
+    EXPECT_EQ(exec.next_result().value(), 0u);
+    // The consumed invocation is only replaced on the next request.
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    EXPECT_EQ(started.load(), 3u);
+
+    EXPECT_EQ(exec.next_result().value(), 1u);
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    EXPECT_EQ(started.load(), 4u);
+}
+
+TEST_F(algorithm_executor_streaming_test, empty_result_bucket)
+{
+    algorithm_t skipping_algorithm = [](size_t const input, callback_t callback)
+    {
+        if (input % 3 != 0)
+            callback(input);
+    };
+
+    executor_t exec{inputs, skipping_algorithm, 0u, execution_handler(), 2u};
+
+    for (size_t input : inputs)
+    {
+        if (input % 3 != 0)
+        {
+            EXPECT_EQ(exec.next_result().value(), input);
+        }
+    }
+
+    EXPECT_FALSE(exec.next_result().has_value());
+}
+
+TEST_F(algorithm_executor_streaming_test, move_assignment)
+{
+    executor_t exec{inputs, delayed_algorithm, 0u, execution_handler(), 4u};
+    executor_t exec_move_assigned{inputs, delayed_algorithm, 0u, execution_handler(), 4u};
+    EXPECT_EQ(exec_move_assigned.next_result().value(), 0u);
+
+    EXPECT_EQ(exec.next_result().value(), 0u);
+    exec_move_assigned = std::move(exec);
+    EXPECT_EQ(exec_move_assigned.next_result().value(), 0u);
+    EXPECT_EQ(exec_move_assigned.next_result().value(), 1u);
+
+    executor_t exec_move_constructed{std::move(exec_move_assigned)};
+    EXPECT_EQ(exec_move_constructed.next_result().value(), 1u);
+
+    size_t count = 0;
+    while (exec_move_constructed.next_result().has_value())
+        ++count;
+    EXPECT_EQ(count, 2 * inputs.size() - 4);
+}
@@ -65,3 +65,15 @@ TEST(misc_output, issue2455_bz)
     EXPECT_TRUE(seqan3::detail::starts_with(file_content, seqan3::detail::bz2_compression::magic_header));
 }
 #endif
+
+#if defined(SEQAN3_HAS_ZSTD)
+TEST(misc_output, issue2455_zst)
+{
+    seqan3::test::tmp_directory tmp;
+    auto filename = tmp.path() / "io_misc_output_test.txt.zst";
+    tmp_compressed_file(filename);
+    std::vector<char> const file_content = read_file_content(filename);
+
+    EXPECT_TRUE(seqan3::detail::starts_with(file_content, seqan3::detail::zstd_compression::magic_header));
+}
+#endif
@@ -0,0 +1,369 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/core/debug_stream/tuple.hpp>
+#include <seqan3/io/sam_file/bam_index.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/io/sam_file/output.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+using seqan3::operator""_cigar_operation;
+using seqan3::operator""_dna5;
+
+using chunks_t = std::vector<seqan3::bam_index_chunk>;
+
+TEST(bam_index, insert_and_query)
+{
+    seqan3::bam_index index{2};
+    index.insert(0, 100, 200, true, {10, 20});
+    index.insert(0, 150, 250, true, {20, 30});     // same bin, merged with the previous chunk
+    index.insert(0, 16000, 17000, true, {30, 40}); // spans two windows of 16384 positions
+    index.insert(0, 40000, 40100, false, {40, 50});
+    index.insert(1, 10, 20, true, {50, 60});
+    index.insert(-1, -1, 0, false, {60, 70});
+
+    EXPECT_EQ(index.reference_count(), 2u);
+    EXPECT_EQ(index.mapped_count(0), 3u);
+    EXPECT_EQ(index.unmapped_count(0), 1u);
+    EXPECT_EQ(index.mapped_count(1), 1u);
+    EXPECT_EQ(index.unplaced_unmapped_count(), 1u);
+
+    EXPECT_RANGE_EQ(index.query(0, 0, 1000), (chunks_t{{10, 40}})); // the bin of the spanning record contains [0, 1000)
+    EXPECT_RANGE_EQ(index.query(0, 200000, 200100), (chunks_t{}));
+    EXPECT_RANGE_EQ(index.query(0, 16500, 16600), (chunks_t{{30, 40}}));
+    EXPECT_RANGE_EQ(index.query(0, 40050, 50000), (chunks_t{{40, 50}}));
+    EXPECT_RANGE_EQ(index.query(0, 0, 1 << 29), (chunks_t{{10, 50}})); // adjacent chunks are merged
+    EXPECT_RANGE_EQ(index.query(1, 0, 100), (chunks_t{{50, 60}}));
+    EXPECT_TRUE(index.query(0, 1000000, 2000000).empty());
+    EXPECT_TRUE(index.query(2, 0, 100).empty());
+    EXPECT_TRUE(index.query(0, 200, 200).empty());
+}
+
+TEST(bam_index, linear_index)
+{
+    // The long record overlaps the window of the query, the short record before it does not.
+    seqan3::bam_index index{1};
+    index.insert(0, 0, 100, true, {10, 20});
+    index.insert(0, 1000, 40000, true, {20, 30});
+    index.insert(0, 20000, 20100, true, {30, 40});
+
+    EXPECT_RANGE_EQ(index.query(0, 35000, 36000), (chunks_t{{20, 30}}));
+    EXPECT_RANGE_EQ(index.query(0, 20050, 20060), (chunks_t{{20, 40}}));
+}
+
+TEST(bam_index, unsorted)
+{
+    seqan3::bam_index index{2};
+    index.insert(0, 100, 200, true, {10, 20});
+    EXPECT_THROW(index.insert(0, 50, 200, true, {20, 30}), seqan3::format_error);
+    index.insert(1, 50, 200, true, {20, 30});
+    EXPECT_THROW(index.insert(0, 300, 400, true, {30, 40}), seqan3::format_error);
+    index.insert(-1, -1, 0, false, {30, 40});
+    EXPECT_THROW(index.insert(1, 300, 400, true, {40, 50}), seqan3::format_error);
+}
+
+TEST(bam_index, max_position)
+{
+    seqan3::bam_index bai{1};
+    EXPECT_THROW(bai.insert(0, (1 << 29) - 10, (1 << 29) + 10, true, {10, 20}), seqan3::format_error);
+
+    seqan3::bam_index csi{1, 14, 6};
+    EXPECT_NO_THROW(csi.insert(0, (1 << 29) - 10, (1 << 29) + 10, true, {10, 20}));
+    EXPECT_RANGE_EQ(csi.query(0, 1 << 29, (1 << 29) + 1), (chunks_t{{10, 20}}));
+}
+
+#if defined(SEQAN3_HAS_ZLIB)
+TEST(bam_index, write_and_read)
+{
+    seqan3::bam_index index{2};
+    index.insert(0, 100, 200, true, {10, 20});
+    index.insert(0, 16000, 17000, true, {30, 40});
+    index.insert(0, 40000, 40100, false, {40, 50});
+    index.insert(1, 10, 20, true, {50, 60});
+    index.insert(-1, -1, 0, false, {60, 70});
+
+    seqan3::test::tmp_directory tmp{};
+    index.write(tmp.path() / "index.bai");
+    index.write(tmp.path() / "index.csi");
+
+    for (auto file_name : {"index.bai", "index.csi"})
+    {
+        seqan3::bam_index read_index{tmp.path() / file_name};
+        EXPECT_EQ(read_index.min_shift(), 14);
+        EXPECT_EQ(read_index.depth(), 5);
+        EXPECT_EQ(read_index.reference_count(), 2u);
+        EXPECT_EQ(read_index.mapped_count(0), 2u);
+        EXPECT_EQ(read_index.unmapped_count(0), 1u);
+        EXPECT_EQ(read_index.unplaced_unmapped_count(), 1u);
+
+        for (int64_t begin : {0, 150, 16500, 20000, 40050})
+            EXPECT_RANGE_EQ(read_index.query(0, begin, begin + 100), index.query(0, begin, begin + 100));
+        EXPECT_RANGE_EQ(read_index.query(1, 0, 100), (chunks_t{{50, 60}}));
+    }
+
+    // A BAI index cannot store other parameters.
+    EXPECT_THROW((seqan3::bam_index{1, 14, 6}.write(tmp.path() / "deep.bai")), seqan3::format_error);
+    EXPECT_NO_THROW((seqan3::bam_index{1, 14, 6}.write(tmp.path() / "deep.csi")));
+    EXPECT_EQ(seqan3::bam_index{tmp.path() / "deep.csi"}.depth(), 6);
+}
+
+TEST(bam_index, read_errors)
+{
+    seqan3::test::tmp_directory tmp{};
+    EXPECT_THROW(seqan3::bam_index{tmp.path() / "missing.bai"}, seqan3::file_open_error);
+
+    {
+        std::ofstream file{tmp.path() / "invalid.bai"};
+        file << "BAM\1";
+    }
+    EXPECT_THROW(seqan3::bam_index{tmp.path() / "invalid.bai"}, seqan3::format_error);
+
+    {
+        std::ofstream file{tmp.path() / "truncated.bai"};
+        file << "BAI\1";
+    }
+    EXPECT_THROW(seqan3::bam_index{tmp.path() / "truncated.bai"}, seqan3::format_error);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Writing the index with seqan3::sam_file_output and querying regions with seqan3::sam_file_input.
+// ---------------------------------------------------------------------------------------------------------------------
+
+struct bam_region_test : public ::testing::Test
+{
+    std::vector<std::string> const ref_ids{"chr1", "chr2:1-2", "chr3"};
+    std::vector<size_t> const ref_lengths{400000, 300000, 1000};
+
+    struct expected_record
+    {
+        std::string id;
+        int32_t reference_id;
+        int32_t begin;
+        int32_t end;
+    };
+
+    std::vector<expected_record> records{};
+
+    // Writes a sorted BAM file of random records, some of them spliced, and some unmapped records at the end.
+    void write_bam(std::filesystem::path const & file_name, seqan3::bam_index_format const index_format)
+    {
+        std::mt19937_64 generator{42};
+
+        seqan3::sam_file_output fout{file_name,
+                                     ref_ids,
+                                     ref_lengths,
+                                     seqan3::fields<seqan3::field::id,
+                                                    seqan3::field::seq,
+                                                    seqan3::field::ref_id,
+                                                    seqan3::field::ref_offset,
+                                                    seqan3::field::cigar,
+                                                    seqan3::field::flag>{}};
+        fout.options.write_bam_index = index_format;
+
+        for (int32_t reference_id : {0, 1})
+        {
+            std::vector<int32_t> positions(5000);
+            for (int32_t & position : positions)
+                position = generator() % (ref_lengths[reference_id] - 5000);
+            std::ranges::sort(positions);
+
+            for (int32_t position : positions)
+            {
+                uint32_t const length = 50 + generator() % 100;
+                uint32_t const intron = (generator() % 20 == 0) ? 2000 + generator() % 2000 : 0;
+                std::vector<seqan3::cigar> cigar{{length, 'M'_cigar_operation}};
+                if (intron > 0)
+                    cigar = {{length / 2, 'M'_cigar_operation},
+                             {intron, 'N'_cigar_operation},
+                             {length - length / 2, 'M'_cigar_operation}};
+
+                std::string id = "read" + std::to_string(records.size());
+                records.push_back({id, reference_id, position, static_cast<int32_t>(position + length + intron)});
+                fout.emplace_back(id, seqan3::dna5_vector(length, 'A'_dna5), reference_id, position, cigar);
+            }
+        }
+
+        for (size_t i = 0; i < 10; ++i)
+        {
+            fout.emplace_back("unmapped",
+                              "ACGT"_dna5,
+                              std::optional<int32_t>{},
+                              std::optional<int32_t>{},
+                              std::vector<seqan3::cigar>{},
+                              seqan3::sam_flag::unmapped);
+        }
+    }
+
+    std::vector<std::string> expected_ids(int32_t const reference_id, int32_t const begin, int32_t const end) const
+    {
+        std::vector<std::string> ids{};
+        for (expected_record const & record : records)
+            if (record.reference_id == reference_id && record.begin < end && record.end > begin)
+                ids.push_back(record.id);
+        return ids;
+    }
+
+    template <typename records_t>
+    static std::vector<std::string> ids_of(records_t && region_records)
+    {
+        std::vector<std::string> ids{};
+        for (auto & record : region_records)
+            ids.push_back(record.id());
+        return ids;
+    }
+
+    // Compares the records of random regions with the expected records.
+    void test_regions(seqan3::bam_index_format const index_format)
+    {
+        seqan3::test::tmp_directory tmp{};
+        auto file_name = tmp.path() / "regions.bam";
+        write_bam(file_name, index_format);
+
+        std::filesystem::path index_file_name{file_name};
+        index_file_name += (index_format == seqan3::bam_index_format::bai) ? ".bai" : ".csi";
+        ASSERT_TRUE(std::filesystem::exists(index_file_name));
+
+        seqan3::bam_index index{index_file_name};
+        EXPECT_EQ(index.reference_count(), 3u);
+        EXPECT_EQ(index.mapped_count(0), 5000u);
+        EXPECT_EQ(index.mapped_count(1), 5000u);
+        EXPECT_EQ(index.mapped_count(2), 0u);
+        EXPECT_EQ(index.unplaced_unmapped_count(), 10u);
+
+        seqan3::sam_file_input fin{file_name};
+        std::mt19937_64 generator{7};
+        for (size_t i = 0; i < 100; ++i)
+        {
+            int32_t const reference_id = i % 2;
+            int32_t const begin = generator() % ref_lengths[reference_id];
+            int32_t const end = begin + 1 + generator() % 10000;
+            EXPECT_RANGE_EQ(ids_of(fin.region(ref_ids[reference_id], begin, end)),
+                            expected_ids(reference_id, begin, end));
+        }
+
+        // Whole references and references without records.
+        EXPECT_RANGE_EQ(ids_of(fin.region("chr1")), expected_ids(0, 0, 400000));
+        EXPECT_RANGE_EQ(ids_of(fin.region("chr2:1-2")), expected_ids(1, 0, 300000)); // the name contains a colon
+        EXPECT_TRUE(ids_of(fin.region("chr3")).empty());
+
+        // The samtools notation is 1-based and inclusive.
+        EXPECT_RANGE_EQ(ids_of(fin.region("chr1:1001-2000")), expected_ids(0, 1000, 2000));
+        EXPECT_RANGE_EQ(ids_of(fin.region("chr2:1-2:5001")), expected_ids(1, 5000, 300000));
+
+        // The file can still be read sequentially after seeking to the beginning.
+        auto it = fin.begin();
+        it.seek_to(index.query(0, 0, 1).front().begin);
+        EXPECT_EQ((*it).id(), "read0");
+    }
+};
+
+TEST_F(bam_region_test, bai)
+{
+    test_regions(seqan3::bam_index_format::bai);
+}
+
+TEST_F(bam_region_test, csi)
+{
+    test_regions(seqan3::bam_index_format::csi);
+}
+
+TEST(bam_region, errors)
+{
+    seqan3::test::tmp_directory tmp{};
+    auto file_name = tmp.path() / "no_index.bam";
+
+    {
+        seqan3::sam_file_output fout{file_name,
+                                     std::vector<std::string>{"chr1"},
+                                     std::vector<size_t>{1000},
+                                     seqan3::fields<seqan3::field::ref_id, seqan3::field::ref_offset>{}};
+        fout.emplace_back(0, 10);
+    }
+
+    seqan3::sam_file_input fin{file_name};
+    EXPECT_THROW(fin.region("chr1"), seqan3::file_open_error);
+    EXPECT_THROW(fin.region("chrX"), std::invalid_argument);
+    EXPECT_THROW(fin.region("chr1:x-10"), std::invalid_argument);
+    EXPECT_THROW(fin.region("chr1:0-10"), std::invalid_argument);
+
+    // The records must be sorted.
+    {
+        seqan3::sam_file_output fout{tmp.path() / "unsorted.bam",
+                                     std::vector<std::string>{"chr1"},
+                                     std::vector<size_t>{1000},
+                                     seqan3::fields<seqan3::field::ref_id, seqan3::field::ref_offset>{}};
+        fout.options.write_bam_index = seqan3::bam_index_format::bai;
+        fout.emplace_back(0, 10);
+        EXPECT_THROW(fout.emplace_back(0, 5), seqan3::format_error);
+    }
+
+    // The index can only be written if the file was constructed from a file name.
+    std::ostringstream stream{};
+    std::vector<std::string> ref_ids{"chr1"};
+    seqan3::sam_file_output fout{stream,
+                                 ref_ids,
+                                 std::vector<size_t>{1000},
+                                 seqan3::format_bam{},
+                                 seqan3::fields<seqan3::field::ref_offset>{}};
+    fout.options.write_bam_index = seqan3::bam_index_format::bai;
+    EXPECT_THROW(fout.emplace_back(10), std::logic_error);
+    fout.options.write_bam_index = seqan3::bam_index_format::none;
+
+    // Region queries require a BAM file.
+    std::filesystem::path sam_file_name = tmp.path() / "file.sam";
+    {
+        std::ofstream file{sam_file_name};
+        file << "@SQ\tSN:chr1\tLN:1000\n";
+    }
+    seqan3::sam_file_input sam_fin{sam_file_name};
+    EXPECT_THROW(sam_fin.region("chr1"), seqan3::format_error);
+}
+
+TEST(bam_region, write_index)
+{
+    seqan3::test::tmp_directory tmp{};
+    auto file_name = tmp.path() / "file.bam";
+    auto make_output = [&file_name]()
+    {
+        seqan3::sam_file_output fout{file_name,
+                                     std::vector<std::string>{"chr1"},
+                                     std::vector<size_t>{1000},
+                                     seqan3::fields<seqan3::field::ref_id, seqan3::field::ref_offset>{}};
+        fout.options.write_bam_index = seqan3::bam_index_format::bai;
+        fout.emplace_back(0, 10);
+        return fout;
+    };
+
+    {
+        auto fout = make_output();
+        fout.write_index();
+        EXPECT_TRUE(std::filesystem::exists(tmp.path() / "file.bam.bai"));
+        EXPECT_THROW(fout.emplace_back(0, 20), std::logic_error);
+    }
+
+    seqan3::sam_file_input fin{file_name};
+    EXPECT_EQ(std::ranges::distance(fin.region("chr1")), 1);
+
+    // A directory in place of the index cannot be written; the destructor ignores the error.
+    std::filesystem::remove(tmp.path() / "file.bam.bai");
+    std::filesystem::create_directory(tmp.path() / "file.bam.bai");
+    {
+        auto fout = make_output();
+        EXPECT_THROW(fout.write_index(), seqan3::file_open_error);
+    }
+    EXPECT_NO_THROW(make_output());
+}
+#endif // defined(SEQAN3_HAS_ZLIB)
@@ -0,0 +1,237 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/core/debug_stream/tuple.hpp>
+#include <seqan3/io/sam_file/bam_record_view.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/io/sam_file/output.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+using seqan3::operator""_cigar_operation;
+using seqan3::operator""_dna5;
+using seqan3::operator""_tag;
+
+using output_fields = seqan3::fields<seqan3::field::seq,
+                                     seqan3::field::id,
+                                     seqan3::field::ref_id,
+                                     seqan3::field::ref_offset,
+                                     seqan3::field::cigar,
+                                     seqan3::field::qual,
+                                     seqan3::field::flag,
+                                     seqan3::field::mapq,
+                                     seqan3::field::mate,
+                                     seqan3::field::tags>;
+
+// Writes records with different field contents, e.g. unmapped records, odd sequence lengths and all tag types.
+template <typename file_t>
+void write_records(file_t & fout, size_t const count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        seqan3::dna5_vector seq(i % 7 == 0 ? 0 : 11 + i % 150);
+        for (size_t j = 0; j < seq.size(); ++j)
+            seq[j] = seqan3::assign_rank_to((i + j) % 5, seqan3::dna5{});
+
+        std::vector<seqan3::phred42> qual(i % 3 == 0 ? 0 : seq.size());
+        for (size_t j = 0; j < qual.size(); ++j)
+            qual[j] = seqan3::assign_rank_to((i * j) % 42, seqan3::phred42{});
+
+        bool const mapped = i % 5 != 0;
+        std::vector<seqan3::cigar> cigar{};
+        if (mapped && !seq.empty())
+            cigar = {{5, 'S'_cigar_operation}, {static_cast<uint32_t>(seq.size() - 5), 'M'_cigar_operation}};
+
+        seqan3::sam_tag_dictionary tags{};
+        tags["NM"_tag] = static_cast<int32_t>(i);
+        if (i % 2 == 0)
+            tags["XA"_tag] = 'a';
+        if (i % 3 == 0)
+            tags["XF"_tag] = 1.5f;
+        if (i % 4 == 0)
+            tags["XZ"_tag] = "string" + std::to_string(i);
+        if (i % 6 == 0)
+            tags["XB"_tag] = std::vector<int16_t>{-1, 2, static_cast<int16_t>(i)};
+        if (i % 9 == 0)
+            tags["XU"_tag] = std::vector<uint8_t>{};
+
+        std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t> mate{};
+        if (i % 2 == 1)
+            mate = {1, static_cast<int32_t>(i), -static_cast<int32_t>(i)};
+
+        fout.emplace_back(seq,
+                          "read" + std::to_string(i),
+                          mapped ? std::optional<int32_t>{static_cast<int32_t>(i % 2)} : std::optional<int32_t>{},
+                          mapped ? std::optional<int32_t>{static_cast<int32_t>(i)} : std::optional<int32_t>{},
+                          cigar,
+                          qual,
+                          mapped ? seqan3::sam_flag::none : seqan3::sam_flag::unmapped,
+                          static_cast<uint8_t>(i % 61),
+                          mate,
+                          tags);
+    }
+}
+
+std::string bam_with_records(size_t const count)
+{
+    std::vector<std::string> const ref_ids{"ref1", "ref2"};
+    std::vector<size_t> const ref_lengths{10000, 20000};
+    std::ostringstream stream{};
+
+    {
+        seqan3::sam_file_output fout{stream, ref_ids, ref_lengths, seqan3::format_bam{}, output_fields{}};
+        write_records(fout, count);
+    }
+
+    return stream.str();
+}
+
+// Compares the lazily decoded fields of every record to the fields read by the seqan3::sam_file_input.
+template <typename lazy_file_t, typename file_t>
+void expect_same_records(lazy_file_t & lazy_fin, file_t & fin)
+{
+    auto it = fin.begin();
+    size_t count{};
+
+    for (seqan3::bam_record_view const & view : lazy_fin.bam_records())
+    {
+        ASSERT_TRUE(it != fin.end());
+        auto & record = *it;
+
+        EXPECT_EQ(view.id(), record.id());
+        EXPECT_EQ(view.reference_id(), record.reference_id());
+        EXPECT_EQ(view.reference_position(), record.reference_position());
+        EXPECT_EQ(view.mapping_quality(), record.mapping_quality());
+        EXPECT_EQ(view.flag(), record.flag());
+        EXPECT_EQ(view.mate_reference_id(), record.mate_reference_id());
+        EXPECT_EQ(view.mate_position(), record.mate_position());
+        EXPECT_EQ(view.template_length(), record.template_length());
+        EXPECT_RANGE_EQ(view.cigar_sequence(), record.cigar_sequence());
+        EXPECT_EQ(view.sequence_size(), record.sequence().size());
+        EXPECT_RANGE_EQ(view.sequence() | seqan3::views::to_char, record.sequence() | seqan3::views::to_char);
+
+        // Missing qualities are an empty range instead of the lowest qualities.
+        if (std::ranges::empty(view.base_qualities()))
+            EXPECT_EQ(std::ranges::count(record.base_qualities(), seqan3::phred42{}), record.base_qualities().size());
+        else
+            EXPECT_RANGE_EQ(view.base_qualities() | seqan3::views::to_char,
+                            record.base_qualities() | seqan3::views::to_char);
+        EXPECT_TRUE(view.tags() == record.tags());
+
+        for (auto && [tag_id, value] : record.tags())
+            EXPECT_TRUE(view.tag(tag_id) == value);
+        EXPECT_FALSE(view.tag("YY"_tag).has_value());
+
+        ++it;
+        ++count;
+    }
+
+    EXPECT_TRUE(it == fin.end());
+    EXPECT_GT(count, 0u);
+}
+
+TEST(bam_record_view, fields)
+{
+    std::string const input = bam_with_records(500);
+    std::istringstream lazy_stream{input};
+    std::istringstream stream{input};
+    seqan3::sam_file_input lazy_fin{lazy_stream, seqan3::format_bam{}};
+    seqan3::sam_file_input fin{stream, seqan3::format_bam{}};
+
+    expect_same_records(lazy_fin, fin);
+}
+
+TEST(bam_record_view, missing_qualities)
+{
+    std::string const input = bam_with_records(1);
+    std::istringstream stream{input};
+    seqan3::sam_file_input fin{stream, seqan3::format_bam{}};
+
+    // The first record has neither a sequence nor qualities.
+    for (seqan3::bam_record_view const & view : fin.bam_records())
+    {
+        EXPECT_TRUE(view.sequence().empty());
+        EXPECT_TRUE(view.base_qualities().empty());
+        EXPECT_TRUE(view.cigar_sequence().empty());
+        EXPECT_FALSE(view.reference_id().has_value());
+        EXPECT_FALSE(view.reference_position().has_value());
+        EXPECT_EQ(view.id(), "read0");
+    }
+}
+
+TEST(bam_record_view, header)
+{
+    std::string const input = bam_with_records(10);
+    std::istringstream stream{input};
+    seqan3::sam_file_input fin{stream, seqan3::format_bam{}};
+
+    auto records = fin.bam_records();
+    EXPECT_RANGE_EQ(fin.header().ref_ids(), (std::vector<std::string>{"ref1", "ref2"}));
+    EXPECT_EQ(std::ranges::distance(records), 10);
+
+    // The file itself is at end.
+    EXPECT_TRUE(fin.begin() == fin.end());
+    EXPECT_THROW(fin.bam_records(), std::logic_error);
+}
+
+TEST(bam_record_view, errors)
+{
+    // Records were already read.
+    std::string const input = bam_with_records(10);
+    std::istringstream stream{input};
+    seqan3::sam_file_input fin{stream, seqan3::format_bam{}};
+    fin.begin();
+    EXPECT_THROW(fin.bam_records(), std::logic_error);
+
+    // Not a BAM file.
+    std::istringstream sam_stream{"@SQ\tSN:ref\tLN:100\nread\t4\t*\t0\t0\t*\t*\t0\t0\tACGT\t*\n"};
+    seqan3::sam_file_input sam_fin{sam_stream, seqan3::format_sam{}};
+    EXPECT_THROW(sam_fin.bam_records(), seqan3::format_error);
+
+    // An unknown reference id.
+    std::istringstream invalid_stream{input};
+    seqan3::sam_file_input invalid_fin{invalid_stream, seqan3::format_bam{}};
+    auto records = invalid_fin.bam_records();
+    std::string invalid = input;
+    int32_t const reference_id{5};
+    size_t const first_record = static_cast<size_t>(invalid_stream.tellg());
+    std::memcpy(invalid.data() + first_record + 4, &reference_id, sizeof(reference_id));
+
+    std::istringstream unknown_reference_stream{invalid};
+    seqan3::sam_file_input unknown_reference_fin{unknown_reference_stream, seqan3::format_bam{}};
+    EXPECT_THROW(unknown_reference_fin.bam_records().begin(), seqan3::format_error);
+
+    // A record that is shorter than its fields.
+    EXPECT_THROW(seqan3::bam_record_view{std::string_view{invalid}.substr(first_record + 4, 31)}, seqan3::format_error);
+}
+
+#if defined(SEQAN3_HAS_ZLIB)
+TEST(bam_record_view, compressed_file)
+{
+    seqan3::test::tmp_directory tmp{};
+    auto const file_name = tmp.path() / "records.bam";
+
+    {
+        std::vector<std::string> const ref_ids{"ref1", "ref2"};
+        std::vector<size_t> const ref_lengths{10000, 20000};
+        seqan3::sam_file_output fout{file_name, ref_ids, ref_lengths, output_fields{}};
+        write_records(fout, 3000);
+    }
+
+    // Many records span the boundaries of the BGZF blocks.
+    seqan3::sam_file_input lazy_fin{file_name};
+    seqan3::sam_file_input fin{file_name};
+    expect_same_records(lazy_fin, fin);
+}
+#endif // defined(SEQAN3_HAS_ZLIB)
@@ -702,3 +702,157 @@ TEST_F(bam_format, issue1201)
 
     fin.header().format_version;
 }
+
+// Writes an uncompressed BAM file with the given number of records.
+std::string many_records_bam(size_t const count)
+{
+    std::vector<std::string> const ref_ids{"ref1", "ref2"};
+    std::vector<size_t> const ref_lengths{100000, 100000};
+    std::ostringstream stream{};
+
+    {
+        seqan3::sam_file_output fout{stream,
+                                     ref_ids,
+                                     ref_lengths,
+                                     seqan3::format_bam{},
+                                     seqan3::fields<seqan3::field::seq,
+                                                    seqan3::field::id,
+                                                    seqan3::field::ref_id,
+                                                    seqan3::field::ref_offset,
+                                                    seqan3::field::cigar,
+                                                    seqan3::field::qual,
+                                                    seqan3::field::mapq,
+                                                    seqan3::field::tags>{}};
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            seqan3::dna5_vector const seq(10 + i % 90, seqan3::assign_rank_to(i % 5, seqan3::dna5{}));
+            std::vector<seqan3::phred42> const qual(seq.size(), seqan3::assign_rank_to(i % 42, seqan3::phred42{}));
+            std::vector<seqan3::cigar> cigar{{static_cast<uint32_t>(seq.size()), 'M'_cigar_operation}};
+            seqan3::sam_tag_dictionary tags{};
+            tags["NM"_tag] = static_cast<int32_t>(i);
+
+            fout.emplace_back(seq,
+                              "read" + std::to_string(i),
+                              static_cast<int32_t>(i % 2),
+                              static_cast<int32_t>(i * 10),
+                              cigar,
+                              qual,
+                              static_cast<uint8_t>(i % 60),
+                              tags);
+        }
+    }
+
+    return stream.str();
+}
+
+// Reads all records and their positions, decoding them on the given number of threads.
+template <typename file_t>
+auto read_all_records(file_t & fin, size_t const thread_count)
+{
+    fin.options.bam_decode_thread_count = thread_count;
+
+    std::vector<typename file_t::record_type> records{};
+    std::vector<std::streampos> positions{};
+    for (auto it = fin.begin(); it != fin.end(); ++it)
+    {
+        positions.push_back(it.file_position());
+        records.push_back(std::move(*it));
+    }
+
+    return std::pair{std::move(records), std::move(positions)};
+}
+
+using parallel_decoding_fields = seqan3::fields<seqan3::field::seq,
+                                                seqan3::field::id,
+                                                seqan3::field::ref_id,
+                                                seqan3::field::ref_offset,
+                                                seqan3::field::cigar,
+                                                seqan3::field::qual,
+                                                seqan3::field::mapq,
+                                                seqan3::field::flag,
+                                                seqan3::field::tags>;
+
+TEST_F(bam_format, parallel_decoding)
+{
+    std::string const input = many_records_bam(5000);
+
+    std::istringstream sequential_stream{input};
+    seqan3::sam_file_input sequential_fin{sequential_stream, seqan3::format_bam{}, parallel_decoding_fields{}};
+    auto [expected_records, expected_positions] = read_all_records(sequential_fin, 0);
+    ASSERT_EQ(expected_records.size(), 5000u);
+
+    for (size_t thread_count : {1u, 4u})
+    {
+        std::istringstream stream{input};
+        seqan3::sam_file_input fin{stream, seqan3::format_bam{}, parallel_decoding_fields{}};
+        auto [records, positions] = read_all_records(fin, thread_count);
+
+        ASSERT_EQ(records.size(), expected_records.size());
+        EXPECT_TRUE(records == expected_records);
+        EXPECT_TRUE(positions == expected_positions);
+    }
+}
+
+TEST_F(bam_format, parallel_decoding_seek)
+{
+    std::string const input = many_records_bam(5000);
+    std::istringstream sequential_stream{input};
+    seqan3::sam_file_input sequential_fin{sequential_stream, seqan3::format_bam{}, parallel_decoding_fields{}};
+    auto [expected_records, positions] = read_all_records(sequential_fin, 0);
+
+    std::istringstream stream{input};
+    seqan3::sam_file_input fin{stream, seqan3::format_bam{}, parallel_decoding_fields{}};
+    fin.options.bam_decode_thread_count = 4;
+
+    // Records read ahead before seeking must not be returned.
+    auto it = fin.begin();
+    for (size_t i : {4000u, 3u, 2999u, 4999u, 0u, 1024u})
+    {
+        it.seek_to(positions[i]);
+        for (size_t j = i; j < std::min<size_t>(i + 1500, expected_records.size()); ++j, ++it)
+        {
+            ASSERT_TRUE(it != fin.end());
+            EXPECT_TRUE(*it == expected_records[j]);
+        }
+    }
+}
+
+TEST_F(bam_format, parallel_decoding_invalid_record)
+{
+    std::string input = many_records_bam(5000);
+    std::istringstream sequential_stream{input};
+    seqan3::sam_file_input sequential_fin{sequential_stream, seqan3::format_bam{}, parallel_decoding_fields{}};
+    auto [expected_records, positions] = read_all_records(sequential_fin, 0);
+
+    // The records in front of an invalid record are returned before the error is reported.
+    auto expect_records_before_error = [&expected_records](std::string const & invalid_input, size_t const count)
+    {
+        std::istringstream stream{invalid_input};
+        seqan3::sam_file_input fin{stream, seqan3::format_bam{}, parallel_decoding_fields{}};
+        fin.options.bam_decode_thread_count = 4;
+
+        size_t record_count{};
+        auto read_records = [&]()
+        {
+            for (auto & record : fin)
+            {
+                EXPECT_TRUE(record == expected_records[record_count]);
+                ++record_count;
+            }
+        };
+
+        EXPECT_THROW(read_records(), seqan3::format_error);
+        EXPECT_EQ(record_count, count);
+    };
+
+    // An unknown reference id.
+    std::string unknown_reference = input;
+    int32_t const reference_id{2};
+    std::memcpy(unknown_reference.data() + static_cast<std::streamoff>(positions[3000]) + 4, &reference_id, 4);
+    expect_records_before_error(unknown_reference, 3000);
+
+    // A truncated record.
+    std::string truncated = input.substr(0, static_cast<std::streamoff>(positions[4500]) + 10);
+    expect_records_before_error(truncated, 4500);
+}
@@ -14,7 +14,11 @@
 
 #include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
 #include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/core/debug_stream/byte.hpp>
+#include <seqan3/core/debug_stream/tuple.hpp>
+#include <seqan3/core/debug_stream/variant.hpp>
 #include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/io/sam_file/output.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/test/tmp_directory.hpp>
 #include <seqan3/utility/views/convert.hpp>
@@ -278,6 +282,44 @@ TEST_F(sam_file_input_f, record_reading_custom_fields)
     EXPECT_EQ(counter, 3u);
 }
 
+struct flat_tag_dictionary_traits : seqan3::sam_file_input_default_traits<>
+{
+    using tag_dictionary = seqan3::flat_sam_tag_dictionary;
+};
+
+TEST_F(sam_file_input_f, flat_tag_dictionary)
+{
+    using seqan3::operator""_tag;
+
+    seqan3::sam_file_input<flat_tag_dictionary_traits> fin{std::istringstream{input}, seqan3::format_sam{}};
+    EXPECT_TRUE((std::same_as<typename decltype(fin)::tag_dictionary_type, seqan3::flat_sam_tag_dictionary>));
+
+    std::vector<seqan3::flat_sam_tag_dictionary> tags{};
+    std::ostringstream stream{};
+    {
+        seqan3::sam_file_output fout{stream, seqan3::format_sam{}};
+        for (auto & rec : fin)
+        {
+            tags.push_back(rec.tags());
+            fout.push_back(rec);
+        }
+    }
+
+    ASSERT_EQ(tags.size(), 3u);
+    EXPECT_EQ(tags[0], (seqan3::flat_sam_tag_dictionary{{"AS"_tag, 2}, {"NM"_tag, 7}}));
+    EXPECT_EQ(tags[1], (seqan3::flat_sam_tag_dictionary{{"xy"_tag, std::vector<uint16_t>{3, 4, 5}}}));
+    EXPECT_TRUE(tags[2].empty());
+
+    // The tags are written like the ones of a seqan3::sam_tag_dictionary.
+    std::ostringstream expected{};
+    {
+        seqan3::sam_file_input default_fin{std::istringstream{input}, seqan3::format_sam{}};
+        seqan3::sam_file_output fout{expected, seqan3::format_sam{}};
+        fout = default_fin;
+    }
+    EXPECT_EQ(stream.str(), expected.str());
+}
+
 TEST_F(sam_file_input_f, file_view)
 {
     seqan3::sam_file_input fin{std::istringstream{input}, seqan3::format_sam{}};
@@ -488,6 +530,49 @@ TEST_F(sam_file_input_f, read_empty_bz2_file)
 }
 #endif
 
+#if defined(SEQAN3_HAS_ZSTD)
+std::string input_zst{
+    '\x28', '\xB5', '\x2F', '\xFD', '\x24', '\xC3', '\x3D', '\x04', '\x00', '\x22', '\x48', '\x1B',
+    '\x1C', '\x60', '\xA9', '\xDA', '\xDD', '\xC0', '\x95', '\x22', '\x04', '\x7C', '\xA9', '\xAB',
+    '\xF8', '\xD1', '\x3C', '\x88', '\xA6', '\xB4', '\x5A', '\xDB', '\x08', '\x0E', '\xA1', '\x6B',
+    '\x23', '\x0C', '\xAC', '\x45', '\x79', '\x07', '\xE2', '\x60', '\x58', '\x05', '\x05', '\x41',
+    '\xCE', '\x8F', '\x5F', '\x73', '\x37', '\x53', '\xE6', '\xAA', '\xEC', '\x9A', '\x58', '\x6C',
+    '\xE9', '\x72', '\xAB', '\xD8', '\x06', '\xE3', '\x0A', '\x61', '\x20', '\x08', '\x34', '\x43',
+    '\xFD', '\x9C', '\x6E', '\x87', '\x0D', '\x1F', '\x6C', '\xCD', '\x93', '\x79', '\x26', '\x7B',
+    '\x4A', '\xD1', '\x54', '\x1D', '\xCD', '\x52', '\xDB', '\xA0', '\xE7', '\x52', '\xEB', '\xF8',
+    '\x80', '\x24', '\x41', '\xFE', '\xDA', '\xE1', '\x2F', '\x8B', '\x7E', '\x69', '\xF9', '\x60',
+    '\x43', '\x87', '\x47', '\xE6', '\xF8', '\xC5', '\x54', '\x1D', '\xD9', '\x51', '\x8A', '\xA6',
+    '\x2A', '\x08', '\x00', '\x50', '\x24', '\x81', '\x30', '\x49', '\xA0', '\x11', '\x4A', '\x48',
+    '\x30', '\xE2', '\x8A', '\x83', '\x70', '\xDF', '\x4F', '\xDD', '\x67', '\x0D', '\x73', '\x0C',
+    '\x0B', '\x8D', '\xB2', '\xE7', '\x5E', '\x2A', '\x4D', '\x18', '\x11', '\x00', '\x00', '\x00',
+    '\x94', '\x00', '\x00', '\x00', '\xC3', '\x00', '\x00', '\x00', '\x01', '\x00', '\x00', '\x00',
+    '\x00', '\xB1', '\xEA', '\x92', '\x8F',
+};
+
+TEST_F(sam_file_input_f, decompression_by_filename_zst)
+{
+    seqan3::test::tmp_directory tmp{};
+    auto filename = tmp.path() / "sam_file_output_test.sam.zst";
+
+    {
+        std::ofstream of{filename, std::ios::binary};
+
+        std::copy(input_zst.begin(), input_zst.end(), std::ostreambuf_iterator<char>{of});
+    }
+
+    seqan3::sam_file_input fin{filename};
+
+    decompression_impl(*this, fin);
+}
+
+TEST_F(sam_file_input_f, decompression_by_stream_zst)
+{
+    seqan3::sam_file_input fin{std::istringstream{input_zst}, seqan3::format_sam{}};
+
+    decompression_impl(*this, fin);
+}
+#endif
+
 // ----------------------------------------------------------------------------
 // BAM format specificities
 // ----------------------------------------------------------------------------
@@ -581,4 +666,26 @@ TEST_F(sam_file_input_bam_format_f, construct_by_stream)
 
     EXPECT_EQ(counter, 3u);
 }
+
+TEST_F(sam_file_input_bam_format_f, flat_tag_dictionary)
+{
+    seqan3::sam_file_input default_fin{std::istringstream{binary_input}, seqan3::format_bam{}};
+    seqan3::sam_file_input<flat_tag_dictionary_traits> fin{std::istringstream{binary_input}, seqan3::format_bam{}};
+
+    size_t counter = 0;
+    for (auto it = fin.begin(); auto & default_rec : default_fin)
+    {
+        ASSERT_NE(it, fin.end());
+        EXPECT_TRUE(std::ranges::equal((*it).tags(),
+                                       default_rec.tags(),
+                                       [](auto const & lhs, auto const & rhs)
+                                       {
+                                           return lhs.first == rhs.first && lhs.second == rhs.second;
+                                       }));
+        ++it;
+        ++counter;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
 #endif // defined(SEQAN3_HAS_ZLIB)
@@ -687,6 +687,7 @@ std::string expected_gz{'\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00',
                         '\x63', '\x88', '\xA3', '\x63', '\x08', '\x2A', '\x04', '\x6A', '\x00', '\x00', '\x7E',
                         '\x6C', '\x6C', '\x0F', '\x76', '\x00', '\x00', '\x00'};
 
+#if !defined(SEQAN3_HAS_LIBDEFLATE) // The expected output was compressed by zlib, libdeflate compresses differently.
 std::string expected_bgzf{
     '\x1F', '\x8B', '\x08', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x06', '\x00', '\x42', '\x43',
     '\x02', '\x00', '\x50', '\x00', '\x2B', '\x4A', '\x4D', '\x4C', '\x31', '\xE4', '\x34', '\xE0', '\xD4', '\x02',
@@ -743,6 +744,7 @@ TEST(compression, by_stream_bgzf)
     buffer[9] = '\x00'; // zero out OS byte.
     EXPECT_EQ(buffer, expected_bgzf);
 }
+#endif // !defined(SEQAN3_HAS_LIBDEFLATE)
 #endif
 
 #if defined(SEQAN3_HAS_BZIP2)
@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <concepts>
 #include <type_traits>
 
@@ -162,3 +163,76 @@ TEST(sam_tag_dictionary, get_function_temporary_const)
     EXPECT_TRUE((std::is_rvalue_reference_v<decltype(std::move(dict2).get<"CO"_tag>())>));
     EXPECT_TRUE((std::is_rvalue_reference_v<decltype(std::move(dict2).get<"CG"_tag>())>));
 }
+
+TEST(flat_sam_tag_dictionary, get_function)
+{
+    seqan3::flat_sam_tag_dictionary dict{};
+
+    dict.get<"NM"_tag>() = 3;
+    dict.get<"NM"_tag>() = 5; // overwrites previous
+    dict.get<"CO"_tag>() = "comment";
+    dict.get<"CG"_tag>() = std::vector<int32_t>{3, 4, 5};
+
+    EXPECT_EQ(dict.size(), 3u);
+    EXPECT_EQ(dict.get<"NM"_tag>(), 5);
+    EXPECT_EQ(dict.get<"CO"_tag>(), "comment");
+    EXPECT_EQ(dict.get<"CG"_tag>(), (std::vector<int32_t>{3, 4, 5}));
+
+    auto const & dict2 = dict;
+    EXPECT_EQ(dict2.get<"NM"_tag>(), 5);
+    EXPECT_THROW(dict2.get<"AS"_tag>(), std::out_of_range);
+
+    EXPECT_TRUE((std::is_rvalue_reference_v<decltype(std::move(dict).get<"NM"_tag>())>));
+    EXPECT_TRUE((std::is_rvalue_reference_v<decltype(std::move(dict2).get<"CO"_tag>())>));
+}
+
+TEST(flat_sam_tag_dictionary, map_interface)
+{
+    using variant_type = seqan3::flat_sam_tag_dictionary::variant_type;
+
+    seqan3::flat_sam_tag_dictionary dict{{"zb"_tag, 'a'}, {"co"_tag, std::string{"comment"}}, {"zb"_tag, 'b'}};
+    EXPECT_EQ(dict.size(), 2u);
+    EXPECT_EQ(dict.at("zb"_tag), variant_type{'a'}); // the first value is kept
+
+    dict["nm"_tag] = std::vector<int32_t>{3, 4, 5};
+    EXPECT_TRUE(dict.insert({"aa"_tag, 1}).second);
+    EXPECT_FALSE(dict.insert({"aa"_tag, 2}).second);
+
+    // The tags are sorted by their id.
+    std::vector<uint16_t> tags{};
+    for (auto & [tag, value] : dict)
+        tags.push_back(tag);
+    EXPECT_EQ(tags, (std::vector<uint16_t>{"aa"_tag, "co"_tag, "nm"_tag, "zb"_tag}));
+
+    EXPECT_EQ(dict.count("nm"_tag), 1u);
+    EXPECT_TRUE(dict.contains("co"_tag));
+    EXPECT_EQ(dict.find("xx"_tag), dict.end());
+    EXPECT_THROW(dict.at("xx"_tag), std::out_of_range);
+
+    EXPECT_EQ(dict.erase("co"_tag), 1u);
+    EXPECT_EQ(dict.erase("co"_tag), 0u);
+    dict.erase(dict.find("aa"_tag));
+    EXPECT_EQ(dict, (seqan3::flat_sam_tag_dictionary{{"nm"_tag, std::vector<int32_t>{3, 4, 5}}, {"zb"_tag, 'a'}}));
+
+    dict.clear();
+    EXPECT_TRUE(dict.empty());
+}
+
+TEST(flat_sam_tag_dictionary, same_order_as_sam_tag_dictionary)
+{
+    seqan3::sam_tag_dictionary map_dict{};
+    seqan3::flat_sam_tag_dictionary flat_dict{};
+
+    for (uint16_t tag : {"XZ"_tag, "NM"_tag, "AS"_tag, "XA"_tag, "MD"_tag, "ZZ"_tag, "AA"_tag})
+    {
+        map_dict[tag] = static_cast<int32_t>(tag);
+        flat_dict[tag] = static_cast<int32_t>(tag);
+    }
+
+    EXPECT_TRUE(std::ranges::equal(map_dict,
+                                   flat_dict,
+                                   [](auto const & lhs, auto const & rhs)
+                                   {
+                                       return lhs.first == rhs.first && lhs.second == rhs.second;
+                                   }));
+}
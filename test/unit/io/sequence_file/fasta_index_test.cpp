@@ -0,0 +1,107 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <seqan3/io/sequence_file/fasta_index.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+using entries_t = std::vector<seqan3::fasta_index_entry>;
+
+TEST(fasta_index, create)
+{
+    std::string const fasta{">seq1 some description\nACGTACGT\nACGTACGT\nACG\n"
+                            ">seq2\nAC\n"
+                            ">empty\n"
+                            ">seq3\tdescription\nACGTACGTAC\nACGTACGTAC\n\n\n"
+                            ">last\nACGTA\nAC"};
+
+    seqan3::fasta_index index = seqan3::fasta_index::create(fasta);
+
+    // id, length, offset of the first base, bases per line, bytes per line
+    EXPECT_TRUE(index.entries()
+                == (entries_t{{"seq1", 19, 23, 8, 9},
+                              {"seq2", 2, 51, 2, 3},
+                              {"empty", 0, 61, 0, 0},
+                              {"seq3", 20, 79, 10, 11},
+                              {"last", 7, 109, 5, 6}}));
+    EXPECT_EQ(index.size(), 5u);
+    EXPECT_EQ(index.find("seq3"), 3u);
+    EXPECT_EQ(index.find("seq4"), std::nullopt);
+    EXPECT_EQ(index.find("seq1 some description"), std::nullopt);
+}
+
+TEST(fasta_index, create_windows_line_breaks)
+{
+    std::string const fasta{">seq1\r\nACGT\r\nACGT\r\nAC\r\n>seq2\r\nA\r\n"};
+
+    EXPECT_TRUE(seqan3::fasta_index::create(fasta).entries()
+                == (entries_t{{"seq1", 10, 7, 4, 6}, {"seq2", 1, 30, 1, 3}}));
+}
+
+TEST(fasta_index, create_empty)
+{
+    EXPECT_EQ(seqan3::fasta_index::create("").size(), 0u);
+    EXPECT_EQ(seqan3::fasta_index::create("\n\n").size(), 0u);
+}
+
+TEST(fasta_index, create_errors)
+{
+    // Lines of different lengths.
+    EXPECT_THROW(seqan3::fasta_index::create(">seq\nACGT\nACGTA\n"), seqan3::format_error);
+    EXPECT_THROW(seqan3::fasta_index::create(">seq\nACGT\nAC\nAC\n"), seqan3::format_error);
+    EXPECT_THROW(seqan3::fasta_index::create(">seq\nACGT\n\nACGT\n"), seqan3::format_error);
+    EXPECT_THROW(seqan3::fasta_index::create(">seq\nACGT\r\nACGT\nAC\n"), seqan3::format_error);
+    // No header.
+    EXPECT_THROW(seqan3::fasta_index::create("ACGT\n>seq\nACGT\n"), seqan3::format_error);
+    // Duplicate ids.
+    EXPECT_THROW(seqan3::fasta_index::create(">seq\nACGT\n>seq\nACGT\n"), seqan3::format_error);
+}
+
+TEST(fasta_index, write_and_read)
+{
+    seqan3::test::tmp_directory tmp{};
+    auto const file_name = tmp.path() / "index.fai";
+
+    seqan3::fasta_index const index = seqan3::fasta_index::create(">seq1\nACGT\nAC\n>seq2 description\nACGTACGT\n");
+    index.write(file_name);
+
+    {
+        std::ifstream file{file_name};
+        std::string const content{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+        EXPECT_EQ(content, "seq1\t6\t6\t4\t5\nseq2\t8\t32\t8\t9\n");
+    }
+
+    seqan3::fasta_index const read_index{file_name};
+    EXPECT_TRUE(read_index == index);
+    EXPECT_EQ(read_index.find("seq2"), 1u);
+}
+
+TEST(fasta_index, read_errors)
+{
+    seqan3::test::tmp_directory tmp{};
+    auto const file_name = tmp.path() / "index.fai";
+
+    EXPECT_THROW(seqan3::fasta_index{file_name}, seqan3::file_open_error);
+
+    std::vector<std::string> const malformed_lines{"seq\t6\t6\t4\n",
+                                                   "seq\t6\t6\t4\t5\t7\n",
+                                                   "seq\t6\tx\t4\t5\n",
+                                                   "seq\t6\t6\t4\t4\n"};
+
+    for (std::string const & content : malformed_lines)
+    {
+        {
+            std::ofstream file{file_name};
+            file << content;
+        }
+
+        EXPECT_THROW(seqan3::fasta_index{file_name}, seqan3::format_error);
+    }
+}
@@ -0,0 +1,158 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <random>
+
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/sequence_file/indexed_fasta_file.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+#include <seqan3/utility/views/slice.hpp>
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_dna5;
+
+struct indexed_fasta_file_test : public ::testing::Test
+{
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path fasta_file = tmp.path() / "genome.fasta";
+
+    void write_fasta(std::string const & content)
+    {
+        std::ofstream file{fasta_file, std::ios::binary};
+        file << content;
+    }
+
+    // Random sequences with different line lengths.
+    void write_random_fasta()
+    {
+        std::mt19937_64 generator{42};
+        std::string content{};
+
+        for (size_t i = 0; i < 20; ++i)
+        {
+            size_t const length = generator() % 500;
+            size_t const line_length = 1 + generator() % 80;
+            std::string const line_break = (i % 3 == 0) ? "\r\n" : "\n";
+
+            content += ">seq" + std::to_string(i) + " description\n";
+            for (size_t j = 0; j < length; ++j)
+            {
+                content.push_back("ACGTN"[generator() % 5]);
+                if ((j + 1) % line_length == 0 || j + 1 == length)
+                    content += line_break;
+            }
+        }
+
+        write_fasta(content);
+    }
+};
+
+TEST_F(indexed_fasta_file_test, sequence)
+{
+    write_fasta(">chr1 first chromosome\nACGTACGTAC\nGGGGCCCCTT\nAAAA\n>chr2\nTTTTTGGGGG\nCC\n");
+
+    seqan3::indexed_fasta_file genome{fasta_file};
+    EXPECT_EQ(genome.index().size(), 2u);
+
+    auto window = genome.sequence("chr1", 8, 14);
+    EXPECT_TRUE(std::ranges::random_access_range<decltype(window)>);
+    EXPECT_TRUE(std::ranges::sized_range<decltype(window)>);
+    EXPECT_EQ(std::ranges::size(window), 6u);
+    EXPECT_RANGE_EQ(window, "ACGGGG"_dna5);
+    EXPECT_EQ(window[2], 'G'_dna5);
+
+    EXPECT_RANGE_EQ(genome.sequence("chr1"), "ACGTACGTACGGGGCCCCTTAAAA"_dna5);
+    EXPECT_RANGE_EQ(genome.sequence("chr2", 5, 100), "GGGGGCC"_dna5); // The end is clamped.
+    EXPECT_TRUE(std::ranges::empty(genome.sequence("chr2", 50, 100)));
+    EXPECT_TRUE(std::ranges::empty(genome.sequence("chr2", 5, 3)));
+    EXPECT_RANGE_EQ(genome.sequence(1u, 0, 3), "TTT"_dna5);
+
+    EXPECT_THROW(genome.sequence("chr3", 0, 10), std::out_of_range);
+    EXPECT_THROW(genome.sequence(2u, 0, 10), std::out_of_range);
+}
+
+TEST_F(indexed_fasta_file_test, alphabet)
+{
+    write_fasta(">chr1\nACGTN\nacgtn\n");
+
+    seqan3::indexed_fasta_file<seqan3::dna4> genome{fasta_file};
+    EXPECT_RANGE_EQ(genome.sequence("chr1"), "ACGTAACGTA"_dna4);
+
+    seqan3::indexed_fasta_file<char> raw_genome{fasta_file};
+    EXPECT_RANGE_EQ(raw_genome.sequence("chr1"), std::string{"ACGTNacgtn"});
+}
+
+TEST_F(indexed_fasta_file_test, same_as_sequence_file_input)
+{
+    write_random_fasta();
+
+    seqan3::indexed_fasta_file genome{fasta_file};
+    seqan3::sequence_file_input fin{fasta_file};
+    std::mt19937_64 generator{0};
+
+    size_t counter = 0;
+    for (auto & [sequence, id, qualities] : fin)
+    {
+        std::string const sequence_id = id.substr(0, id.find(' '));
+        EXPECT_RANGE_EQ(genome.sequence(sequence_id), sequence);
+
+        for (size_t i = 0; i < 20; ++i)
+        {
+            size_t begin = generator() % (sequence.size() + 1);
+            size_t end = begin + generator() % 100;
+            EXPECT_RANGE_EQ(genome.sequence(sequence_id, begin, end), sequence | seqan3::views::slice(begin, end));
+        }
+
+        ++counter;
+    }
+
+    EXPECT_EQ(counter, genome.index().size());
+}
+
+TEST_F(indexed_fasta_file_test, index_file)
+{
+    write_fasta(">chr1\nACGTACGTAC\nGG\n");
+    std::filesystem::path index_file{fasta_file};
+    index_file += ".fai";
+
+    // The index is read from the index file if it exists.
+    seqan3::fasta_index index{};
+    index.write(index_file);
+    EXPECT_EQ(seqan3::indexed_fasta_file{fasta_file}.index().size(), 0u);
+
+    seqan3::fasta_index::create(">chr1\nACGTACGTAC\nGG\n").write(index_file);
+    EXPECT_RANGE_EQ(seqan3::indexed_fasta_file{fasta_file}.sequence("chr1", 9, 12), "CGG"_dna5);
+
+    // An index that does not fit the file.
+    seqan3::fasta_index::create(">chr1\nACGTACGTAC\nGGAAA\n").write(index_file);
+    EXPECT_THROW(seqan3::indexed_fasta_file{fasta_file}, seqan3::format_error);
+
+    // The index can be given explicitly.
+    seqan3::indexed_fasta_file genome{fasta_file, seqan3::fasta_index::create(">chr2\nAC\n")};
+    EXPECT_RANGE_EQ(genome.sequence("chr2"), "AC"_dna5);
+}
+
+TEST_F(indexed_fasta_file_test, errors)
+{
+    EXPECT_THROW(seqan3::indexed_fasta_file{fasta_file}, seqan3::file_open_error);
+
+    write_fasta(std::string{"\x1f\x8b\x08\x00", 4});
+    EXPECT_THROW(seqan3::indexed_fasta_file{fasta_file}, seqan3::format_error);
+
+    write_fasta(">chr1\nACGT\nACGTA\n");
+    EXPECT_THROW(seqan3::indexed_fasta_file{fasta_file}, seqan3::format_error);
+
+    write_fasta("");
+    EXPECT_EQ(seqan3::indexed_fasta_file{fasta_file}.index().size(), 0u);
+}
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <random>
 #include <ranges>
 #include <sstream>
 
@@ -296,6 +297,216 @@ TEST_F(sequence_file_input_f, file_view)
     EXPECT_EQ(counter, 3u);
 }
 
+// ----------------------------------------------------------------------------
+// parallel parsing
+// ----------------------------------------------------------------------------
+
+// Records with random sequences of random length, some of them spanning several lines.
+std::string many_records(bool const fastq, size_t const count)
+{
+    std::mt19937_64 generator{42};
+    auto wrapped = [&generator](std::string const & line)
+    {
+        size_t const line_length = generator() % 2 ? line.size() : 60;
+        std::string result{};
+        for (size_t i = 0; i < line.size(); i += line_length)
+            result += line.substr(i, line_length) + '\n';
+        return result;
+    };
+
+    std::string data{};
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::string sequence(50 + generator() % 250, 'A');
+        for (char & c : sequence)
+            c = "ACGTN"[generator() % 5];
+
+        if (fastq)
+        {
+            // Qualities starting with '@' or '+' must not be mistaken for the start of a record.
+            std::string qualities(sequence.size(), '!');
+            for (char & c : qualities)
+                c = static_cast<char>('!' + generator() % 41);
+
+            data += "@read " + std::to_string(i) + '\n' + wrapped(sequence) + "+\n" + wrapped(qualities);
+        }
+        else
+        {
+            data += (i % 3 ? ">read " : ";read ") + std::to_string(i) + '\n' + wrapped(sequence);
+        }
+    }
+
+    return data;
+}
+
+// Reads all records and their positions, parsing them on the given number of threads.
+template <typename file_t>
+auto read_all_records(file_t & fin, size_t const thread_count)
+{
+    fin.options.parse_thread_count = thread_count;
+
+    std::vector<typename file_t::record_type> records{};
+    std::vector<std::streampos> positions{};
+    for (auto it = fin.begin(); it != fin.end(); ++it)
+    {
+        positions.push_back(it.file_position());
+        records.push_back(std::move(*it));
+    }
+
+    return std::pair{std::move(records), std::move(positions)};
+}
+
+TEST(sequence_file_input_parallel, parallel_parsing)
+{
+    for (bool fastq : {false, true})
+    {
+        std::string const input = many_records(fastq, 20'000);
+        seqan3::format_fasta const fasta{};
+        seqan3::format_fastq const fastq_format{};
+        auto open = [&](std::istream & stream)
+        {
+            using file_t = seqan3::sequence_file_input<>;
+            return fastq ? file_t{stream, fastq_format} : file_t{stream, fasta};
+        };
+
+        std::istringstream sequential_stream{input};
+        auto sequential_fin = open(sequential_stream);
+        auto [expected_records, expected_positions] = read_all_records(sequential_fin, 0);
+        ASSERT_EQ(expected_records.size(), 20'000u);
+
+        for (size_t thread_count : {1u, 4u})
+        {
+            std::istringstream stream{input};
+            auto fin = open(stream);
+            auto [records, positions] = read_all_records(fin, thread_count);
+
+            ASSERT_EQ(records.size(), expected_records.size()) << "FASTQ " << fastq << ", " << thread_count;
+            EXPECT_TRUE(records == expected_records) << "FASTQ " << fastq << ", " << thread_count << " threads";
+            EXPECT_TRUE(positions == expected_positions) << "FASTQ " << fastq << ", " << thread_count << " threads";
+        }
+    }
+}
+
+// A stream buffer that does not report positions, like the one of a decompressing stream.
+class non_seekable_stringbuf : public std::stringbuf
+{
+public:
+    using std::stringbuf::stringbuf;
+
+protected:
+    pos_type seekoff(off_type, std::ios_base::seekdir, std::ios_base::openmode) override
+    {
+        return pos_type(off_type(-1));
+    }
+
+    pos_type seekpos(pos_type, std::ios_base::openmode) override
+    {
+        return pos_type(off_type(-1));
+    }
+};
+
+TEST(sequence_file_input_parallel, non_seekable_stream)
+{
+    std::string const input = many_records(true, 20'000);
+
+    non_seekable_stringbuf sequential_buffer{input};
+    std::istream sequential_stream{&sequential_buffer};
+    seqan3::sequence_file_input sequential_fin{sequential_stream, seqan3::format_fastq{}};
+    auto [expected_records, expected_positions] = read_all_records(sequential_fin, 0);
+    ASSERT_EQ(expected_records.size(), 20'000u);
+    EXPECT_EQ(expected_positions.front(), std::streampos(-1));
+
+    non_seekable_stringbuf buffer{input};
+    std::istream stream{&buffer};
+    seqan3::sequence_file_input fin{stream, seqan3::format_fastq{}};
+    auto [records, positions] = read_all_records(fin, 4);
+
+    EXPECT_TRUE(records == expected_records);
+    EXPECT_TRUE(positions == expected_positions);
+}
+
+TEST(sequence_file_input_parallel, single_record)
+{
+    seqan3::sequence_file_input fin{std::istringstream{"@ID\nACGT\n+\n!!!!"}, seqan3::format_fastq{}};
+    fin.options.parse_thread_count = 2;
+
+    auto it = fin.begin();
+    ASSERT_TRUE(it != fin.end());
+    EXPECT_EQ((*it).id(), "ID");
+    EXPECT_TRUE(++it == fin.end());
+
+    seqan3::sequence_file_input empty_fin{std::istringstream{}, seqan3::format_fasta{}};
+    empty_fin.options.parse_thread_count = 2;
+    EXPECT_TRUE(empty_fin.begin() == empty_fin.end());
+}
+
+TEST(sequence_file_input_parallel, seek)
+{
+    std::string const input = many_records(true, 20'000);
+    std::istringstream sequential_stream{input};
+    seqan3::sequence_file_input sequential_fin{sequential_stream, seqan3::format_fastq{}};
+    auto [expected_records, positions] = read_all_records(sequential_fin, 0);
+
+    std::istringstream stream{input};
+    seqan3::sequence_file_input fin{stream, seqan3::format_fastq{}};
+    fin.options.parse_thread_count = 4;
+
+    // Records read ahead before seeking must not be returned.
+    auto it = fin.begin();
+    for (size_t i : {15000u, 3u, 9999u, 19999u, 0u, 1024u})
+    {
+        it.seek_to(positions[i]);
+        for (size_t j = i; j < std::min<size_t>(i + 6000, expected_records.size()); ++j, ++it)
+        {
+            ASSERT_TRUE(it != fin.end());
+            EXPECT_TRUE(*it == expected_records[j]);
+        }
+    }
+}
+
+TEST(sequence_file_input_parallel, invalid_record)
+{
+    std::string const input = many_records(true, 20'000);
+    std::istringstream sequential_stream{input};
+    seqan3::sequence_file_input sequential_fin{sequential_stream, seqan3::format_fastq{}};
+    auto [expected_records, positions] = read_all_records(sequential_fin, 0);
+
+    // The records in front of an invalid record are returned before the error is reported.
+    auto expect_records_before_error = [&expected_records](std::string const & invalid_input, size_t const count)
+    {
+        seqan3::sequence_file_input fin{std::istringstream{invalid_input}, seqan3::format_fastq{}};
+        fin.options.parse_thread_count = 4;
+
+        size_t record_count{};
+        auto read_records = [&]()
+        {
+            for (auto & record : fin)
+            {
+                EXPECT_TRUE(record == expected_records[record_count]);
+                ++record_count;
+            }
+        };
+
+        // seqan3::parse_error or seqan3::unexpected_end_of_input, as if parsed sequentially.
+        EXPECT_THROW(read_records(), std::runtime_error);
+        EXPECT_EQ(record_count, count);
+    };
+
+    // A record without an ID.
+    std::string missing_id = input;
+    missing_id[static_cast<std::streamoff>(positions[12000])] = 'X';
+    expect_records_before_error(missing_id, 12000);
+
+    // An invalid character in the sequence.
+    std::string invalid_character = input;
+    invalid_character[input.find('\n', static_cast<std::streamoff>(positions[7000])) + 1] = '!';
+    expect_records_before_error(invalid_character, 7000);
+
+    // A truncated record.
+    std::string truncated = input.substr(0, static_cast<std::streamoff>(positions[19000]) + 20);
+    expect_records_before_error(truncated, 19000);
+}
+
 // ----------------------------------------------------------------------------
 // decompression
 // ----------------------------------------------------------------------------
@@ -348,6 +559,30 @@ TEST_F(sequence_file_input_f, decompression_by_stream_gz)
     decompression_impl(*this, fin);
 }
 
+// Plain gzip files are only decompressed by seqan3::contrib::parallel_gz_istream if more threads are configured.
+struct sequence_file_input_parallel_gz_f : public sequence_file_input_f
+{
+    uint64_t default_thread_count{};
+
+    void SetUp() override
+    {
+        default_thread_count = seqan3::contrib::gz_thread_count;
+        seqan3::contrib::gz_thread_count = 4u;
+    }
+
+    // Also restores the thread count if an assertion of the test failed.
+    void TearDown() override
+    {
+        seqan3::contrib::gz_thread_count = default_thread_count;
+    }
+};
+
+TEST_F(sequence_file_input_parallel_gz_f, decompression_by_stream_gz)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input_gz}, seqan3::format_fasta{}};
+    decompression_impl(*this, fin);
+}
+
 TEST_F(sequence_file_input_f, read_empty_gz_file)
 {
     std::string empty_zipped_file{'\x1f', '\x8b', '\x08', '\x08', '\x5a', '\x07', '\x98', '\x5c',
@@ -470,3 +705,51 @@ TEST_F(sequence_file_input_f, read_empty_bz2_file)
     EXPECT_TRUE(fin.begin() == fin.end());
 }
 #endif
+
+#if defined(SEQAN3_HAS_ZSTD)
+std::string input_zst{
+    '\x28', '\xB5', '\x2F', '\xFD', '\x24', '\x3E', '\xAD', '\x01', '\x00', '\xC4', '\x02', '\x3E',
+    '\x20', '\x54', '\x45', '\x53', '\x54', '\x20', '\x31', '\x0A', '\x41', '\x43', '\x47', '\x54',
+    '\x0A', '\x3E', '\x54', '\x65', '\x73', '\x74', '\x32', '\x0A', '\x41', '\x47', '\x47', '\x43',
+    '\x54', '\x47', '\x4E', '\x0A', '\x3E', '\x20', '\x33', '\x0A', '\x47', '\x47', '\x41', '\x47',
+    '\x54', '\x41', '\x54', '\x41', '\x41', '\x54', '\x0A', '\x02', '\x00', '\x39', '\x49', '\x0F',
+    '\x3B', '\x9D', '\xFA', '\x2E', '\x51', '\xFF', '\x5E', '\x2A', '\x4D', '\x18', '\x11', '\x00',
+    '\x00', '\x00', '\x42', '\x00', '\x00', '\x00', '\x3E', '\x00', '\x00', '\x00', '\x01', '\x00',
+    '\x00', '\x00', '\x00', '\xB1', '\xEA', '\x92', '\x8F',
+};
+
+TEST_F(sequence_file_input_f, decompression_by_filename_zst)
+{
+    seqan3::test::tmp_directory tmp;
+    auto filename = tmp.path() / "sequence_file_output_test.fasta.zst";
+
+    {
+        std::ofstream of{filename, std::ios::binary};
+
+        std::copy(begin(input_zst), end(input_zst), std::ostreambuf_iterator<char>{of});
+    }
+
+    seqan3::sequence_file_input fin{filename};
+
+    decompression_impl(*this, fin);
+}
+
+TEST_F(sequence_file_input_f, decompression_by_stream_zst)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input_zst}, seqan3::format_fasta{}};
+
+    decompression_impl(*this, fin);
+}
+
+TEST_F(sequence_file_input_f, read_empty_zst_file)
+{
+    std::string empty_zst_file{
+        '\x28', '\xB5', '\x2F', '\xFD', '\x24', '\x00', '\x01', '\x00', '\x00', '\x99', '\xE9', '\xD8', '\x51', '\x5E',
+        '\x2A', '\x4D', '\x18', '\x11', '\x00', '\x00', '\x00', '\x0D', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+        '\x00', '\x01', '\x00', '\x00', '\x00', '\x00', '\xB1', '\xEA', '\x92', '\x8F',
+    };
+    seqan3::sequence_file_input fin{std::istringstream{empty_zst_file}, seqan3::format_fasta{}};
+
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+#endif
@@ -11,6 +11,7 @@
 
 #include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
 #include <seqan3/test/streambuf.hpp>
+#include <seqan3/utility/char_operations/predicate.hpp>
 
 TEST(fast_istreambuf_iterator, concept)
 {
@@ -135,6 +136,69 @@ TEST(debug_fast_istreambuf_iterator, not_enough_field_separation_signs_found)
 }
 #endif
 
+TEST(fast_istreambuf_iterator, skip_until)
+{
+    std::string const id(50, 'A');
+    std::istringstream str{"@" + id + " comment\nACGT"};
+    seqan3::detail::fast_istreambuf_iterator<char> it{*str.rdbuf()};
+
+    std::string skipped{};
+    auto append = [&skipped](std::string_view const chunk)
+    {
+        skipped += chunk;
+    };
+
+    it.skip_until(seqan3::is_char<'@'>, append); // already there
+    EXPECT_EQ(skipped, "");
+    ++it;
+
+    it.skip_until(seqan3::is_cntrl || seqan3::is_blank, append);
+    EXPECT_EQ(skipped, id);
+    EXPECT_EQ(*it, ' ');
+
+    it.skip_until(seqan3::is_char<'\n'>);
+    EXPECT_EQ(*it, '\n');
+    ++it;
+
+    skipped.clear();
+    it.skip_until(seqan3::is_space, append); // not found
+    EXPECT_EQ(skipped, "ACGT");
+    EXPECT_TRUE(std::default_sentinel == it);
+}
+
+TEST(fast_istreambuf_iterator, skip_until_small_streambuffer)
+{
+    std::string const id(50, 'A');
+    std::istringstream str{"@" + id + " comment\nACGT"};
+    std::istream & in{str};
+    std::streambuf * orig = in.rdbuf();
+    seqan3::test::streambuf_with_custom_buffer_size<3> buf(orig);
+    in.rdbuf(&buf);
+
+    seqan3::detail::fast_istreambuf_iterator<char> it{*in.rdbuf()};
+
+    std::string skipped{};
+    auto append = [&skipped](std::string_view const chunk)
+    {
+        EXPECT_LE(chunk.size(), 3u);
+        skipped += chunk;
+    };
+
+    ++it;
+    it.skip_until(seqan3::is_cntrl || seqan3::is_blank, append);
+    EXPECT_EQ(skipped, id);
+    EXPECT_EQ(*it, ' ');
+
+    it.skip_until(seqan3::is_char<'\n'>);
+    EXPECT_EQ(*it, '\n');
+    ++it;
+
+    skipped.clear();
+    it.skip_until(seqan3::is_space, append);
+    EXPECT_EQ(skipped, "ACGT");
+    EXPECT_TRUE(std::default_sentinel == it);
+}
+
 TEST(fast_istreambuf_iterator, cache_bytes)
 {
     std::istringstream str{"ABCDEFGHIJKLMNOPQRSTUVWXYZ"};
@@ -0,0 +1,76 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include <seqan3/io/stream/detail/simd_find.hpp>
+#include <seqan3/utility/char_operations/predicate.hpp>
+
+TEST(simd_find, char_intervals)
+{
+    constexpr auto space = seqan3::detail::char_intervals<std::remove_cvref_t<decltype(seqan3::is_space)>>;
+    ASSERT_EQ(space.size(), 2u);
+    EXPECT_EQ(space[0].first, '\t');
+    EXPECT_EQ(space[0].last, '\r');
+    EXPECT_EQ(space[1].first, ' ');
+    EXPECT_EQ(space[1].last, ' ');
+
+    constexpr auto no_space = seqan3::detail::char_intervals<std::remove_cvref_t<decltype(!seqan3::is_space)>>;
+    ASSERT_EQ(no_space.size(), 3u);
+    EXPECT_EQ(no_space[0].first, 0);
+    EXPECT_EQ(no_space[2].last, 255);
+}
+
+// Compares the result with std::find_if for all positions and lengths, i.e. for matches in and behind blocks.
+template <typename predicate_t>
+void expect_same_as_find_if(predicate_t const & predicate, std::string const & text)
+{
+    for (size_t begin = 0; begin < 70; ++begin)
+    {
+        for (size_t end = begin; end <= text.size(); end += 7)
+        {
+            char const * first = text.data() + begin;
+            char const * last = text.data() + end;
+
+            EXPECT_EQ(seqan3::detail::simd_find_if(first, last, predicate), std::find_if(first, last, predicate))
+                << predicate.message() << " in [" << begin << ", " << end << ")";
+        }
+    }
+}
+
+TEST(simd_find, simd_find_if)
+{
+    // Sparse matches, including characters above 127.
+    std::mt19937_64 generator{42};
+    std::string text(300, 'A');
+    for (char & c : text)
+        c = generator() % 20 == 0 ? static_cast<char>(generator()) : "ACGT"[generator() % 4];
+
+    expect_same_as_find_if(seqan3::is_char<'\n'>, text);
+    expect_same_as_find_if(seqan3::is_space, text);
+    expect_same_as_find_if(seqan3::is_cntrl || seqan3::is_blank, text);
+    expect_same_as_find_if(seqan3::is_char<'>'> || seqan3::is_char<';'>, text);
+    expect_same_as_find_if(!seqan3::is_alpha, text);
+    expect_same_as_find_if(seqan3::is_alnum, text); // more than four intervals
+}
+
+TEST(simd_find, simd_find)
+{
+    std::string const text = std::string(100, 'A') + "\tB\t" + std::string(50, 'C') + "\xff";
+    char const * const first = text.data();
+    char const * const last = text.data() + text.size();
+
+    EXPECT_EQ(seqan3::detail::simd_find(first, last, '\t'), first + 100);
+    EXPECT_EQ(seqan3::detail::simd_find(first + 101, last, '\t'), first + 102);
+    EXPECT_EQ(seqan3::detail::simd_find(first, last, '\xff'), last - 1);
+    EXPECT_EQ(seqan3::detail::simd_find(first, last, '\n'), last);
+    EXPECT_EQ(seqan3::detail::simd_find(first, first, 'A'), first);
+}
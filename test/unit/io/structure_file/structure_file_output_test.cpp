@@ -453,6 +453,7 @@ std::string expected_gz{
     '\x96', '\x6E', '\x5B', '\x85', '\xF4', '\x3F', '\x04', '\xBF', '\x08', '\xCF', '\x29', '\xB9', '\xF1', '\x1B',
     '\x0F', '\x1F', '\xA0', '\x5A', '\xBE', '\x54', '\xFC', '\x00', '\x00', '\x00'};
 
+#if !defined(SEQAN3_HAS_LIBDEFLATE) // The expected output was compressed by zlib, libdeflate compresses differently.
 std::string expected_bgzf{
     '\x1F', '\x8B', '\x08', '\x04', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x06', '\x00', '\x42', '\x43',
     '\x02', '\x00', '\xAF', '\x00', '\x55', '\x4E', '\xB1', '\x0A', '\xC2', '\x50', '\x0C', '\xDC', '\xF3', '\x15',
@@ -512,6 +513,7 @@ TEST_F(structure_file_output_compression, by_stream_bgzf)
     buffer[9] = '\x00'; // zero out OS byte
     EXPECT_EQ(buffer, expected_bgzf);
 }
+#endif // !defined(SEQAN3_HAS_LIBDEFLATE)
 #endif
 
 #if defined(SEQAN3_HAS_BZIP2)
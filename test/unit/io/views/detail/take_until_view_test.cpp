@@ -10,9 +10,13 @@
 #include <algorithm>
 #include <ranges>
 #include <span>
+#include <sstream>
 
+#include <seqan3/io/views/detail/istreambuf_view.hpp>
 #include <seqan3/io/views/detail/take_until_view.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/streambuf.hpp>
+#include <seqan3/utility/char_operations/predicate.hpp>
 #include <seqan3/utility/views/single_pass_input.hpp>
 
 // ============================================================================
@@ -228,3 +232,30 @@ TEST(take_until_and_consume, concepts)
     };
     do_concepts(seqan3::detail::take_until_and_consume(is_newline), true);
 }
+
+// ============================================================================
+//  consume on istreambuf
+// ============================================================================
+
+TEST(take_until_istreambuf, consume)
+{
+    // The stream buffer holds 3 characters at a time; the lines are longer than a SIMD block.
+    std::string const line(40, 'x');
+    std::istringstream str{line + "\t" + line + "\n\n\n" + line + "\r\n"};
+    seqan3::test::streambuf_with_custom_buffer_size<3> buf{str.rdbuf()};
+    auto stream_view = seqan3::detail::istreambuf(buf);
+
+    seqan3::detail::consume(stream_view | seqan3::detail::take_until(seqan3::is_blank));
+    EXPECT_EQ(*stream_view.begin(), '\t');
+
+    // Consumes the line and all newlines behind it.
+    seqan3::detail::consume(stream_view | seqan3::detail::take_until_and_consume(seqan3::is_char<'\n'>));
+    EXPECT_EQ(*stream_view.begin(), 'x');
+
+    seqan3::detail::consume(stream_view | seqan3::detail::take_until_or_throw_and_consume(!seqan3::is_alpha));
+    EXPECT_TRUE(stream_view.begin() == stream_view.end());
+
+    EXPECT_NO_THROW(seqan3::detail::consume(stream_view | seqan3::detail::take_until(seqan3::is_blank)));
+    EXPECT_THROW(seqan3::detail::consume(stream_view | seqan3::detail::take_until_or_throw(seqan3::is_blank)),
+                 seqan3::unexpected_end_of_input);
+}
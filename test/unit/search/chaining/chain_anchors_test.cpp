@@ -0,0 +1,235 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <seqan3/search/chaining/all.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+namespace cfg = seqan3::chain_cfg;
+
+using anchors_t = std::vector<seqan3::anchor>;
+
+// Random anchors of two references, among them a few colinear runs.
+anchors_t generate_anchors(size_t const seed)
+{
+    std::mt19937_64 generator{seed};
+    std::uniform_int_distribution<size_t> position{0, 3000};
+    std::uniform_int_distribution<size_t> span{5, 20};
+    std::uniform_int_distribution<size_t> gap{0, 30};
+
+    anchors_t anchors{};
+    for (size_t i = 0; i < 150; ++i)
+        anchors.push_back(seqan3::anchor{generator() % 2, position(generator), position(generator), span(generator)});
+
+    for (size_t run = 0; run < 4; ++run)
+    {
+        seqan3::anchor current{run % 2, position(generator), position(generator), span(generator)};
+        for (size_t i = 0; i < 25; ++i)
+        {
+            anchors.push_back(current);
+            current.reference_position += current.span + gap(generator);
+            current.query_position += current.span + gap(generator);
+            current.span = span(generator);
+        }
+    }
+
+    std::ranges::shuffle(anchors, generator);
+    return anchors;
+}
+
+// Computes the best chain score of all anchors by testing all predecessors.
+double best_score(anchors_t anchors, double const weight, size_t const max_gap)
+{
+    std::ranges::sort(anchors);
+    std::vector<double> scores(anchors.size());
+    double best = 0;
+    for (size_t i = 0; i < anchors.size(); ++i)
+    {
+        scores[i] = anchors[i].span;
+        for (size_t j = 0; j < i; ++j)
+        {
+            size_t const reference_end = anchors[j].reference_position + anchors[j].span;
+            size_t const query_end = anchors[j].query_position + anchors[j].span;
+            if (anchors[j].reference_id != anchors[i].reference_id || reference_end > anchors[i].reference_position
+                || query_end > anchors[i].query_position)
+                continue;
+
+            size_t const reference_gap = anchors[i].reference_position - reference_end;
+            size_t const query_gap = anchors[i].query_position - query_end;
+            if (reference_gap > max_gap || query_gap > max_gap)
+                continue;
+
+            scores[i] = std::max(scores[i], anchors[i].span + scores[j] - weight * (reference_gap + query_gap));
+        }
+        best = std::max(best, scores[i]);
+    }
+    return best;
+}
+
+// Checks that the chain is colinear and returns its score.
+double validate_chain(seqan3::anchor_chain const & chain, double const weight, size_t const max_gap)
+{
+    EXPECT_FALSE(chain.anchors.empty());
+    double score = chain.anchors.front().span;
+    for (size_t i = 1; i < chain.anchors.size(); ++i)
+    {
+        seqan3::anchor const & previous = chain.anchors[i - 1];
+        seqan3::anchor const & current = chain.anchors[i];
+        EXPECT_EQ(previous.reference_id, current.reference_id);
+        EXPECT_LE(previous.reference_position + previous.span, current.reference_position);
+        EXPECT_LE(previous.query_position + previous.span, current.query_position);
+
+        size_t const reference_gap = current.reference_position - previous.reference_position - previous.span;
+        size_t const query_gap = current.query_position - previous.query_position - previous.span;
+        EXPECT_LE(reference_gap, max_gap);
+        EXPECT_LE(query_gap, max_gap);
+        score += current.span - weight * (reference_gap + query_gap);
+    }
+    return score;
+}
+
+TEST(chain_anchors, empty)
+{
+    EXPECT_TRUE(seqan3::chain_anchors(anchors_t{}).empty());
+    EXPECT_TRUE(seqan3::chain_anchors(anchors_t{}, cfg::look_back{}).empty());
+}
+
+TEST(chain_anchors, simple)
+{
+    anchors_t anchors{{0, 30, 28, 10}, {0, 100, 5, 10}, {0, 0, 0, 10}, {0, 14, 14, 10}};
+
+    for (auto && chains : {seqan3::chain_anchors(anchors), seqan3::chain_anchors(anchors, cfg::look_back{})})
+    {
+        ASSERT_EQ(chains.size(), 2u);
+        EXPECT_EQ(chains[0].score, 21);
+        EXPECT_RANGE_EQ(chains[0].anchors, (anchors_t{{0, 0, 0, 10}, {0, 14, 14, 10}, {0, 30, 28, 10}}));
+        EXPECT_EQ(chains[1].score, 10);
+        EXPECT_RANGE_EQ(chains[1].anchors, (anchors_t{{0, 100, 5, 10}}));
+    }
+}
+
+TEST(chain_anchors, input_range)
+{
+    std::list<seqan3::anchor> anchors{{0, 0, 0, 10}, {0, 14, 14, 10}, {0, 14, 0, 0}};
+
+    auto chains = seqan3::chain_anchors(anchors);
+    ASSERT_EQ(chains.size(), 1u); // The anchor with a span of 0 is ignored.
+    EXPECT_EQ(chains[0].score, 16);
+}
+
+TEST(chain_anchors, reference_id)
+{
+    anchors_t anchors{{0, 0, 0, 10}, {1, 14, 14, 10}, {1, 28, 28, 10}};
+
+    auto chains = seqan3::chain_anchors(anchors);
+    ASSERT_EQ(chains.size(), 2u);
+    EXPECT_EQ(chains[0].score, 16);
+    EXPECT_RANGE_EQ(chains[0].anchors, (anchors_t{{1, 14, 14, 10}, {1, 28, 28, 10}}));
+    EXPECT_EQ(chains[1].score, 10);
+}
+
+TEST(chain_anchors, max_gap)
+{
+    anchors_t anchors{{0, 0, 0, 20}, {0, 30, 30, 20}};
+
+    EXPECT_EQ(seqan3::chain_anchors(anchors, cfg::gap_cost_linear{0.25}).size(), 1u);
+    EXPECT_EQ(seqan3::chain_anchors(anchors, cfg::gap_cost_linear{0.25} | cfg::max_gap{9}).size(), 2u);
+    EXPECT_EQ(seqan3::chain_anchors(anchors, cfg::gap_cost_linear{0.25} | cfg::max_gap{9} | cfg::look_back{}).size(),
+              2u);
+}
+
+TEST(chain_anchors, min_score)
+{
+    anchors_t anchors{{0, 30, 28, 10}, {0, 100, 5, 10}, {0, 0, 0, 10}, {0, 14, 14, 10}};
+
+    auto chains = seqan3::chain_anchors(anchors, cfg::min_score{15});
+    ASSERT_EQ(chains.size(), 1u);
+    EXPECT_EQ(chains[0].score, 21);
+}
+
+TEST(chain_anchors, look_back_count)
+{
+    // The anchor between the chained anchors cannot be chained with either of them.
+    anchors_t anchors{{0, 0, 0, 10}, {0, 11, 100, 5}, {0, 12, 12, 10}};
+
+    EXPECT_EQ(seqan3::chain_anchors(anchors).front().score, 18);
+    EXPECT_EQ(seqan3::chain_anchors(anchors, cfg::look_back{2}).front().score, 18);
+    EXPECT_EQ(seqan3::chain_anchors(anchors, cfg::look_back{1}).front().score, 10);
+}
+
+TEST(chain_anchors, gap_cost_log)
+{
+    anchors_t anchors{{0, 0, 0, 10}, {0, 20, 22, 10}};
+
+    // The gap difference is 2 and the average span 10.
+    auto chains = seqan3::chain_anchors(anchors, cfg::gap_cost_log{} | cfg::look_back{});
+    ASSERT_EQ(chains.size(), 1u);
+    EXPECT_DOUBLE_EQ(chains[0].score, 20 - (0.01 * 10 * 2 + 0.5 * 1));
+
+    // Gaps of the same length are free.
+    anchors = anchors_t{{0, 0, 0, 10}, {0, 50, 50, 10}};
+    chains = seqan3::chain_anchors(anchors, cfg::gap_cost_log{0.02, 1.0} | cfg::look_back{});
+    ASSERT_EQ(chains.size(), 1u);
+    EXPECT_EQ(chains[0].score, 20);
+}
+
+TEST(chain_anchors, range_maximum_and_look_back)
+{
+    for (size_t seed = 0; seed < 10; ++seed)
+    {
+        anchors_t anchors = generate_anchors(seed);
+        for (size_t max_gap : {50u, 5000u})
+        {
+            double const expected = best_score(anchors, 0.5, max_gap);
+
+            auto chains = seqan3::chain_anchors(anchors, cfg::max_gap{max_gap});
+            auto look_back_chains = seqan3::chain_anchors(anchors, cfg::max_gap{max_gap} | cfg::look_back{1000});
+            ASSERT_FALSE(chains.empty());
+            ASSERT_FALSE(look_back_chains.empty());
+            EXPECT_EQ(chains.front().score, expected);
+            EXPECT_EQ(look_back_chains.front().score, expected);
+            EXPECT_EQ(validate_chain(chains.front(), 0.5, max_gap), expected);
+            EXPECT_EQ(validate_chain(look_back_chains.front(), 0.5, max_gap), expected);
+
+            // Every anchor is reported in at most one chain.
+            size_t anchor_count = 0;
+            for (seqan3::anchor_chain const & chain : chains)
+            {
+                anchor_count += chain.anchors.size();
+                validate_chain(chain, 0.5, max_gap);
+            }
+            EXPECT_LE(anchor_count, anchors.size());
+            EXPECT_TRUE(std::ranges::is_sorted(chains, std::ranges::greater{}, &seqan3::anchor_chain::score));
+        }
+    }
+}
+
+TEST(chain_anchors, batch)
+{
+    std::vector<anchors_t> anchor_sets{};
+    for (size_t seed = 0; seed < 20; ++seed)
+        anchor_sets.push_back(generate_anchors(seed));
+
+    auto chains = seqan3::chain_anchors(anchor_sets);
+    auto parallel_chains = seqan3::chain_anchors(anchor_sets, cfg::parallel{4});
+    ASSERT_EQ(chains.size(), anchor_sets.size());
+    ASSERT_EQ(parallel_chains.size(), anchor_sets.size());
+
+    for (size_t i = 0; i < anchor_sets.size(); ++i)
+    {
+        EXPECT_TRUE(chains[i] == seqan3::chain_anchors(anchor_sets[i]));
+        EXPECT_TRUE(parallel_chains[i] == chains[i]);
+    }
+
+    EXPECT_THROW(seqan3::chain_anchors(anchor_sets, cfg::parallel{}), std::runtime_error);
+}
@@ -0,0 +1,59 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/search/database_search/configuration/all.hpp>
+#include <seqan3/utility/type_list/traits.hpp>
+
+#include "../../core/configuration/pipeable_config_element_test_template.hpp"
+
+// Define some aliases to make the list below more readable.
+namespace cfg = seqan3::database_cfg;
+
+// A list of config types to test, associated with their incompatible config classes defined as a taboo list.
+// We later use this taboo list to generate a configuration object containing only the valid combinations for each
+// test type.
+using database_config_and_taboo_types =
+    seqan3::type_list<std::pair<cfg::min_score, seqan3::type_list<cfg::min_score>>,
+                      std::pair<cfg::parallel, seqan3::type_list<cfg::parallel>>,
+                      std::pair<cfg::top_k, seqan3::type_list<cfg::top_k>>>;
+
+// The pure list of configuration elements to instantiate the typed test case with.
+using database_config_types = pure_config_type_list<database_config_and_taboo_types>;
+
+template <typename config_t>
+class test_fixture
+{
+public:
+    // The actual config type that is tested.
+    using config_type = config_t;
+
+    // The taboo list associated with the given TypeParam element.
+    using taboo_list_type = typename seqan3::list_traits::at<
+        seqan3::list_traits::find<config_t, database_config_types>, // determine the index
+        database_config_and_taboo_types>::second_type;                // extract the taboo list.
+
+    // A compatible configuration type for the current configuration element to test.
+    using compatible_configuration_type = make_pipeable_configuration<database_config_types, taboo_list_type>;
+
+    // The type of the configuration element ids.
+    using config_id_type = seqan3::detail::database_config_id;
+
+    // NOTE: You must update this number if you add a new entity to seqan3::detail::database_config_id.
+    // config_count is used to check that the config size is correct.
+    // And don't forget to add the new config into the above test fixture (via database_config_and_taboo_types).
+    static constexpr int8_t config_count = 3;
+};
+
+// Configuration element type list as gtest suitable testing::Types
+using fixture_types = seqan3::list_traits::transform<test_fixture, database_config_types>;
+using test_types = seqan3::detail::transfer_template_args_onto_t<fixture_types, ::testing::Types>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(database_configuration_test, pipeable_config_element_test, test_types, );
@@ -0,0 +1,239 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2022, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2022, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/container/concatenated_sequences.hpp>
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/search/database_search/all.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using namespace seqan3::literals;
+
+namespace cfg = seqan3::database_cfg;
+
+using sequences_t = std::vector<seqan3::aa27_vector>;
+
+// Random protein sequences; the database spans more than one block of the prefilter.
+sequences_t generate_sequences(size_t const count, size_t const seed)
+{
+    std::mt19937_64 generator{seed};
+    std::uniform_int_distribution<size_t> length{10, 60};
+    std::uniform_int_distribution<uint8_t> rank{0, 25};
+
+    sequences_t sequences(count);
+    for (seqan3::aa27_vector & sequence : sequences)
+        for (size_t i = length(generator); i > 0; --i)
+            sequence.push_back(seqan3::assign_rank_to(rank(generator), seqan3::aa27{}));
+
+    return sequences;
+}
+
+auto const score_config = seqan3::align_cfg::scoring_scheme{seqan3::aminoacid_scoring_scheme{
+                              seqan3::aminoacid_similarity_matrix::blosum62}}
+                        | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                             seqan3::align_cfg::extension_score{-1}};
+
+auto const global_config = seqan3::align_cfg::method_global{} | score_config;
+auto const local_config = seqan3::align_cfg::method_local{} | score_config;
+auto const semi_global_config =
+    seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                     seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                     seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                     seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+    | score_config;
+
+struct expected_hit
+{
+    int32_t score;
+    size_t database_id;
+};
+
+// Computes the best hits of every query by aligning it with every database sequence.
+template <typename config_t>
+std::vector<std::vector<expected_hit>> brute_force(sequences_t const & queries,
+                                                   sequences_t const & database,
+                                                   config_t const & config,
+                                                   size_t const top_k,
+                                                   int32_t const min_score)
+{
+    std::vector<std::vector<expected_hit>> expected(queries.size());
+    for (size_t query_id = 0; query_id < queries.size(); ++query_id)
+    {
+        for (size_t database_id = 0; database_id < database.size(); ++database_id)
+        {
+            auto results = seqan3::align_pairwise(std::tie(database[database_id], queries[query_id]),
+                                                  config | seqan3::align_cfg::output_score{});
+            int32_t const score = (*results.begin()).score();
+            if (score >= min_score)
+                expected[query_id].push_back(expected_hit{score, database_id});
+        }
+
+        std::ranges::sort(expected[query_id],
+                          [](expected_hit const & lhs, expected_hit const & rhs)
+                          {
+                              return std::tie(rhs.score, lhs.database_id) < std::tie(lhs.score, rhs.database_id);
+                          });
+        expected[query_id].resize(std::min(expected[query_id].size(), top_k));
+    }
+    return expected;
+}
+
+template <typename hits_t>
+void expect_hits(hits_t const & hits, std::vector<std::vector<expected_hit>> const & expected)
+{
+    ASSERT_EQ(hits.size(), expected.size());
+    for (size_t query_id = 0; query_id < hits.size(); ++query_id)
+    {
+        ASSERT_EQ(hits[query_id].size(), expected[query_id].size());
+        for (size_t i = 0; i < hits[query_id].size(); ++i)
+        {
+            EXPECT_EQ(hits[query_id][i].database_id, expected[query_id][i].database_id);
+            EXPECT_EQ(hits[query_id][i].alignment.score(), expected[query_id][i].score);
+        }
+    }
+}
+
+class search_database_test : public ::testing::Test
+{
+public:
+    sequences_t const queries = generate_sequences(4, 0);
+    sequences_t const database = generate_sequences(3000, 1);
+};
+
+TEST_F(search_database_test, global)
+{
+    expect_hits(seqan3::search_database(queries, database, global_config),
+                brute_force(queries, database, global_config, 10, std::numeric_limits<int32_t>::lowest()));
+}
+
+TEST_F(search_database_test, local)
+{
+    expect_hits(seqan3::search_database(queries, database, local_config, cfg::top_k{25}),
+                brute_force(queries, database, local_config, 25, std::numeric_limits<int32_t>::lowest()));
+}
+
+TEST_F(search_database_test, free_end_gaps)
+{
+    expect_hits(seqan3::search_database(queries, database, semi_global_config, cfg::top_k{5}),
+                brute_force(queries, database, semi_global_config, 5, std::numeric_limits<int32_t>::lowest()));
+}
+
+TEST_F(search_database_test, min_score)
+{
+    auto expected = brute_force(queries, database, local_config, database.size(), 30);
+    expect_hits(seqan3::search_database(queries, database, local_config, cfg::min_score{30} | cfg::top_k{3000}),
+                expected);
+
+    // Without seqan3::database_cfg::top_k, the 10 best hits of the default configuration are reported.
+    EXPECT_TRUE(std::ranges::any_of(expected,
+                                    [](std::vector<expected_hit> const & query_hits)
+                                    {
+                                        return query_hits.size() > 10;
+                                    }));
+    for (std::vector<expected_hit> & query_hits : expected)
+        query_hits.resize(std::min<size_t>(query_hits.size(), 10));
+
+    expect_hits(seqan3::search_database(queries, database, local_config, cfg::min_score{30}), expected);
+
+    for (std::vector<expected_hit> & query_hits : expected)
+        query_hits.resize(std::min<size_t>(query_hits.size(), 3));
+
+    expect_hits(seqan3::search_database(queries, database, local_config, cfg::min_score{30} | cfg::top_k{3}),
+                expected);
+}
+
+TEST_F(search_database_test, top_k_zero)
+{
+    auto hits = seqan3::search_database(queries, database, local_config, cfg::top_k{0});
+    ASSERT_EQ(hits.size(), queries.size());
+    for (auto const & query_hits : hits)
+        EXPECT_TRUE(query_hits.empty());
+}
+
+TEST_F(search_database_test, parallel)
+{
+    auto expected = brute_force(queries, database, local_config, 10, std::numeric_limits<int32_t>::lowest());
+    expect_hits(seqan3::search_database(queries, database, local_config, cfg::top_k{} | cfg::parallel{4}), expected);
+
+    EXPECT_THROW(seqan3::search_database(queries, database, local_config, cfg::parallel{}), std::runtime_error);
+}
+
+TEST_F(search_database_test, concatenated_sequences)
+{
+    seqan3::concatenated_sequences<seqan3::aa27_vector> concatenated_database{};
+    for (seqan3::aa27_vector const & sequence : database)
+        concatenated_database.push_back(sequence);
+
+    std::list<seqan3::aa27_vector> query_list{queries.begin(), queries.end()};
+
+    expect_hits(seqan3::search_database(query_list, concatenated_database, global_config),
+                brute_force(queries, database, global_config, 10, std::numeric_limits<int32_t>::lowest()));
+}
+
+TEST_F(search_database_test, default_output)
+{
+    auto hits = seqan3::search_database(queries, database, global_config, cfg::top_k{1});
+    ASSERT_EQ(hits.size(), queries.size());
+
+    for (size_t query_id = 0; query_id < queries.size(); ++query_id)
+    {
+        ASSERT_EQ(hits[query_id].size(), 1u);
+        auto & alignment = hits[query_id][0].alignment;
+        auto results = seqan3::align_pairwise(std::tie(database[hits[query_id][0].database_id], queries[query_id]),
+                                              global_config);
+        auto expected = *results.begin();
+
+        EXPECT_EQ(alignment.score(), expected.score());
+        EXPECT_EQ(alignment.sequence1_end_position(), expected.sequence1_end_position());
+        EXPECT_EQ(alignment.sequence2_end_position(), expected.sequence2_end_position());
+        EXPECT_RANGE_EQ(std::get<0>(alignment.alignment()), std::get<0>(expected.alignment()));
+        EXPECT_RANGE_EQ(std::get<1>(alignment.alignment()), std::get<1>(expected.alignment()));
+    }
+}
+
+TEST_F(search_database_test, configured_output)
+{
+    auto hits = seqan3::search_database(queries,
+                                        database,
+                                        local_config | seqan3::align_cfg::output_end_position{},
+                                        cfg::top_k{3});
+    ASSERT_EQ(hits.size(), queries.size());
+
+    for (size_t query_id = 0; query_id < queries.size(); ++query_id)
+    {
+        ASSERT_EQ(hits[query_id].size(), 3u);
+        for (auto const & hit : hits[query_id])
+        {
+            auto results = seqan3::align_pairwise(std::tie(database[hit.database_id], queries[query_id]),
+                                                  local_config | seqan3::align_cfg::output_end_position{});
+            auto expected = *results.begin();
+
+            EXPECT_EQ(hit.alignment.sequence1_end_position(), expected.sequence1_end_position());
+            EXPECT_EQ(hit.alignment.sequence2_end_position(), expected.sequence2_end_position());
+        }
+    }
+}
+
+TEST_F(search_database_test, empty)
+{
+    EXPECT_TRUE(seqan3::search_database(sequences_t{}, database, global_config).empty());
+
+    auto hits = seqan3::search_database(queries, sequences_t{}, global_config);
+    ASSERT_EQ(hits.size(), queries.size());
+    for (auto const & query_hits : hits)
+        EXPECT_TRUE(query_hits.empty());
+}